@@ -13,7 +13,14 @@
  * 7. WS2812 RGB LED状态指示
  *    - 未连接：蓝色闪烁（1秒间隔）
  *    - 已连接未播放：蓝色长亮
- *    - 播放中：绿色呼吸灯效果
+ *    - 播放中：绿色呼吸灯效果（可选随音乐变化）
+ *    - 灯效任务播放预计算关键帧，RMT异步发送
+ * 8. QMI8658A姿态感知
+ *    - 倒置时左右声道互换，平放/侧放时单声道，切换时交叉淡化
+ *    - 双击播放/暂停，摇晃下一曲
+ * 9. 电池电量监测
+ *    - 负载补偿后查开路电压表估算电量，检测充电状态
+ *    - 低电量或电压跌落时降低最大音量和LED亮度
  *
  * 硬件连接：
  * PCM5102 DAC模块：
@@ -29,6 +36,7 @@
  *   - IO0  -> BOOT按钮（连按5下恢复出厂设置）
  *   - IO34 -> 音量控制ADC输入（可选）
  *   - IO12 -> WS2812 RGB LED数据引脚
+ *   - IO39 -> 电池电压ADC输入（1:2分压，可选）
  *
  * 使用方法：
  * 1. 首次开机进入蓝牙广播模式（蓝色闪烁）
@@ -43,8 +51,12 @@
  * - src/bluetooth_manager.* - 蓝牙管理模块
  * - src/volume_control.*  - 音量控制模块
  * - src/led_control.*     - LED控制模块
+ * - src/led_effects.*     - LED灯效引擎
  * - src/button_handler.*  - 按钮处理模块
  * - src/config_manager.*  - 配置管理模块
+ * - src/imu_orientation.* - IMU姿态融合和手势模块
+ * - src/i2c_bus.*         - I2C总线事务调度模块
+ * - src/battery_monitor.* - 电池电量监测模块
  *
  * @author ESP-AI Team
  * @date 2024
@@ -58,7 +70,10 @@
 #include "src/led_control.h"
 #include "src/button_handler.h"
 #include "src/config_manager.h"
+#include "src/i2c_bus.h"
 #include "src/pca9554_handler.h"
+#include "src/imu_orientation.h"
+#include "src/battery_monitor.h"
 
 // ==================== 初始化函数 ====================
 void setup() {
@@ -73,6 +88,7 @@ void setup() {
   initVolumeControl();    // 初始化音量控制
   initLedControl();       // 初始化LED控制
   initButtonHandler();    // 初始化按钮处理
+  initBatteryMonitor();   // 初始化电池监测（低电量时调暗LED）
 
   // 初始化蓝牙A2DP（会自动配置I2S）
   initBluetooth(BT_DEVICE_NAME);
@@ -83,6 +99,9 @@ void setup() {
   // 设置A2DP音频数据回调
   getA2DPSink()->set_stream_reader(read_data_stream, false);
 
+  // 初始化I2C总线任务（PCA9554和QMI8658A的事务都由它排队执行）
+  initI2CBus();
+
   // 初始化PCA9554 IO扩展芯片
   if (initPCA9554Handler()) {
     Serial.println("PCA9554 初始化成功");
@@ -90,6 +109,9 @@ void setup() {
     Serial.println("PCA9554 初始化失败，跳过IO扩展功能");
   }
 
+  // 初始化IMU姿态感知（与PCA9554共用I2C总线）
+  initImuOrientation();
+
   Serial.println("========================================");
   Serial.println("PCM5102音箱已启动");
   Serial.printf("蓝牙设备名称: %s\n", BT_DEVICE_NAME);
@@ -111,6 +133,12 @@ void loop() {
   // 更新PCA9554状态
   updatePCA9554();
 
+  // 姿态融合、声道切换和手势
+  updateImuOrientation();
+
+  // 电池电量和功率限制
+  updateBatteryMonitor();
+
   // 定期打印状态信息
   static unsigned long lastStatusPrint = 0;
   unsigned long currentTime = millis();
@@ -121,6 +149,25 @@ void loop() {
                   isAudioPlaying() ? "播放中" : "暂停",
                   getCurrentVolume(),
                   conn_state == ESP_A2D_CONNECTION_STATE_CONNECTING ? "重连中" : "空闲");
+    AudioLevelMeter::levels_t levels;
+    if (isAudioPlaying() && getAudioLevels(levels)) {
+      Serial.printf("电平 - 峰值: L %.1f / R %.1f dBFS, RMS: L %.1f / R %.1f dBFS\n",
+                    levels.peakDb[0], levels.peakDb[1], levels.rmsDb[0], levels.rmsDb[1]);
+    }
+    Serial.printf("姿态 - 竖直: %.2f, 融合CPU占用: %.2f%%\n", getImuUprightness(), getImuFusionLoad());
+    i2c_bus_stats_t bus;
+    getI2CBusStats(bus);
+    Serial.printf("I2C - 占用: %.1f%%, 事务: %u/%u/%u, 错误: %u, 拒绝: %u, 最长排队: %uus\n",
+                  bus.utilization, (unsigned)bus.transactions[I2C_BUS_PRIO_HIGH],
+                  (unsigned)bus.transactions[I2C_BUS_PRIO_NORMAL], (unsigned)bus.transactions[I2C_BUS_PRIO_LOW],
+                  (unsigned)bus.errors, (unsigned)bus.rejected, (unsigned)bus.maxWaitUs);
+    battery_status_t battery;
+    getBatteryStatus(battery);
+    if (battery.present) {
+      Serial.printf("电池 - 电压: %.2fV, 开路: %.2fV, 电量: %d%%, 负载: %umA, %s, 增益上限: %.2f, 跌落: %u\n",
+                    battery.voltageMv / 1000.0f, battery.ocvMv / 1000.0f, battery.soc, (unsigned)battery.loadMa,
+                    battery.charging ? "充电中" : "放电中", battery.gainLimit, (unsigned)battery.sagCount);
+    }
     lastStatusPrint = currentTime;
   }
 
@@ -13,6 +13,26 @@
 // 当前音量（内部变量）
 static float currentVolume = DEFAULT_VOLUME;
 
+// 增益上限比例（电池电量低或电压跌落时由电池监测模块降低）
+static volatile float gainLimit = 1.0f;
+
+// 电平表（在A2DP回调中写入，其他任务读取快照）
+static AudioLevelMeter levelMeter;
+
+// 声道矩阵 (Q15)：L' = m[0]*L + m[1]*R, R' = m[2]*L + m[3]*R
+// 请求的模式由其他任务写入，音频回调在下一块开始淡化，每帧开销固定
+#define CHANNEL_FADE_FRAMES (I2S_SAMPLE_RATE * CHANNEL_FADE_MS / 1000)
+static const int32_t channelMatrix[3][4] = {
+  {32768, 0, 0, 32768},         // 立体声
+  {0, 32768, 32768, 0},         // 左右互换
+  {16384, 16384, 16384, 16384}  // 单声道
+};
+static volatile uint8_t requestedChannelMode = AUDIO_CHANNEL_STEREO;
+static uint8_t activeChannelMode = AUDIO_CHANNEL_STEREO;
+static int32_t mixMatrix[4] = {32768, 0, 0, 32768};
+static int32_t mixStep[4] = {0, 0, 0, 0};
+static int32_t fadeFramesLeft = 0;
+
 /**
  * 配置PCM5102 MUTE引脚
  * 注意：ESP32-A2DP库会自动初始化I2S驱动和引脚
@@ -36,6 +56,9 @@ void setI2Smute(bool mute) {
  * 音频数据流处理回调函数
  */
 void read_data_stream(const uint8_t *data, uint32_t length) {
+  // 电平测量（音量调节之前，每20ms计算一次）
+  levelMeter.process((const int16_t*)data, length / 4, 2);
+
   if (currentVolume >= 0.0 && length > 0) {
     // 创建临时缓冲区用于音量调整
     uint8_t* tempBuffer = (uint8_t*)malloc(length);
@@ -44,14 +67,42 @@ void read_data_stream(const uint8_t *data, uint32_t length) {
       int16_t* audioData = (int16_t*)tempBuffer;
       int samples = length / 2;
 
-      // 应用音量控制（限制最大增益）
-      float effectiveVolume = currentVolume * VOLUME_MAX_GAIN;
+      // 应用音量控制（限制最大增益，低电量时进一步降低）
+      float effectiveVolume = currentVolume * VOLUME_MAX_GAIN * gainLimit;
       if (effectiveVolume > VOLUME_MAX_GAIN) {
         effectiveVolume = VOLUME_MAX_GAIN;
       }
 
-      for (int i = 0; i < samples; i++) {
-        audioData[i] = (int16_t)(audioData[i] * effectiveVolume);
+      // 声道模式变化：从当前矩阵线性淡化到新矩阵，经过中间的混合状态不会有爆音
+      uint8_t mode = requestedChannelMode;
+      if (mode != activeChannelMode) {
+        activeChannelMode = mode;
+        for (int k = 0; k < 4; k++) {
+          mixStep[k] = (channelMatrix[mode][k] - mixMatrix[k]) / CHANNEL_FADE_FRAMES;
+        }
+        fadeFramesLeft = CHANNEL_FADE_FRAMES;
+      }
+
+      int32_t volume = (int32_t)(effectiveVolume * 32768);
+      int frames = samples / 2;
+      if (fadeFramesLeft == 0 && activeChannelMode == AUDIO_CHANNEL_STEREO) {
+        for (int i = 0; i < samples; i++) {
+          audioData[i] = (int16_t)((audioData[i] * volume) >> 15);
+        }
+      } else {
+        for (int i = 0; i < frames; i++) {
+          if (fadeFramesLeft > 0) {
+            for (int k = 0; k < 4; k++) mixMatrix[k] += mixStep[k];
+            // 最后一帧对齐目标，消除步长的截断误差
+            if (--fadeFramesLeft == 0) memcpy(mixMatrix, channelMatrix[activeChannelMode], sizeof(mixMatrix));
+          }
+          int32_t left = audioData[2 * i];
+          int32_t right = audioData[2 * i + 1];
+          int32_t outLeft = (left * mixMatrix[0] + right * mixMatrix[1]) >> 15;
+          int32_t outRight = (left * mixMatrix[2] + right * mixMatrix[3]) >> 15;
+          audioData[2 * i] = (int16_t)((outLeft * volume) >> 15);
+          audioData[2 * i + 1] = (int16_t)((outRight * volume) >> 15);
+        }
       }
 
       // 输出到I2S
@@ -83,3 +134,39 @@ float getAudioVolume() {
   return currentVolume;
 }
 
+/**
+ * 设置电平表采样率
+ */
+void setAudioLevelSampleRate(uint16_t rate) {
+  levelMeter.setSampleRate(rate);
+}
+
+/**
+ * 获取最近一个块的音频电平
+ */
+bool getAudioLevels(AudioLevelMeter::levels_t& levels) {
+  return levelMeter.getLevels(levels);
+}
+
+/**
+ * 设置声道模式
+ */
+void setAudioChannelMode(audio_channel_mode_t mode) {
+  requestedChannelMode = (uint8_t)mode;
+}
+
+/**
+ * 设置增益上限比例
+ */
+void setAudioGainLimit(float scale) {
+  if (scale < 0.0f) scale = 0.0f;
+  if (scale > 1.0f) scale = 1.0f;
+  gainLimit = scale;
+}
+
+/**
+ * 获取增益上限比例
+ */
+float getAudioGainLimit() {
+  return gainLimit;
+}
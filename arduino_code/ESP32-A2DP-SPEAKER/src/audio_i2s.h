@@ -12,6 +12,16 @@
 
 #include <Arduino.h>
 #include "driver/i2s.h"
+#include <AudioLevelMeter.h>
+
+/**
+ * 声道模式（由IMU姿态模块根据音箱朝向设置）
+ */
+typedef enum {
+  AUDIO_CHANNEL_STEREO = 0,   // 正常立体声
+  AUDIO_CHANNEL_SWAPPED,      // 左右互换
+  AUDIO_CHANNEL_MONO          // 单声道 (L+R)/2
+} audio_channel_mode_t;
 
 /**
  * 初始化I2S硬件
@@ -42,6 +52,47 @@ void setAudioVolume(float volume);
  */
 float getAudioVolume();
 
+/**
+ * 设置电平表采样率
+ * 由A2DP采样率变化回调调用
+ *
+ * @param rate 采样率（Hz）
+ */
+void setAudioLevelSampleRate(uint16_t rate);
+
+/**
+ * 获取最近一个块（20ms）的音频电平
+ * 无锁快照，可在任意任务中调用（LED、显示屏等）
+ *
+ * @param levels 峰值/RMS（线性值和dBFS）
+ * @return true=有效, false=尚未收到音频数据
+ */
+bool getAudioLevels(AudioLevelMeter::levels_t& levels);
+
+/**
+ * 设置声道模式
+ * 音频回调在CHANNEL_FADE_MS内交叉淡化到新的声道矩阵，可在任意任务中调用
+ *
+ * @param mode 声道模式
+ */
+void setAudioChannelMode(audio_channel_mode_t mode);
+
+/**
+ * 设置增益上限比例
+ * 在VOLUME_MAX_GAIN基础上再乘以该比例，由电池监测模块在低电量或电压跌落时降低，
+ * 避免低音峰值的大电流把电池电压拉到欠压复位。下一个音频块生效
+ *
+ * @param scale 比例 (0.0 - 1.0)
+ */
+void setAudioGainLimit(float scale);
+
+/**
+ * 获取增益上限比例
+ *
+ * @return 比例 (0.0 - 1.0)
+ */
+float getAudioGainLimit();
+
 #endif // AUDIO_I2S_H
 
 void setI2Smute(bool mute);
@@ -0,0 +1,287 @@
+/**
+ * 电池监测模块实现
+ *
+ * 每BATTERY_SAMPLE_INTERVAL读取BATTERY_OVERSAMPLE次ADC取平均
+ * （analogReadMilliVolts使用eFuse中的校准值），得到端电压：
+ *   - 端电压直接用于跌落检测，低于BATTERY_SAG_MV立即降低增益上限
+ *   - 端电压加上估计电流 × 内阻得到开路电压，指数滤波后查表得到电量。
+ *     电流由音量和电平表快照估计，播放时电量不会随低音忽高忽低
+ * 增益上限 = 电量比例 × 跌落比例，跌落比例在无跌落时缓慢恢复。
+ *
+ * @author ESP-AI Team
+ * @date 2024
+ */
+
+#include "battery_monitor.h"
+#include "audio_i2s.h"
+#include "led_effects.h"
+#include "userconfig.h"
+
+// 单节锂电池开路电压-电量表，0%到100%每5%一点 (mV)
+static const uint16_t ocvTable[21] = {
+  3270, 3610, 3690, 3710, 3730, 3750, 3770, 3790, 3800, 3820, 3840,
+  3850, 3870, 3910, 3950, 3980, 4020, 4080, 4110, 4150, 4200
+};
+
+static battery_status_t status;
+static battery_event_callback_t eventCallback = NULL;
+static bool monitorReady = false;
+
+// 滤波状态
+static float voltageFiltered = 0.0f;
+static float ocvFiltered = 0.0f;
+static unsigned long lastSample = 0;
+
+// 充电趋势窗口
+static unsigned long chargeWindowStart = 0;
+static float chargeWindowMv = 0.0f;
+
+// 功率限制
+static float sagScale = 1.0f;
+static unsigned long lastSag = 0;
+static bool lowArmed = true;
+static bool criticalArmed = true;
+static bool ledDimmed = false;
+
+/**
+ * 开路电压查表，相邻两点线性插值
+ */
+static uint8_t ocvToSoc(uint16_t mv) {
+  if (mv <= ocvTable[0]) {
+    return 0;
+  }
+  if (mv >= ocvTable[20]) {
+    return 100;
+  }
+  int i = 0;
+  while (mv >= ocvTable[i + 1]) {
+    i++;
+  }
+  return i * 5 + (mv - ocvTable[i]) * 5 / (ocvTable[i + 1] - ocvTable[i]);
+}
+
+/**
+ * 读取电池端电压（过采样平均）
+ */
+static uint16_t readBatteryMv() {
+  uint32_t sum = 0;
+  for (int i = 0; i < BATTERY_OVERSAMPLE; i++) {
+    sum += analogReadMilliVolts(BATTERY_ADC_PIN);
+  }
+  return (uint16_t)(sum / BATTERY_OVERSAMPLE * BATTERY_DIVIDER_RATIO);
+}
+
+/**
+ * 估计负载电流：静态电流 + 按输出功率折算的功放电流
+ */
+static uint16_t estimateLoadMa() {
+  float load = BATTERY_IDLE_MA;
+  AudioLevelMeter::levels_t levels;
+  // 电平快照超过100ms没有更新说明没有音频输出
+  if (getAudioLevels(levels) && millis() - levels.time < 100) {
+    float rms = max(levels.rms[0], levels.rms[1]) / 32768.0f;
+    float gain = getAudioVolume() * VOLUME_MAX_GAIN * getAudioGainLimit();
+    // 满幅正弦的均方值为0.5
+    load += BATTERY_AUDIO_FULL_MA * (rms * gain) * (rms * gain) / 0.5f;
+  }
+  return (uint16_t)load;
+}
+
+/**
+ * 发布事件
+ */
+static void publishEvent(battery_event_t event) {
+  static const char* names[] = {"电压跌落", "低电量", "电量严重不足", "开始充电", "停止充电"};
+  Serial.printf("电池事件: %s (%.2fV, %d%%, 增益上限 %.2f)\n", names[event],
+                status.voltageMv / 1000.0f, status.soc, status.gainLimit);
+  if (eventCallback != NULL) {
+    eventCallback(event, status);
+  }
+}
+
+/**
+ * 更新充电状态
+ */
+static void updateCharging(unsigned long now) {
+  bool charging;
+#if BATTERY_CHARGE_PIN >= 0
+  charging = digitalRead(BATTERY_CHARGE_PIN) == LOW;
+#else
+  // 没有状态引脚：端电压高于充电阈值，或一个窗口内持续上升
+  charging = status.charging;
+  if (voltageFiltered >= BATTERY_CHARGE_MV) {
+    charging = true;
+  }
+  if (now - chargeWindowStart >= BATTERY_CHARGE_WINDOW_MS) {
+    float delta = voltageFiltered - chargeWindowMv;
+    if (delta >= BATTERY_CHARGE_RISE_MV) {
+      charging = true;
+    } else if (delta < 0 && voltageFiltered < BATTERY_CHARGE_MV) {
+      charging = false;
+    }
+    chargeWindowStart = now;
+    chargeWindowMv = voltageFiltered;
+  }
+#endif
+
+  if (charging != status.charging) {
+    status.charging = charging;
+    publishEvent(charging ? BATTERY_EVENT_CHARGING : BATTERY_EVENT_DISCHARGING);
+  }
+}
+
+/**
+ * 按电量和跌落状态更新音频增益上限和LED亮度
+ */
+static void applyPowerLimits(bool sagged, unsigned long now) {
+  // 跌落：每BATTERY_SAG_HOLD_MS最多降一级，给功放电流下降留出时间
+  bool sagStep = sagged && now - lastSag >= BATTERY_SAG_HOLD_MS;
+  if (sagStep) {
+    lastSag = now;
+    sagScale *= BATTERY_SAG_STEP;
+    if (sagScale < BATTERY_SAG_MIN_SCALE) {
+      sagScale = BATTERY_SAG_MIN_SCALE;
+    }
+    status.sagCount++;
+  } else if (!sagged && now - lastSag >= BATTERY_SAG_HOLD_MS && sagScale < 1.0f) {
+    sagScale += BATTERY_SAG_RECOVER;
+    if (sagScale > 1.0f) {
+      sagScale = 1.0f;
+    }
+  }
+
+  // 电量：低于BATTERY_LIMIT_SOC线性降低，充电时由充电器供电，不按电量限制
+  float socScale = 1.0f;
+  if (!status.charging && status.soc < BATTERY_LIMIT_SOC) {
+    socScale = BATTERY_MIN_GAIN_SCALE + (1.0f - BATTERY_MIN_GAIN_SCALE) * status.soc / BATTERY_LIMIT_SOC;
+  }
+
+  float limit = socScale * sagScale;
+  if (fabs(limit - status.gainLimit) >= 0.005f || (limit == 1.0f && status.gainLimit != 1.0f)) {
+    status.gainLimit = limit;
+    setAudioGainLimit(limit);
+  }
+  if (sagStep) {
+    publishEvent(BATTERY_EVENT_SAG);
+  }
+
+  // LED：低电量时调暗，回升5%后恢复
+  bool dim = !status.charging && (ledDimmed ? status.soc < BATTERY_LOW_SOC + 5 : status.soc < BATTERY_LOW_SOC);
+  if (dim != ledDimmed) {
+    uint8_t brightness = dim ? (uint8_t)(LED_BRIGHTNESS * BATTERY_LOW_LED_SCALE) : LED_BRIGHTNESS;
+    // 命令队列满时下次采样重试
+    if (setLedBrightness(brightness)) {
+      ledDimmed = dim;
+    }
+  }
+}
+
+/**
+ * 低电量事件，回升5%后重新触发
+ */
+static void updateSocEvents() {
+  if (status.charging) {
+    return;
+  }
+  if (status.soc < BATTERY_LOW_SOC && lowArmed) {
+    lowArmed = false;
+    publishEvent(BATTERY_EVENT_LOW);
+  } else if (status.soc >= BATTERY_LOW_SOC + 5) {
+    lowArmed = true;
+  }
+  if (status.soc < BATTERY_CRITICAL_SOC && criticalArmed) {
+    criticalArmed = false;
+    publishEvent(BATTERY_EVENT_CRITICAL);
+  } else if (status.soc >= BATTERY_CRITICAL_SOC + 5) {
+    criticalArmed = true;
+  }
+}
+
+/**
+ * 初始化电池监测
+ */
+bool initBatteryMonitor() {
+  status.present = false;
+  status.charging = false;
+  status.voltageMv = 0;
+  status.ocvMv = 0;
+  status.loadMa = 0;
+  status.soc = 0;
+  status.gainLimit = 1.0f;
+  status.sagCount = 0;
+
+#if BATTERY_ADC_PIN < 0
+  Serial.println("未配置电池ADC引脚，跳过电池监测");
+  return false;
+#else
+  pinMode(BATTERY_ADC_PIN, INPUT);
+  analogSetPinAttenuation(BATTERY_ADC_PIN, ADC_11db);
+#if BATTERY_CHARGE_PIN >= 0
+  pinMode(BATTERY_CHARGE_PIN, INPUT_PULLUP);
+#endif
+
+  // 用第一次读数初始化滤波器，开机即得到准确电量
+  uint16_t mv = readBatteryMv();
+  if (mv < BATTERY_PRESENT_MV) {
+    Serial.printf("未检测到电池 (%dmV)，跳过电池监测\n", mv);
+    return false;
+  }
+  voltageFiltered = mv;
+  ocvFiltered = mv + estimateLoadMa() * BATTERY_RINT_MOHM / 1000.0f;
+  chargeWindowStart = millis();
+  chargeWindowMv = voltageFiltered;
+  lastSample = millis();
+
+  status.present = true;
+  status.voltageMv = mv;
+  status.ocvMv = (uint16_t)ocvFiltered;
+  status.soc = ocvToSoc(status.ocvMv);
+  monitorReady = true;
+
+  Serial.printf("电池监测已初始化: %.2fV, 电量 %d%%\n", mv / 1000.0f, status.soc);
+  return true;
+#endif
+}
+
+/**
+ * 采样并更新电量、充电状态和功率限制
+ */
+void updateBatteryMonitor() {
+  unsigned long now = millis();
+  if (!monitorReady || now - lastSample < BATTERY_SAMPLE_INTERVAL) {
+    return;
+  }
+  lastSample = now;
+
+  uint16_t mv = readBatteryMv();
+  uint16_t loadMa = estimateLoadMa();
+
+  // 端电压：快速滤波只去掉ADC噪声，跌落检测用未滤波的读数
+  voltageFiltered += (mv - voltageFiltered) * 0.25f;
+  // 开路电压：补偿负载压降后慢速滤波
+  float ocv = mv + loadMa * BATTERY_RINT_MOHM / 1000.0f;
+  ocvFiltered += (ocv - ocvFiltered) * BATTERY_SOC_ALPHA;
+
+  status.voltageMv = (uint16_t)voltageFiltered;
+  status.ocvMv = (uint16_t)ocvFiltered;
+  status.loadMa = loadMa;
+  status.soc = ocvToSoc(status.ocvMv);
+
+  updateCharging(now);
+  applyPowerLimits(mv < BATTERY_SAG_MV, now);
+  updateSocEvents();
+}
+
+/**
+ * 获取电池状态
+ */
+void getBatteryStatus(battery_status_t& out) {
+  out = status;
+}
+
+/**
+ * 注册电池事件回调
+ */
+void setBatteryEventCallback(battery_event_callback_t callback) {
+  eventCallback = callback;
+}
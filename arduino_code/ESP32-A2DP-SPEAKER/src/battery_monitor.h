@@ -0,0 +1,77 @@
+/**
+ * 电池监测模块头文件
+ *
+ * 单节锂电池电量计：过采样ADC（eFuse校准）、负载补偿后的开路电压查表得到电量、
+ * 指数滤波和充电检测。低电量和电压跌落时降低音频增益上限和LED亮度，
+ * 避免低音峰值把电池电压拉到欠压复位
+ *
+ * @author ESP-AI Team
+ * @date 2024
+ */
+
+#ifndef BATTERY_MONITOR_H
+#define BATTERY_MONITOR_H
+
+#include <Arduino.h>
+
+/**
+ * 电池事件
+ */
+typedef enum {
+  BATTERY_EVENT_SAG = 0,      // 电压跌落，已降低增益上限
+  BATTERY_EVENT_LOW,          // 电量降到BATTERY_LOW_SOC以下
+  BATTERY_EVENT_CRITICAL,     // 电量降到BATTERY_CRITICAL_SOC以下
+  BATTERY_EVENT_CHARGING,     // 开始充电
+  BATTERY_EVENT_DISCHARGING   // 停止充电
+} battery_event_t;
+
+/**
+ * 电池状态
+ */
+typedef struct {
+  bool present;         // 检测到电池
+  bool charging;        // 充电中
+  uint16_t voltageMv;   // 端电压（滤波后）(mV)
+  uint16_t ocvMv;       // 负载补偿后的开路电压估计 (mV)
+  uint16_t loadMa;      // 估计负载电流 (mA)
+  uint8_t soc;          // 电量 (%)
+  float gainLimit;      // 当前音频增益上限比例
+  uint32_t sagCount;    // 电压跌落次数
+} battery_status_t;
+
+/**
+ * 电池事件回调，在主循环中执行
+ *
+ * @param event 事件
+ * @param status 事件发生时的电池状态
+ */
+typedef void (*battery_event_callback_t)(battery_event_t event, const battery_status_t& status);
+
+/**
+ * 初始化电池监测（需在initLedControl之后调用）
+ *
+ * @return true=检测到电池, false=未配置引脚或未检测到电池，不做限制
+ */
+bool initBatteryMonitor();
+
+/**
+ * 采样并更新电量、充电状态和功率限制
+ * 应在主循环中调用，每BATTERY_SAMPLE_INTERVAL采样一次
+ */
+void updateBatteryMonitor();
+
+/**
+ * 获取电池状态
+ *
+ * @param status 输出状态
+ */
+void getBatteryStatus(battery_status_t& status);
+
+/**
+ * 注册电池事件回调
+ *
+ * @param callback 回调函数，NULL=取消
+ */
+void setBatteryEventCallback(battery_event_callback_t callback);
+
+#endif // BATTERY_MONITOR_H
@@ -9,6 +9,7 @@
 
 #include "bluetooth_manager.h"
 #include "config_manager.h"
+#include "audio_i2s.h"
 #include "userconfig.h"
 
 // 蓝牙A2DP Sink对象
@@ -58,6 +59,9 @@ void initBluetooth(const char* deviceName) {
   a2dp_sink.set_on_connection_state_changed(connection_state_changed);
   a2dp_sink.set_on_audio_state_changed(audio_state_changed);
 
+  // 采样率变化时同步电平表
+  a2dp_sink.set_sample_rate_callback(setAudioLevelSampleRate);
+
   // 启动A2DP蓝牙接收器（会自动初始化I2S）
   a2dp_sink.start(deviceName);
 
@@ -0,0 +1,300 @@
+/**
+ * I2C总线管理模块实现
+ *
+ * 每个优先级一个FreeRTOS队列，总线任务是唯一使用Wire的任务：
+ * 被通知后按优先级取出事务执行，每个事务结束后重新从最高优先级开始取，
+ * 长时间的低优先级传输最多让高优先级事务多等一个事务
+ *
+ * @author ESP-AI Team
+ * @date 2024
+ */
+
+#include "i2c_bus.h"
+#include "userconfig.h"
+#include <Wire.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+
+// 排队中的事务
+typedef struct {
+  uint8_t addr;
+  uint8_t txLen;
+  uint8_t rxLen;
+  uint8_t tx[I2C_BUS_MAX_TX];
+  uint8_t* rx;
+  i2c_bus_callback_t callback;
+  void* arg;
+  uint32_t queuedUs;
+} i2c_txn_t;
+
+// 同步事务的等待状态，位于调用者栈上
+typedef struct {
+  SemaphoreHandle_t done;
+  bool ok;
+} i2c_sync_t;
+
+static QueueHandle_t txnQueues[I2C_BUS_PRIO_COUNT] = {NULL};
+static TaskHandle_t busTask = NULL;
+
+// 统计，总线任务写入，getI2CBusStats读取并清零
+static portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;
+static i2c_bus_stats_t stats;
+static uint32_t statsSinceUs = 0;
+
+/**
+ * 组装事务
+ */
+static bool IRAM_ATTR buildTxn(i2c_txn_t& txn, uint8_t addr, const uint8_t* tx, uint8_t txLen,
+                               uint8_t* rx, uint8_t rxLen, i2c_bus_callback_t callback, void* arg) {
+  if (txLen > I2C_BUS_MAX_TX || rxLen > I2C_BUS_MAX_RX || (rxLen > 0 && rx == NULL)) {
+    return false;
+  }
+  txn.addr = addr;
+  txn.txLen = txLen;
+  txn.rxLen = rxLen;
+  for (uint8_t i = 0; i < txLen; i++) {
+    txn.tx[i] = tx[i];
+  }
+  txn.rx = rx;
+  txn.callback = callback;
+  txn.arg = arg;
+  txn.queuedUs = micros();
+  return true;
+}
+
+/**
+ * 在总线上执行一个事务
+ */
+static bool executeTxn(const i2c_txn_t& txn) {
+  // 只读事务直接requestFrom；有写入时读操作用重复起始条件，中间不释放总线
+  if (txn.txLen > 0 || txn.rxLen == 0) {
+    Wire.beginTransmission(txn.addr);
+    if (txn.txLen > 0) {
+      Wire.write(txn.tx, txn.txLen);
+    }
+    if (txn.rxLen == 0) {
+      return Wire.endTransmission() == 0;
+    }
+    Wire.endTransmission(false);
+  }
+  if (Wire.requestFrom(txn.addr, txn.rxLen) != txn.rxLen) {
+    return false;
+  }
+  Wire.readBytes(txn.rx, txn.rxLen);
+  return true;
+}
+
+/**
+ * 按优先级取出下一个事务
+ */
+static bool takeNextTxn(i2c_txn_t& txn, int& prio) {
+  for (prio = 0; prio < I2C_BUS_PRIO_COUNT; prio++) {
+    if (xQueueReceive(txnQueues[prio], &txn, 0) == pdTRUE) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * 执行事务并计入统计
+ */
+static bool runTxn(const i2c_txn_t& txn, int prio) {
+  uint32_t start = micros();
+  bool ok = executeTxn(txn);
+  uint32_t end = micros();
+
+  portENTER_CRITICAL(&statsMux);
+  stats.transactions[prio]++;
+  stats.bytes += txn.txLen + txn.rxLen;
+  stats.busyUs += end - start;
+  if (start - txn.queuedUs > stats.maxWaitUs) {
+    stats.maxWaitUs = start - txn.queuedUs;
+  }
+  if (!ok) {
+    stats.errors++;
+  }
+  portEXIT_CRITICAL(&statsMux);
+
+  if (txn.callback != NULL) {
+    txn.callback(ok, txn.arg);
+  }
+  return ok;
+}
+
+/**
+ * 总线任务
+ */
+static void i2cBusTask(void* param) {
+  i2c_txn_t txn;
+  int prio;
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    // 取完所有队列再等待，期间新提交的事务会留下通知，不会丢失
+    while (takeNextTxn(txn, prio)) {
+      runTxn(txn, prio);
+    }
+  }
+}
+
+/**
+ * 同步事务的完成回调
+ */
+static void syncDone(bool ok, void* arg) {
+  i2c_sync_t* sync = (i2c_sync_t*)arg;
+  sync->ok = ok;
+  xSemaphoreGive(sync->done);
+}
+
+/**
+ * 统计队列满被拒绝的事务
+ */
+static void IRAM_ATTR countRejected() {
+  portENTER_CRITICAL_SAFE(&statsMux);
+  stats.rejected++;
+  portEXIT_CRITICAL_SAFE(&statsMux);
+}
+
+/**
+ * 初始化I2C总线和总线任务
+ */
+bool initI2CBus() {
+  if (busTask != NULL) {
+    return true;
+  }
+
+  Wire.begin(I2C_SDA_PIN, I2C_SCL_PIN, I2C_FREQ);
+
+  for (int i = 0; i < I2C_BUS_PRIO_COUNT; i++) {
+    txnQueues[i] = xQueueCreate(I2C_BUS_QUEUE_LEN, sizeof(i2c_txn_t));
+    if (txnQueues[i] == NULL) {
+      Serial.println("I2C总线队列创建失败");
+      return false;
+    }
+  }
+
+  statsSinceUs = micros();
+  if (xTaskCreatePinnedToCore(i2cBusTask, "i2c_bus", 3072, NULL, I2C_BUS_TASK_PRIORITY,
+                              &busTask, I2C_BUS_TASK_CORE) != pdPASS) {
+    busTask = NULL;
+    Serial.println("I2C总线任务创建失败");
+    return false;
+  }
+
+  Serial.printf("I2C总线已初始化: SDA=%d, SCL=%d, %dkHz\n", I2C_SDA_PIN, I2C_SCL_PIN, I2C_FREQ / 1000);
+  return true;
+}
+
+/**
+ * 提交异步事务
+ */
+bool i2cBusSubmit(uint8_t addr, const uint8_t* tx, uint8_t txLen, uint8_t* rx, uint8_t rxLen,
+                  i2c_bus_priority_t prio, i2c_bus_callback_t callback, void* arg) {
+  i2c_txn_t txn;
+  if (busTask == NULL || prio >= I2C_BUS_PRIO_COUNT ||
+      !buildTxn(txn, addr, tx, txLen, rx, rxLen, callback, arg)) {
+    return false;
+  }
+  if (xQueueSendToBack(txnQueues[prio], &txn, 0) != pdTRUE) {
+    countRejected();
+    return false;
+  }
+  xTaskNotifyGive(busTask);
+  return true;
+}
+
+/**
+ * 在中断中提交异步事务
+ */
+bool IRAM_ATTR i2cBusSubmitFromISR(uint8_t addr, const uint8_t* tx, uint8_t txLen, uint8_t* rx, uint8_t rxLen,
+                                   i2c_bus_priority_t prio, i2c_bus_callback_t callback, void* arg) {
+  i2c_txn_t txn;
+  if (busTask == NULL || prio >= I2C_BUS_PRIO_COUNT ||
+      !buildTxn(txn, addr, tx, txLen, rx, rxLen, callback, arg)) {
+    return false;
+  }
+  BaseType_t woken = pdFALSE;
+  if (xQueueSendToBackFromISR(txnQueues[prio], &txn, &woken) != pdTRUE) {
+    countRejected();
+    return false;
+  }
+  vTaskNotifyGiveFromISR(busTask, &woken);
+  if (woken) {
+    portYIELD_FROM_ISR();
+  }
+  return true;
+}
+
+/**
+ * 同步事务
+ */
+bool i2cBusTransfer(uint8_t addr, const uint8_t* tx, uint8_t txLen, uint8_t* rx, uint8_t rxLen,
+                    i2c_bus_priority_t prio) {
+  if (busTask == NULL || prio >= I2C_BUS_PRIO_COUNT) {
+    return false;
+  }
+
+  // 在总线任务自身（回调）中调用时直接执行，避免等待自己
+  if (xTaskGetCurrentTaskHandle() == busTask) {
+    i2c_txn_t txn;
+    if (!buildTxn(txn, addr, tx, txLen, rx, rxLen, NULL, NULL)) {
+      return false;
+    }
+    return runTxn(txn, prio);
+  }
+
+  StaticSemaphore_t doneBuffer;
+  i2c_sync_t sync;
+  sync.done = xSemaphoreCreateBinaryStatic(&doneBuffer);
+  sync.ok = false;
+
+  i2c_txn_t txn;
+  if (!buildTxn(txn, addr, tx, txLen, rx, rxLen, syncDone, &sync)) {
+    return false;
+  }
+  // 队列满时稍后重试，同步调用者宁可等待也不丢事务
+  while (xQueueSendToBack(txnQueues[prio], &txn, 0) != pdTRUE) {
+    vTaskDelay(1);
+  }
+  xTaskNotifyGive(busTask);
+  // 信号量在调用者栈上，必须等到回调执行完才能返回；Wire自带超时，不会永久阻塞
+  xSemaphoreTake(sync.done, portMAX_DELAY);
+  return sync.ok;
+}
+
+/**
+ * 同步写一个寄存器
+ */
+bool i2cBusWriteReg(uint8_t addr, uint8_t reg, uint8_t value, i2c_bus_priority_t prio) {
+  uint8_t tx[2] = {reg, value};
+  return i2cBusTransfer(addr, tx, 2, NULL, 0, prio);
+}
+
+/**
+ * 同步读一个寄存器
+ */
+bool i2cBusReadReg(uint8_t addr, uint8_t reg, uint8_t* value, i2c_bus_priority_t prio) {
+  return i2cBusTransfer(addr, &reg, 1, value, 1, prio);
+}
+
+/**
+ * 检测设备是否应答
+ */
+bool i2cBusProbe(uint8_t addr) {
+  return i2cBusTransfer(addr, NULL, 0, NULL, 0, I2C_BUS_PRIO_LOW);
+}
+
+/**
+ * 获取总线统计并开始新的统计周期
+ */
+void getI2CBusStats(i2c_bus_stats_t& out) {
+  uint32_t now = micros();
+  portENTER_CRITICAL(&statsMux);
+  out = stats;
+  memset(&stats, 0, sizeof(stats));
+  portEXIT_CRITICAL(&statsMux);
+
+  uint32_t elapsed = now - statsSinceUs;
+  statsSinceUs = now;
+  out.utilization = elapsed ? out.busyUs * 100.0f / elapsed : 0.0f;
+}
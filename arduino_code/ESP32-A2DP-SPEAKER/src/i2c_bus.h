@@ -0,0 +1,124 @@
+/**
+ * I2C总线管理模块头文件
+ *
+ * 所有I2C外设（PCA9554、QMI8658A等）的读写都提交为事务，由一个总线任务
+ * 按优先级依次执行，完成后回调通知。调用者不再直接使用Wire，互不阻塞，
+ * 主循环也不会被I2C等待卡住
+ *
+ * @author ESP-AI Team
+ * @date 2024
+ */
+
+#ifndef I2C_BUS_H
+#define I2C_BUS_H
+
+#include <Arduino.h>
+
+// 单个事务最多写入的字节数（寄存器地址 + 数据）
+#define I2C_BUS_MAX_TX 8
+
+// 单个事务最多读取的字节数（ESP32 Wire缓冲区为128字节）
+#define I2C_BUS_MAX_RX 128
+
+/**
+ * 事务优先级，总线空闲时先执行高优先级队列中的事务
+ */
+typedef enum {
+  I2C_BUS_PRIO_HIGH = 0,    // 传感器数据（IMU FIFO读取）
+  I2C_BUS_PRIO_NORMAL,      // 按键、IO扩展
+  I2C_BUS_PRIO_LOW,         // 配置、后台任务
+  I2C_BUS_PRIO_COUNT
+} i2c_bus_priority_t;
+
+/**
+ * 事务完成回调，在总线任务中执行，应尽快返回
+ * 不要在回调中调用i2cBusTransfer等同步函数
+ *
+ * @param ok 事务是否成功（收到ACK且读满rxLen字节）
+ * @param arg 提交时传入的参数
+ */
+typedef void (*i2c_bus_callback_t)(bool ok, void* arg);
+
+/**
+ * 总线统计（自上次调用getI2CBusStats以来）
+ */
+typedef struct {
+  uint32_t transactions[I2C_BUS_PRIO_COUNT];  // 各优先级完成的事务数
+  uint32_t errors;        // 失败的事务数
+  uint32_t rejected;      // 队列已满被拒绝的事务数
+  uint32_t bytes;         // 传输的数据字节数（不含地址字节）
+  uint32_t busyUs;        // 总线忙碌时间 (微秒)
+  uint32_t maxWaitUs;     // 事务最长排队时间 (微秒)
+  float utilization;      // 总线占用率 (%)
+} i2c_bus_stats_t;
+
+/**
+ * 初始化I2C总线和总线任务
+ * 需在所有I2C外设初始化之前调用
+ *
+ * @return true=成功, false=任务或队列创建失败
+ */
+bool initI2CBus();
+
+/**
+ * 提交异步事务：先写tx，再以重复起始条件读rxLen字节到rx
+ * tx会被复制，rx在回调前必须保持有效
+ *
+ * @param addr 7位I2C地址
+ * @param tx 写入数据，txLen为0时可为NULL
+ * @param txLen 写入字节数 (0 ~ I2C_BUS_MAX_TX)
+ * @param rx 读取缓冲区，rxLen为0时可为NULL
+ * @param rxLen 读取字节数 (0 ~ I2C_BUS_MAX_RX)
+ * @param prio 优先级
+ * @param callback 完成回调，可为NULL
+ * @param arg 回调参数
+ * @return true=已入队, false=队列已满或参数无效
+ */
+bool i2cBusSubmit(uint8_t addr, const uint8_t* tx, uint8_t txLen, uint8_t* rx, uint8_t rxLen,
+                  i2c_bus_priority_t prio, i2c_bus_callback_t callback, void* arg);
+
+/**
+ * 在中断中提交异步事务，参数同i2cBusSubmit
+ */
+bool i2cBusSubmitFromISR(uint8_t addr, const uint8_t* tx, uint8_t txLen, uint8_t* rx, uint8_t rxLen,
+                         i2c_bus_priority_t prio, i2c_bus_callback_t callback, void* arg);
+
+/**
+ * 同步事务：提交后阻塞调用任务直到完成，只阻塞调用者，不阻塞其他外设
+ * 等待时间由Wire超时限定
+ *
+ * @return true=成功
+ */
+bool i2cBusTransfer(uint8_t addr, const uint8_t* tx, uint8_t txLen, uint8_t* rx, uint8_t rxLen,
+                    i2c_bus_priority_t prio);
+
+/**
+ * 同步写一个寄存器
+ *
+ * @return true=成功
+ */
+bool i2cBusWriteReg(uint8_t addr, uint8_t reg, uint8_t value, i2c_bus_priority_t prio);
+
+/**
+ * 同步读一个寄存器
+ *
+ * @return true=成功
+ */
+bool i2cBusReadReg(uint8_t addr, uint8_t reg, uint8_t* value, i2c_bus_priority_t prio);
+
+/**
+ * 检测设备是否应答
+ *
+ * @param addr 7位I2C地址
+ * @return true=设备存在
+ */
+bool i2cBusProbe(uint8_t addr);
+
+/**
+ * 获取总线统计并开始新的统计周期
+ *
+ * @param stats 输出统计
+ */
+void getI2CBusStats(i2c_bus_stats_t& stats);
+
+#endif // I2C_BUS_H
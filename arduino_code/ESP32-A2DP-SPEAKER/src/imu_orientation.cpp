@@ -0,0 +1,294 @@
+/**
+ * IMU姿态模块实现
+ *
+ * QMI8658A工作在FIFO模式（约224Hz），后台任务在中断后经I2C总线任务批量读取，
+ * 本模块在主循环中从无锁环形缓冲区取采样，做定点Mahony融合：
+ *   - 四元数和单位向量用Q30定点（1.0 = 1<<30），乘法用64位中间结果
+ *   - 只有加速度模长接近1g时才用重力校正，摇晃/敲击时只积分陀螺仪
+ *   - 只用到重力方向，不做积分项（陀螺零偏只带来很小的倾角误差）
+ * 重力在“上”轴上的分量决定声道模式，新模式保持ORIENTATION_HOLD_MS才生效，
+ * 切换由音频回调做交叉淡化。加速度模长的峰值序列用于手势识别。
+ *
+ * @author ESP-AI Team
+ * @date 2024
+ */
+
+#include "imu_orientation.h"
+#include "audio_i2s.h"
+#include "bluetooth_manager.h"
+#include "i2c_bus.h"
+#include "userconfig.h"
+#include <QMI8658A.h>
+
+// QMI8658A 对象
+static QMI8658A imu;
+static bool imuReady = false;
+
+// 采样参数：±4g、±512dps、gyro_odr_norm_250（实际224.2Hz）
+#define IMU_ONE_G             8192      // 1g 的原始值
+#define IMU_GYRO_DPS_PER_LSB  (512.0 / 32768.0)
+#define IMU_SAMPLE_PERIOD_US  4460
+#define IMU_BOOT_SAMPLES      448       // 启动后2秒用10倍增益快速收敛
+
+// Q30 定点
+#define Q30_ONE   (1L << 30)
+#define Q30_HALF  (1L << 29)
+#define Q30(x)    ((int32_t)((x) * Q30_ONE))
+
+static inline int32_t mulQ30(int32_t a, int32_t b) {
+  return (int32_t)(((int64_t)a * b) >> 30);
+}
+
+// 姿态四元数和估计的重力方向（传感器坐标）
+static int32_t q0 = Q30_ONE, q1 = 0, q2 = 0, q3 = 0;
+static int32_t gravity[3] = {0, 0, Q30_ONE};
+
+// 每个采样周期、每LSB陀螺仪转过的半角（Q40），Kp * dt（Q30）
+static int32_t gyroHalfAngle = 0;
+static int32_t kpDt = 0;
+static int32_t kpDtBoot = 0;
+static uint32_t bootSamples = IMU_BOOT_SAMPLES;
+
+// 声道模式：候选模式保持足够久才生效
+static audio_channel_mode_t appliedMode = AUDIO_CHANNEL_STEREO;
+static audio_channel_mode_t candidateMode = AUDIO_CHANNEL_STEREO;
+static uint32_t candidateSinceUs = 0;
+
+// 手势：加速度模长偏离1g的峰值计数
+static bool inPeak = false;
+static uint8_t peakCount = 0;
+static uint32_t lastPeakUs = 0;
+static uint32_t lastGestureUs = 0;
+
+// CPU占用统计
+static uint32_t busyUs = 0;
+static uint32_t loadSinceUs = 0;
+
+/**
+ * 32位整数平方根
+ */
+static uint32_t isqrt32(uint32_t x) {
+  uint32_t root = 0;
+  uint32_t bit = 1UL << 30;
+  while (bit > x) bit >>= 2;
+  while (bit) {
+    if (x >= root + bit) {
+      x -= root + bit;
+      root = (root >> 1) + bit;
+    } else {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+  return root;
+}
+
+/**
+ * Mahony融合一个采样
+ *
+ * @return 加速度模长（原始值）
+ */
+static uint32_t fuseSample(const int16_t acc[3], const int16_t gyro[3]) {
+  // 陀螺仪转过的半角
+  int32_t hx = (int32_t)(((int64_t)gyro[0] * gyroHalfAngle) >> 10);
+  int32_t hy = (int32_t)(((int64_t)gyro[1] * gyroHalfAngle) >> 10);
+  int32_t hz = (int32_t)(((int64_t)gyro[2] * gyroHalfAngle) >> 10);
+
+  uint32_t norm2 = (uint32_t)((int32_t)acc[0] * acc[0]) + (uint32_t)((int32_t)acc[1] * acc[1])
+                 + (uint32_t)((int32_t)acc[2] * acc[2]);
+  uint32_t norm = isqrt32(norm2);
+
+  // 只有接近1g（静止或慢速移动）时加速度才代表重力方向
+  if (norm > IMU_ONE_G * 4 / 5 && norm < IMU_ONE_G * 6 / 5) {
+    int32_t ax = (int32_t)(((int64_t)acc[0] << 30) / norm);
+    int32_t ay = (int32_t)(((int64_t)acc[1] << 30) / norm);
+    int32_t az = (int32_t)(((int64_t)acc[2] << 30) / norm);
+
+    // 估计的重力方向的一半
+    int32_t halfvx = mulQ30(q1, q3) - mulQ30(q0, q2);
+    int32_t halfvy = mulQ30(q0, q1) + mulQ30(q2, q3);
+    int32_t halfvz = mulQ30(q0, q0) - Q30_HALF + mulQ30(q3, q3);
+
+    // 误差 = 测量方向 × 估计方向
+    int32_t halfex = mulQ30(ay, halfvz) - mulQ30(az, halfvy);
+    int32_t halfey = mulQ30(az, halfvx) - mulQ30(ax, halfvz);
+    int32_t halfez = mulQ30(ax, halfvy) - mulQ30(ay, halfvx);
+
+    int32_t kp = bootSamples ? kpDtBoot : kpDt;
+    hx += mulQ30(halfex, kp);
+    hy += mulQ30(halfey, kp);
+    hz += mulQ30(halfez, kp);
+  }
+  if (bootSamples) bootSamples--;
+
+  // 四元数积分
+  int32_t qa = q0, qb = q1, qc = q2;
+  q0 += -mulQ30(qb, hx) - mulQ30(qc, hy) - mulQ30(q3, hz);
+  q1 += mulQ30(qa, hx) + mulQ30(qc, hz) - mulQ30(q3, hy);
+  q2 += mulQ30(qa, hy) - mulQ30(qb, hz) + mulQ30(q3, hx);
+  q3 += mulQ30(qa, hz) + mulQ30(qb, hy) - mulQ30(qc, hx);
+
+  // 归一化：模长接近1，一步牛顿迭代 1/sqrt(n) ≈ 1.5 - 0.5n 足够
+  int32_t n2 = mulQ30(q0, q0) + mulQ30(q1, q1) + mulQ30(q2, q2) + mulQ30(q3, q3);
+  int32_t scale = 3 * Q30_HALF - (n2 >> 1);
+  q0 = mulQ30(q0, scale);
+  q1 = mulQ30(q1, scale);
+  q2 = mulQ30(q2, scale);
+  q3 = mulQ30(q3, scale);
+
+  gravity[0] = 2 * (mulQ30(q1, q3) - mulQ30(q0, q2));
+  gravity[1] = 2 * (mulQ30(q0, q1) + mulQ30(q2, q3));
+  gravity[2] = mulQ30(q0, q0) - mulQ30(q1, q1) - mulQ30(q2, q2) + mulQ30(q3, q3);
+
+  return norm;
+}
+
+/**
+ * 根据竖直程度选择声道模式（带迟滞）
+ */
+static audio_channel_mode_t classifyOrientation(int32_t up, audio_channel_mode_t current) {
+  if (up > Q30(0.7)) return AUDIO_CHANNEL_STEREO;   // 正放
+  if (up < -Q30(0.7)) return AUDIO_CHANNEL_SWAPPED; // 倒置，左右互换
+  if (up < Q30(0.5) && up > -Q30(0.5)) return AUDIO_CHANNEL_MONO; // 平放或侧放
+  return current;
+}
+
+/**
+ * 更新声道模式
+ */
+static void updateChannelMode(uint32_t timestampUs) {
+  int32_t up = gravity[IMU_UP_AXIS] * IMU_UP_SIGN;
+  audio_channel_mode_t mode = classifyOrientation(up, candidateMode);
+
+  if (mode != candidateMode) {
+    candidateMode = mode;
+    candidateSinceUs = timestampUs;
+  } else if (candidateMode != appliedMode
+             && timestampUs - candidateSinceUs >= ORIENTATION_HOLD_MS * 1000UL) {
+    appliedMode = candidateMode;
+    setAudioChannelMode(appliedMode);
+    Serial.printf("音箱朝向变化: %s\n", appliedMode == AUDIO_CHANNEL_STEREO ? "正放，立体声" :
+                  appliedMode == AUDIO_CHANNEL_SWAPPED ? "倒置，左右互换" : "平放/侧放，单声道");
+  }
+}
+
+/**
+ * 手势检测：加速度模长偏离1g的峰值，静止GESTURE_QUIET_MS后按峰值数判断
+ *   2个峰值 -> 双击，播放/暂停
+ *   4个以上 -> 摇晃，下一曲
+ */
+static void updateGesture(uint32_t norm, uint32_t timestampUs) {
+  int32_t dev = abs((int32_t)norm - IMU_ONE_G);
+
+  if (!inPeak && dev > (int32_t)(GESTURE_PEAK_G * IMU_ONE_G)) {
+    inPeak = true;
+    // 同一次敲击的回弹不重复计数
+    if (peakCount == 0 || timestampUs - lastPeakUs > GESTURE_DEBOUNCE_MS * 1000UL) {
+      if (peakCount < 255) peakCount++;
+    }
+    lastPeakUs = timestampUs;
+  } else if (inPeak && dev < (int32_t)(GESTURE_QUIET_G * IMU_ONE_G)) {
+    inPeak = false;
+    lastPeakUs = timestampUs;
+  }
+
+  if (inPeak || peakCount == 0 || timestampUs - lastPeakUs < GESTURE_QUIET_MS * 1000UL) {
+    return;
+  }
+
+  if (lastGestureUs == 0 || timestampUs - lastGestureUs > GESTURE_COOLDOWN_MS * 1000UL) {
+    if (peakCount == 2) {
+      Serial.println("手势: 双击 - 播放/暂停");
+      togglePlayPause();
+      lastGestureUs = timestampUs;
+    } else if (peakCount >= 4) {
+      Serial.println("手势: 摇晃 - 下一曲");
+      nextTrack();
+      lastGestureUs = timestampUs;
+    }
+  }
+  peakCount = 0;
+}
+
+/**
+ * QMI8658A的总线访问：FIFO任务同步等待自己的事务，不阻塞其他外设
+ */
+static bool imuBusTransfer(byte addr, const uint8_t* tx, uint8_t txLen, uint8_t* rx, uint8_t rxLen, void* arg) {
+  return i2cBusTransfer(addr, tx, txLen, rx, rxLen, I2C_BUS_PRIO_HIGH);
+}
+
+/**
+ * 初始化IMU
+ */
+bool initImuOrientation() {
+  // 检测IMU是否存在（I2C总线由initI2CBus初始化）
+  if (!i2cBusProbe(IMU_ADDR)) {
+    Serial.println("未检测到QMI8658A，跳过姿态功能");
+    return false;
+  }
+
+  imu.setTransfer(imuBusTransfer);
+  imu.begin(IMU_ADDR);
+  imu.setAccScale(acc_scale_4g);
+  imu.setGyroScale(gyro_scale_512dps);
+  imu.setAccODR(acc_odr_norm_250);
+  imu.setGyroODR(gyro_odr_norm_250);
+
+  // FIFO每8个采样（约36ms）中断一次，读取任务放在核心1，不与蓝牙音频抢核心0
+  if (!imu.beginFifo(IMU_INT_PIN, 1, 8, 1)) {
+    Serial.println("QMI8658A FIFO启动失败，跳过姿态功能");
+    return false;
+  }
+
+  double dt = IMU_SAMPLE_PERIOD_US / 1000000.0;
+  gyroHalfAngle = (int32_t)(IMU_GYRO_DPS_PER_LSB * PI / 180.0 * dt / 2 * (double)(1LL << 40));
+  kpDt = Q30(IMU_FUSION_KP * dt);
+  kpDtBoot = kpDt * 10;
+
+  loadSinceUs = micros();
+  imuReady = true;
+  Serial.printf("QMI8658A已初始化: 224Hz FIFO, INT=%d, 上轴=%c%c\n", IMU_INT_PIN,
+                IMU_UP_SIGN > 0 ? '+' : '-', 'X' + IMU_UP_AXIS);
+  return true;
+}
+
+/**
+ * 处理FIFO中的新采样
+ */
+void updateImuOrientation() {
+  if (!imuReady || imu.sampleAvailable() == 0) {
+    return;
+  }
+
+  uint32_t start = micros();
+  qmi8658_sample_t sample;
+  bool fresh = false;
+  while (imu.readSample(&sample)) {
+    uint32_t norm = fuseSample(sample.acc, sample.gyro);
+    updateGesture(norm, sample.timestamp_us);
+    fresh = true;
+  }
+  if (fresh) {
+    updateChannelMode(sample.timestamp_us);
+  }
+  busyUs += micros() - start;
+}
+
+/**
+ * 获取音箱竖直程度
+ */
+float getImuUprightness() {
+  return (float)(gravity[IMU_UP_AXIS] * IMU_UP_SIGN) / Q30_ONE;
+}
+
+/**
+ * 获取姿态融合的CPU占用
+ */
+float getImuFusionLoad() {
+  uint32_t now = micros();
+  uint32_t elapsed = now - loadSinceUs;
+  float load = elapsed ? busyUs * 100.0f / elapsed : 0.0f;
+  busyUs = 0;
+  loadSinceUs = now;
+  return load;
+}
@@ -0,0 +1,44 @@
+/**
+ * IMU姿态模块头文件
+ *
+ * QMI8658A FIFO采样 + 定点Mahony姿态融合，根据音箱朝向切换声道
+ * （正放立体声、倒置左右互换、平放/侧放单声道），并检测敲击/摇晃手势
+ *
+ * @author ESP-AI Team
+ * @date 2024
+ */
+
+#ifndef IMU_ORIENTATION_H
+#define IMU_ORIENTATION_H
+
+#include <Arduino.h>
+
+/**
+ * 初始化IMU（需在initPCA9554Handler之后调用，共用I2C总线）
+ *
+ * @return true=成功, false=未检测到IMU，跳过姿态功能
+ */
+bool initImuOrientation();
+
+/**
+ * 处理FIFO中的新采样：姿态融合、声道切换、手势检测
+ * 应在主循环中调用，不访问I2C，不阻塞
+ */
+void updateImuOrientation();
+
+/**
+ * 获取音箱竖直程度
+ *
+ * @return 重力在“上”轴上的分量 (-1.0 倒置 ~ 1.0 正放)
+ */
+float getImuUprightness();
+
+/**
+ * 获取姿态融合的CPU占用
+ * 自上次调用以来updateImuOrientation的耗时占比
+ *
+ * @return CPU占用 (%)
+ */
+float getImuFusionLoad();
+
+#endif // IMU_ORIENTATION_H
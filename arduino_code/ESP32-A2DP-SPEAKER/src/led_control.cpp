@@ -8,79 +8,65 @@
  */
 
 #include "led_control.h"
+#include "led_effects.h"
 #include "userconfig.h"
-#include <Adafruit_NeoPixel.h>
 
-// WS2812 RGB LED对象
-static Adafruit_NeoPixel rgbLed(WS2812_LED_COUNT, WS2812_PIN, NEO_GRB + NEO_KHZ800);
+// LED状态：未连接 / 已连接未播放 / 播放中
+typedef enum {
+  LED_STATE_UNKNOWN = 0,
+  LED_STATE_DISCONNECTED,
+  LED_STATE_CONNECTED,
+  LED_STATE_PLAYING
+} led_state_t;
 
-// LED控制变量
-static unsigned long lastLedUpdate = 0;
-static int breathBrightness = 0;
-static int breathDirection = 1;
-static bool ledBlinkState = false;
+static led_state_t ledState = LED_STATE_UNKNOWN;
 
 /**
  * 初始化LED控制模块
  */
 void initLedControl() {
-  rgbLed.begin();
-  // rgbLed.setBrightness(LED_B/GHTNESS);
-  rgbLed.setPixelColor(0, rgbLed.Color(LED_COLOR_BLUE));  // 启动时显示蓝色
-  rgbLed.show();
+  if (!initLedEffects()) {
+    return;
+  }
+  setLedEffect(LED_FX_SOLID, LED_COLOR_BLUE);  // 启动时显示蓝色
   Serial.println("WS2812 RGB LED已初始化");
 }
 
 /**
  * 更新LED状态显示
+ * 动画由灯效任务播放，这里只在状态变化时提交一次命令
  */
 void updateRgbLed(bool connected, bool playing) {
-  unsigned long currentTime = millis();
-
+  led_state_t state;
   if (!connected) {
-    // 状态1: 未连接 - 蓝色闪烁，间隔1秒
-    if (currentTime - lastLedUpdate >= LED_BLINK_INTERVAL) {
-      lastLedUpdate = currentTime;
-      ledBlinkState = !ledBlinkState;
-
-      if (ledBlinkState) {
-        rgbLed.setPixelColor(0, rgbLed.Color(LED_COLOR_BLUE));  // 蓝色
-        rgbLed.setBrightness(LED_BRIGHTNESS);
-      } else {
-        rgbLed.setPixelColor(0, rgbLed.Color(LED_COLOR_OFF));    // 熄灭
-      }
-      rgbLed.show();
-    }
+    state = LED_STATE_DISCONNECTED;
+  } else if (!playing) {
+    state = LED_STATE_CONNECTED;
+  } else {
+    state = LED_STATE_PLAYING;
   }
-  else if (connected && !playing) {
-    // 状态2: 已连接但未播放 - 蓝色长亮
-    if (currentTime - lastLedUpdate >= 100) {
-      lastLedUpdate = currentTime;
-      rgbLed.setPixelColor(0, rgbLed.Color(LED_COLOR_BLUE));    // 蓝色
-      rgbLed.setBrightness(LED_BRIGHTNESS);
-      rgbLed.show();
-    }
+  if (state == ledState) {
+    return;
   }
-  else if (connected && playing) {
-    // 状态3: 播放中 - 绿色呼吸灯效果
-    if (currentTime - lastLedUpdate >= LED_BREATH_INTERVAL) {
-      lastLedUpdate = currentTime;
 
-      // 更新呼吸亮度
-      breathBrightness += breathDirection * LED_BREATH_STEP;
+  bool posted = false;
+  switch (state) {
+    case LED_STATE_DISCONNECTED:
+      // 状态1: 未连接 - 蓝色闪烁，间隔1秒
+      posted = setLedEffect(LED_FX_BLINK, LED_COLOR_BLUE);
+      break;
+    case LED_STATE_CONNECTED:
+      // 状态2: 已连接但未播放 - 蓝色长亮
+      posted = setLedEffect(LED_FX_SOLID, LED_COLOR_BLUE);
+      break;
+    default:
+      // 状态3: 播放中 - 绿色呼吸灯或随音乐变化
+      posted = setLedEffect(LED_PLAYING_EFFECT, LED_COLOR_GREEN);
+      break;
+  }
 
-      // 反转方向
-      if (breathBrightness >= LED_BRIGHTNESS) {
-        breathBrightness = LED_BRIGHTNESS;
-        breathDirection = -1.5;
-      } else if (breathBrightness <= 1) {
-        breathBrightness = 1;
-        breathDirection = 1;
-      }
-      rgbLed.setPixelColor(0, rgbLed.Color(0, breathBrightness, 0));  // 绿色渐变
-      rgbLed.setBrightness(LED_BRIGHTNESS);
-      rgbLed.show();
-    }
+  // 命令队列满时下次循环重试
+  if (posted) {
+    ledState = state;
   }
 }
-
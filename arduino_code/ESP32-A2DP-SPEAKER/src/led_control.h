@@ -19,7 +19,7 @@ void initLedControl();
 
 /**
  * 更新LED状态显示
- * 应在主循环中定期调用
+ * 应在主循环中定期调用，只在状态变化时向灯效引擎提交命令
  * 
  * @param connected 蓝牙连接状态
  * @param playing 音频播放状态
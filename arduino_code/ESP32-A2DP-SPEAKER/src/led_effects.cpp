@@ -0,0 +1,373 @@
+/**
+ * LED灯效引擎实现
+ *
+ * 启动时生成伽马校正后的关键帧表（闪烁、呼吸、心跳、电平映射），
+ * 灯效任务按帧间隔播放：每帧查表得到亮度，乘以颜色和整体亮度，
+ * 颜色有变化时才转换成RMT脉冲并异步发送，发送期间不占用CPU。
+ * 常亮/熄灭时任务阻塞在命令队列上，只在状态变化时唤醒。
+ *
+ * 伽马是幂函数，(颜色 × 亮度 × 关键帧)^γ 可拆成各项分别校正，
+ * 所以只有动画曲线需要校正，颜色和整体亮度仍按原始PWM值使用。
+ *
+ * @author ESP-AI Team
+ * @date 2024
+ */
+
+#include "led_effects.h"
+#include "audio_i2s.h"
+#include "userconfig.h"
+#include <freertos/queue.h>
+
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+// Arduino 3.x：RMT由esp32-hal-rmt管理，10MHz计数（100ns）
+#define LED_RMT_TICK_HZ   10000000
+#define LED_T0H           4     // 0码高电平 400ns
+#define LED_T0L           8     // 0码低电平 800ns
+#define LED_T1H           8     // 1码高电平 800ns
+#define LED_T1L           4     // 1码低电平 400ns
+typedef rmt_data_t led_symbol_t;
+#else
+#include "driver/rmt.h"
+// 旧版RMT驱动：APB 80MHz两分频，40MHz计数（25ns）
+#define LED_RMT_CLK_DIV   2
+#define LED_T0H           16    // 0码高电平 400ns
+#define LED_T0L           34    // 0码低电平 850ns
+#define LED_T1H           32    // 1码高电平 800ns
+#define LED_T1L           18    // 1码低电平 450ns
+typedef rmt_item32_t led_symbol_t;
+#endif
+
+// 关键帧表长度
+#define BREATH_FRAMES   128
+#define PULSE_FRAMES    64
+
+// 命令
+typedef enum {
+  LED_CMD_EFFECT = 0,
+  LED_CMD_BRIGHTNESS
+} led_cmd_type_t;
+
+typedef struct {
+  led_cmd_type_t type;
+  led_effect_t effect;
+  uint8_t color[3];
+  uint8_t brightness;
+} led_cmd_t;
+
+// 关键帧表（已伽马校正，0-255）
+static const uint8_t blinkTable[2] = {255, 0};
+static uint8_t breathTable[BREATH_FRAMES];
+static uint8_t pulseTable[PULSE_FRAMES];
+static uint8_t levelTable[LED_AUDIO_RANGE_DB + 1];
+
+// RMT脉冲缓冲区，GRB顺序，每位一个符号
+static led_symbol_t symbols[WS2812_LED_COUNT * 24];
+
+static QueueHandle_t cmdQueue = NULL;
+static volatile uint32_t frameCount = 0;
+
+// 以下状态只在灯效任务中访问
+static led_effect_t activeEffect = LED_FX_OFF;
+static uint8_t activeColor[3] = {0, 0, 0};
+static uint8_t brightness = LED_BRIGHTNESS;
+static const uint8_t* table = NULL;
+static uint16_t tableFrames = 0;
+static uint16_t frameIndex = 0;
+static TickType_t frameTicks = 0;    // 0 = 静止灯效，不需要定时刷新
+static uint8_t audioLevel = 0;
+static uint8_t lastRgb[3] = {0, 0, 0};
+static bool sentOnce = false;
+
+/**
+ * 伽马校正，x为0.0-1.0的感知亮度
+ */
+static uint8_t gammaLevel(float x) {
+  if (x <= 0.0f) {
+    return 0;
+  }
+  if (x >= 1.0f) {
+    return 255;
+  }
+  return (uint8_t)(powf(x, LED_GAMMA) * 255.0f + 0.5f);
+}
+
+/**
+ * 生成关键帧表
+ */
+static void buildTables() {
+  // 呼吸：升余弦，保留约1.5%的底光（伽马前15%），低亮度设置下也不会完全熄灭
+  for (int i = 0; i < BREATH_FRAMES; i++) {
+    float phase = (1.0f - cosf(2.0f * PI * i / BREATH_FRAMES)) / 2.0f;
+    breathTable[i] = gammaLevel(0.15f + 0.85f * phase);
+  }
+
+  // 心跳：两次快速起伏后静止
+  for (int i = 0; i < PULSE_FRAMES; i++) {
+    float t = (float)i / PULSE_FRAMES;
+    float beat = expf(-t / 0.06f);
+    if (t >= 0.22f) {
+      beat = fmaxf(beat, 0.6f * expf(-(t - 0.22f) / 0.06f));
+    }
+    pulseTable[i] = gammaLevel(beat);
+  }
+
+  // 电平：LED_AUDIO_RANGE_DB范围内线性映射到感知亮度
+  for (int i = 0; i <= LED_AUDIO_RANGE_DB; i++) {
+    levelTable[i] = gammaLevel((float)i / LED_AUDIO_RANGE_DB);
+  }
+}
+
+/**
+ * 配置RMT发送通道
+ */
+static bool setupRmt() {
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+  return rmtInit(WS2812_PIN, RMT_TX_MODE, RMT_MEM_NUM_BLOCKS_1, LED_RMT_TICK_HZ);
+#else
+  rmt_config_t config = RMT_DEFAULT_CONFIG_TX((gpio_num_t)WS2812_PIN, (rmt_channel_t)LED_RMT_CHANNEL);
+  config.clk_div = LED_RMT_CLK_DIV;
+  if (rmt_config(&config) != ESP_OK) {
+    return false;
+  }
+  return rmt_driver_install((rmt_channel_t)LED_RMT_CHANNEL, 0, 0) == ESP_OK;
+#endif
+}
+
+/**
+ * 把颜色转换成RMT脉冲并异步发送
+ */
+static bool sendPixels(const uint8_t rgb[3]) {
+#if ESP_IDF_VERSION < ESP_IDF_VERSION_VAL(5, 0, 0)
+  // 上一帧（单颗LED约30us）早已发完，这里只是保证不改写正在发送的缓冲区
+  rmt_wait_tx_done((rmt_channel_t)LED_RMT_CHANNEL, pdMS_TO_TICKS(10));
+#endif
+
+  const uint8_t grb[3] = {rgb[1], rgb[0], rgb[2]};
+  led_symbol_t* symbol = symbols;
+  for (int led = 0; led < WS2812_LED_COUNT; led++) {
+    for (int c = 0; c < 3; c++) {
+      for (int bit = 7; bit >= 0; bit--, symbol++) {
+        bool one = (grb[c] >> bit) & 1;
+        symbol->level0 = 1;
+        symbol->duration0 = one ? LED_T1H : LED_T0H;
+        symbol->level1 = 0;
+        symbol->duration1 = one ? LED_T1L : LED_T0L;
+      }
+    }
+  }
+
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+  return rmtWriteAsync(WS2812_PIN, symbols, WS2812_LED_COUNT * 24);
+#else
+  return rmt_write_items((rmt_channel_t)LED_RMT_CHANNEL, symbols, WS2812_LED_COUNT * 24, false) == ESP_OK;
+#endif
+}
+
+/**
+ * 当前帧的电平亮度：快速上升，每帧最多回落LED_AUDIO_RELEASE
+ */
+static uint8_t audioFrameLevel() {
+  AudioLevelMeter::levels_t levels;
+  int target = 0;
+  if (getAudioLevels(levels)) {
+    float db = fmaxf(levels.peakDb[0], levels.peakDb[1]);
+    int index = (int)(db + LED_AUDIO_RANGE_DB);
+    if (index < 0) {
+      index = 0;
+    } else if (index > LED_AUDIO_RANGE_DB) {
+      index = LED_AUDIO_RANGE_DB;
+    }
+    target = levelTable[index];
+  }
+
+  if (target >= audioLevel) {
+    audioLevel = target;
+  } else if (audioLevel - target > LED_AUDIO_RELEASE) {
+    audioLevel -= LED_AUDIO_RELEASE;
+  } else {
+    audioLevel = target;
+  }
+  return audioLevel;
+}
+
+/**
+ * 计算并输出当前帧，颜色不变时不发送
+ */
+static void renderFrame() {
+  uint8_t level;
+  switch (activeEffect) {
+    case LED_FX_OFF:
+      level = 0;
+      break;
+    case LED_FX_SOLID:
+      level = 255;
+      break;
+    case LED_FX_AUDIO_LEVEL:
+      level = audioFrameLevel();
+      break;
+    default:
+      level = table[frameIndex];
+      break;
+  }
+
+  uint8_t rgb[3];
+  for (int c = 0; c < 3; c++) {
+    rgb[c] = (uint8_t)((uint32_t)activeColor[c] * level * brightness / (255 * 255));
+  }
+  if (sentOnce && memcmp(rgb, lastRgb, sizeof(rgb)) == 0) {
+    return;
+  }
+  if (sendPixels(rgb)) {
+    memcpy(lastRgb, rgb, sizeof(rgb));
+    sentOnce = true;
+    frameCount++;
+  }
+}
+
+/**
+ * 切换灯效，选择关键帧表和帧间隔
+ */
+static void startEffect(const led_cmd_t& cmd) {
+  activeEffect = cmd.effect;
+  memcpy(activeColor, cmd.color, sizeof(activeColor));
+  frameIndex = 0;
+  audioLevel = 0;
+
+  uint32_t frameMs = 0;
+  switch (activeEffect) {
+    case LED_FX_BLINK:
+      table = blinkTable;
+      tableFrames = 2;
+      frameMs = LED_BLINK_INTERVAL;
+      break;
+    case LED_FX_BREATH:
+      table = breathTable;
+      tableFrames = BREATH_FRAMES;
+      frameMs = LED_BREATH_PERIOD / BREATH_FRAMES;
+      break;
+    case LED_FX_PULSE:
+      table = pulseTable;
+      tableFrames = PULSE_FRAMES;
+      frameMs = LED_PULSE_PERIOD / PULSE_FRAMES;
+      break;
+    case LED_FX_AUDIO_LEVEL:
+      frameMs = LED_AUDIO_FRAME_MS;
+      break;
+    default:
+      break;
+  }
+  frameTicks = frameMs ? pdMS_TO_TICKS(frameMs) : 0;
+  if (frameMs && frameTicks == 0) {
+    frameTicks = 1;
+  }
+}
+
+/**
+ * 灯效任务：在命令和下一帧之间阻塞，静止灯效无限等待命令
+ */
+static void ledEffectsTask(void* param) {
+  led_cmd_t cmd;
+  TickType_t nextFrame = xTaskGetTickCount();
+
+  for (;;) {
+    TickType_t wait = portMAX_DELAY;
+    if (frameTicks > 0) {
+      TickType_t now = xTaskGetTickCount();
+      wait = (int32_t)(nextFrame - now) > 0 ? nextFrame - now : 0;
+    }
+
+    if (xQueueReceive(cmdQueue, &cmd, wait) == pdTRUE) {
+      if (cmd.type == LED_CMD_BRIGHTNESS) {
+        brightness = cmd.brightness;
+      } else {
+        startEffect(cmd);
+        nextFrame = xTaskGetTickCount() + frameTicks;
+      }
+      renderFrame();
+      continue;
+    }
+
+    // 下一帧
+    if (table != NULL && activeEffect != LED_FX_AUDIO_LEVEL) {
+      frameIndex = (frameIndex + 1) % tableFrames;
+    }
+    renderFrame();
+    nextFrame += frameTicks;
+    // 落后超过一帧（例如长时间被高优先级任务占用）时重新对齐，不追帧
+    if ((int32_t)(xTaskGetTickCount() - nextFrame) > 0) {
+      nextFrame = xTaskGetTickCount() + frameTicks;
+    }
+  }
+}
+
+/**
+ * 提交命令
+ */
+static bool postCommand(const led_cmd_t& cmd) {
+  if (cmdQueue == NULL) {
+    return false;
+  }
+  return xQueueSendToBack(cmdQueue, &cmd, 0) == pdTRUE;
+}
+
+/**
+ * 初始化灯效引擎
+ */
+bool initLedEffects() {
+  if (cmdQueue != NULL) {
+    return true;
+  }
+
+  buildTables();
+
+  if (!setupRmt()) {
+    Serial.println("WS2812 RMT初始化失败");
+    return false;
+  }
+
+  cmdQueue = xQueueCreate(4, sizeof(led_cmd_t));
+  if (cmdQueue == NULL) {
+    Serial.println("LED命令队列创建失败");
+    return false;
+  }
+
+  if (xTaskCreatePinnedToCore(ledEffectsTask, "led_fx", 2048, NULL, LED_TASK_PRIORITY, NULL, LED_TASK_CORE) != pdPASS) {
+    vQueueDelete(cmdQueue);
+    cmdQueue = NULL;
+    Serial.println("LED灯效任务创建失败");
+    return false;
+  }
+  return true;
+}
+
+/**
+ * 切换灯效
+ */
+bool setLedEffect(led_effect_t effect, uint8_t r, uint8_t g, uint8_t b) {
+  led_cmd_t cmd;
+  cmd.type = LED_CMD_EFFECT;
+  cmd.effect = effect;
+  cmd.color[0] = r;
+  cmd.color[1] = g;
+  cmd.color[2] = b;
+  cmd.brightness = 0;
+  return postCommand(cmd);
+}
+
+/**
+ * 设置整体亮度
+ */
+bool setLedBrightness(uint8_t value) {
+  led_cmd_t cmd;
+  memset(&cmd, 0, sizeof(cmd));
+  cmd.type = LED_CMD_BRIGHTNESS;
+  cmd.brightness = value;
+  return postCommand(cmd);
+}
+
+/**
+ * 获取已发送到LED的帧数
+ */
+uint32_t getLedFrameCount() {
+  return frameCount;
+}
@@ -0,0 +1,62 @@
+/**
+ * LED灯效引擎头文件
+ *
+ * WS2812灯效由独立任务按预计算的关键帧表播放，RMT外设发送数据不占用CPU。
+ * 主循环只在状态变化时提交命令，灯效静止时任务不再唤醒
+ *
+ * @author ESP-AI Team
+ * @date 2024
+ */
+
+#ifndef LED_EFFECTS_H
+#define LED_EFFECTS_H
+
+#include <Arduino.h>
+
+/**
+ * 灯效类型
+ */
+typedef enum {
+  LED_FX_OFF = 0,       // 熄灭
+  LED_FX_SOLID,         // 常亮
+  LED_FX_BLINK,         // 闪烁，亮灭各LED_BLINK_INTERVAL
+  LED_FX_BREATH,        // 呼吸，周期LED_BREATH_PERIOD
+  LED_FX_PULSE,         // 心跳脉冲，周期LED_PULSE_PERIOD
+  LED_FX_AUDIO_LEVEL    // 随音乐电平变化（读取电平表快照）
+} led_effect_t;
+
+/**
+ * 初始化灯效引擎：生成关键帧表，配置RMT，启动灯效任务
+ *
+ * @return true=成功
+ */
+bool initLedEffects();
+
+/**
+ * 切换灯效，立即生效，动画从第一帧开始
+ * 可在任意任务中调用，不阻塞
+ *
+ * @param effect 灯效类型
+ * @param r 红色分量 (0-255)
+ * @param g 绿色分量 (0-255)
+ * @param b 蓝色分量 (0-255)
+ * @return true=命令已提交, false=命令队列已满
+ */
+bool setLedEffect(led_effect_t effect, uint8_t r, uint8_t g, uint8_t b);
+
+/**
+ * 设置整体亮度，不打断当前动画
+ *
+ * @param brightness 亮度 (0-255)
+ * @return true=命令已提交, false=命令队列已满
+ */
+bool setLedBrightness(uint8_t brightness);
+
+/**
+ * 获取已发送到LED的帧数（颜色不变的帧不发送）
+ *
+ * @return 帧数
+ */
+uint32_t getLedFrameCount();
+
+#endif // LED_EFFECTS_H
@@ -9,18 +9,23 @@
 
 #include "pca9554_handler.h"
 #include "bluetooth_manager.h"
+#include "i2c_bus.h"
 #include "userconfig.h"
-#include <Wire.h>
-#include <PCA9554.h>
 
-// PCA9554 对象
-static PCA9554 ioExpander(PCA9554_ADDR);
+// PCA9554 寄存器
+#define PCA9554_REG_INPUT  0x00
+#define PCA9554_REG_CONFIG 0x03
 
 // 上次的 IO 状态
 static uint8_t lastIOState = 0xFF;
 
-// 中断标志
-static volatile bool interruptTriggered = false;
+// 中断中提交的异步读：寄存器地址和接收缓冲区，结果由总线任务写入
+static const uint8_t inputReg = PCA9554_REG_INPUT;
+static uint8_t ioReadBuffer = 0xFF;
+static volatile uint8_t ioReadState = 0xFF;
+static volatile bool ioReadReady = false;
+static volatile bool ioReadInFlight = false;
+static volatile bool ioReadRetry = false;
 
 // 按钮防抖时间戳
 static unsigned long lastIO1Change = 0;
@@ -31,10 +36,30 @@ static unsigned long lastIO3Change = 0;
 #define DEBOUNCE_DELAY 200
 
 /**
- * 中断处理函数
+ * 输入端口读取完成（在I2C总线任务中执行）
+ */
+static void onInputRead(bool ok, void* arg) {
+  if (ok) {
+    ioReadState = ioReadBuffer;
+    ioReadReady = true;
+  }
+  ioReadInFlight = false;
+}
+
+/**
+ * 中断处理函数：直接提交输入端口读取，主循环不再等待I2C
  */
 void IRAM_ATTR handlePCA9554Interrupt() {
-  interruptTriggered = true;
+  // 上一次读取还没完成时只做标记，由主循环在其完成后补读一次
+  if (ioReadInFlight) {
+    ioReadRetry = true;
+    return;
+  }
+  ioReadInFlight = true;
+  if (!i2cBusSubmitFromISR(PCA9554_ADDR, &inputReg, 1, &ioReadBuffer, 1, I2C_BUS_PRIO_NORMAL, onInputRead, NULL)) {
+    ioReadInFlight = false;
+    ioReadRetry = true;
+  }
 }
 
 /**
@@ -89,25 +114,22 @@ static void handleIOChange(uint8_t currentState) {
  * 初始化PCA9554模块
  */
 bool initPCA9554Handler() {
-  // 初始化 I2C
-  Wire.begin(I2C_SDA_PIN, I2C_SCL_PIN, I2C_FREQ);
-  
   // 配置 INT 引脚为输入
   pinMode(INT_PIN, INPUT_PULLUP);
   
-  // 初始化 PCA9554
-  if (!ioExpander.begin()) {
+  // 检测 PCA9554（I2C总线由initI2CBus初始化）
+  if (!i2cBusProbe(PCA9554_ADDR)) {
     return false;
   }
   
   // 配置所有 IO 为输入 (0xFF = 所有位为 1 = 所有 IO 为输入)
-  if (!ioExpander.portMode(0xFF)) {
+  if (!i2cBusWriteReg(PCA9554_ADDR, PCA9554_REG_CONFIG, 0xFF, I2C_BUS_PRIO_LOW)) {
     return false;
   }
   
   // 读取初始状态
   uint8_t initialState = 0;
-  if (!ioExpander.digitalReadPort(initialState)) {
+  if (!i2cBusReadReg(PCA9554_ADDR, PCA9554_REG_INPUT, &initialState, I2C_BUS_PRIO_NORMAL)) {
     return false;
   }
   lastIOState = initialState;
@@ -122,14 +144,19 @@ bool initPCA9554Handler() {
  * 更新PCA9554状态
  */
 void updatePCA9554() {
-  // 检查中断标志
-  if (interruptTriggered) {
-    interruptTriggered = false;
-    
-    // 读取当前 IO 状态
-    uint8_t currentState = 0;
-    if (ioExpander.digitalReadPort(currentState)) {
-      handleIOChange(currentState);
+  // 处理总线任务读回的 IO 状态
+  if (ioReadReady) {
+    ioReadReady = false;
+    handleIOChange(ioReadState);
+  }
+  
+  // 读取期间又有中断或队列已满时补读一次
+  if (ioReadRetry && !ioReadInFlight) {
+    ioReadRetry = false;
+    ioReadInFlight = true;
+    if (!i2cBusSubmit(PCA9554_ADDR, &inputReg, 1, &ioReadBuffer, 1, I2C_BUS_PRIO_NORMAL, onInputRead, NULL)) {
+      ioReadInFlight = false;
+      ioReadRetry = true;
     }
   }
 }
@@ -14,7 +14,7 @@
 
 /**
  * 初始化PCA9554模块
- * 配置I2C、中断引脚和IO扩展芯片
+ * 配置中断引脚和IO扩展芯片，需在initI2CBus之后调用
  * 
  * @return true=初始化成功, false=初始化失败
  */
@@ -22,7 +22,7 @@ bool initPCA9554Handler();
 
 /**
  * 更新PCA9554状态
- * 在主循环中调用，检查IO变化并执行相应操作
+ * 在主循环中调用，处理中断后读回的IO状态并执行相应操作，不访问I2C
  */
 void updatePCA9554();
 
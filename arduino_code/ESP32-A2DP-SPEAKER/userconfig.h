@@ -47,8 +47,16 @@
 #define WS2812_LED_COUNT        1       // WS2812 LED数量
 #define LED_BRIGHTNESS          100     // LED亮度 (0-255)
 #define LED_BLINK_INTERVAL      1000    // LED闪烁间隔 (毫秒)
-#define LED_BREATH_INTERVAL     30      // LED呼吸灯更新间隔 (毫秒)
-#define LED_BREATH_STEP         3       // LED呼吸灯亮度步进值
+#define LED_BREATH_PERIOD       3000    // LED呼吸周期 (毫秒)
+#define LED_PULSE_PERIOD        1200    // LED心跳周期 (毫秒)
+#define LED_GAMMA               2.2     // 动画曲线伽马校正
+#define LED_PLAYING_EFFECT      LED_FX_BREATH  // 播放中灯效：LED_FX_BREATH 呼吸 / LED_FX_AUDIO_LEVEL 随音乐
+#define LED_AUDIO_FRAME_MS      20      // 随音乐模式帧间隔，与电平表更新周期一致 (毫秒)
+#define LED_AUDIO_RANGE_DB      48      // 随音乐模式显示的电平范围，-48dBFS以下熄灭 (dB)
+#define LED_AUDIO_RELEASE       12      // 随音乐模式每帧最大回落亮度
+#define LED_RMT_CHANNEL         0       // WS2812使用的RMT通道（旧版RMT驱动）
+#define LED_TASK_PRIORITY       2       // 灯效任务优先级
+#define LED_TASK_CORE           1       // 灯效任务所在核心
 
 // ==================== 蓝牙配置参数 ====================
 #define BT_DEVICE_NAME          "ESP-AI-SPEAKER"  // 蓝牙设备名称
@@ -63,12 +71,20 @@
 #define LED_COLOR_RED           255, 0, 0    // 红色 - 错误状态
 #define LED_COLOR_YELLOW        255, 255, 0  // 黄色 - 警告状态
 
-// ====================PCA9554 配置参数 ====================
+// ==================== I2C总线配置 ====================
+// 所有I2C外设的事务由总线任务统一排队执行，见 src/i2c_bus.h
 
 // I2C 引脚配置
 #define I2C_SDA_PIN 4      // SDA 引脚
 #define I2C_SCL_PIN 15     // SCL 引脚
-#define I2C_FREQ 100000    // I2C 频率 (100kHz)
+#define I2C_FREQ 400000    // I2C 频率 (400kHz，PCA9554与QMI8658A均支持)
+
+// 总线任务配置
+#define I2C_BUS_QUEUE_LEN     8       // 每个优先级的事务队列深度
+#define I2C_BUS_TASK_PRIORITY 6       // 高于IMU FIFO任务(5)，同步事务尽快完成
+#define I2C_BUS_TASK_CORE     1       // 与loop同核，不与蓝牙音频抢核心0
+
+// ====================PCA9554 配置参数 ====================
 
 // PCA9554 配置
 #define PCA9554_ADDR 0x38  // 7位 I2C 地址
@@ -76,6 +92,56 @@
 // 中断引脚配置
 #define INT_PIN 2          // INT 引脚 (GPIO2)
 
+// ==================== IMU姿态配置 ====================
+// QMI8658A 与 PCA9554 共用 I2C 总线
+#define IMU_ADDR              0x6B    // QMI8658A I2C地址（SA0低电平）
+#define IMU_INT_PIN           35      // QMI8658A INT1 -> GPIO35 (FIFO水位中断)
+#define IMU_UP_AXIS           2       // 音箱正放时朝上的传感器轴 (0=X, 1=Y, 2=Z)
+#define IMU_UP_SIGN           1       // 该轴朝上为1，朝下为-1
+#define IMU_FUSION_KP         1.0     // Mahony比例增益（越大越信任加速度计）
+#define ORIENTATION_HOLD_MS   600     // 新朝向保持多久才切换声道 (毫秒)
+#define CHANNEL_FADE_MS       50      // 声道切换交叉淡化时长 (毫秒)
+
+// 手势：双击 = 播放/暂停，摇晃 = 下一曲
+#define GESTURE_PEAK_G        1.0     // 峰值阈值，加速度模长偏离1g (g)
+#define GESTURE_QUIET_G       0.3     // 低于此值视为峰值结束 (g)
+#define GESTURE_DEBOUNCE_MS   80      // 同一次敲击的回弹间隔 (毫秒)
+#define GESTURE_QUIET_MS      400     // 最后一个峰值后静止多久结束手势 (毫秒)
+#define GESTURE_COOLDOWN_MS   1000    // 两次手势的最小间隔 (毫秒)
+
+// ==================== 电池监测配置 ====================
+// 单节锂电池经分压电阻接ADC1引脚；检测不到电池（USB供电）时不做任何限制
+#define BATTERY_ADC_PIN         39      // 电池电压ADC引脚 (ADC1，-1=不使用电池监测)
+#define BATTERY_DIVIDER_RATIO   2.0     // 分压比 (电池电压 / 引脚电压)
+#define BATTERY_CHARGE_PIN      -1      // 充电芯片状态引脚，低电平=充电中 (-1=按电压变化判断)
+#define BATTERY_SAMPLE_INTERVAL 50      // 采样间隔 (毫秒)
+#define BATTERY_OVERSAMPLE      8       // 每次采样的ADC读取次数
+#define BATTERY_PRESENT_MV      2500    // 低于此电压视为未接电池 (mV)
+#define BATTERY_SOC_ALPHA       0.01    // 开路电压指数滤波系数（每次采样，约5秒时间常数）
+
+// 负载补偿：开路电压 = 端电压 + 估计电流 × 内阻
+#define BATTERY_RINT_MOHM       150     // 电池内阻 + 线路电阻 (毫欧)
+#define BATTERY_IDLE_MA         90      // 静态电流（蓝牙连接）(mA)
+#define BATTERY_AUDIO_FULL_MA   1200    // 满幅正弦、增益1.0时功放电流 (mA)
+
+// 充电判断（无状态引脚时）
+#define BATTERY_CHARGE_MV       4230    // 高于此端电压视为充电中 (mV)
+#define BATTERY_CHARGE_RISE_MV  20      // 窗口内电压上升超过此值视为充电 (mV)
+#define BATTERY_CHARGE_WINDOW_MS 60000  // 电压趋势窗口 (毫秒)
+
+// 低电量策略
+#define BATTERY_LOW_SOC         20      // 低电量阈值 (%)，LED亮度降低
+#define BATTERY_CRITICAL_SOC    5       // 严重低电量阈值 (%)
+#define BATTERY_LIMIT_SOC       30      // 低于此电量开始降低增益上限 (%)
+#define BATTERY_MIN_GAIN_SCALE  0.5     // 电量0%时的增益上限比例
+#define BATTERY_LOW_LED_SCALE   0.3     // 低电量时LED亮度比例
+
+// 电压跌落保护（低音峰值电流过大）
+#define BATTERY_SAG_MV          3450    // 端电压低于此值视为跌落 (mV)
+#define BATTERY_SAG_STEP        0.8     // 每次跌落增益上限乘以此比例
+#define BATTERY_SAG_MIN_SCALE   0.4     // 跌落保护的最低增益比例
+#define BATTERY_SAG_HOLD_MS     200     // 两次降低之间的最小间隔 (毫秒)
+#define BATTERY_SAG_RECOVER     0.002   // 无跌落时每次采样恢复的增益比例（约10秒恢复）
 
 #endif // USERCONFIG_H
 
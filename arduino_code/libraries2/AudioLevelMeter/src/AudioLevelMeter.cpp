@@ -0,0 +1,234 @@
+/*
+ * AudioLevelMeter.cpp
+ *
+ * Created on: Oct 18,2026
+ *
+ *  The per sample work is kept to two kernels: peakSum (peak and sum of squares, integer only, two frames per
+ *  iteration) and kWeight (two biquads in transposed direct form II, float, states in registers). Everything
+ *  else (sqrt, log10, loudness windows, publishing) runs once per block.
+ *
+ */
+#include "AudioLevelMeter.h"
+#include <math.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+//  kernels
+//----------------------------------------------------------------------------------------------------------------------
+static inline uint32_t mag(int32_t s) { return (uint32_t)(s < 0 ? -s : s); }
+
+static void peakSumStereo(const int16_t* p, uint32_t frames, uint16_t peak[2], uint64_t sumSq[2]) {
+    uint32_t pl = peak[0], pr = peak[1];
+    uint64_t sl = 0, sr = 0;
+    uint32_t i = 0;
+    for(; i + 2 <= frames; i += 2, p += 4) {
+        int32_t l0 = p[0], r0 = p[1], l1 = p[2], r1 = p[3];
+        uint32_t ml = max(mag(l0), mag(l1));
+        uint32_t mr = max(mag(r0), mag(r1));
+        if(ml > pl) pl = ml;
+        if(mr > pr) pr = mr;
+        sl += (uint32_t)(l0 * l0) + (uint32_t)(l1 * l1); // each square <= 2^30, the pair fits into 32 bit
+        sr += (uint32_t)(r0 * r0) + (uint32_t)(r1 * r1);
+    }
+    if(i < frames) {
+        int32_t l0 = p[0], r0 = p[1];
+        if(mag(l0) > pl) pl = mag(l0);
+        if(mag(r0) > pr) pr = mag(r0);
+        sl += (uint32_t)(l0 * l0);
+        sr += (uint32_t)(r0 * r0);
+    }
+    peak[0] = pl; peak[1] = pr;
+    sumSq[0] += sl; sumSq[1] += sr;
+}
+
+static void peakSumMono(const int16_t* p, uint32_t frames, uint16_t peak[2], uint64_t sumSq[2]) {
+    uint32_t pk = peak[0];
+    uint64_t s = 0;
+    uint32_t i = 0;
+    for(; i + 2 <= frames; i += 2, p += 2) {
+        int32_t a = p[0], b = p[1];
+        uint32_t m = max(mag(a), mag(b));
+        if(m > pk) pk = m;
+        s += (uint32_t)(a * a) + (uint32_t)(b * b);
+    }
+    if(i < frames) {
+        int32_t a = p[0];
+        if(mag(a) > pk) pk = mag(a);
+        s += (uint32_t)(a * a);
+    }
+    peak[0] = pk;
+    sumSq[0] += s;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+AudioLevelMeter::AudioLevelMeter() : m_seq(0), m_reqRate(44100), m_reqBlockMs(20), m_reqLoudness(false), m_reqReset(false) {
+    memset(&m_snapshot, 0, sizeof(m_snapshot));
+    m_blockFrames = m_sampleRate * m_blockMs / 1000;
+    calcCoefficients();
+    clear();
+}
+//----------------------------------------------------------------------------------------------------------------------
+void AudioLevelMeter::applySettings() {
+    m_reqReset = false;
+    uint32_t rate = m_reqRate;
+    if(rate != m_sampleRate) {
+        m_sampleRate = rate;
+        calcCoefficients();
+    }
+    m_blockMs = m_reqBlockMs;
+    m_blockFrames = m_sampleRate * m_blockMs / 1000;
+    m_f_loudness = m_reqLoudness;
+    clear();
+}
+//----------------------------------------------------------------------------------------------------------------------
+void AudioLevelMeter::clear() {
+    memset(&m_work, 0, sizeof(m_work));
+    memset(m_z, 0, sizeof(m_z));
+    m_sumSq[0] = m_sumSq[1] = 0;
+    m_peak[0] = m_peak[1] = 0;
+    m_kSum[0] = m_kSum[1] = 0;
+    m_frames = 0;
+    m_histIdx = 0;
+    m_histCnt = 0;
+    publish(); // blocks == 0, getLevels() returns false until the next block is done
+}
+//----------------------------------------------------------------------------------------------------------------------
+void AudioLevelMeter::calcCoefficients() {
+    // ITU-R BS.1770-4 K-weighting, the 48 kHz coefficients of the standard rederived for any sample rate
+    // (bilinear transform of the analog prototypes, same approach as libebur128)
+    const double fs = m_sampleRate;
+
+    double f0 = 1681.974450955533;  // stage 1, high shelf +4 dB
+    double G  = 3.999843853973347;
+    double Q  = 0.7071752369554196;
+    double K  = tan(M_PI * f0 / fs);
+    double Vh = pow(10.0, G / 20.0);
+    double Vb = pow(Vh, 0.4996667741545416);
+    double a0 = 1.0 + K / Q + K * K;
+    m_shelf.b0 = (Vh + Vb * K / Q + K * K) / a0;
+    m_shelf.b1 = 2.0 * (K * K - Vh) / a0;
+    m_shelf.b2 = (Vh - Vb * K / Q + K * K) / a0;
+    m_shelf.a1 = 2.0 * (K * K - 1.0) / a0;
+    m_shelf.a2 = (1.0 - K / Q + K * K) / a0;
+
+    f0 = 38.13547087602444;          // stage 2, RLB high pass
+    Q  = 0.5003270373238773;
+    K  = tan(M_PI * f0 / fs);
+    a0 = 1.0 + K / Q + K * K;
+    m_hipass.b0 = 1.0;
+    m_hipass.b1 = -2.0;
+    m_hipass.b2 = 1.0;
+    m_hipass.a1 = 2.0 * (K * K - 1.0) / a0;
+    m_hipass.a2 = (1.0 - K / Q + K * K) / a0;
+}
+//----------------------------------------------------------------------------------------------------------------------
+void AudioLevelMeter::process(const int16_t* pcm, size_t frames, uint8_t channels) {
+    if(!pcm || !frames || channels < 1 || channels > 2) return;
+    if(m_reqReset || m_reqRate != m_sampleRate || m_reqBlockMs != m_blockMs || m_reqLoudness != m_f_loudness) applySettings();
+    if(channels != m_channels) { // format change, the running block is meaningless
+        m_channels = channels;
+        clear();
+    }
+    while(frames) {
+        uint32_t n = min((uint32_t)frames, m_blockFrames - m_frames);
+        if(channels == 2) peakSumStereo(pcm, n, m_peak, m_sumSq);
+        else              peakSumMono(pcm, n, m_peak, m_sumSq);
+
+        if(m_f_loudness) {
+            for(uint8_t ch = 0; ch < channels; ch++) { // kWeight
+                const int16_t* p = pcm + ch;
+                const biquad_t s = m_shelf, h = m_hipass;
+                float s1 = m_z[ch][0], s2 = m_z[ch][1], t1 = m_z[ch][2], t2 = m_z[ch][3];
+                float sum = 0;
+                for(uint32_t i = 0; i < n; i++, p += channels) {
+                    float x = *p * (1.0f / 32768.0f);
+                    float y = s.b0 * x + s1;
+                    s1 = s.b1 * x - s.a1 * y + s2;
+                    s2 = s.b2 * x - s.a2 * y;
+                    float w = h.b0 * y + t1;
+                    t1 = h.b1 * y - h.a1 * w + t2;
+                    t2 = h.b2 * y - h.a2 * w;
+                    sum += w * w;
+                }
+                m_z[ch][0] = s1; m_z[ch][1] = s2; m_z[ch][2] = t1; m_z[ch][3] = t2;
+                m_kSum[ch] += sum;
+            }
+        }
+        pcm += n * channels;
+        frames -= n;
+        m_frames += n;
+        if(m_frames >= m_blockFrames) endOfBlock();
+    }
+}
+//----------------------------------------------------------------------------------------------------------------------
+void AudioLevelMeter::endOfBlock() {
+    for(uint8_t ch = 0; ch < 2; ch++) {
+        uint8_t src = (m_channels == 2) ? ch : 0;
+        float rms = sqrtf((float)m_sumSq[src] / m_frames);
+        m_work.peak[ch]   = m_peak[src];
+        m_work.rms[ch]    = (uint16_t)(rms + 0.5f);
+        m_work.peakDb[ch] = toDb(m_peak[src]);
+        m_work.rmsDb[ch]  = toDb(rms);
+    }
+    if(m_f_loudness) {
+        float power = 0;
+        for(uint8_t ch = 0; ch < m_channels; ch++) power += m_kSum[ch] / m_frames; // channel weights L = R = 1
+        m_blockPower[m_histIdx] = power;
+        m_histIdx = (m_histIdx + 1) % LEVELMETER_HISTORY;
+        if(m_histCnt < LEVELMETER_HISTORY) m_histCnt++;
+        m_work.lufsM = loudness((400 + m_blockMs / 2) / m_blockMs);
+        m_work.lufsS = loudness((3000 + m_blockMs / 2) / m_blockMs);
+    }
+    else {
+        m_work.lufsM = m_work.lufsS = LEVELMETER_SILENCE_DB;
+    }
+    m_work.blocks++;
+    m_work.time = millis();
+    publish();
+
+    m_sumSq[0] = m_sumSq[1] = 0;
+    m_peak[0] = m_peak[1] = 0;
+    m_kSum[0] = m_kSum[1] = 0;
+    m_frames = 0;
+}
+//----------------------------------------------------------------------------------------------------------------------
+float AudioLevelMeter::loudness(uint16_t blocks) {
+    // mean of the last 'blocks' K-weighted powers, BS.1770: L = -0.691 + 10 * log10(sum of channel powers)
+    if(blocks > m_histCnt) blocks = m_histCnt;
+    if(!blocks) return LEVELMETER_SILENCE_DB;
+    float sum = 0;
+    uint16_t idx = m_histIdx;
+    for(uint16_t i = 0; i < blocks; i++) {
+        idx = idx ? idx - 1 : LEVELMETER_HISTORY - 1;
+        sum += m_blockPower[idx];
+    }
+    float mean = sum / blocks;
+    if(mean <= 1e-10f) return LEVELMETER_SILENCE_DB;
+    float l = -0.691f + 10.0f * log10f(mean);
+    return l < LEVELMETER_SILENCE_DB ? LEVELMETER_SILENCE_DB : l;
+}
+//----------------------------------------------------------------------------------------------------------------------
+float AudioLevelMeter::toDb(float v) {
+    if(v < 0.5f) return LEVELMETER_SILENCE_DB;
+    float db = 20.0f * log10f(v / 32768.0f);
+    return db < LEVELMETER_SILENCE_DB ? LEVELMETER_SILENCE_DB : db;
+}
+//----------------------------------------------------------------------------------------------------------------------
+void AudioLevelMeter::publish() {
+    // single writer: odd sequence while copying, readers that saw it or saw a change retry
+    uint32_t seq = m_seq.load(std::memory_order_relaxed);
+    m_seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy(&m_snapshot, &m_work, sizeof(levels_t));
+    m_seq.store(seq + 2, std::memory_order_release);
+}
+//----------------------------------------------------------------------------------------------------------------------
+bool AudioLevelMeter::getLevels(levels_t& levels) {
+    for(uint8_t tries = 0; tries < 16; tries++) {
+        uint32_t seq = m_seq.load(std::memory_order_acquire);
+        if(seq & 1) continue; // writer is busy
+        memcpy(&levels, &m_snapshot, sizeof(levels_t));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if(m_seq.load(std::memory_order_relaxed) == seq) return levels.blocks != 0;
+    }
+    return false; // the writer was preempted inside publish(), try again later
+}
@@ -0,0 +1,96 @@
+/*
+ * AudioLevelMeter.h
+ *
+ * Created on: Oct 18,2026
+ *
+ *  Block level meter for interleaved 16 bit PCM (mono or stereo).
+ *
+ *  The audio path hands every buffer to process(). Samples are collected into blocks of blockMs (default 20 ms),
+ *  at the end of each block peak and RMS of both channels are computed once and published. With setLoudness(true)
+ *  the samples also run through the ITU-R BS.1770 K-weighting filter (high shelf + high pass), the snapshot then
+ *  carries the momentary (400 ms) and short-term (3 s) loudness in LUFS, ungated.
+ *
+ *  Exactly one task writes (the one calling process()), any number of tasks read. The snapshot is protected by a
+ *  sequence counter (seqlock): the writer never waits, a reader copies the snapshot and retries if the writer was
+ *  busy meanwhile. Neither side takes a mutex, so the meter can sit in the I2S or A2DP callback. The setters may be
+ *  called from any task, they only post the new value, the writer applies it at the start of the next process().
+ *
+ *  Usage:
+ *      meter.setSampleRate(44100);                        // when the format is known
+ *      meter.process(pcm, frames, channels);              // writer, every buffer
+ *      AudioLevelMeter::levels_t lv;
+ *      if(meter.getLevels(lv)) { ... lv.peak[0] ... }     // any task
+ *
+ */
+#pragma once
+
+#include "Arduino.h"
+#include <atomic>
+
+#define LEVELMETER_BLOCK_MS_MIN     10
+#define LEVELMETER_BLOCK_MS_MAX     100
+#define LEVELMETER_HISTORY          (3000 / LEVELMETER_BLOCK_MS_MIN)   // blocks of the short-term loudness window
+#define LEVELMETER_SILENCE_DB       (-96.0f)                           // reported for digital silence
+
+class AudioLevelMeter {
+
+  public:
+    typedef struct _levels{
+        uint32_t blocks;        // blocks measured since reset(), 0 = nothing measured yet
+        uint32_t time;          // millis() at the end of the last block
+        uint16_t peak[2];       // largest magnitude in the last block, 0 ... 32768, mono: both the same
+        uint16_t rms[2];        // RMS of the last block, 0 ... 32768
+        float    peakDb[2];     // dBFS, LEVELMETER_SILENCE_DB ... 0
+        float    rmsDb[2];      // dBFS, a full scale sine reads -3.01
+        float    lufsM;         // momentary loudness (400 ms), LEVELMETER_SILENCE_DB if loudness is off
+        float    lufsS;         // short-term loudness (3 s)
+    } levels_t;
+
+    AudioLevelMeter();
+
+    void         setSampleRate(uint32_t sampleRate) { if(sampleRate) m_reqRate = sampleRate; }
+    void         setBlockTime(uint16_t blockMs) { m_reqBlockMs = constrain(blockMs, LEVELMETER_BLOCK_MS_MIN, LEVELMETER_BLOCK_MS_MAX); }
+    void         setLoudness(bool enable) { m_reqLoudness = enable; } // K-weighted LUFS on/off
+    void         reset() { m_reqReset = true; }                // clears all levels
+    void         process(const int16_t* pcm, size_t frames, uint8_t channels = 2);
+    bool         getLevels(levels_t& levels);                  // false until the first block is done
+    uint32_t     getSampleRate() { return m_reqRate; }
+
+  private:
+    typedef struct _biquad{
+        float b0, b1, b2, a1, a2;
+    } biquad_t;
+
+    void         applySettings();
+    void         clear();
+    void         calcCoefficients();
+    void         endOfBlock();
+    void         publish();
+    float        toDb(float v);
+    float        loudness(uint16_t blocks);
+
+    std::atomic<uint32_t> m_seq;                // odd while the writer updates m_snapshot
+    std::atomic<uint32_t> m_reqRate;            // requested settings, applied by process()
+    std::atomic<uint16_t> m_reqBlockMs;
+    std::atomic<bool>     m_reqLoudness;
+    std::atomic<bool>     m_reqReset;
+    levels_t     m_snapshot;
+    levels_t     m_work;
+
+    biquad_t     m_shelf;                       // K-weighting stage 1
+    biquad_t     m_hipass;                      // K-weighting stage 2 (RLB)
+    float        m_z[2][4];                     // filter states per channel, transposed direct form II
+    float        m_kSum[2];                     // K-weighted sum of squares of the current block
+    float        m_blockPower[LEVELMETER_HISTORY]; // K-weighted mean square per block, summed over the channels
+    uint16_t     m_histIdx = 0;
+    uint16_t     m_histCnt = 0;
+
+    uint64_t     m_sumSq[2];                    // sum of squares of the current block
+    uint16_t     m_peak[2];
+    uint32_t     m_blockFrames = 882;
+    uint32_t     m_frames = 0;                  // frames in the current block
+    uint32_t     m_sampleRate = 44100;
+    uint16_t     m_blockMs = 20;
+    uint8_t      m_channels = 2;                // of the current block
+    bool         m_f_loudness = false;
+};
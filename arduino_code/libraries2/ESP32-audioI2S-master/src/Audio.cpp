@@ -393,7 +393,9 @@ void Audio::setDefaults() {
     m_M4A_sampleRate = 0;
     m_opus_mode = 0;
     m_lastGranulePosition = 0;
-    m_vuLeft = m_vuRight = 0; // #835
+    m_levelMeter.reset(); // #835
+    m_vuLeft = m_vuRight = 0;
+    m_cVUl = {};
     std::fill(std::begin(m_inputHistory), std::end(m_inputHistory), 0);
     if(m_f_reset_m3u8Codec){m_m3u8Codec = CODEC_AAC;} // reset to default
     m_f_reset_m3u8Codec = true;
@@ -404,6 +406,12 @@ void Audio::setDefaults() {
 void Audio::setConnectionTimeout(uint16_t timeout_ms, uint16_t timeout_ms_ssl) {
     if(timeout_ms) m_timeout_ms = timeout_ms;
     if(timeout_ms_ssl) m_timeout_ms_ssl = timeout_ms_ssl;
+    m_hlsPrefetch.setTimeout(m_timeout_ms, m_timeout_ms_ssl);
+}
+//------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Audio::setHLSPrefetch(bool enable) {
+    m_f_hlsPrefetch = enable;
+    if(!enable && !m_f_hlsSegment) m_hlsPrefetch.stop(); // otherwise at the next stopSong()
 }
 
 /*
@@ -2928,6 +2936,8 @@ uint32_t Audio::stopSong() {
         uint8_t maxWait = 0;
         while(m_f_audioTaskIsDecoding) {vTaskDelay(1); maxWait++; if(maxWait > 100) break;} // in case of error wait max 100ms
         uint32_t currTime = getAudioCurrentTime();
+        m_hlsPrefetch.stop();
+        m_f_hlsSegment = false;
         if(m_f_running) {
             m_f_running = false;
             if(m_client->connected()){
@@ -3075,10 +3085,11 @@ void IRAM_ATTR Audio::playChunk() {
     }
 
     m_plCh.validSamples = m_validSamples;
+    m_levelMeter.process(m_outBuff.get(), m_validSamples, 2); // once per chunk, before tone and volume
+    computeVUlevel(m_outBuff.get(), m_validSamples);
 
     while(m_plCh.validSamples) {
         *m_plCh.sample = m_outBuff.get() + m_plCh.i;
-        computeVUlevel(*m_plCh.sample);
 
         //---------- Filterchain, can commented out if not used-------------
         {
@@ -3196,6 +3207,11 @@ void Audio::loop() {
                 else{
                     m_lVar.count = 0;
                     m_f_firstCall  = true;
+                    if(m_dataMode == AUDIO_DATA && m_f_hlsPrefetch && !m_hlsPrefetch.isRunning()) { // codec is known now, load the next segments meanwhile
+                        m_hlsPrefetch.setTimeout(m_timeout_ms, m_timeout_ms_ssl);
+                        if(!m_hlsPrefetch.start(xPortGetCoreID())) m_f_hlsPrefetch = false;
+                    }
+                    if(m_dataMode == AUDIO_DATA) hlsPrefetchQueue(nullptr);
                 }
                 break;
             case AUDIO_PLAYLISTINIT:
@@ -3207,14 +3223,26 @@ void Audio::loop() {
                    break;
                 }
             case AUDIO_PLAYLISTDATA:
+                m_f_hlsSegment = false;
                 host = parsePlaylist_M3U8();
                 if(!host.valid()) m_lVar.no_host_cnt++;
                 else {m_lVar.no_host_cnt = 0; m_lVar.no_host_timer = millis();}
 
                 if(m_lVar.no_host_cnt == 2){m_lVar.no_host_timer = millis() + 2000;} // no new url? wait 2 seconds
                 if(host.valid()) { // host contains the next playlist URL
-                    httpPrint(host.get());
-                    m_dataMode = HTTP_RESPONSE_HEADER;
+                    hlsPrefetchQueue(host.get());
+                    if(m_hlsPrefetch.select(host.get())) { // loaded (or loading) in the background, no request and no response header
+                        m_f_hlsSegment = true;
+                        m_f_chunked = false;
+                        m_audioFileSize = 0;
+                        m_f_firstCall = true;
+                        m_dataMode = AUDIO_DATA;
+                        info(evt_info, "next URL (prefetched): \"%s\"", host.get());
+                    }
+                    else {
+                        httpPrint(host.get());
+                        m_dataMode = HTTP_RESPONSE_HEADER;
+                    }
                 }
                 else { // host == NULL means connect to m3u8 URL
                     if(m_lastM3U8host.valid()) {m_f_reset_m3u8Codec = false; httpPrint(m_lastM3U8host.get());}
@@ -3226,6 +3254,9 @@ void Audio::loop() {
                 if(m_f_ts) { processWebStreamTS(); } // aac or aacp with ts packets
                 else { processWebStreamHLS(); }      // aac or aacp normal stream
 
+                if(m_f_hlsSegment && !m_f_continue && m_hlsPrefetch.eos()) { // prefetched segment is read completely
+                    if(InBuff.bufferFilled() < (m_f_ts ? 120000 : 50000)) m_f_continue = true;
+                }
                 if(m_f_continue) { // at this point m_f_continue is true, means processWebStream() needs more data
                     m_dataMode = AUDIO_PLAYLISTDATA;
                     m_f_continue = false;
@@ -3992,7 +4023,7 @@ void Audio::processWebStreamTS() {
     if(m_dataMode != AUDIO_DATA) return; // guard
 
 nextRound:
-    availableBytes = m_client->available();
+    availableBytes = m_f_hlsSegment ? m_hlsPrefetch.available() : m_client->available();
     if(availableBytes) {
         /* If the m3u8 stream uses 'chunked data transfer' no content length is supplied. Then the chunk size determines the audio data to be processed.
            However, the chunk size in some streams is limited to 32768 bytes, although the chunk can be larger. Then the chunk size is
@@ -4128,7 +4159,7 @@ void Audio::processWebStreamHLS() {
 
     if(m_dataMode != AUDIO_DATA) return; // guard
 
-    m_pwsHLS.availableBytes = m_client->available();
+    m_pwsHLS.availableBytes = m_f_hlsSegment ? m_hlsPrefetch.available() : m_client->available();
     if(m_pwsHLS.availableBytes) { // an ID3 header could come here
         uint16_t readedBytes = 0;
 
@@ -4207,6 +4238,15 @@ void Audio::processWebStreamHLS() {
     return;
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+void Audio::hlsPrefetchQueue(const char* next) {
+    // offers the segment that is played next and the rest of the playlist to the prefetch task, known URLs are ignored
+    if(!m_hlsPrefetch.isRunning()) return;
+    if(next) m_hlsPrefetch.enqueue(next);
+    for(uint16_t i = 0; i < m_linesWithURL.size(); i++) {
+        if(m_linesWithURL[i].valid()) m_hlsPrefetch.enqueue(m_linesWithURL[i].get());
+    }
+}
+//------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 void Audio::playAudioData() {
 
     if(!m_f_stream || m_f_eof || m_f_lockInBuffer || !m_f_running){m_validSamples = 0; return;} // guard, stream not ready or eof reached or InBuff is locked or not running
@@ -5533,6 +5573,10 @@ int32_t Audio::audioFileRead(uint8_t* buff, size_t len){
             res = m_audiofile.read();
             if(res >= 0) m_audioFilePosition ++;
         }
+        else if(m_f_hlsSegment){
+            res = m_hlsPrefetch.read();
+            if(res >= 0) m_audioFilePosition ++;
+        }
         else{
             res = m_client->read();
             if(res >= 0) m_audioFilePosition ++;
@@ -5546,6 +5590,11 @@ int32_t Audio::audioFileRead(uint8_t* buff, size_t len){
                 if(readed_bytes >= 0) {m_audioFilePosition += readed_bytes; len -= readed_bytes; offset += readed_bytes; res = offset; t = millis();}
                 if(readed_bytes <= 0) break;
             }
+            else if(m_f_hlsSegment){ // PSRAM, never waits
+                readed_bytes = m_hlsPrefetch.read(buff + offset, len);
+                if(readed_bytes >= 0) {m_audioFilePosition += readed_bytes; len -= readed_bytes; offset += readed_bytes; res = offset; t = millis();}
+                if(readed_bytes <= 0) break;
+            }
             else{
                 readed_bytes = m_client->read(buff + offset, len);
                 if(readed_bytes >= 0) {m_audioFilePosition += readed_bytes; len -= readed_bytes; offset += readed_bytes; res = offset; t = millis();}
@@ -5618,6 +5667,7 @@ bool Audio::setSampleRate(uint32_t sampRate) {
     }
     m_sampleRate = sampRate;
     m_resampleRatio = (float)m_sampleRate / 48000.0f;
+    m_levelMeter.setSampleRate(m_sampleRate);
 
     m_i2s_std_cfg.clk_cfg.sample_rate_hz = m_sampleRate;
     i2s_channel_disable(m_i2s_tx_handle);
@@ -5693,63 +5743,40 @@ void Audio::setI2SCommFMT_LSB(bool commFMT) {
     i2s_channel_enable(m_i2s_tx_handle);
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
-void Audio::computeVUlevel(int16_t sample[2]) {
-
-    auto avg = [&](uint8_t* sampArr) { // lambda, inner function, compute the average of 8 samples
+void Audio::computeVUlevel(const int16_t* buff, uint32_t frames) {
+    // same time constants as the former per sample cascade: peaks of 64 frames, averaged over 512 frames, the VU
+    // value is the mean of the last 8 averages (4096 frames) and changes every 512 frames
+    auto avg = [](const uint8_t* a) { // average of 8 values
         uint16_t av = 0;
-        for(int i = 0; i < 8; i++) { av += sampArr[i]; }
-        return av >> 3;
+        for(int i = 0; i < 8; i++) av += a[i];
+        return (uint8_t)(av >> 3);
     };
-
-    auto largest = [&](uint8_t* sampArr) { // lambda, inner function, compute the largest of 8 samples
-        uint16_t maxValue = 0;
-        for(int i = 0; i < 8; i++) {
-            if(maxValue < sampArr[i]) maxValue = sampArr[i];
-        }
-        return maxValue;
-    };
-
-    if(m_cVUl.cnt0 == 64) {
-        m_cVUl.cnt0 = 0;
-        m_cVUl.cnt1++;
-    }
-    if(m_cVUl.cnt1 == 8) {
-        m_cVUl.cnt1 = 0;
-        m_cVUl.cnt2++;
-    }
-    if(m_cVUl.cnt2 == 8) {
-        m_cVUl.cnt2 = 0;
-        m_cVUl.cnt3++;
-    }
-    if(m_cVUl.cnt3 == 8) {
-        m_cVUl.cnt3 = 0;
-        m_cVUl.cnt4++;
-        m_cVUl.f_vu = true;
-    }
-    if(m_cVUl.cnt4 == 8) { m_cVUl.cnt4 = 0; }
-
-    if(!m_cVUl.cnt0) { // store every 64th sample in the array[0]
-        m_cVUl.sampleArray[LEFTCHANNEL][0][m_cVUl.cnt1] = abs(sample[LEFTCHANNEL] >> 7);
-        m_cVUl.sampleArray[RIGHTCHANNEL][0][m_cVUl.cnt1] = abs(sample[RIGHTCHANNEL] >> 7);
-    }
-    if(!m_cVUl.cnt1) { // store argest from 64 * 8 samples in the array[1]
-        m_cVUl.sampleArray[LEFTCHANNEL][1][m_cVUl.cnt2] = largest(m_cVUl.sampleArray[LEFTCHANNEL][0]);
-        m_cVUl.sampleArray[RIGHTCHANNEL][1][m_cVUl.cnt2] = largest(m_cVUl.sampleArray[RIGHTCHANNEL][0]);
-    }
-    if(!m_cVUl.cnt2) { // store avg from 64 * 8 * 8 samples in the array[2]
-        m_cVUl.sampleArray[LEFTCHANNEL][2][m_cVUl.cnt3] = largest(m_cVUl.sampleArray[LEFTCHANNEL][1]);
-        m_cVUl.sampleArray[RIGHTCHANNEL][2][m_cVUl.cnt3] = largest(m_cVUl.sampleArray[RIGHTCHANNEL][1]);
-    }
-    if(!m_cVUl.cnt3) { // store avg from 64 * 8 * 8 * 8 samples in the array[3]
-        m_cVUl.sampleArray[LEFTCHANNEL][3][m_cVUl.cnt4] = avg(m_cVUl.sampleArray[LEFTCHANNEL][2]);
-        m_cVUl.sampleArray[RIGHTCHANNEL][3][m_cVUl.cnt4] = avg(m_cVUl.sampleArray[RIGHTCHANNEL][2]);
+    audiolib::cVUl_t& v = m_cVUl;
+    while(frames) {
+        uint32_t n = min(frames, (uint32_t)(64 - v.cnt64));
+        uint8_t pl = v.peak[LEFTCHANNEL], pr = v.peak[RIGHTCHANNEL];
+        for(uint32_t i = 0; i < n; i++) {
+            uint8_t l = abs(buff[i * 2 + LEFTCHANNEL] >> 7);
+            uint8_t r = abs(buff[i * 2 + RIGHTCHANNEL] >> 7);
+            if(l > pl) pl = l;
+            if(r > pr) pr = r;
+        }
+        buff += n * 2;
+        frames -= n;
+        v.cnt64 += n;
+        if(v.cnt64 < 64) {v.peak[LEFTCHANNEL] = pl; v.peak[RIGHTCHANNEL] = pr; break;}
+        v.cnt64 = 0;
+        v.peak[LEFTCHANNEL] = v.peak[RIGHTCHANNEL] = 0;
+        v.peak64[LEFTCHANNEL][v.cnt512] = pl;
+        v.peak64[RIGHTCHANNEL][v.cnt512] = pr;
+        if(++v.cnt512 < 8) continue;
+        v.cnt512 = 0;
+        v.avg512[LEFTCHANNEL][v.cnt4096] = avg(v.peak64[LEFTCHANNEL]);
+        v.avg512[RIGHTCHANNEL][v.cnt4096] = avg(v.peak64[RIGHTCHANNEL]);
+        v.cnt4096 = (v.cnt4096 + 1) & 7;
+        m_vuLeft = avg(v.avg512[LEFTCHANNEL]);
+        m_vuRight = avg(v.avg512[RIGHTCHANNEL]);
     }
-    if(m_cVUl.f_vu) {
-        m_cVUl.f_vu = false;
-        m_vuLeft = avg(m_cVUl.sampleArray[LEFTCHANNEL][3]);
-        m_vuRight = avg(m_cVUl.sampleArray[RIGHTCHANNEL][3]);
-    }
-    m_cVUl.cnt1++;
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 uint16_t Audio::getVUlevel() {
@@ -5758,6 +5785,14 @@ uint16_t Audio::getVUlevel() {
     return (m_vuLeft << 8) + m_vuRight;
 }
 //------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+uint16_t Audio::getVUpeak() {
+    // 0 ... 255 per channel, getLevels() has the full picture
+    if(!m_f_running) return 0;
+    AudioLevelMeter::levels_t lv;
+    if(!m_levelMeter.getLevels(lv)) return 0;
+    return (min(lv.peak[LEFTCHANNEL] >> 7, 255) << 8) + min(lv.peak[RIGHTCHANNEL] >> 7, 255);
+}
+//------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 void Audio::setTone(int8_t gainLowPass, int8_t gainBandPass, int8_t gainHighPass) {
     // see https://www.earlevel.com/main/2013/10/13/biquad-calculator-v2/
     // values can be between -40 ... +6 (dB)
@@ -30,7 +30,9 @@
 #include <NetworkClient.h>
 #include <NetworkClientSecure.h>
 #include <driver/i2s_std.h>
+#include <AudioLevelMeter.h>
 #include "audiolib_structs.hpp"
+#include "hls_prefetch/hls_prefetch.h"
 
 #ifndef I2S_GPIO_UNUSED
   #define I2S_GPIO_UNUSED -1 // = I2S_PIN_NO_CHANGE in IDF < 5
@@ -159,11 +161,16 @@ class Audio{
     uint32_t     getAudioCurrentTime();
     uint32_t     getAudioFilePosition();
     bool         setAudioFilePosition(uint32_t pos);
-    uint16_t     getVUlevel();
+    uint16_t     getVUlevel();                // smoothed level (~90 ms), left << 8 | right, 0 ... 255 each
+    uint16_t     getVUpeak();                 // peak of the last 20 ms block, left << 8 | right, 0 ... 255 each
+    bool         getLevels(AudioLevelMeter::levels_t& levels) { return m_levelMeter.getLevels(levels); } // peak, RMS, LUFS, any task
+    void         setLoudnessMeter(bool enable) { m_levelMeter.setLoudness(enable); } // K-weighted LUFS in getLevels() (default off)
     uint32_t     inBufferFilled();            // returns the number of stored bytes in the inputbuffer
     uint32_t     inBufferFree();              // returns the number of free bytes in the inputbuffer
     uint32_t     getInBufferSize();           // returns the size of the inputbuffer in bytes
     bool         setInBufferSize(size_t mbs); // sets the size of the inputbuffer in bytes
+    void         setHLSPrefetch(bool enable);  // m3u8: load the next segments in the background (default on, needs PSRAM)
+    void         getHLSPrefetchStats(HLSPrefetch::stats_t& s) { m_hlsPrefetch.getStats(s); }
     void         setTone(int8_t gainLowPass, int8_t gainBandPass, int8_t gainHighPass);
     void         setI2SCommFMT_LSB(bool commFMT);
     int          getCodec() { return m_codec; }
@@ -189,6 +196,7 @@ class Audio{
     void         processWebFile();
     void         processWebStreamTS();
     void         processWebStreamHLS();
+    void         hlsPrefetchQueue(const char* next);
     void         playAudioData();
     bool         readPlayListData();
     const char*  parsePlaylist_M3U();
@@ -217,7 +225,7 @@ class Audio{
     bool         setChannels(int channels);
     size_t       resampleTo48kStereo(const int16_t* input, size_t inputFrames);
     void         playChunk();
-    void         computeVUlevel(int16_t sample[2]);
+    void         computeVUlevel(const int16_t* buff, uint32_t frames);
     void         computeLimit();
     void         Gain(int16_t* sample);
     void         showstreamtitle(char* ml);
@@ -631,6 +639,7 @@ private:
     uint8_t         m_filterType[2];                // lowpass, highpass
     uint8_t         m_streamType = ST_NONE;
     uint8_t         m_ID3Size = 0;                  // lengt of ID3frame - ID3header
+    AudioLevelMeter m_levelMeter;                   // peak/RMS/LUFS per block, fed by playChunk()
     uint8_t         m_vuLeft = 0;                   // average value of samples, left channel
     uint8_t         m_vuRight = 0;                  // average value of samples, right channel
     uint8_t         m_audioTaskCoreId = 0;
@@ -688,6 +697,8 @@ private:
     bool            m_f_acceptRanges = false;
     bool            m_f_reset_m3u8Codec = true;     // reset codec for m3u8 stream
     bool            m_f_connectionClose = false;    // set in parseHttpResponseHeader
+    bool            m_f_hlsPrefetch = true;         // use m_hlsPrefetch for m3u8 segments
+    bool            m_f_hlsSegment = false;         // the current m3u8 segment is read from m_hlsPrefetch, not from m_client
     uint32_t        m_audioFileDuration = 0;        // seconds
     uint32_t        m_audioCurrentTime = 0;         // seconds
     float           m_resampleError = 0.0f;
@@ -714,6 +725,7 @@ private:
     audiolib::ID3Hdr_t m_ID3Hdr;
     audiolib::pwsHLS_t m_pwsHLS;
     audiolib::pplM3u8_t m_pplM3U8;
+    HLSPrefetch        m_hlsPrefetch;
     audiolib::m4aHdr_t m_m4aHdr;
     audiolib::plCh_t m_plCh;
     audiolib::lVar_t m_lVar;
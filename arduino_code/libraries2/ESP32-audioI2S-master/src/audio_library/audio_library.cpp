@@ -0,0 +1,615 @@
+/*
+ * audio_library.cpp
+ *
+ * Created on: Oct 18,2026
+ *
+ *  Media library index, see audio_library.h for the file layout
+ *
+ *  AudioLibrary lib;
+ *  lib.begin(SD_MMC);            // ~ms for 10k tracks, one read of the index file
+ *  lib.startScan("/music");      // background task, only new or changed files are parsed
+ *  AudioLibrary::track_t t;
+ *  for(int i = 0; i < lib.count(); i++){ lib.getTrack(i, t); printf("%s - %s\n", t.artist, t.title); }
+ *
+ */
+#include "audio_library.h"
+#include <algorithm>
+
+constexpr size_t   AUDIOLIB_STACK_SIZE  = 6144;
+constexpr uint32_t AUDIOLIB_POOL_CHUNK  = 32768;
+constexpr uint32_t AUDIOLIB_ENTRY_CHUNK = 256;
+constexpr size_t   AUDIOLIB_READBUFF    = AUDIOLIB_MAX_TAG_LEN * 4;
+
+//----------------------------------------------------------------------------------------------------------------------
+AudioLibrary::AudioLibrary() {
+    m_mutex = xSemaphoreCreateMutex();
+}
+
+AudioLibrary::~AudioLibrary() {
+    stopScan();
+    vSemaphoreDelete(m_mutex);
+}
+//----------------------------------------------------------------------------------------------------------------------
+bool AudioLibrary::begin(fs::FS& fs, const char* indexPath) {
+    stopScan();
+    m_fs = &fs;
+    m_indexPath.assign(indexPath);
+    xSemaphoreTake(m_mutex, portMAX_DELAY);
+    bool res = loadIndex();
+    xSemaphoreGive(m_mutex);
+    if(res) log_i("audio library: %lu tracks loaded from %s", (unsigned long)m_hdr->numRecords, indexPath);
+    else    log_i("audio library: no valid index in %s, a scan is required", indexPath);
+    return res;
+}
+//----------------------------------------------------------------------------------------------------------------------
+bool AudioLibrary::startScan(const char* rootDir, uint8_t coreID) {
+    if(!m_fs) {log_e("call begin() first"); return false;}
+    if(m_f_scanning) {log_w("scan is already running"); return false;}
+    m_rootDir.assign(rootDir);
+    m_f_stopScan = false;
+    m_f_scanning = true;
+    BaseType_t res = xTaskCreatePinnedToCore(
+        &AudioLibrary::taskWrapper, /* Function to implement the task */
+        "AudioLibScan",             /* Name of the task */
+        AUDIOLIB_STACK_SIZE,        /* Stack size */
+        this,                       /* Task input parameter */
+        1,                          /* Priority, below the audio task (2) */
+        &m_scanTaskHandle,          /* Task handle */
+        coreID                      /* Core where the task should run */
+    );
+    if(res != pdPASS) {
+        log_e("can't create scan task");
+        m_f_scanning = false;
+        return false;
+    }
+    return true;
+}
+//----------------------------------------------------------------------------------------------------------------------
+void AudioLibrary::stopScan() {
+    if(!m_f_scanning) return;
+    m_f_stopScan = true;
+    while(m_f_scanning) vTaskDelay(10);
+}
+//----------------------------------------------------------------------------------------------------------------------
+size_t AudioLibrary::count() {
+    xSemaphoreTake(m_mutex, portMAX_DELAY);
+    size_t n = m_hdr ? m_hdr->numRecords : 0;
+    xSemaphoreGive(m_mutex);
+    return n;
+}
+//----------------------------------------------------------------------------------------------------------------------
+bool AudioLibrary::getTrack(size_t idx, track_t& t) {
+    xSemaphoreTake(m_mutex, portMAX_DELAY);
+    if(!m_hdr || idx >= m_hdr->numRecords) {
+        xSemaphoreGive(m_mutex);
+        return false;
+    }
+    const libRecord_t& r = records()[idx];
+    t.path     = indexStr(r.path);
+    t.title    = indexStr(r.title);
+    t.artist   = indexStr(r.artist);
+    t.album    = indexStr(r.album);
+    t.size     = r.size;
+    t.duration = r.duration;
+    t.codec    = r.codec;
+    xSemaphoreGive(m_mutex);
+    return true;
+}
+//----------------------------------------------------------------------------------------------------------------------
+int32_t AudioLibrary::findByPath(const char* path) { // binary search over the path sorted permutation
+    xSemaphoreTake(m_mutex, portMAX_DELAY);
+    int32_t res = -1;
+    if(m_hdr && m_pathOrder.valid()) {
+        int32_t lo = 0, hi = (int32_t)m_hdr->numRecords - 1;
+        while(lo <= hi) {
+            int32_t mid = (lo + hi) / 2;
+            uint32_t idx = m_pathOrder.get()[mid];
+            int cmp = strcmp(indexStr(records()[idx].path), path);
+            if(cmp == 0) {res = idx; break;}
+            if(cmp < 0) lo = mid + 1;
+            else        hi = mid - 1;
+        }
+    }
+    xSemaphoreGive(m_mutex);
+    return res;
+}
+//----------------------------------------------------------------------------------------------------------------------
+void AudioLibrary::taskWrapper(void* param) {
+    AudioLibrary* lib = (AudioLibrary*)param;
+    lib->scanTask();
+}
+//----------------------------------------------------------------------------------------------------------------------
+void AudioLibrary::scanTask() {
+    uint32_t t0 = millis();
+    m_poolUsed = 0;
+    m_numEntries = 0;
+    m_numParsed = 0;
+    m_maxEntries = AUDIOLIB_ENTRY_CHUNK;
+    m_pool.alloc(AUDIOLIB_POOL_CHUNK, "m_pool");
+    m_entries.alloc(m_maxEntries * sizeof(entry_t), "m_entries");
+    m_readBuff.alloc(AUDIOLIB_READBUFF + 4, "m_readBuff");
+
+    if(m_pool.valid() && m_entries.valid() && m_readBuff.valid()) {
+        poolAdd("", 0); // offset 0 is always the empty string, used for missing tags
+        walkDir(m_rootDir.get(), 0);
+        uint32_t numOld = count();
+        if(m_f_stopScan) {
+            log_i("audio library: scan aborted");
+        }
+        else if(m_numParsed == 0 && m_numEntries == numOld) {
+            log_i("audio library: index is up to date, %lu tracks", (unsigned long)numOld);
+        }
+        else {
+            writeIndex();
+        }
+    }
+    freeStaging();
+    uint32_t ms = millis() - t0;
+    log_i("audio library: scan finished, %lu files parsed in %lu ms", (unsigned long)m_numParsed, (unsigned long)ms);
+    if(scan_done_callback && !m_f_stopScan) scan_done_callback(count(), m_numParsed, ms);
+    m_scanTaskHandle = nullptr;
+    m_f_scanning = false;
+    vTaskDelete(NULL);
+}
+//----------------------------------------------------------------------------------------------------------------------
+void AudioLibrary::freeStaging() {
+    m_pool.reset();
+    m_entries.reset();
+    m_readBuff.reset();
+    m_poolUsed = 0;
+    m_numEntries = 0;
+    m_maxEntries = 0;
+}
+//----------------------------------------------------------------------------------------------------------------------
+void AudioLibrary::walkDir(const char* dir, uint8_t depth) {
+    File root = m_fs->open(dir);
+    if(!root || !root.isDirectory()) {log_e("can't open directory %s", dir); return;}
+    File file = root.openNextFile();
+    while(file && !m_f_stopScan) {
+        if(file.isDirectory()) {
+            if(depth < AUDIOLIB_MAX_DIR_DEPTH) walkDir(file.path(), depth + 1);
+        }
+        else {
+            addFile(file);
+        }
+        file = root.openNextFile();
+    }
+}
+//----------------------------------------------------------------------------------------------------------------------
+uint8_t AudioLibrary::codecFromPath(const char* path) {
+    const char* ext = strrchr(path, '.');
+    if(!ext) return CODEC_UNKNOWN;
+    if(!strcasecmp(ext, ".mp3"))  return CODEC_MP3;
+    if(!strcasecmp(ext, ".m4a"))  return CODEC_M4A;
+    if(!strcasecmp(ext, ".flac")) return CODEC_FLAC;
+    if(!strcasecmp(ext, ".wav"))  return CODEC_WAV;
+    if(!strcasecmp(ext, ".ogg"))  return CODEC_OGG;
+    if(!strcasecmp(ext, ".opus")) return CODEC_OPUS;
+    return CODEC_UNKNOWN;
+}
+//----------------------------------------------------------------------------------------------------------------------
+void AudioLibrary::addFile(File& file) {
+    const char* path = file.path();
+    uint8_t codec = codecFromPath(path);
+    if(codec == CODEC_UNKNOWN) return;
+
+    if(m_numEntries == m_maxEntries) {
+        m_maxEntries += AUDIOLIB_ENTRY_CHUNK;
+        m_entries.realloc(m_maxEntries * sizeof(entry_t));
+        if(m_entries.size() < m_maxEntries * sizeof(entry_t)) {m_f_stopScan = true; return;} // OOM
+    }
+    entry_t& e = m_entries.get()[m_numEntries];
+    memset(&e, 0, sizeof(entry_t));
+    e.size  = file.size();
+    e.mtime = (uint32_t)file.getLastWrite();
+    e.codec = codec;
+    e.path  = poolAdd(path, strlen(path));
+
+    int32_t old = findByPath(path);
+    if(old >= 0) { // known file, take the tags from the index if the file has not been changed
+        xSemaphoreTake(m_mutex, portMAX_DELAY);
+        const libRecord_t r = records()[old];
+        bool unchanged = (r.size == e.size && r.mtime == e.mtime);
+        if(unchanged) {
+            const char* title  = indexStr(r.title);
+            const char* artist = indexStr(r.artist);
+            const char* album  = indexStr(r.album);
+            e.tag[0]   = poolAdd(title,  strlen(title));
+            e.tag[1]   = poolAdd(artist, strlen(artist));
+            e.tag[2]   = poolAdd(album,  strlen(album));
+            e.duration = r.duration;
+        }
+        xSemaphoreGive(m_mutex);
+        if(unchanged) {m_numEntries++; return;}
+    }
+
+    parseTags(file, codec, e);
+    m_numParsed++;
+    if(!e.tag[0]) { // no title, use the file name without extension
+        const char* name = strrchr(path, '/');
+        name = name ? name + 1 : path;
+        const char* ext = strrchr(name, '.');
+        e.tag[0] = poolAdd(name, ext ? ext - name : strlen(name));
+    }
+    m_numEntries++;
+    if((m_numParsed & 0x1F) == 0) vTaskDelay(1); // give the SD card back to the audio task from time to time
+}
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t AudioLibrary::poolAdd(const char* str, size_t len) {
+    if(len > AUDIOLIB_MAX_TAG_LEN && str[0] != '/') { // truncate tags, but not paths, at a UTF-8 boundary
+        len = AUDIOLIB_MAX_TAG_LEN;
+        while(len && (str[len] & 0xC0) == 0x80) len--;
+    }
+    if(m_poolUsed + len + 1 > m_pool.size()) {
+        size_t newSize = m_pool.size() + AUDIOLIB_POOL_CHUNK + len;
+        m_pool.realloc(newSize);
+        if(m_pool.size() < newSize) {m_f_stopScan = true; return 0;} // OOM
+    }
+    uint32_t offset = m_poolUsed;
+    memcpy(m_pool.get() + offset, str, len);
+    m_pool.get()[offset + len] = '\0';
+    m_poolUsed += len + 1;
+    return offset;
+}
+//----------------------------------------------------------------------------------------------------------------------
+void AudioLibrary::setTag(entry_t& e, uint8_t field, const char* str) {
+    if(!str || e.tag[field]) return; // first occurrence wins
+    size_t len = strlen(str);
+    while(len && (str[len - 1] == ' ' || str[len - 1] == '\r' || str[len - 1] == '\n')) len--; // ID3v1 is space padded
+    while(len && *str == ' ') {str++; len--;}
+    if(!len) return;
+    e.tag[field] = poolAdd(str, len);
+}
+//----------------------------------------------------------------------------------------------------------------------
+void AudioLibrary::setTagEncoded(entry_t& e, uint8_t field, const uint8_t* data, size_t len) {
+    // ID3v2 text frame: first byte is the text encoding, 0: ISO-8859-1, 1: UTF-16 with BOM, 2: UTF-16BE, 3: UTF-8
+    if(len < 2 || e.tag[field]) return;
+    uint8_t enc = data[0];
+    uint8_t* buff = m_readBuff.get();
+    len -= 1;
+    if(len > AUDIOLIB_READBUFF) len = AUDIOLIB_READBUFF;
+    if((enc == 1 || enc == 2) && (len & 1)) len--;
+    memmove(buff, data + 1, len);
+    memset(buff + len, 0, 4);
+    ps_ptr<char> tmp;
+    switch(enc) {
+        case 0:  tmp.copy_from_iso8859_1(buff); break;
+        case 1:  tmp.copy_from_utf16(buff, false); break;
+        case 2:  tmp.copy_from_utf16(buff, true); break;
+        default: setTag(e, field, (const char*)buff); return;
+    }
+    if(tmp.valid()) setTag(e, field, tmp.get());
+}
+//----------------------------------------------------------------------------------------------------------------------
+void AudioLibrary::parseTags(File& file, uint8_t codec, entry_t& e) {
+    switch(codec) {
+        case CODEC_MP3:  parseID3v2(file, e); parseID3v1(file, e); break;
+        case CODEC_FLAC: parseFLAC(file, e); break;
+        case CODEC_M4A:  parseM4A(file, e); break;
+        case CODEC_WAV:  parseID3v2(file, e); break; // rare, but some tools write an ID3 header
+        default: break;                             // OGG/OPUS: file name only
+    }
+}
+//----------------------------------------------------------------------------------------------------------------------
+void AudioLibrary::parseID3v2(File& file, entry_t& e) {
+    uint8_t h[10];
+    if(!file.seek(0) || file.read(h, 10) != 10) return;
+    if(memcmp(h, "ID3", 3)) return;
+    uint8_t  version = h[3];
+    uint32_t tagEnd = 10 + bigEndian(h + 6, 4, 7); // syncsafe integer
+    uint32_t pos = 10;
+    if(version >= 3 && (h[5] & 0x40)) { // extended header
+        if(file.read(h, 4) != 4) return;
+        uint32_t extSize = (version == 3) ? 4 + bigEndian(h, 4)  // size without the size field
+                                          : bigEndian(h, 4, 7);  // v2.4: syncsafe, size field included
+        if(extSize > tagEnd - pos) return;
+        pos += extSize;
+    }
+    uint8_t hdrLen = (version == 2) ? 6 : 10;
+    while(pos + hdrLen <= tagEnd && pos + hdrLen <= e.size) {
+        if(!file.seek(pos) || file.read(h, hdrLen) != hdrLen) return;
+        if(h[0] == 0) return; // padding
+        char frameId[5] = {0};
+        uint32_t frameSize;
+        if(version == 2) {memcpy(frameId, h, 3); frameSize = bigEndian(h + 3, 3);}
+        else             {memcpy(frameId, h, 4); frameSize = (version == 4) ? bigEndian(h + 4, 4, 7) : bigEndian(h + 4, 4);}
+        pos += hdrLen;
+        if(frameSize > tagEnd - pos) return; // a frame can't leave the tag, the size is broken
+        int8_t field = -1;
+        if(!strcmp(frameId, "TIT2") || !strcmp(frameId, "TT2")) field = 0;
+        if(!strcmp(frameId, "TPE1") || !strcmp(frameId, "TP1")) field = 1;
+        if(!strcmp(frameId, "TALB") || !strcmp(frameId, "TAL")) field = 2;
+        bool isLength = !strcmp(frameId, "TLEN") || !strcmp(frameId, "TLE");
+        if((field >= 0 && !e.tag[field]) || (isLength && !e.duration)) {
+            size_t n = std::min<size_t>(frameSize, AUDIOLIB_READBUFF);
+            if(file.read(m_readBuff.get(), n) != n) return;
+            if(field >= 0) {
+                setTagEncoded(e, field, m_readBuff.get(), n);
+            }
+            else if(n > 1) {
+                m_readBuff.get()[std::min<size_t>(n, AUDIOLIB_READBUFF - 1)] = '\0';
+                e.duration = atol((const char*)m_readBuff.get() + 1) / 1000; // TLEN is in milliseconds
+            }
+        }
+        if(e.tag[0] && e.tag[1] && e.tag[2] && e.duration) return;
+        pos += frameSize;
+    }
+}
+//----------------------------------------------------------------------------------------------------------------------
+void AudioLibrary::parseID3v1(File& file, entry_t& e) {
+    if(e.tag[0] && e.tag[1] && e.tag[2]) return;
+    if(e.size < 128) return;
+    uint8_t* b = m_readBuff.get();
+    if(!file.seek(e.size - 128) || file.read(b, 128) != 128) return;
+    if(memcmp(b, "TAG", 3)) return;
+    char field[31];
+    for(int i = 0; i < 3; i++) { // title 3..32, artist 33..62, album 63..92, each 30 bytes ISO-8859-1
+        memcpy(field, b + 3 + i * 30, 30);
+        field[30] = '\0';
+        ps_ptr<char> tmp;
+        tmp.copy_from_iso8859_1((const uint8_t*)field);
+        if(tmp.valid()) setTag(e, i, tmp.get());
+    }
+}
+//----------------------------------------------------------------------------------------------------------------------
+void AudioLibrary::parseFLAC(File& file, entry_t& e) {
+    uint8_t h[18];
+    if(!file.seek(0) || file.read(h, 4) != 4) return;
+    if(memcmp(h, "fLaC", 4)) {parseID3v2(file, e); return;} // FLAC with a leading ID3 tag is not worth the effort
+    uint32_t pos = 4;
+    bool last = false;
+    while(!last && pos + 4 <= e.size) {
+        if(!file.seek(pos) || file.read(h, 4) != 4) return;
+        last = h[0] & 0x80;
+        uint8_t  blockType = h[0] & 0x7F;
+        uint32_t blockLen = bigEndian(h + 1, 3);
+        pos += 4;
+        if(blockLen > e.size - pos) return; // block runs past the end of the file
+        if(blockType == 0 && blockLen >= 18) { // STREAMINFO
+            if(file.read(h, 18) != 18) return;
+            uint32_t sampleRate = (h[10] << 12) | (h[11] << 4) | (h[12] >> 4);
+            uint64_t totalSamples = ((uint64_t)(h[13] & 0x0F) << 32) | bigEndian(h + 14, 4);
+            if(sampleRate) e.duration = totalSamples / sampleRate;
+        }
+        if(blockType == 4) { // VORBIS_COMMENT, little endian lengths
+            uint32_t p = pos, end = pos + blockLen;
+            if(blockLen < 8 || file.read(h, 4) != 4) return;
+            uint32_t vendorLen = littleEndian(h, 4);
+            if(vendorLen > blockLen - 8) return;
+            p += 4 + vendorLen; // skip vendor string
+            if(!file.seek(p) || file.read(h, 4) != 4) return;
+            uint32_t numComments = littleEndian(h, 4);
+            p += 4;
+            uint8_t* b = m_readBuff.get();
+            for(uint32_t i = 0; i < numComments && p + 4 <= end; i++) {
+                if(!file.seek(p) || file.read(h, 4) != 4) return;
+                uint32_t len = littleEndian(h, 4);
+                p += 4;
+                if(len > end - p) return; // comment runs past the block
+                if(len < AUDIOLIB_READBUFF) {
+                    if(file.read(b, len) != len) return;
+                    b[len] = '\0';
+                    const char* c = (const char*)b;
+                    if     (!strncasecmp(c, "TITLE=", 6))  setTag(e, 0, c + 6);
+                    else if(!strncasecmp(c, "ARTIST=", 7)) setTag(e, 1, c + 7);
+                    else if(!strncasecmp(c, "ALBUM=", 6))  setTag(e, 2, c + 6);
+                }
+                p += len;
+            }
+        }
+        pos += blockLen;
+    }
+}
+//----------------------------------------------------------------------------------------------------------------------
+bool AudioLibrary::m4aFindAtom(File& file, uint32_t start, uint32_t end, const char* name, uint32_t* atomStart, uint32_t* atomSize) {
+    uint8_t h[16];
+    uint32_t pos = start;
+    while(pos + 8 <= end) {
+        if(!file.seek(pos) || file.read(h, 8) != 8) return false;
+        uint32_t size = bigEndian(h, 4);
+        if(size == 1) { // 64 bit size follows, only the low word is of interest (files < 4GB)
+            if(file.read(h + 8, 8) != 8) return false;
+            size = bigEndian(h + 12, 4);
+        }
+        if(size == 0) size = end - pos; // atom extends to the end
+        if(size < 8) return false;
+        if(!memcmp(h + 4, name, 4)) {
+            *atomStart = pos;
+            *atomSize = size;
+            return true;
+        }
+        pos += size;
+    }
+    return false;
+}
+//----------------------------------------------------------------------------------------------------------------------
+void AudioLibrary::parseM4A(File& file, entry_t& e) {
+    //  moov -> mvhd                     duration
+    //       -> udta -> meta -> ilst     ©nam, ©ART, ©alb -> data
+    uint32_t moovPos, moovSize, pos, size;
+    if(!m4aFindAtom(file, 0, e.size, "moov", &moovPos, &moovSize)) return;
+    uint32_t moovEnd = moovPos + moovSize;
+    uint8_t* b = m_readBuff.get();
+
+    if(m4aFindAtom(file, moovPos + 8, moovEnd, "mvhd", &pos, &size) && size >= 40) {
+        if(file.seek(pos + 8) && file.read(b, 32) == 32) {
+            uint32_t timescale, duration;
+            if(b[0] == 1) {timescale = bigEndian(b + 20, 4); duration = bigEndian(b + 28, 4);} // version 1, 64 bit times
+            else          {timescale = bigEndian(b + 12, 4); duration = bigEndian(b + 16, 4);}
+            if(timescale) e.duration = duration / timescale;
+        }
+    }
+    uint32_t udtaPos, udtaSize, metaPos, metaSize, ilstPos, ilstSize;
+    if(!m4aFindAtom(file, moovPos + 8, moovEnd, "udta", &udtaPos, &udtaSize)) return;
+    if(!m4aFindAtom(file, udtaPos + 8, udtaPos + udtaSize, "meta", &metaPos, &metaSize)) return;
+    if(!m4aFindAtom(file, metaPos + 12, metaPos + metaSize, "ilst", &ilstPos, &ilstSize)) return; // meta is a full atom
+    static const char* names[3] = {"\xA9nam", "\xA9" "ART", "\xA9" "alb"};
+    for(int i = 0; i < 3; i++) {
+        uint32_t itemPos, itemSize, dataPos, dataSize;
+        if(!m4aFindAtom(file, ilstPos + 8, ilstPos + ilstSize, names[i], &itemPos, &itemSize)) continue;
+        if(!m4aFindAtom(file, itemPos + 8, itemPos + itemSize, "data", &dataPos, &dataSize)) continue;
+        if(dataSize <= 16) continue;
+        uint32_t len = std::min<uint32_t>(dataSize - 16, AUDIOLIB_READBUFF); // size, 'data', type, locale
+        if(!file.seek(dataPos + 16) || file.read(b, len) != len) continue;
+        b[len] = '\0';
+        setTag(e, i, (const char*)b); // UTF-8
+    }
+}
+//----------------------------------------------------------------------------------------------------------------------
+bool AudioLibrary::writeIndex() {
+    uint32_t n = m_numEntries;
+    if(n == 0) { // every track is gone, drop the old index instead of keeping it on flash
+        m_fs->remove(m_indexPath.get());
+        xSemaphoreTake(m_mutex, portMAX_DELAY);
+        m_hdr = nullptr;
+        m_pathOrder.reset();
+        m_index.reset();
+        xSemaphoreGive(m_mutex);
+        log_i("audio library: no tracks, index removed");
+        return true;
+    }
+    ps_ptr<strRef_t> refs;
+    ps_ptr<uint32_t> tblOffs;
+    refs.alloc(n * 4 * sizeof(strRef_t), "refs");
+    tblOffs.alloc(n * 4 * sizeof(uint32_t), "tblOffs");
+    if(!refs.valid() || !tblOffs.valid()) return false;
+
+    // sort all strings, identical strings become neighbours
+    const entry_t* entries = m_entries.get();
+    strRef_t* r = refs.get();
+    for(uint32_t i = 0; i < n; i++) {
+        r[i * 4 + 0] = {entries[i].path,   i * 4 + 0};
+        r[i * 4 + 1] = {entries[i].tag[0], i * 4 + 1};
+        r[i * 4 + 2] = {entries[i].tag[1], i * 4 + 2};
+        r[i * 4 + 3] = {entries[i].tag[2], i * 4 + 3};
+    }
+    const char* pool = m_pool.get();
+    std::sort(r, r + n * 4, [pool](const strRef_t& a, const strRef_t& b) {
+        return strcmp(pool + a.poolOffset, pool + b.poolOffset) < 0;
+    });
+
+    // first pass: size of the deduplicated string table
+    uint32_t strSize = 1; // at least the empty string
+    for(uint32_t i = 0; i < n * 4; i++) {
+        if(i == 0 || strcmp(pool + r[i].poolOffset, pool + r[i - 1].poolOffset)) strSize += strlen(pool + r[i].poolOffset) + 1;
+    }
+    if(n && pool[r[0].poolOffset] == '\0') strSize -= 1; // empty string is already part of the table
+
+    uint32_t recOffset = sizeof(libHeader_t);
+    uint32_t strOffset = recOffset + n * sizeof(libRecord_t);
+    uint32_t fileSize  = strOffset + strSize;
+    ps_ptr<uint8_t> blob;
+    blob.alloc(fileSize, "index");
+    if(!blob.valid()) return false;
+
+    // second pass: fill the string table, remember the table offset of every slot
+    char* tbl = (char*)blob.get() + strOffset;
+    uint32_t used = 1;
+    tbl[0] = '\0';
+    uint32_t lastOffs = 0;
+    for(uint32_t i = 0; i < n * 4; i++) {
+        const char* s = pool + r[i].poolOffset;
+        if(*s == '\0') {tblOffs.get()[r[i].slot] = 0; continue;}
+        if(i == 0 || strcmp(s, pool + r[i - 1].poolOffset)) {
+            size_t len = strlen(s) + 1;
+            memcpy(tbl + used, s, len);
+            lastOffs = used;
+            used += len;
+        }
+        tblOffs.get()[r[i].slot] = lastOffs;
+    }
+    refs.reset();
+
+    libRecord_t* rec = (libRecord_t*)(blob.get() + recOffset);
+    for(uint32_t i = 0; i < n; i++) {
+        memset(&rec[i], 0, sizeof(libRecord_t));
+        rec[i].path     = tblOffs.get()[i * 4 + 0];
+        rec[i].title    = tblOffs.get()[i * 4 + 1];
+        rec[i].artist   = tblOffs.get()[i * 4 + 2];
+        rec[i].album    = tblOffs.get()[i * 4 + 3];
+        rec[i].size     = entries[i].size;
+        rec[i].mtime    = entries[i].mtime;
+        rec[i].duration = entries[i].duration;
+        rec[i].codec    = entries[i].codec;
+    }
+    tblOffs.reset();
+    std::sort(rec, rec + n, [](const libRecord_t& a, const libRecord_t& b) { // offsets are ordered like the strings
+        if(a.title  != b.title)  return a.title  < b.title;
+        if(a.artist != b.artist) return a.artist < b.artist;
+        return a.path < b.path;
+    });
+
+    libHeader_t* hdr = (libHeader_t*)blob.get();
+    memset(hdr, 0, sizeof(libHeader_t));
+    hdr->magic        = AUDIOLIB_INDEX_MAGIC;
+    hdr->version      = AUDIOLIB_INDEX_VERSION;
+    hdr->recordSize   = sizeof(libRecord_t);
+    hdr->numRecords   = n;
+    hdr->recordOffset = recOffset;
+    hdr->strOffset    = strOffset;
+    hdr->strSize      = strSize;
+    hdr->fileSize     = fileSize;
+
+    // write to a temporary file first, a power loss must not leave a broken index behind
+    ps_ptr<char> tmpPath;
+    tmpPath.assign(m_indexPath.get());
+    tmpPath.append(".tmp");
+    File f = m_fs->open(tmpPath.get(), FILE_WRITE);
+    if(!f) {log_e("can't create %s", tmpPath.get()); return false;}
+    size_t written = f.write(blob.get(), fileSize);
+    f.close();
+    if(written != fileSize) {log_e("write error %s", tmpPath.get()); m_fs->remove(tmpPath.get()); return false;}
+    m_fs->remove(m_indexPath.get());
+    if(!m_fs->rename(tmpPath.get(), m_indexPath.get())) {log_e("can't rename %s", tmpPath.get()); return false;}
+
+    // the blob is the index, no need to read it back
+    xSemaphoreTake(m_mutex, portMAX_DELAY);
+    m_index = std::move(blob);
+    bool res = loadIndex();
+    xSemaphoreGive(m_mutex);
+    log_i("audio library: %lu tracks, index %lu bytes", (unsigned long)n, (unsigned long)fileSize);
+    return res;
+}
+//----------------------------------------------------------------------------------------------------------------------
+bool AudioLibrary::loadIndex() { // mutex must be taken, reads the file only if m_index is empty
+    m_hdr = nullptr;
+    m_pathOrder.reset();
+    if(!m_index.valid()) {
+        File f = m_fs->open(m_indexPath.get(), FILE_READ);
+        if(!f) return false;
+        size_t fileSize = f.size();
+        if(fileSize < sizeof(libHeader_t)) return false;
+        m_index.alloc(fileSize, "index");
+        if(!m_index.valid()) return false;
+        if(f.read(m_index.get(), fileSize) != fileSize) {m_index.reset(); return false;}
+        if(((const libHeader_t*)m_index.get())->fileSize != fileSize) {m_index.reset(); return false;} // truncated
+    }
+    const libHeader_t* hdr = (const libHeader_t*)m_index.get();
+    bool ok = m_index.size() >= sizeof(libHeader_t) &&
+              hdr->magic == AUDIOLIB_INDEX_MAGIC && hdr->version == AUDIOLIB_INDEX_VERSION &&
+              hdr->recordSize == sizeof(libRecord_t) && hdr->fileSize <= m_index.size() &&
+              hdr->recordOffset >= sizeof(libHeader_t) && (hdr->recordOffset & 3) == 0 &&
+              hdr->recordOffset + (uint64_t)hdr->numRecords * sizeof(libRecord_t) <= hdr->strOffset &&
+              hdr->strSize > 0 && hdr->strOffset + (uint64_t)hdr->strSize == hdr->fileSize &&
+              m_index.get()[hdr->fileSize - 1] == '\0'; // every string offset below strSize ends inside the table
+    if(ok) { // getTrack() and indexStr() trust the offsets, a single bad record rejects the whole index
+        const libRecord_t* rec = (const libRecord_t*)(m_index.get() + hdr->recordOffset);
+        for(uint32_t i = 0; ok && i < hdr->numRecords; i++) {
+            ok = rec[i].path < hdr->strSize && rec[i].title < hdr->strSize &&
+                 rec[i].artist < hdr->strSize && rec[i].album < hdr->strSize;
+        }
+    }
+    if(!ok) {
+        log_e("audio library: index is corrupt or has a different version");
+        m_index.reset();
+        return false;
+    }
+    m_hdr = hdr;
+    m_pathOrder.alloc(hdr->numRecords * sizeof(uint32_t) + 4, "m_pathOrder");
+    if(!m_pathOrder.valid()) return true; // index is usable, rescans will parse every file
+    uint32_t* order = m_pathOrder.get();
+    for(uint32_t i = 0; i < hdr->numRecords; i++) order[i] = i;
+    const libRecord_t* rec = records();
+    std::sort(order, order + hdr->numRecords, [rec](uint32_t a, uint32_t b) { return rec[a].path < rec[b].path; });
+    return true;
+}
@@ -0,0 +1,153 @@
+/*
+ * audio_library.h
+ *
+ * Created on: Oct 18,2026
+ *
+ *  Media library index for SD/SD_MMC/LittleFS/FFat.
+ *
+ *  A low priority task walks the file system once, reads title/artist/album from ID3v2/ID3v1, FLAC VORBIS_COMMENT
+ *  and M4A 'ilst' atoms and writes a compact binary index. On the next boot the index is loaded with a single read
+ *  and only files whose size or mtime changed are parsed again.
+ *
+ *  Index layout (little endian, all offsets relative to the start of the file, no pointers -> memory mappable):
+ *
+ *  |<-- header 32 bytes -->|<-- records numRecords * 32 bytes -->|<-- string table strSize bytes -->|
+ *
+ *  The string table holds every path and tag string exactly once, zero terminated and sorted in ascending byte
+ *  order. Therefore comparing two string offsets is the same as comparing the strings, the records are kept
+ *  sorted by (title, artist, path) offset and a listing needs no string compare at all.
+ *
+ */
+#pragma once
+#pragma GCC optimize ("Ofast")
+
+#include "Arduino.h"
+#include <FS.h>
+#include <functional>
+#include "../psram_unique_ptr.hpp"
+
+#define AUDIOLIB_INDEX_MAGIC    0x42494C41  // "ALIB"
+#define AUDIOLIB_INDEX_VERSION  1
+#define AUDIOLIB_MAX_TAG_LEN    256         // longer tags are truncated
+#define AUDIOLIB_MAX_DIR_DEPTH  8
+
+class AudioLibrary {
+
+  public:
+    typedef struct _libHeader{
+        uint32_t magic;         // AUDIOLIB_INDEX_MAGIC
+        uint16_t version;       // AUDIOLIB_INDEX_VERSION
+        uint16_t recordSize;    // sizeof(libRecord_t)
+        uint32_t numRecords;
+        uint32_t recordOffset;
+        uint32_t strOffset;
+        uint32_t strSize;
+        uint32_t fileSize;      // sanity check, size of the whole index file
+        uint32_t reserved;
+    } libHeader_t;
+
+    typedef struct _libRecord{
+        uint32_t path;          // offsets into the string table
+        uint32_t title;
+        uint32_t artist;
+        uint32_t album;
+        uint32_t size;          // file size in bytes
+        uint32_t mtime;         // last write time, File::getLastWrite()
+        uint32_t duration;      // seconds, 0 if unknown
+        uint8_t  codec;         // CODEC_xxx
+        uint8_t  flags;
+        uint16_t reserved;
+    } libRecord_t;
+
+    typedef struct _track{      // view into the loaded index, valid until the next scan has finished
+        const char* path;
+        const char* title;
+        const char* artist;
+        const char* album;
+        uint32_t    size;
+        uint32_t    duration;
+        uint8_t     codec;
+    } track_t;
+
+    enum : uint8_t { CODEC_UNKNOWN = 0, CODEC_MP3 = 1, CODEC_M4A = 2, CODEC_FLAC = 3, CODEC_WAV = 4, CODEC_OGG = 5, CODEC_OPUS = 6 };
+
+    AudioLibrary();
+    ~AudioLibrary();
+
+    bool         begin(fs::FS& fs, const char* indexPath = "/audiolib.idx");   // loads an existing index (if any)
+    bool         startScan(const char* rootDir = "/", uint8_t coreID = 0);     // background rescan, priority 1
+    void         stopScan();
+    bool         isScanning() { return m_f_scanning; }
+    size_t       count();                                                      // number of tracks in the index
+    bool         getTrack(size_t idx, track_t& t);                            // sorted by title, artist, path
+    int32_t      findByPath(const char* path);                                 // -1 if not found
+    inline static std::function<void(uint32_t numTracks, uint32_t numParsed, uint32_t ms)> scan_done_callback;
+
+  private:
+    typedef struct _entry{      // staging area during a scan, offsets into m_pool
+        uint32_t path;
+        uint32_t tag[3];        // title, artist, album
+        uint32_t size;
+        uint32_t mtime;
+        uint32_t duration;
+        uint8_t  codec;
+    } entry_t;
+
+    typedef struct _strRef{
+        uint32_t poolOffset;
+        uint32_t slot;          // entryIdx * 4 + field (0 = path, 1..3 = tags)
+    } strRef_t;
+
+    static void  taskWrapper(void* param);
+    void         scanTask();
+    bool         loadIndex();
+    bool         writeIndex();
+    void         walkDir(const char* dir, uint8_t depth);
+    void         addFile(File& file);
+    uint8_t      codecFromPath(const char* path);
+    void         parseTags(File& file, uint8_t codec, entry_t& e);
+    void         parseID3v2(File& file, entry_t& e);
+    void         parseID3v1(File& file, entry_t& e);
+    void         parseFLAC(File& file, entry_t& e);
+    void         parseM4A(File& file, entry_t& e);
+    bool         m4aFindAtom(File& file, uint32_t start, uint32_t end, const char* name, uint32_t* atomStart, uint32_t* atomSize);
+    void         setTag(entry_t& e, uint8_t field, const char* str);
+    void         setTagEncoded(entry_t& e, uint8_t field, const uint8_t* data, size_t len);
+    uint32_t     poolAdd(const char* str, size_t len);
+    const char*  poolStr(uint32_t offset) { return m_pool.get() + offset; }
+    const libRecord_t* records() { return (const libRecord_t*)(m_index.get() + m_hdr->recordOffset); }
+    const char*  indexStr(uint32_t offset) { return (const char*)m_index.get() + m_hdr->strOffset + offset; }
+    void         freeStaging();
+
+    uint32_t     bigEndian(const uint8_t* base, uint8_t numBytes, uint8_t shiftLeft = 8) {
+        uint32_t result = 0;
+        for(int i = 0; i < numBytes; i++) result |= (uint32_t)base[i] << ((numBytes - i - 1) * shiftLeft);
+        return result;
+    }
+    uint32_t     littleEndian(const uint8_t* base, uint8_t numBytes) {
+        uint32_t result = 0;
+        for(int i = 0; i < numBytes; i++) result |= (uint32_t)base[i] << (i * 8);
+        return result;
+    }
+
+    fs::FS*             m_fs = nullptr;
+    SemaphoreHandle_t   m_mutex = nullptr;
+    TaskHandle_t        m_scanTaskHandle = nullptr;
+
+    ps_ptr<char>        m_indexPath;
+    ps_ptr<char>        m_rootDir;
+    ps_ptr<uint8_t>     m_index;                // loaded index file (header + records + strings)
+    const libHeader_t*  m_hdr = nullptr;        // points into m_index
+    ps_ptr<uint32_t>    m_pathOrder;            // record indices sorted by path, for incremental rescans
+
+    ps_ptr<char>        m_pool;                 // staging string pool
+    ps_ptr<entry_t>     m_entries;              // staging entries
+    ps_ptr<uint8_t>     m_readBuff;             // tag read buffer, AUDIOLIB_MAX_TAG_LEN * 4
+    uint32_t            m_poolUsed = 0;
+    uint32_t            m_numEntries = 0;
+    uint32_t            m_maxEntries = 0;
+    uint32_t            m_numParsed = 0;        // files whose tags had to be read again
+
+    bool                m_f_scanning = false;
+    bool                m_f_stopScan = false;
+};
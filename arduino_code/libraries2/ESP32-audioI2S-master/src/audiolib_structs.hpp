@@ -165,9 +165,10 @@ namespace audiolib {
     };
 
     struct cVUl_t { // used in computeVUlevel
-        uint8_t sampleArray[2][4][8] = {0};
-        uint8_t cnt0 = 0, cnt1 = 0, cnt2 = 0, cnt3 = 0, cnt4 = 0;
-        bool    f_vu = false;
+        uint8_t  peak[2] = {0};             // running peak of the current 64 frames
+        uint8_t  peak64[2][8] = {0};        // peaks of the last 8 groups of 64 frames
+        uint8_t  avg512[2][8] = {0};        // averages of peak64, one per 512 frames
+        uint8_t  cnt64 = 0, cnt512 = 0, cnt4096 = 0;
     };
 
     struct ifCh_t { // used in IIR_filterChain0, 1, 2
@@ -17,7 +17,6 @@ ps_ptr<FLACFrameHeader_t> FLACFrameHeader;
 ps_ptr<FLACMetadataBlock_t> FLACMetadataBlock;
 
 vector<uint32_t> s_flacSegmTableVec;
-vector<int32_t>  coefs;
 vector<uint32_t> s_flacBlockPicItem;
 uint64_t         s_flac_bitBuffer = 0;
 uint32_t         s_flacBitrate = 0;
@@ -96,13 +95,11 @@ void FLACDecoder_FreeBuffers(){
     s_flacVendorString.reset();
 
     s_samplesBuffer.clear(); s_samplesBuffer.shrink_to_fit();
-    coefs.clear(); coefs.shrink_to_fit();
     s_flacSegmTableVec.clear(); s_flacSegmTableVec.shrink_to_fit();
     s_flacBlockPicItem.clear(); s_flacBlockPicItem.shrink_to_fit();
 }
 //----------------------------------------------------------------------------------------------------------------------
 void FLACDecoder_setDefaults(){
-    coefs.clear(); coefs.shrink_to_fit();
     s_flacSegmTableVec.clear(); s_flacSegmTableVec.shrink_to_fit();
     s_flacBlockPicItem.clear(); s_flacBlockPicItem.shrink_to_fit();
     s_flac_bitBuffer = 0;
@@ -133,44 +130,61 @@ void FLACDecoder_setDefaults(){
 //----------------------------------------------------------------------------------------------------------------------
 //            B I T R E A D E R
 //----------------------------------------------------------------------------------------------------------------------
-const uint32_t mask[] = {0x00000000, 0x00000001, 0x00000003, 0x00000007, 0x0000000f, 0x0000001f, 0x0000003f,
-                         0x0000007f, 0x000000ff, 0x000001ff, 0x000003ff, 0x000007ff, 0x00000fff, 0x00001fff,
-                         0x00003fff, 0x00007fff, 0x0000ffff, 0x0001ffff, 0x0003ffff, 0x0007ffff, 0x000fffff,
-                         0x001fffff, 0x003fffff, 0x007fffff, 0x00ffffff, 0x01ffffff, 0x03ffffff, 0x07ffffff,
-                         0x0fffffff, 0x1fffffff, 0x3fffffff, 0x7fffffff, 0xffffffff};
-
-uint32_t readUint(uint8_t nBits, int32_t *bytesLeft){
-    while (s_flacBitBufferLen < nBits){
-        uint8_t temp = *(s_flacInptr + s_rIndex);
+//  s_flac_bitBuffer holds s_flacBitBufferLen unread bits left aligned (MSB first), the unused bits below are zero.
+//  It is refilled 32 bits at a time, bytes that were read ahead are given back with bitReaderRelease() before the
+//  decoder returns to the caller, so *bytesLeft always counts the bytes that are really consumed.
+
+static inline bool bitReaderRefill(int32_t* bytesLeft){  // returns false if nothing is left
+    if(s_flacBitBufferLen > 32) return true;
+    const uint8_t* p = s_flacInptr + s_rIndex;
+    if(*bytesLeft >= 4){
+        uint32_t w = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+        s_flac_bitBuffer |= (uint64_t)w << (32 - s_flacBitBufferLen);
+        s_flacBitBufferLen += 32;
+        s_rIndex += 4;
+        *bytesLeft -= 4;
+        return true;
+    }
+    while(s_flacBitBufferLen <= 56 && *bytesLeft > 0){ // tail of the buffer
+        s_flac_bitBuffer |= (uint64_t)*p++ << (56 - s_flacBitBufferLen);
+        s_flacBitBufferLen += 8;
         s_rIndex++;
         (*bytesLeft)--;
-        if(*bytesLeft < 0) { FLAC_LOG_ERROR("error in bitreader"); s_f_bitReaderError = true; break;}
-        s_flac_bitBuffer = (s_flac_bitBuffer << 8) | temp;
-        s_flacBitBufferLen += 8;
     }
+    return s_flacBitBufferLen > 0;
+}
+
+static void bitReaderRelease(int32_t* bytesLeft){ // give back whole bytes that are not consumed yet
+    uint8_t n = s_flacBitBufferLen / 8;
+    s_rIndex -= n;
+    *bytesLeft += n;
+    s_flacBitBufferLen -= n * 8;
+    s_flac_bitBuffer = s_flacBitBufferLen ? s_flac_bitBuffer & (~(uint64_t)0 << (64 - s_flacBitBufferLen)) : 0;
+}
+
+uint32_t readUint(uint8_t nBits, int32_t *bytesLeft){
+    if(s_flacBitBufferLen < nBits){
+        bitReaderRefill(bytesLeft);
+        if(s_flacBitBufferLen < nBits) { FLAC_LOG_ERROR("error in bitreader"); s_f_bitReaderError = true; return 0;}
+    }
+    if(!nBits) return 0;
+    uint32_t result = s_flac_bitBuffer >> (64 - nBits);
+    s_flac_bitBuffer <<= nBits;
     s_flacBitBufferLen -= nBits;
-    uint32_t result = s_flac_bitBuffer >> s_flacBitBufferLen;
-    if (nBits < 32)
-        result &= mask[nBits];
     return result;
 }
 
 int32_t readSignedInt(int32_t nBits, int32_t* bytesLeft){
+    if(!nBits) return 0;
     int32_t temp = readUint(nBits, bytesLeft) << (32 - nBits);
     temp = temp >> (32 - nBits); // The C++ compiler uses the sign bit to fill vacated bit positions
     return temp;
 }
 
-int64_t readRiceSignedInt(uint8_t param, int32_t* bytesLeft){
-    long val = 0;
-    while (readUint(1, bytesLeft) == 0)
-        val++;
-    val = (val << param) | readUint(param, bytesLeft);
-    return (val >> 1) ^ -(val & 1);
-}
-
 void alignToByte() {
-    s_flacBitBufferLen -= s_flacBitBufferLen % 8;
+    uint8_t n = s_flacBitBufferLen % 8;
+    s_flac_bitBuffer <<= n;
+    s_flacBitBufferLen -= n;
 }
 //----------------------------------------------------------------------------------------------------------------------
 //              F L A C - D E C O D E R
@@ -681,6 +695,7 @@ int8_t FLACDecodeNative(uint8_t *inbuf, int32_t *bytesLeft, int16_t *outbuf){
 
     while(s_flacStatus == DECODE_FRAME){// Read a ton of header fields, and ignore most of them
         int32_t ret = flacDecodeFrame (inbuf, bytesLeft);
+        bitReaderRelease(bytesLeft);
         if(ret != 0) return ret;
         if(*bytesLeft < FLAC_MAX_BLOCKSIZE) return FLAC_DECODE_FRAMES_LOOP; // need more data
         sbl += bl - *bytesLeft;
@@ -689,7 +704,7 @@ int8_t FLACDecodeNative(uint8_t *inbuf, int32_t *bytesLeft, int16_t *outbuf){
     if(s_flacStatus == DECODE_SUBFRAMES){
         // Decode each channel's subframe, then skip footer
         int32_t ret = decodeSubframes(bytesLeft);
-        if(ret != 0) return ret;
+        if(ret != 0) {bitReaderRelease(bytesLeft); return ret;}
         s_flacStatus = OUT_SAMPLES;
         sbl += bl - *bytesLeft;
     }
@@ -701,13 +716,7 @@ int8_t FLACDecodeNative(uint8_t *inbuf, int32_t *bytesLeft, int16_t *outbuf){
         if(s_numOfOutSamples < s_flacOutBuffSize + s_offset) blockSize = s_numOfOutSamples - s_offset;
         else blockSize = s_flacOutBuffSize;
 
-        for (int32_t i = 0; i < blockSize; i++) {
-            for (int32_t j = 0; j < FLACMetadataBlock->numChannels; j++) {
-                int32_t val = s_samplesBuffer[j][i + s_offset];
-                if (FLACMetadataBlock->bitsPerSample == 8) val += 128;
-                outbuf[2*i+j] = val;
-            }
-        }
+        writeOutSamples(outbuf, s_offset, blockSize);
 
         s_flacValidSamples = blockSize * FLACMetadataBlock->numChannels;
         s_offset += blockSize;
@@ -718,13 +727,14 @@ int8_t FLACDecodeNative(uint8_t *inbuf, int32_t *bytesLeft, int16_t *outbuf){
             s_flacBitrate /= s_flacCompressionRatio;
       //      FLAC_LOG_INFO("s_flacBitrate %i, s_flacCompressionRatio %f, FLACMetadataBlock->sampleRate %i ", s_flacBitrate, s_flacCompressionRatio, FLACMetadataBlock->sampleRate);
         }
-        if(s_offset != s_numOfOutSamples) return GIVE_NEXT_LOOP;
+        if(s_offset != s_numOfOutSamples) {bitReaderRelease(bytesLeft); return GIVE_NEXT_LOOP;}
         if(s_offset > s_numOfOutSamples) { FLAC_LOG_ERROR("offset has a wrong value"); }
         s_offset = 0;
     }
 
     alignToByte();
     readUint(16, bytesLeft);
+    bitReaderRelease(bytesLeft);
 
 //    s_flacCompressionRatio = (float)m_bytesDecoded / (float)s_numOfOutSamples * FLACMetadataBlock->numChannels * (16/8);
 //    FLAC_LOG_INFO("s_flacCompressionRatio % f", s_flacCompressionRatio);
@@ -732,8 +742,47 @@ int8_t FLACDecodeNative(uint8_t *inbuf, int32_t *bytesLeft, int16_t *outbuf){
     return FLAC_NONE;
 }
 //----------------------------------------------------------------------------------------------------------------------
+void writeOutSamples(int16_t* outbuf, uint16_t offset, uint32_t blockSize){
+    // the inter-channel decorrelation is done here, together with the interleaving, every sample is touched once
+    const int32_t* c0 = s_samplesBuffer[0].get() + offset;
+    const int32_t* c1 = FLACMetadataBlock->numChannels > 1 ? s_samplesBuffer[1].get() + offset : c0;
+    const int16_t  bias = (FLACMetadataBlock->bitsPerSample == 8) ? 128 : 0;
+
+    if(FLACMetadataBlock->numChannels == 1){
+        for(uint32_t i = 0; i < blockSize; i++) outbuf[i] = c0[i] + bias;
+        return;
+    }
+    switch(FLACFrameHeader->chanAsgn){
+        case 8:  // left/side
+            for(uint32_t i = 0; i < blockSize; i++){
+                outbuf[2 * i]     = c0[i] + bias;
+                outbuf[2 * i + 1] = c0[i] - c1[i] + bias;
+            }
+            break;
+        case 9:  // side/right
+            for(uint32_t i = 0; i < blockSize; i++){
+                outbuf[2 * i]     = c0[i] + c1[i] + bias;
+                outbuf[2 * i + 1] = c1[i] + bias;
+            }
+            break;
+        case 10: // mid/side
+            for(uint32_t i = 0; i < blockSize; i++){
+                int32_t side = c1[i];
+                int32_t right = c0[i] - (side >> 1);
+                outbuf[2 * i]     = right + side + bias;
+                outbuf[2 * i + 1] = right + bias;
+            }
+            break;
+        default: // independent
+            for(uint32_t i = 0; i < blockSize; i++){
+                outbuf[2 * i]     = c0[i] + bias;
+                outbuf[2 * i + 1] = c1[i] + bias;
+            }
+    }
+}
+//----------------------------------------------------------------------------------------------------------------------
 int8_t flacDecodeFrame(uint8_t *inbuf, int32_t *bytesLeft){
-    if(FLAC_specialIndexOf(inbuf, "OggS", *bytesLeft) == 0){ // async? => new sync is OggS => reset and decode (not page 0 or 1)
+    if(*bytesLeft > 4 && memcmp(inbuf, "OggS", 4) == 0){ // async? => new sync is OggS => reset and decode (not page 0 or 1)
         FLACDecoderReset();
         s_flacPageNr = 2;
         return FLAC_OGG_SYNC_FOUND;
@@ -855,35 +904,23 @@ uint32_t FLACGetAudioFileDuration() {
 }
 //----------------------------------------------------------------------------------------------------------------------
 int8_t decodeSubframes(int32_t* bytesLeft){
+    if(FLACMetadataBlock->numChannels > FLAC_MAX_CHANNELS){
+        FLAC_LOG_ERROR("Flac, %i channels are not supported", FLACMetadataBlock->numChannels);
+        return FLAC_STOP;
+    }
+    int8_t ret = FLAC_NONE;
     if(FLACFrameHeader->chanAsgn <= 7) {
-        for (int32_t ch = 0; ch < FLACMetadataBlock->numChannels; ch++)
-            decodeSubframe(FLACMetadataBlock->bitsPerSample, ch, bytesLeft);
+        for (int32_t ch = 0; ch < FLACMetadataBlock->numChannels; ch++){
+            ret = decodeSubframe(FLACMetadataBlock->bitsPerSample, ch, bytesLeft);
+            if(ret) return ret;
+        }
     }
     else if (8 <= FLACFrameHeader->chanAsgn && FLACFrameHeader->chanAsgn <= 10) {
-        decodeSubframe(FLACMetadataBlock->bitsPerSample + (FLACFrameHeader->chanAsgn == 9 ? 1 : 0), 0, bytesLeft);
-        decodeSubframe(FLACMetadataBlock->bitsPerSample + (FLACFrameHeader->chanAsgn == 9 ? 0 : 1), 1, bytesLeft);
-        if(FLACFrameHeader->chanAsgn == 8) {
-            for (int32_t i = 0; i < s_numOfOutSamples; i++)
-                s_samplesBuffer[1][i] = (
-                        s_samplesBuffer[0][i] -
-                        s_samplesBuffer[1][i]);
-        }
-        else if (FLACFrameHeader->chanAsgn == 9) {
-            for (int32_t i = 0; i < s_numOfOutSamples; i++)
-                s_samplesBuffer[0][i] += s_samplesBuffer[1][i];
-        }
-        else if (FLACFrameHeader->chanAsgn == 10) {
-            for (int32_t i = 0; i < s_numOfOutSamples; i++) {
-                int32_t side =  s_samplesBuffer[1][i];
-                int32_t right = s_samplesBuffer[0][i] - (side >> 1);
-                s_samplesBuffer[1][i] = right;
-                s_samplesBuffer[0][i] = right + side;
-            }
-        }
-        else {
-            FLAC_LOG_ERROR("Flac, unknown channel assignment, %i", FLACFrameHeader->chanAsgn);
-            return FLAC_ERR;
-        }
+        // the side channel needs one bit more, left/right are restored in writeOutSamples()
+        ret = decodeSubframe(FLACMetadataBlock->bitsPerSample + (FLACFrameHeader->chanAsgn == 9 ? 1 : 0), 0, bytesLeft);
+        if(ret) return ret;
+        ret = decodeSubframe(FLACMetadataBlock->bitsPerSample + (FLACFrameHeader->chanAsgn == 9 ? 0 : 1), 1, bytesLeft);
+        if(ret) return ret;
     }
     else{
         FLAC_LOG_ERROR("Flac reserved channel assignment, %i", FLACFrameHeader->chanAsgn);
@@ -894,6 +931,7 @@ int8_t decodeSubframes(int32_t* bytesLeft){
 //----------------------------------------------------------------------------------------------------------------------
 int8_t decodeSubframe(uint8_t sampleDepth, uint8_t ch, int32_t* bytesLeft) {
     int8_t ret = 0;
+    int32_t* samples = s_samplesBuffer[ch].get();
     readUint(1, bytesLeft);                // Zero bit padding, to prevent sync-fooling string of 1s
     uint8_t type = readUint(6, bytesLeft); // Subframe type: 000000 : SUBFRAME_CONSTANT
                                            //                000001 : SUBFRAME_VERBATIM
@@ -907,19 +945,20 @@ int8_t decodeSubframe(uint8_t sampleDepth, uint8_t ch, int32_t* bytesLeft) {
                                            // 0 : no wasted bits-per-sample in source subblock, k=0
                                            // 1 : k wasted bits-per-sample in source subblock, k-1 follows, unary coded; e.g. k=3 => 001 follows, k=7 => 0000001 follows.
     if (shift == 1) {
-        while (readUint(1, bytesLeft) == 0) { shift++;}
+        while (readUint(1, bytesLeft) == 0 && !s_f_bitReaderError) { shift++;}
     }
+    if(shift >= sampleDepth) {FLAC_LOG_ERROR("Flac, wasted bits %i >= sample depth %i", shift, sampleDepth); return FLAC_ERR;}
     sampleDepth -= shift;
 
     if(type == 0){  // Constant coding
         int32_t s= readSignedInt(sampleDepth, bytesLeft);                                    // SUBFRAME_CONSTANT
         for(int32_t i = 0; i < s_numOfOutSamples; i++){
-            s_samplesBuffer[ch][i] = s;
+            samples[i] = s;
         }
     }
     else if (type == 1) {  // Verbatim coding
         for (int32_t i = 0; i < s_numOfOutSamples; i++)
-            s_samplesBuffer[ch][i] = readSignedInt(sampleDepth, bytesLeft);                  // SUBFRAME_VERBATIM
+            samples[i] = readSignedInt(sampleDepth, bytesLeft);                              // SUBFRAME_VERBATIM
     }
     else if (8 <= type && type <= 12){
         ret = decodeFixedPredictionSubframe(type - 8, sampleDepth, ch, bytesLeft);           // SUBFRAME_FIXED
@@ -935,45 +974,47 @@ int8_t decodeSubframe(uint8_t sampleDepth, uint8_t ch, int32_t* bytesLeft) {
     }
     if(shift>0){
         for (int32_t i = 0; i < s_numOfOutSamples; i++){
-            s_samplesBuffer[ch][i] <<= shift;
+            samples[i] <<= shift;
         }
     }
+    if(s_f_bitReaderError) {FLAC_LOG_ERROR("Flac bitreader underflow"); return FLAC_ERR;}
     return FLAC_NONE;
 }
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 int8_t decodeFixedPredictionSubframe(uint8_t predOrder, uint8_t sampleDepth, uint8_t ch, int32_t* bytesLeft) {     // SUBFRAME_FIXED
-
-    uint8_t ret = 0;
+    static const int32_t fixedCoefs[5][4] = {{0}, {1}, {2, -1}, {3, -3, 1}, {4, -6, 4, -1}}; // FIXED_PREDICTION_COEFFICIENTS
+    int8_t ret = 0;
+    int32_t* samples = s_samplesBuffer[ch].get();
+    if(predOrder > 4) {FLAC_LOG_ERROR("Flac preorder too big: %i", predOrder); return FLAC_ERR;} // Error: preorder > 4"
     for(uint8_t i = 0; i < predOrder; i++)
-        s_samplesBuffer[ch][i] = readSignedInt(sampleDepth, bytesLeft); // Unencoded warm-up samples (n = frame's bits-per-sample * predictor order).
+        samples[i] = readSignedInt(sampleDepth, bytesLeft); // Unencoded warm-up samples (n = frame's bits-per-sample * predictor order).
     ret = decodeResiduals(predOrder, ch, bytesLeft);
     if(ret) return ret;
-    coefs.clear(); coefs.shrink_to_fit();
-    if(predOrder == 0) coefs.resize(0);
-    if(predOrder == 1) coefs.push_back(1);  // FIXED_PREDICTION_COEFFICIENTS
-    if(predOrder == 2){coefs.push_back(2); coefs.push_back(-1);}
-    if(predOrder == 3){coefs.push_back(3); coefs.push_back(-3); coefs.push_back(1);}
-    if(predOrder == 4){coefs.push_back(4); coefs.push_back(-6); coefs.push_back(4); coefs.push_back(-1);}
-    if(predOrder > 4) {FLAC_LOG_ERROR("Flac preorder too big: %i", predOrder); return FLAC_ERR;} // Error: preorder > 4"
-    restoreLinearPrediction(ch, 0);
+    // sum of |coefs| is at most 16, 4 bits headroom are enough for 32 bit accumulation
+    restoreLinearPrediction(samples, fixedCoefs[predOrder], predOrder, 0, sampleDepth + 4 > 32);
     return FLAC_NONE;
 }
 //----------------------------------------------------------------------------------------------------------------------
 int8_t decodeLinearPredictiveCodingSubframe(int32_t lpcOrder, int32_t sampleDepth, uint8_t ch, int32_t* bytesLeft){
 
     int8_t ret = 0;
+    int32_t coefs[32];
+    int32_t* samples = s_samplesBuffer[ch].get();
     for (int32_t i = 0; i < lpcOrder; i++){
-        s_samplesBuffer[ch][i] = readSignedInt(sampleDepth, bytesLeft); // Unencoded warm-up samples (n = frame's bits-per-sample * lpc order).
+        samples[i] = readSignedInt(sampleDepth, bytesLeft); // Unencoded warm-up samples (n = frame's bits-per-sample * lpc order).
     }
     int32_t precision = readUint(4, bytesLeft) + 1;                         // (Quantized linear predictor coefficients' precision in bits)-1 (1111 = invalid).
     int32_t shift = readSignedInt(5, bytesLeft);                            // Quantized linear predictor coefficient shift needed in bits (NOTE: this number is signed two's-complement).
-    coefs.clear(); coefs.shrink_to_fit();
+    if(precision == 16) {FLAC_LOG_ERROR("Flac, invalid lpc precision"); return FLAC_ERR;}
+    if(shift < 0)       {FLAC_LOG_ERROR("Flac, negative lpc shift %i", shift); return FLAC_ERR;}
     for (uint8_t i = 0; i < lpcOrder; i++){
-        coefs.push_back(readSignedInt(precision, bytesLeft));           // Unencoded predictor coefficients (n = qlp coeff precision * lpc order) (NOTE: the coefficients are signed two's-complement).
+        coefs[i] = readSignedInt(precision, bytesLeft);                     // Unencoded predictor coefficients (n = qlp coeff precision * lpc order) (NOTE: the coefficients are signed two's-complement).
     }
     ret = decodeResiduals(lpcOrder, ch, bytesLeft);
     if(ret) return ret;
-    restoreLinearPrediction(ch, shift);
+    // |sum| < 2^(sampleDepth - 1) * 2^(precision - 1) * order, 64 bit accumulation only if that can exceed int32_t
+    uint8_t orderBits = 32 - __builtin_clz((uint32_t)lpcOrder);             // floor(log2(order)) + 1, same limit as libFLAC
+    restoreLinearPrediction(samples, coefs, lpcOrder, shift, sampleDepth + precision + orderBits - 1 > 32);
     return FLAC_NONE;
 }
 //----------------------------------------------------------------------------------------------------------------------
@@ -994,6 +1035,8 @@ int8_t decodeResiduals(uint8_t warmup, uint8_t ch, int32_t* bytesLeft) {
         return FLAC_ERR;                  //Error: Block size not divisible by number of Rice partitions
     }
     int32_t partitionSize = s_numOfOutSamples / numPartitions;
+    if(partitionSize < warmup) {FLAC_LOG_ERROR("Flac, rice partition smaller than predictor order"); return FLAC_ERR;}
+    int32_t* samples = s_samplesBuffer[ch].get();
 
     for (int32_t i = 0; i < numPartitions; i++) {
         int32_t start = i * partitionSize + (i == 0 ? warmup : 0);
@@ -1001,33 +1044,110 @@ int8_t decodeResiduals(uint8_t warmup, uint8_t ch, int32_t* bytesLeft) {
 
         int32_t param = readUint(paramBits, bytesLeft);
         if (param < escapeParam) {
-            for (int32_t j = start; j < end; j++){
-                if(s_f_bitReaderError) break;
-                s_samplesBuffer[ch][j] = readRiceSignedInt(param, bytesLeft);
-            }
+            if(!readRicePartition(samples + start, end - start, param, bytesLeft)) break;
         }
         else {
             int32_t numBits = readUint(5, bytesLeft);                 // Escape code, meaning the partition is in unencoded binary form using n bits per sample; n follows as a 5-bit number.
             for (int32_t j = start; j < end; j++){
                 if(s_f_bitReaderError) break;
-                s_samplesBuffer[ch][j] = readSignedInt(numBits, bytesLeft);
+                samples[j] = readSignedInt(numBits, bytesLeft);
             }
         }
+        if(s_f_bitReaderError) break;
     }
     if(s_f_bitReaderError) {FLAC_LOG_ERROR("Flac bitreader underflow"); return FLAC_ERR;}
     return FLAC_NONE;
 }
 //----------------------------------------------------------------------------------------------------------------------
-void restoreLinearPrediction(uint8_t ch, uint8_t shift) {
-
-    for (int32_t i = coefs.size(); i < s_numOfOutSamples; i++) {
-        int32_t sum = 0;
-        for (int32_t j = 0; j < coefs.size(); j++){
-            sum += s_samplesBuffer[ch][i - 1 - j] * coefs[j];
+bool readRicePartition(int32_t* dst, int32_t count, uint8_t param, int32_t* bytesLeft){
+    // hot loop, the bit buffer is kept in locals and the unary quotient is found with count leading zeros
+    uint64_t cache = s_flac_bitBuffer;
+    uint8_t  bits = s_flacBitBufferLen;
+    bool     ok = true;
+
+    for(int32_t j = 0; j < count; j++){
+        uint32_t q = 0;
+        while(cache == 0){                       // all buffered bits are zero, the unary code continues
+            q += bits;
+            s_flac_bitBuffer = 0; s_flacBitBufferLen = 0;
+            if(!bitReaderRefill(bytesLeft)) { ok = false; break; }
+            cache = s_flac_bitBuffer; bits = s_flacBitBufferLen;
         }
-        s_samplesBuffer[ch][i] += (sum >> shift);
+        if(!ok) break;
+        uint8_t lz = __builtin_clzll(cache);     // < bits, because cache != 0
+        q += lz;
+        cache = (cache << lz) << 1;              // lz may be 63
+        bits -= lz + 1;
+        if(bits < param){
+            s_flac_bitBuffer = cache; s_flacBitBufferLen = bits;
+            bitReaderRefill(bytesLeft);
+            cache = s_flac_bitBuffer; bits = s_flacBitBufferLen;
+            if(bits < param) { ok = false; break; }
+        }
+        uint32_t val = q << param;
+        if(param){
+            val |= (uint32_t)(cache >> (64 - param));
+            cache <<= param;
+            bits -= param;
+        }
+        dst[j] = (int32_t)(val >> 1) ^ -(int32_t)(val & 1);
+        if(bits < 32){                           // keep at least 32 bits buffered, that is one code in most cases
+            s_flac_bitBuffer = cache; s_flacBitBufferLen = bits;
+            bitReaderRefill(bytesLeft);
+            cache = s_flac_bitBuffer; bits = s_flacBitBufferLen;
+        }
+    }
+    s_flac_bitBuffer = cache;
+    s_flacBitBufferLen = bits;
+    if(!ok) { FLAC_LOG_ERROR("error in bitreader"); s_f_bitReaderError = true; }
+    return ok;
+}
+//----------------------------------------------------------------------------------------------------------------------
+//  Linear prediction, sample[i] += sum(coefs[j] * sample[i - 1 - j]) >> shift
+//  The orders 1...12 cover nearly all encoder presets (-0 ... -8), they are unrolled by the compiler because ORDER
+//  is a constant. ACC is int32_t when the sum can't overflow (16 bit audio with the usual precision), else int64_t.
+template <typename ACC, int ORDER>
+static void lpcKernel(int32_t* s, const int32_t* coefs, int32_t n, int8_t shift){
+    for(int32_t i = ORDER; i < n; i++){
+        ACC sum = 0;
+        for(int32_t j = 0; j < ORDER; j++) sum += (ACC)coefs[j] * s[i - 1 - j];
+        s[i] += (int32_t)(sum >> shift);
+    }
+}
+
+template <typename ACC>
+static void lpcKernelN(int32_t* s, const int32_t* coefs, uint8_t order, int32_t n, int8_t shift){
+    for(int32_t i = order; i < n; i++){
+        ACC sum = 0;
+        for(int32_t j = 0; j < order; j++) sum += (ACC)coefs[j] * s[i - 1 - j];
+        s[i] += (int32_t)(sum >> shift);
     }
 }
+
+template <typename ACC>
+static void lpcDispatch(int32_t* s, const int32_t* coefs, uint8_t order, int32_t n, int8_t shift){
+    switch(order){
+        case 0:  break;
+        case 1:  lpcKernel<ACC, 1>(s, coefs, n, shift); break;
+        case 2:  lpcKernel<ACC, 2>(s, coefs, n, shift); break;
+        case 3:  lpcKernel<ACC, 3>(s, coefs, n, shift); break;
+        case 4:  lpcKernel<ACC, 4>(s, coefs, n, shift); break;
+        case 5:  lpcKernel<ACC, 5>(s, coefs, n, shift); break;
+        case 6:  lpcKernel<ACC, 6>(s, coefs, n, shift); break;
+        case 7:  lpcKernel<ACC, 7>(s, coefs, n, shift); break;
+        case 8:  lpcKernel<ACC, 8>(s, coefs, n, shift); break;
+        case 9:  lpcKernel<ACC, 9>(s, coefs, n, shift); break;
+        case 10: lpcKernel<ACC, 10>(s, coefs, n, shift); break;
+        case 11: lpcKernel<ACC, 11>(s, coefs, n, shift); break;
+        case 12: lpcKernel<ACC, 12>(s, coefs, n, shift); break;
+        default: lpcKernelN<ACC>(s, coefs, order, n, shift); break;
+    }
+}
+
+void restoreLinearPrediction(int32_t* samples, const int32_t* coefs, uint8_t order, int8_t shift, bool wide) {
+    if(wide) lpcDispatch<int64_t>(samples, coefs, order, s_numOfOutSamples, shift);
+    else     lpcDispatch<int32_t>(samples, coefs, order, s_numOfOutSamples, shift);
+}
 //----------------------------------------------------------------------------------------------------------------------
 int32_t FLAC_specialIndexOf(uint8_t* base, const char* str, int32_t baselen, bool exact){
     int32_t result = 0;  // seek for str in buffer or in header up to baselen, not nullterninated
@@ -163,14 +163,15 @@ uint32_t         FLACGetAudioDataStart();
 uint32_t         FLACGetAudioFileDuration();
 uint32_t         readUint(uint8_t nBits, int32_t* bytesLeft);
 int32_t          readSignedInt(int32_t nBits, int32_t* bytesLeft);
-int64_t          readRiceSignedInt(uint8_t param, int32_t* bytesLeft);
 void             alignToByte();
 int8_t           decodeSubframes(int32_t* bytesLeft);
 int8_t           decodeSubframe(uint8_t sampleDepth, uint8_t ch, int32_t* bytesLeft);
 int8_t           decodeFixedPredictionSubframe(uint8_t predOrder, uint8_t sampleDepth, uint8_t ch, int32_t* bytesLeft);
 int8_t           decodeLinearPredictiveCodingSubframe(int32_t lpcOrder, int32_t sampleDepth, uint8_t ch, int32_t* bytesLeft);
 int8_t           decodeResiduals(uint8_t warmup, uint8_t ch, int32_t* bytesLeft);
-void             restoreLinearPrediction(uint8_t ch, uint8_t shift);
+bool             readRicePartition(int32_t* dst, int32_t count, uint8_t param, int32_t* bytesLeft);
+void             restoreLinearPrediction(int32_t* samples, const int32_t* coefs, uint8_t order, int8_t shift, bool wide);
+void             writeOutSamples(int16_t* outbuf, uint16_t offset, uint32_t blockSize);
 int32_t          FLAC_specialIndexOf(uint8_t* base, const char* str, int32_t baselen, bool exact = false);
 
 // —————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -0,0 +1,584 @@
+/*
+ * hls_prefetch.cpp
+ *
+ * Created on: Oct 18,2026
+ *
+ *  The fetch task owns the connections, Audio::loop() owns the read side. Both meet in m_segments, which is
+ *  guarded by m_mutex. Socket I/O is never done while the mutex is held, so the consumer is not blocked by a slow
+ *  connect or TLS handshake.
+ *
+ */
+#include "hls_prefetch.h"
+#include <new>
+
+constexpr size_t   HLS_PREFETCH_STACK_SIZE = 8192;      // TLS handshake runs in this task
+constexpr uint32_t HLS_PREFETCH_RXBUFF     = 4096;
+constexpr uint32_t HLS_PREFETCH_GROW       = 32768;     // buffer increment if the content length is not known
+
+//----------------------------------------------------------------------------------------------------------------------
+HLSPrefetch::HLSPrefetch() {
+    m_mutex = xSemaphoreCreateMutex();
+    for(int i = 0; i < HLS_PREFETCH_MAX_CONN; i++) { // no clients yet, an Audio object that never plays HLS pays nothing
+        m_conn[i].client = nullptr;
+        m_conn[i].clientSsl = false;
+        m_conn[i].port = 0;
+        m_conn[i].ssl = false;
+        m_conn[i].segId = 0;
+        m_conn[i].state = HTTP_IDLE;
+        m_conn[i].lastRx = 0;
+    }
+    memset(m_history, 0, sizeof(m_history));
+}
+
+HLSPrefetch::~HLSPrefetch() {
+    stop();
+    while(m_f_running) vTaskDelay(5); // the task still uses this object, at most one connect timeout
+    xSemaphoreTake(m_mutex, portMAX_DELAY); // the task gives it back as its last action
+    xSemaphoreGive(m_mutex);
+    vSemaphoreDelete(m_mutex);
+}
+//----------------------------------------------------------------------------------------------------------------------
+bool HLSPrefetch::start(uint8_t coreID) {
+    xSemaphoreTake(m_mutex, portMAX_DELAY);
+    if(m_f_running) { // running, or still closing its connections after stop(): the task carries on
+        if(m_f_stop) m_stats = {};
+        m_f_stop = false;
+        xSemaphoreGive(m_mutex);
+        return true;
+    }
+    xSemaphoreGive(m_mutex);
+    if(!psramFound()) {log_w("HLS prefetch requires PSRAM"); return false;}
+    m_rxBuff.alloc(HLS_PREFETCH_RXBUFF, "hls_rxBuff", false); // internal RAM, the socket copies into it
+    if(!m_rxBuff.valid()) return false;
+    m_stats = {};
+    m_f_stop = false;
+    m_f_running = true;
+    BaseType_t res = xTaskCreatePinnedToCore(
+        &HLSPrefetch::taskWrapper,  /* Function to implement the task */
+        "HLSPrefetch",              /* Name of the task */
+        HLS_PREFETCH_STACK_SIZE,    /* Stack size */
+        this,                       /* Task input parameter */
+        1,                          /* Priority, below the audio task (2) */
+        &m_taskHandle,              /* Task handle */
+        coreID                      /* Core where the task should run */
+    );
+    if(res != pdPASS) {
+        log_e("can't create HLS prefetch task");
+        m_f_running = false;
+        m_rxBuff.reset();
+        return false;
+    }
+    return true;
+}
+//----------------------------------------------------------------------------------------------------------------------
+void HLSPrefetch::stop() {
+    // does not wait for the task, it may hang in a connect or TLS handshake for a whole timeout. The task sees
+    // m_f_stop, closes its connections and frees m_rxBuff itself. No request is sent meanwhile, the queue is empty.
+    xSemaphoreTake(m_mutex, portMAX_DELAY);
+    if(m_f_running) {m_f_stop = true; m_stopCount = m_stopCount + 1;}
+    m_segments.clear();
+    m_segments.shrink_to_fit();
+    m_currentId = 0;
+    m_avgSegBytes = 0;
+    m_avgLoadMs = 0;
+    m_avgPlayMs = 0;
+    m_lastSelect = 0;
+    m_depth = 2;
+    m_parallel = 1;
+    memset(m_history, 0, sizeof(m_history));
+    xSemaphoreGive(m_mutex);
+}
+//----------------------------------------------------------------------------------------------------------------------
+bool HLSPrefetch::enqueue(const char* url) {
+    if(!isRunning() || !url || !*url) return false;
+    xSemaphoreTake(m_mutex, portMAX_DELAY);
+    if(isKnown(url) || m_segments.size() >= HLS_PREFETCH_MAX_QUEUE) {
+        xSemaphoreGive(m_mutex);
+        return false;
+    }
+    m_history[m_historyIdx] = urlHash(url);
+    m_historyIdx = (m_historyIdx + 1) % HLS_PREFETCH_HISTORY;
+    segment_t& seg = m_segments.emplace_back();
+    seg.url.assign(url);
+    seg.id = m_nextId++;
+    if(!m_nextId) m_nextId = 1; // 0 means idle
+    seg.size = 0;
+    seg.readPos = 0;
+    seg.contentLength = 0;
+    seg.t_start = 0;
+    seg.state = SEG_QUEUED;
+    seg.retries = 0;
+    seg.redirects = 0;
+    xSemaphoreGive(m_mutex);
+    return true;
+}
+//----------------------------------------------------------------------------------------------------------------------
+bool HLSPrefetch::select(const char* url) {
+    if(!isRunning() || !url) return false;
+    xSemaphoreTake(m_mutex, portMAX_DELAY);
+    uint32_t now = millis();
+    if(m_lastSelect) {
+        uint32_t dt = now - m_lastSelect;
+        m_avgPlayMs = m_avgPlayMs ? (m_avgPlayMs * 3 + dt) / 4 : dt;
+    }
+    m_lastSelect = now;
+
+    int idx = -1;
+    for(int i = 0; i < (int)m_segments.size(); i++) {
+        if(m_segments[i].url.equals(url)) {idx = i; break;}
+    }
+    if(idx < 0) { // not enqueued, Audio loads it without us
+        m_currentId = 0;
+        xSemaphoreGive(m_mutex);
+        return false;
+    }
+    m_segments.erase(m_segments.begin(), m_segments.begin() + idx); // played or skipped, a connection loading one of them is closed in pump()
+    if(m_segments.front().state == SEG_FAILED && m_segments.front().size == 0) {
+        m_segments.pop_front();
+        m_currentId = 0;
+        xSemaphoreGive(m_mutex);
+        return false;
+    }
+    m_currentId = m_segments.front().id;
+    updateDepth();
+    xSemaphoreGive(m_mutex);
+    return true;
+}
+//----------------------------------------------------------------------------------------------------------------------
+size_t HLSPrefetch::available() {
+    xSemaphoreTake(m_mutex, portMAX_DELAY);
+    size_t n = 0;
+    if(m_currentId && !m_segments.empty() && m_segments.front().id == m_currentId) n = m_segments.front().size - m_segments.front().readPos;
+    xSemaphoreGive(m_mutex);
+    return n;
+}
+//----------------------------------------------------------------------------------------------------------------------
+int32_t HLSPrefetch::read(uint8_t* buff, size_t len) {
+    xSemaphoreTake(m_mutex, portMAX_DELAY);
+    int32_t n = 0;
+    if(m_currentId && !m_segments.empty() && m_segments.front().id == m_currentId) {
+        segment_t& seg = m_segments.front();
+        n = min((uint32_t)len, seg.size - seg.readPos);
+        if(n > 0) memcpy(buff, seg.data.get() + seg.readPos, n);
+        seg.readPos += n;
+        if(seg.readPos == seg.size && seg.state == SEG_DONE) seg.data.reset(); // played, give the PSRAM back now
+    }
+    xSemaphoreGive(m_mutex);
+    return n;
+}
+
+int HLSPrefetch::read() {
+    uint8_t b = 0;
+    if(read(&b, 1) != 1) return -1;
+    return b;
+}
+//----------------------------------------------------------------------------------------------------------------------
+bool HLSPrefetch::eos() {
+    xSemaphoreTake(m_mutex, portMAX_DELAY);
+    bool res = true;
+    if(m_currentId && !m_segments.empty() && m_segments.front().id == m_currentId) {
+        segment_t& seg = m_segments.front();
+        res = (seg.state == SEG_DONE || seg.state == SEG_FAILED) && seg.readPos == seg.size;
+    }
+    xSemaphoreGive(m_mutex);
+    return res;
+}
+//----------------------------------------------------------------------------------------------------------------------
+void HLSPrefetch::getStats(stats_t& s) {
+    xSemaphoreTake(m_mutex, portMAX_DELAY);
+    s = m_stats;
+    s.depth = m_depth;
+    xSemaphoreGive(m_mutex);
+}
+//----------------------------------------------------------------------------------------------------------------------
+void HLSPrefetch::taskWrapper(void* param) {
+    HLSPrefetch* self = static_cast<HLSPrefetch*>(param);
+    self->fetchTask();
+    vTaskDelete(NULL);
+}
+//----------------------------------------------------------------------------------------------------------------------
+void HLSPrefetch::fetchTask() {
+    uint32_t stopSeen = m_stopCount;
+  restart:
+    while(!m_f_stop && stopSeen == m_stopCount) { // a stop() followed by start() still closes the connections
+        schedule();
+        bool loading = false;
+        for(int i = 0; i < HLS_PREFETCH_MAX_CONN; i++) {
+            conn_t& c = m_conn[i];
+            if(c.segId) {
+                for(int j = 0; j < 8 && c.segId && pump(c); j++) {;} // up to 32KB per connection and round
+                loading |= (c.segId != 0);
+                continue;
+            }
+            if(!c.host.valid()) continue;
+            if(!c.client->connected() || millis() - c.lastRx > HLS_PREFETCH_IDLE_CLOSE) closeConn(c); // closed by the server or unused
+        }
+        vTaskDelay(loading ? 1 : 5);
+    }
+    for(int i = 0; i < HLS_PREFETCH_MAX_CONN; i++) {
+        closeConn(m_conn[i]);
+        delete m_conn[i].client; // created again by the next request after a restart
+        m_conn[i].client = nullptr;
+    }
+    xSemaphoreTake(m_mutex, portMAX_DELAY);
+    stopSeen = m_stopCount;
+    if(!m_f_stop) {xSemaphoreGive(m_mutex); goto restart;} // start() was called again in the meantime
+    m_taskHandle = nullptr;
+    m_rxBuff.reset();
+    m_f_running = false;
+    xSemaphoreGive(m_mutex); // must be the last access to this object, the destructor waits for it
+}
+//----------------------------------------------------------------------------------------------------------------------
+bool HLSPrefetch::schedule() {
+    // starts the next request if a connection is free and the segment is inside the prefetch window
+    int freeConn = -1;
+    uint8_t loading = 0;
+    for(int i = 0; i < HLS_PREFETCH_MAX_CONN; i++) {
+        if(m_conn[i].segId) loading++;
+        else if(freeConn < 0) freeConn = i;
+    }
+    if(freeConn < 0) return false;
+
+    xSemaphoreTake(m_mutex, portMAX_DELAY);
+    if(loading >= m_parallel) {xSemaphoreGive(m_mutex); return false;}
+    int first = (m_currentId && !m_segments.empty() && m_segments.front().id == m_currentId) ? 1 : 0;
+    int last = min((int)m_segments.size(), first + m_depth);    // the current segment and m_depth after it
+    int idx = -1;
+    for(int i = 0; i < last; i++) {
+        if(m_segments[i].state == SEG_QUEUED) {idx = i; break;}
+    }
+    if(idx < 0) {xSemaphoreGive(m_mutex); return false;}
+    if(idx >= first && loading && bufferedBytes() + m_avgSegBytes > HLS_PREFETCH_MAX_BYTES) {xSemaphoreGive(m_mutex); return false;} // PSRAM budget
+
+    // prefer a free connection that is already open to this host
+    url_t u;
+    const char* url = m_segments[idx].target.valid() ? m_segments[idx].target.get() : m_segments[idx].url.get();
+    if(!parseUrl(url, u)) {
+        log_e("HLS prefetch: invalid URL %s", m_segments[idx].url.get());
+        m_segments[idx].state = SEG_FAILED;
+        m_stats.failed++;
+        xSemaphoreGive(m_mutex);
+        return true;
+    }
+    for(int i = 0; i < HLS_PREFETCH_MAX_CONN; i++) {
+        conn_t& c = m_conn[i];
+        if(!c.segId && c.host.valid() && c.host.equals(u.host.get()) && c.port == u.port && c.ssl == u.ssl) {freeConn = i; break;}
+    }
+    segment_t& seg = m_segments[idx];
+    seg.state = SEG_LOADING;
+    seg.t_start = millis();
+    seg.size = 0;
+    seg.contentLength = 0;
+    m_conn[freeConn].segId = seg.id;
+    xSemaphoreGive(m_mutex);
+
+    if(!request(m_conn[freeConn], u)) finish(m_conn[freeConn], false);
+    return true;
+}
+//----------------------------------------------------------------------------------------------------------------------
+bool HLSPrefetch::request(conn_t& c, url_t& u) {
+    if(c.host.valid() && (!c.host.equals(u.host.get()) || c.port != u.port || c.ssl != u.ssl)) closeConn(c);
+    c.f_reused = c.host.valid() && c.client->connected();
+    if(!c.f_reused) {
+        if(!makeClient(c, u.ssl)) return false;
+        c.client->setTimeout(u.ssl ? m_connectTimeoutSSL : m_connectTimeout);
+        if(!c.client->connect(u.host.get(), u.port)) {
+            log_w("HLS prefetch: can't connect to %s:%u", u.host.get(), u.port);
+            c.client->stop();
+            c.host.reset();
+            return false;
+        }
+        c.host.clone_from(u.host);
+        c.port = u.port;
+        c.ssl = u.ssl;
+        xSemaphoreTake(m_mutex, portMAX_DELAY);
+        m_stats.connects++;
+        xSemaphoreGive(m_mutex);
+    }
+    ps_ptr<char> rqh("rqh");
+    rqh.assign("GET ");
+    rqh.append(u.path.get());
+    rqh.append(" HTTP/1.1\r\n");
+    if((u.ssl && u.port == 443) || (!u.ssl && u.port == 80)) rqh.appendf("Host: %s\r\n", u.host.get());
+    else                                                      rqh.appendf("Host: %s:%u\r\n", u.host.get(), u.port);
+    rqh.append("Accept: */*\r\n");
+    rqh.append("User-Agent: VLC/3.0.21 LibVLC/3.0.21 AppleWebKit/537.36 (KHTML, like Gecko)\r\n");
+    rqh.append("Accept-Encoding: identity;q=1,*;q=0\r\n");
+    rqh.append("Connection: keep-alive\r\n\r\n");
+
+    size_t len = rqh.strlen();
+    if(c.client->write((const uint8_t*)rqh.get(), len) != len) {
+        closeConn(c);
+        if(!c.f_reused) return false;
+        return request(c, u); // stale keep-alive connection, once more with a new one
+    }
+    c.state = HTTP_STATUS;
+    c.f_keepAlive = true;
+    c.f_chunked = false;
+    c.f_gotBytes = false;
+    c.status = 0;
+    c.linePos = 0;
+    c.remaining = 0;
+    c.location.reset();
+    c.lastRx = millis();
+    xSemaphoreTake(m_mutex, portMAX_DELAY);
+    m_stats.requests++;
+    if(c.f_reused) m_stats.reused++;
+    xSemaphoreGive(m_mutex);
+    return true;
+}
+//----------------------------------------------------------------------------------------------------------------------
+bool HLSPrefetch::pump(conn_t& c) {
+    int av = c.client->available();
+    if(av <= 0) {
+        if(c.client->connected() && millis() - c.lastRx < HLS_PREFETCH_TIMEOUT) return false;
+        bool untilClose = (c.state == HTTP_BODY && !c.remaining); // HTTP/1.0 style, the body ends with the connection
+        c.f_keepAlive = false;
+        finish(c, untilClose);
+        return true;
+    }
+    int32_t n = c.client->read(m_rxBuff.get(), min((uint32_t)av, HLS_PREFETCH_RXBUFF));
+    if(n <= 0) return false;
+    c.lastRx = millis();
+    c.f_gotBytes = true;
+
+    const uint8_t* p = m_rxBuff.get();
+    while(n > 0 && c.segId) {
+        if(c.state == HTTP_BODY || c.state == HTTP_CHUNK_DATA) {
+            uint32_t take = n;
+            if(c.remaining) take = min(take, c.remaining);
+            xSemaphoreTake(m_mutex, portMAX_DELAY);
+            segment_t* seg = findSegment(c.segId);
+            bool ok = seg && appendBody(*seg, p, take);
+            xSemaphoreGive(m_mutex);
+            if(!ok) { // skipped by select() in the meantime or out of memory, the rest of the body can't be used
+                c.segId = 0;
+                closeConn(c);
+                return true;
+            }
+            p += take;
+            n -= take;
+            if(!c.remaining) continue; // until close
+            c.remaining -= take;
+            if(c.remaining) continue;
+            if(c.state == HTTP_BODY) finish(c, true);
+            else c.state = HTTP_CHUNK_END;
+            continue;
+        }
+        // line oriented states: status line, header, chunk size, chunk end, trailer
+        char ch = *p++;
+        n--;
+        if(ch == '\r') continue;
+        if(ch != '\n') {
+            if(c.linePos < sizeof(c.line) - 1) c.line[c.linePos++] = ch;
+            continue;
+        }
+        c.line[c.linePos] = '\0';
+        c.linePos = 0;
+        if(!headerLine(c)) {finish(c, false); break;}
+    }
+    if(n > 0) closeConn(c); // bytes after the end of the response, the connection is out of sync
+    return true;
+}
+//----------------------------------------------------------------------------------------------------------------------
+bool HLSPrefetch::headerLine(conn_t& c) {
+    char* line = c.line;
+    switch(c.state) {
+        case HTTP_STATUS:
+            if(strncasecmp(line, "HTTP/", 5) != 0) {log_w("HLS prefetch: no HTTP response"); return false;}
+            if(strncmp(line, "HTTP/1.0", 8) == 0) c.f_keepAlive = false;
+            c.status = strchr(line, ' ') ? atoi(strchr(line, ' ') + 1) : 0;
+            c.state = HTTP_HEADER;
+            return true;
+
+        case HTTP_HEADER:
+            if(*line) {
+                char* val = strchr(line, ':');
+                if(!val) return true;
+                *val++ = '\0';
+                while(*val == ' ') val++;
+                if     (!strcasecmp(line, "content-length"))    c.remaining = strtoul(val, NULL, 10);
+                else if(!strcasecmp(line, "transfer-encoding")) c.f_chunked = (strcasestr(val, "chunked") != NULL);
+                else if(!strcasecmp(line, "connection"))        c.f_keepAlive = (strcasestr(val, "close") == NULL);
+                else if(!strcasecmp(line, "location"))          c.location.assign(val);
+                return true;
+            }
+            // end of header
+            if(c.status >= 300 && c.status < 400 && c.location.valid()) {
+                xSemaphoreTake(m_mutex, portMAX_DELAY);
+                segment_t* seg = findSegment(c.segId);
+                if(seg && seg->redirects < 3) {
+                    ps_ptr<char> url("url");
+                    if(c.location.starts_with("/")) url.assignf("%s://%s:%u%s", c.ssl ? "https" : "http", c.host.get(), c.port, c.location.get());
+                    else                            url.clone_from(c.location);
+                    seg->target.clone_from(url);
+                    seg->redirects++;
+                    seg->state = SEG_QUEUED;
+                }
+                xSemaphoreGive(m_mutex);
+                c.segId = 0;
+                if(c.f_chunked || c.remaining || !c.f_keepAlive) closeConn(c); // don't read a body we don't need
+                else c.state = HTTP_IDLE;
+                return true;
+            }
+            if(c.status != 200 && c.status != 206) {log_w("HLS prefetch: HTTP status %u", c.status); return false;}
+            if(c.f_chunked) {c.remaining = 0; c.state = HTTP_CHUNK_SIZE; return true;}
+            if(c.remaining) {
+                xSemaphoreTake(m_mutex, portMAX_DELAY);
+                segment_t* seg = findSegment(c.segId);
+                if(seg) {
+                    seg->contentLength = c.remaining;
+                    seg->data.alloc(c.remaining, "hls_segment"); // PSRAM, the whole segment at once
+                }
+                xSemaphoreGive(m_mutex);
+                c.state = HTTP_BODY;
+                return true;
+            }
+            if(c.f_keepAlive) {finish(c, true); return true;}   // content-length: 0
+            c.state = HTTP_BODY;                                // no length, read until the server closes
+            return true;
+
+        case HTTP_CHUNK_SIZE:
+            if(!*line) return true;
+            c.remaining = strtoul(line, NULL, 16); // chunk extensions after ';' are ignored by strtoul
+            c.state = c.remaining ? HTTP_CHUNK_DATA : HTTP_TRAILER;
+            return true;
+
+        case HTTP_CHUNK_END:
+            c.state = HTTP_CHUNK_SIZE; // the empty line after the chunk data
+            return true;
+
+        case HTTP_TRAILER:
+            if(!*line) finish(c, true);
+            return true;
+    }
+    return false;
+}
+//----------------------------------------------------------------------------------------------------------------------
+bool HLSPrefetch::appendBody(segment_t& seg, const uint8_t* data, uint32_t len) {
+    if(seg.size + len > seg.data.size()) {
+        size_t newSize = max((size_t)(seg.size + len), max(seg.data.size() * 2, (size_t)HLS_PREFETCH_GROW));
+        if(seg.contentLength && seg.size + len <= seg.contentLength) newSize = seg.contentLength;
+        if(seg.data.valid()) seg.data.realloc(newSize);
+        else                 seg.data.alloc(newSize, "hls_segment");
+        if(seg.data.size() < seg.size + len) return false;
+    }
+    memcpy(seg.data.get() + seg.size, data, len);
+    seg.size += len;
+    m_stats.bytes += len;
+    return true;
+}
+//----------------------------------------------------------------------------------------------------------------------
+void HLSPrefetch::finish(conn_t& c, bool ok) {
+    // ends the request on this connection, a failed request is repeated unless the consumer has read a part of it
+    xSemaphoreTake(m_mutex, portMAX_DELAY);
+    segment_t* seg = findSegment(c.segId);
+    if(seg) {
+        if(ok) {
+            uint32_t dt = millis() - seg->t_start;
+            if(!dt) dt = 1;
+            seg->state = SEG_DONE;
+            m_stats.segments++;
+            m_avgLoadMs   = m_avgLoadMs   ? (m_avgLoadMs * 3 + dt) / 4 : dt;
+            m_avgSegBytes = m_avgSegBytes ? (m_avgSegBytes * 3 + seg->size) / 4 : seg->size;
+            uint32_t kbps = (uint64_t)seg->size * 8 / dt;
+            m_stats.kbps = m_stats.kbps ? (m_stats.kbps * 3 + kbps) / 4 : kbps;
+            updateDepth();
+            if(seg->id != m_currentId && seg->data.size() > seg->size && seg->size) seg->data.realloc(seg->size); // chunked, drop the slack
+        }
+        else if(c.f_reused && !c.f_gotBytes) { // the server closed the idle keep-alive connection, not an error
+            seg->state = SEG_QUEUED;
+        }
+        else if(seg->readPos == 0 && ++seg->retries <= HLS_PREFETCH_RETRIES) {
+            log_w("HLS prefetch: retry %s", seg->url.get());
+            seg->state = SEG_QUEUED;
+            seg->size = 0;
+        }
+        else {
+            log_w("HLS prefetch: failed %s", seg->url.get());
+            seg->state = SEG_FAILED;
+            m_stats.failed++;
+        }
+    }
+    xSemaphoreGive(m_mutex);
+    c.segId = 0;
+    c.state = HTTP_IDLE;
+    if(!ok || !c.f_keepAlive) closeConn(c);
+}
+//----------------------------------------------------------------------------------------------------------------------
+void HLSPrefetch::closeConn(conn_t& c) {
+    if(c.client && (c.host.valid() || c.client->connected())) c.client->stop();
+    c.host.reset();
+    c.state = HTTP_IDLE;
+    c.segId = 0;
+}
+//----------------------------------------------------------------------------------------------------------------------
+bool HLSPrefetch::makeClient(conn_t& c, bool ssl) {
+    // the connection is closed, keep its client if the type fits
+    if(c.client && c.clientSsl == ssl) return true;
+    delete c.client;
+    c.client = nullptr;
+    if(ssl) {
+        NetworkClientSecure* s = new (std::nothrow) NetworkClientSecure;
+        if(s) s->setInsecure();
+        c.client = s;
+    }
+    else {
+        c.client = new (std::nothrow) NetworkClient;
+    }
+    c.clientSsl = ssl;
+    if(!c.client) log_e("HLS prefetch: out of memory for a client");
+    return c.client != nullptr;
+}
+//----------------------------------------------------------------------------------------------------------------------
+void HLSPrefetch::updateDepth() {
+    // called with the mutex held
+    if(!m_avgLoadMs || !m_avgPlayMs) return;                    // nothing measured yet, keep the start values
+    uint32_t ratio = m_avgLoadMs * 100 / m_avgPlayMs;           // percent of the play time needed to load a segment
+    uint32_t depth = 1 + (2 * ratio + 99) / 100;
+    if(m_avgSegBytes) depth = min(depth, (uint32_t)max(1, (int)(HLS_PREFETCH_MAX_BYTES / m_avgSegBytes) - 1));
+    m_depth = constrain(depth, 1, HLS_PREFETCH_MAX_DEPTH);
+    m_parallel = (ratio > 50) ? HLS_PREFETCH_MAX_CONN : 1;
+}
+//----------------------------------------------------------------------------------------------------------------------
+bool HLSPrefetch::parseUrl(const char* url, url_t& u) {
+    // http(s)://host[:port]/path?query
+    const char* p = url;
+    if     (!strncasecmp(p, "https://", 8)) {u.ssl = true;  u.port = 443; p += 8;}
+    else if(!strncasecmp(p, "http://", 7))  {u.ssl = false; u.port = 80;  p += 7;}
+    else return false;
+    const char* slash = strchr(p, '/');
+    const char* end = slash ? slash : p + strlen(p);
+    const char* colon = (const char*)memchr(p, ':', end - p);
+    if(colon) u.port = atoi(colon + 1);
+    else      colon = end;
+    if(colon == p) return false;
+    u.host.assign(p, colon - p);
+    u.path.assign(slash ? slash : "/");
+    u.path.replace(" ", "%20");
+    return true;
+}
+//----------------------------------------------------------------------------------------------------------------------
+HLSPrefetch::segment_t* HLSPrefetch::findSegment(uint32_t id) {
+    if(!id) return nullptr;
+    for(auto& seg : m_segments) if(seg.id == id) return &seg;
+    return nullptr;
+}
+
+uint32_t HLSPrefetch::bufferedBytes() {
+    uint32_t n = 0;
+    for(auto& seg : m_segments) n += seg.data.size();
+    return n;
+}
+
+uint32_t HLSPrefetch::urlHash(const char* url) { // FNV-1a
+    uint32_t h = 2166136261u;
+    while(*url) {h ^= (uint8_t)*url++; h *= 16777619u;}
+    return h ? h : 1;
+}
+
+bool HLSPrefetch::isKnown(const char* url) {
+    uint32_t h = urlHash(url);
+    for(int i = 0; i < HLS_PREFETCH_HISTORY; i++) if(m_history[i] == h) return true;
+    return false;
+}
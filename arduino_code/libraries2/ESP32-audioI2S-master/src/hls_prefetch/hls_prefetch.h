@@ -0,0 +1,159 @@
+/*
+ * hls_prefetch.h
+ *
+ * Created on: Oct 18,2026
+ *
+ *  HLS media segment prefetcher.
+ *
+ *  Audio::loop() plays one segment while a low priority task loads the next ones into PSRAM. The task keeps its
+ *  HTTP/1.1 connections open (keep-alive) and sends the next GET on the same socket, so a segment boundary costs
+ *  neither DNS, TCP nor TLS setup. Responses may use content-length or chunked transfer encoding, the segment
+ *  buffer always holds the plain body.
+ *
+ *  The number of segments loaded ahead (depth) follows the measured link speed:
+ *
+ *      ratio = download time of a segment / play time of a segment     (both smoothed)
+ *      depth = 1 + ceil(2 * ratio), limited to HLS_PREFETCH_MAX_DEPTH and the PSRAM budget
+ *
+ *  If one connection is too slow (ratio > 0.5) a second keep-alive connection loads the following segment in
+ *  parallel. A fast link keeps depth at 1 or 2, then only the next segment is held in PSRAM.
+ *
+ *  Usage (in Audio):
+ *      prefetch.start(coreID);
+ *      prefetch.enqueue(url) ...          // next segments of the playlist, duplicates are ignored
+ *      if(prefetch.select(url)) {...}     // url becomes the current segment, read it with available() / read()
+ *      prefetch.eos()                     // current segment is loaded and read completely
+ *      prefetch.stop();
+ *
+ */
+#pragma once
+#pragma GCC optimize ("Ofast")
+
+#include "Arduino.h"
+#include <deque>
+#include <NetworkClient.h>
+#include <NetworkClientSecure.h>
+#include "../psram_unique_ptr.hpp"
+
+#define HLS_PREFETCH_MAX_CONN       2                   // parallel keep-alive connections
+#define HLS_PREFETCH_MAX_DEPTH      6                   // segments loaded ahead of the current one
+#define HLS_PREFETCH_MAX_QUEUE      32                  // URLs waiting in the queue
+#define HLS_PREFETCH_MAX_BYTES      (1536 * 1024)       // PSRAM budget of all segment buffers
+#define HLS_PREFETCH_HISTORY        64                  // URLs already played, prevents loading them again
+#define HLS_PREFETCH_IDLE_CLOSE     20000               // ms, close unused connections
+#define HLS_PREFETCH_TIMEOUT        8000                // ms without any byte received, then the request fails
+#define HLS_PREFETCH_RETRIES        2
+
+class HLSPrefetch {
+
+  public:
+    typedef struct _stats{
+        uint32_t connects;      // TCP/TLS connections opened
+        uint32_t requests;      // GET requests sent
+        uint32_t reused;        // requests sent on an already open connection
+        uint32_t segments;      // segments loaded completely
+        uint32_t failed;
+        uint32_t bytes;         // body bytes received
+        uint32_t kbps;          // smoothed throughput
+        uint8_t  depth;         // current prefetch depth
+    } stats_t;
+
+    HLSPrefetch();
+    ~HLSPrefetch();
+
+    bool         start(uint8_t coreID = 0);            // creates the fetch task
+    void         stop();                               // frees all segments and returns, the task closes its connections and ends
+    bool         isRunning() { return m_f_running && !m_f_stop; }
+    void         setTimeout(uint16_t timeout_ms, uint16_t timeout_ms_ssl) { m_connectTimeout = timeout_ms; m_connectTimeoutSSL = timeout_ms_ssl; }
+    bool         enqueue(const char* url);             // false if url is known, or the queue is full
+    bool         select(const char* url);              // drops all segments before url, false if url is not (usable) in the queue
+    size_t       available();                          // bytes of the current segment that can be read now
+    int32_t      read(uint8_t* buff, size_t len);      // current segment, returns the number of bytes
+    int          read();                               // one byte, -1 if nothing is available
+    bool         eos();                                // current segment is loaded (or failed) and read completely
+    void         getStats(stats_t& s);
+
+  private:
+    enum : uint8_t { SEG_QUEUED = 0, SEG_LOADING, SEG_DONE, SEG_FAILED };
+    enum : uint8_t { HTTP_IDLE = 0, HTTP_STATUS, HTTP_HEADER, HTTP_BODY, HTTP_CHUNK_SIZE, HTTP_CHUNK_DATA, HTTP_CHUNK_END, HTTP_TRAILER };
+
+    typedef struct _segment{
+        ps_ptr<char>    url;                // as enqueued, select() compares with it
+        ps_ptr<char>    target;             // redirection target, if any
+        ps_ptr<uint8_t> data;
+        uint32_t        id;
+        uint32_t        size;               // bytes received
+        uint32_t        readPos;            // bytes read by the consumer
+        uint32_t        contentLength;      // 0 = not known
+        uint32_t        t_start;
+        uint8_t         state;
+        uint8_t         retries;
+        uint8_t         redirects;
+    } segment_t;
+
+    typedef struct _conn{
+        NetworkClient*  client;             // created by the first connect, deleted when the task ends
+        bool            clientSsl;          // client is a NetworkClientSecure
+        ps_ptr<char>    host;               // host without port and path, empty if never connected
+        uint16_t        port;
+        bool            ssl;
+        uint32_t        segId;              // 0 = idle
+        uint8_t         state;              // HTTP_xxx
+        bool            f_reused;           // request was sent on an open connection
+        bool            f_keepAlive;
+        bool            f_chunked;
+        bool            f_gotBytes;
+        uint16_t        status;
+        uint16_t        linePos;
+        uint32_t        remaining;          // body or chunk bytes still expected
+        uint32_t        lastRx;
+        ps_ptr<char>    location;           // from a 3xx response
+        char            line[512];
+    } conn_t;
+
+    typedef struct _url{
+        ps_ptr<char>    host;
+        ps_ptr<char>    path;               // starts with '/', contains the query string
+        uint16_t        port;
+        bool            ssl;
+    } url_t;
+
+    static void  taskWrapper(void* param);
+    void         fetchTask();
+    bool         schedule();
+    bool         pump(conn_t& c);
+    bool         request(conn_t& c, url_t& u);
+    void         finish(conn_t& c, bool ok);
+    bool         headerLine(conn_t& c);
+    bool         appendBody(segment_t& seg, const uint8_t* data, uint32_t len);
+    void         closeConn(conn_t& c);
+    bool         makeClient(conn_t& c, bool ssl);
+    void         updateDepth();
+    bool         parseUrl(const char* url, url_t& u);
+    segment_t*   findSegment(uint32_t id);
+    uint32_t     bufferedBytes();
+    uint32_t     urlHash(const char* url);
+    bool         isKnown(const char* url);
+
+    conn_t              m_conn[HLS_PREFETCH_MAX_CONN];
+    std::deque<segment_t> m_segments;           // front is the current segment once select() was called
+    ps_ptr<uint8_t>     m_rxBuff;
+    SemaphoreHandle_t   m_mutex = nullptr;
+    TaskHandle_t        m_taskHandle = nullptr;
+    uint32_t            m_history[HLS_PREFETCH_HISTORY];
+    uint8_t             m_historyIdx = 0;
+    uint32_t            m_nextId = 1;
+    uint32_t            m_currentId = 0;        // segment read by the consumer, 0 = none
+    uint32_t            m_avgSegBytes = 0;      // smoothed segment size
+    uint32_t            m_avgLoadMs = 0;        // smoothed download time of a segment
+    uint32_t            m_avgPlayMs = 0;        // smoothed time between two select() calls
+    uint32_t            m_lastSelect = 0;
+    uint16_t            m_connectTimeout = 2500;
+    uint16_t            m_connectTimeoutSSL = 4500;
+    uint8_t             m_depth = 2;
+    uint8_t             m_parallel = 1;
+    stats_t             m_stats = {};
+    volatile bool       m_f_running = false;
+    volatile uint32_t   m_stopCount = 0;        // stop() calls, the task closes its connections after each one
+    volatile bool       m_f_stop = false;
+};
@@ -0,0 +1,288 @@
+/*
+ * audio_library_test.cpp
+ *
+ * Created on: Oct 18,2026
+ *
+ *  Runs src/audio_library over a generated tree of 10000 MP3 files with ID3v2.3 tags (100 directories, shuffled
+ *  titles, shared artists and albums) in a temporary directory: full scan, sort order, findByPath() for every
+ *  track, reload from the index file, incremental rescans, a set of corrupted index files that begin() must
+ *  reject instead of handing out pointers outside the string table, tags with frame sizes past their end, and a
+ *  rescan after every track was deleted. Prints scan/load times and the index size.
+ *
+ *      audio_library_test          exit code 0 if everything passed
+ *
+ */
+#include "Arduino.h"
+#include "FS.h"
+#include "audio_library/audio_library.h"
+#include <atomic>
+#include <chrono>
+
+static int s_failed = 0;
+#define CHECK(cond, ...) do{ if(!(cond)) {printf("    FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); s_failed++;} }while(0)
+
+constexpr uint32_t NUM_TRACKS = 10000;
+constexpr uint32_t NUM_DIRS   = 100;
+
+//----------------------------------------------------------------------------------------------------------------------
+//  test tree, track n lives in /music/dNN/tNNNNN.mp3
+static uint32_t    titleNo(uint32_t n) { return (n * 7919) % NUM_TRACKS; }  // permutation, the scan order is not the title order
+static std::string titleOf(uint32_t n)  { char b[32]; snprintf(b, sizeof(b), "Song %05u", (unsigned)titleNo(n)); return b; }
+static std::string artistOf(uint32_t n) { char b[32]; snprintf(b, sizeof(b), "Artist %02u", (unsigned)(n % 50)); return b; }
+static std::string albumOf(uint32_t n)  { char b[32]; snprintf(b, sizeof(b), "Album %03u", (unsigned)(n % 200)); return b; }
+static std::string pathOf(uint32_t n)   { char b[48]; snprintf(b, sizeof(b), "/music/d%02u/t%05u.mp3", (unsigned)(n % NUM_DIRS), (unsigned)n); return b; }
+
+static void id3Frame(std::vector<uint8_t>& v, const char* id, const std::string& text) {
+    uint32_t size = text.size() + 1;
+    v.insert(v.end(), id, id + 4);
+    for(int i = 3; i >= 0; i--) v.push_back((size >> (i * 8)) & 0xFF);
+    v.push_back(0); v.push_back(0);    // flags
+    v.push_back(3);                     // UTF-8
+    v.insert(v.end(), text.begin(), text.end());
+}
+
+static void writeTrack(const std::string& root, uint32_t n, const std::string& title) {
+    std::vector<uint8_t> frames;
+    id3Frame(frames, "TIT2", title);
+    id3Frame(frames, "TPE1", artistOf(n));
+    id3Frame(frames, "TALB", albumOf(n));
+    uint32_t size = frames.size();
+    std::vector<uint8_t> f = {'I', 'D', '3', 3, 0, 0};
+    for(int i = 3; i >= 0; i--) f.push_back((size >> (i * 7)) & 0x7F);  // syncsafe
+    f.insert(f.end(), frames.begin(), frames.end());
+    f.insert(f.end(), 64, 0xFF);        // a few bytes of "audio"
+    FILE* fp = fopen((root + pathOf(n)).c_str(), "wb");
+    fwrite(f.data(), 1, f.size(), fp);
+    fclose(fp);
+}
+
+static std::vector<uint8_t> readFile(const std::string& path) {
+    std::vector<uint8_t> v;
+    FILE* fp = fopen(path.c_str(), "rb");
+    if(!fp) return v;
+    fseek(fp, 0, SEEK_END);
+    v.resize(ftell(fp));
+    fseek(fp, 0, SEEK_SET);
+    if(fread(v.data(), 1, v.size(), fp) != v.size()) v.clear();
+    fclose(fp);
+    return v;
+}
+
+static void writeFile(const std::string& path, const std::vector<uint8_t>& v) {
+    FILE* fp = fopen(path.c_str(), "wb");
+    fwrite(v.data(), 1, v.size(), fp);
+    fclose(fp);
+}
+
+static double msSince(std::chrono::steady_clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static std::atomic<uint32_t> s_doneTracks{0}, s_doneParsed{0}, s_doneCount{0};
+
+static bool scan(AudioLibrary& lib, uint32_t& parsed, double& ms) {
+    uint32_t before = s_doneCount;
+    auto t0 = std::chrono::steady_clock::now();
+    if(!lib.startScan("/music")) return false;
+    while(lib.isScanning()) vTaskDelay(5);
+    ms = msSince(t0);
+    parsed = s_doneParsed;
+    return s_doneCount == before + 1;
+}
+
+static void testScan(FS& fs, const std::string& root) {
+    AudioLibrary lib;
+    CHECK(!lib.begin(fs, "/audiolib.idx"), "begin() found an index in an empty tree");
+    CHECK(lib.count() == 0, "count %zu without an index", lib.count());
+
+    uint32_t parsed = 0;
+    double ms = 0;
+    CHECK(scan(lib, parsed, ms), "scan did not finish");
+    printf("  full scan             %u tracks, %u parsed, %.0f ms\n", (unsigned)lib.count(), (unsigned)parsed, ms);
+    CHECK(lib.count() == NUM_TRACKS && parsed == NUM_TRACKS, "count %zu, parsed %u", lib.count(), (unsigned)parsed);
+
+    // sorted by title, and every record carries the tags of its own file
+    AudioLibrary::track_t t, prev = {};
+    uint32_t wrong = 0, unsorted = 0;
+    for(size_t i = 0; i < lib.count(); i++) {
+        if(!lib.getTrack(i, t)) {wrong++; continue;}
+        uint32_t n = atoi(strrchr(t.path, 't') + 1);
+        if(pathOf(n) != t.path || titleOf(n) != t.title || artistOf(n) != t.artist || albumOf(n) != t.album) wrong++;
+        if(i && strcmp(prev.title, t.title) > 0) unsorted++;
+        if(t.codec != AudioLibrary::CODEC_MP3) wrong++;
+        prev = t;
+    }
+    CHECK(wrong == 0 && unsorted == 0, "%u records with wrong tags, %u out of order", (unsigned)wrong, (unsigned)unsorted);
+    CHECK(!lib.getTrack(NUM_TRACKS, t), "getTrack() past the end");
+
+    auto t0 = std::chrono::steady_clock::now();
+    uint32_t notFound = 0;
+    for(uint32_t n = 0; n < NUM_TRACKS; n++) {
+        int32_t idx = lib.findByPath(pathOf(n).c_str());
+        if(idx < 0 || !lib.getTrack(idx, t) || pathOf(n) != t.path) notFound++;
+    }
+    printf("  findByPath            %.2f us per lookup\n", msSince(t0) * 1000.0 / NUM_TRACKS);
+    CHECK(notFound == 0, "%u paths not found", (unsigned)notFound);
+    CHECK(lib.findByPath("/music/d00/missing.mp3") < 0, "found a missing file");
+
+    std::vector<uint8_t> idx = readFile(root + "/audiolib.idx");
+    printf("  index                 %zu bytes, %.1f bytes per track\n", idx.size(), (double)idx.size() / NUM_TRACKS);
+}
+
+static void testReload(FS& fs, const std::string& root) {
+    AudioLibrary lib;
+    auto t0 = std::chrono::steady_clock::now();
+    bool res = lib.begin(fs, "/audiolib.idx");
+    double ms = msSince(t0);
+    printf("  load                  %u tracks, %.2f ms\n", (unsigned)lib.count(), ms);
+    CHECK(res && lib.count() == NUM_TRACKS, "reload: %d, count %zu", res, lib.count());
+
+    uint32_t parsed = 0;
+    CHECK(scan(lib, parsed, ms), "rescan did not finish");
+    printf("  rescan, unchanged     %u parsed, %.0f ms\n", (unsigned)parsed, ms);
+    CHECK(parsed == 0 && lib.count() == NUM_TRACKS, "unchanged tree: parsed %u, count %zu", (unsigned)parsed, lib.count());
+
+    writeTrack(root, 1234, "A changed title");  // longer tag, the size changes
+    remove((root + pathOf(4321)).c_str());
+    CHECK(scan(lib, parsed, ms), "rescan did not finish");
+    printf("  rescan, 1 changed     %u parsed, %.0f ms\n", (unsigned)parsed, ms);
+    CHECK(parsed == 1 && lib.count() == NUM_TRACKS - 1, "changed tree: parsed %u, count %zu", (unsigned)parsed, lib.count());
+    AudioLibrary::track_t t;
+    CHECK(lib.getTrack(0, t) && !strcmp(t.title, "A changed title") && pathOf(1234) == t.path, "changed title not first");
+    CHECK(lib.findByPath(pathOf(4321).c_str()) < 0, "removed file still listed");
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  corrupted index files, begin() must reject every one of them
+static void testCorrupt(FS& fs, const std::string& root) {
+    const std::vector<uint8_t> good = readFile(root + "/audiolib.idx");
+    AudioLibrary::libHeader_t hdr;
+    memcpy(&hdr, good.data(), sizeof(hdr));
+    auto rec = [&](std::vector<uint8_t>& v, uint32_t i) { return (AudioLibrary::libRecord_t*)(v.data() + hdr.recordOffset) + i; };
+    auto hd  = [](std::vector<uint8_t>& v) { return (AudioLibrary::libHeader_t*)v.data(); };
+
+    struct { const char* name; std::function<void(std::vector<uint8_t>&)> corrupt; } cases[] = {
+        {"intact",              [&](std::vector<uint8_t>&) {}},
+        {"bad magic",           [&](std::vector<uint8_t>& v) { hd(v)->magic ^= 1; }},
+        {"truncated",           [&](std::vector<uint8_t>& v) { v.resize(v.size() - 100); }},
+        {"header only",         [&](std::vector<uint8_t>& v) { v.resize(sizeof(AudioLibrary::libHeader_t)); }},
+        {"short header",        [&](std::vector<uint8_t>& v) { v.resize(8); }},
+        {"path == strSize",     [&](std::vector<uint8_t>& v) { rec(v, 17)->path = hdr.strSize; }},
+        {"title past the end",  [&](std::vector<uint8_t>& v) { rec(v, 0)->title = 0x7FFFFFFF; }},
+        {"artist past the end", [&](std::vector<uint8_t>& v) { rec(v, hdr.numRecords - 1)->artist = hdr.strSize + 3; }},
+        {"album wraps",         [&](std::vector<uint8_t>& v) { rec(v, 4711)->album = 0xFFFFFFFF; }},
+        {"no terminator",       [&](std::vector<uint8_t>& v) { v.back() = 'x'; }},
+        {"strSize too large",   [&](std::vector<uint8_t>& v) { hd(v)->strSize += 16; }},
+        {"numRecords too high", [&](std::vector<uint8_t>& v) { hd(v)->numRecords = 0x10000000; }},
+        {"records in header",   [&](std::vector<uint8_t>& v) { hd(v)->recordOffset = 4; }},
+    };
+    for(auto& c : cases) {
+        std::vector<uint8_t> v = good;
+        c.corrupt(v);
+        writeFile(root + "/bad.idx", v);
+        AudioLibrary lib;
+        bool res = lib.begin(fs, "/bad.idx");
+        bool intact = !strcmp(c.name, "intact");
+        CHECK(res == intact && lib.count() == (intact ? hdr.numRecords : 0), "%s: begin() %d, count %zu", c.name, res, lib.count());
+        AudioLibrary::track_t t;
+        CHECK(lib.getTrack(0, t) == intact, "%s: getTrack() on a rejected index", c.name);
+    }
+    printf("  corrupt index         %zu cases\n", sizeof(cases) / sizeof(cases[0]));
+    remove((root + "/bad.idx").c_str());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  sizes in the tags that point past the tag or the file, the scan must stop parsing and keep what it has
+static void testMalformedTags(FS& fs, const std::string& root) {
+    std::filesystem::create_directories(root + "/music/bad");
+    std::vector<uint8_t> frames;
+    id3Frame(frames, "TIT2", "Broken ID3");
+    frames.insert(frames.end(), {'T', 'X', 'X', 'X', 0xFF, 0xFF, 0xFF, 0xF0, 0, 0});  // pos + size wraps to pos - 16
+    id3Frame(frames, "TPE1", "Lost artist");
+    std::vector<uint8_t> mp3 = {'I', 'D', '3', 3, 0, 0};
+    for(int i = 3; i >= 0; i--) mp3.push_back((frames.size() >> (i * 7)) & 0x7F);
+    mp3.insert(mp3.end(), frames.begin(), frames.end());
+    mp3.insert(mp3.end(), 64, 0xFF);
+    writeFile(root + "/music/bad/id3.mp3", mp3);
+
+    std::vector<uint8_t> flac = {'f', 'L', 'a', 'C', 0x00, 0, 0, 34};    // STREAMINFO
+    std::vector<uint8_t> si(34, 0);
+    si[10] = 0x0A; si[11] = 0xC4; si[12] = 0x40;                        // 44100 Hz
+    si[15] = 0x06; si[16] = 0xBA; si[17] = 0xA8;                        // 441000 samples
+    flac.insert(flac.end(), si.begin(), si.end());
+    const std::string c = "TITLE=Broken FLAC";
+    std::vector<uint8_t> vc = {0, 0, 0, 0, 2, 0, 0, 0, (uint8_t)c.size(), 0, 0, 0};  // no vendor, 2 comments
+    vc.insert(vc.end(), c.begin(), c.end());
+    vc.insert(vc.end(), {0xF0, 0xFF, 0xFF, 0xFF});                       // second comment 4 GB long
+    vc.insert(vc.end(), 16, 'x');
+    flac.insert(flac.end(), {0x84, 0, 0, (uint8_t)vc.size()});          // last block, VORBIS_COMMENT
+    flac.insert(flac.end(), vc.begin(), vc.end());
+    flac.insert(flac.end(), 64, 0xFF);
+    writeFile(root + "/music/bad/vc.flac", flac);
+
+    std::vector<uint8_t> big = flac;
+    big[5] = 0x7F;                                                      // STREAMINFO 8 MB long
+    writeFile(root + "/music/bad/block.flac", big);
+
+    AudioLibrary lib;
+    lib.begin(fs, "/audiolib.idx");
+    uint32_t parsed = 0;
+    double ms = 0;
+    CHECK(scan(lib, parsed, ms), "scan over malformed tags did not finish");
+    CHECK(parsed == 3 && lib.count() == NUM_TRACKS + 2, "malformed tags: parsed %u, count %zu", (unsigned)parsed, lib.count());
+    AudioLibrary::track_t t;
+    int32_t i = lib.findByPath("/music/bad/id3.mp3");
+    CHECK(i >= 0 && lib.getTrack(i, t) && !strcmp(t.title, "Broken ID3") && !*t.artist, "id3: frame size past the tag");
+    i = lib.findByPath("/music/bad/vc.flac");
+    CHECK(i >= 0 && lib.getTrack(i, t) && !strcmp(t.title, "Broken FLAC") && t.duration == 10, "flac: comment length past the block");
+    i = lib.findByPath("/music/bad/block.flac");
+    CHECK(i >= 0 && lib.getTrack(i, t) && !strcmp(t.title, "block") && t.duration == 0, "flac: block length past the file");
+    printf("  malformed tags        %u files, %.0f ms\n", (unsigned)parsed, ms);
+}
+
+//  every track deleted, the rescan must not leave the old index behind
+static void testEmpty(FS& fs, const std::string& root) {
+    std::filesystem::remove_all(root + "/music");
+    std::filesystem::create_directories(root + "/music");
+    AudioLibrary lib;
+    CHECK(lib.begin(fs, "/audiolib.idx") && lib.count() > 0, "no index before the empty rescan");
+    uint32_t parsed = 0;
+    double ms = 0;
+    CHECK(scan(lib, parsed, ms), "empty rescan did not finish");
+    CHECK(lib.count() == 0, "count %zu after deleting every track", lib.count());
+    CHECK(!fs.exists("/audiolib.idx"), "old index still on disk");
+    AudioLibrary reopened;
+    CHECK(!reopened.begin(fs, "/audiolib.idx") && reopened.count() == 0, "old index loaded after the empty rescan");
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+int main() {
+    char tmpl[] = "/tmp/audiolib_XXXXXX";
+    if(!mkdtemp(tmpl)) {printf("can't create a temporary directory\n"); return 1;}
+    std::string root = tmpl;
+    printf("AudioLibrary, %u tracks in %s\n", (unsigned)NUM_TRACKS, root.c_str());
+    std::filesystem::create_directories(root + "/music");
+    for(uint32_t d = 0; d < NUM_DIRS; d++) {
+        char b[32];
+        snprintf(b, sizeof(b), "/music/d%02u", (unsigned)d);
+        std::filesystem::create_directories(root + b);
+    }
+    for(uint32_t n = 0; n < NUM_TRACKS; n++) writeTrack(root, n, titleOf(n));
+
+    AudioLibrary::scan_done_callback = [](uint32_t numTracks, uint32_t numParsed, uint32_t) {
+        s_doneTracks = numTracks;
+        s_doneParsed = numParsed;
+        s_doneCount++;
+    };
+    FS fs(root.c_str());
+    testScan(fs, root);
+    testCorrupt(fs, root);
+    testReload(fs, root);
+    testMalformedTags(fs, root);
+    testEmpty(fs, root);
+
+    std::filesystem::remove_all(root);
+    printf("%s\n", s_failed ? "FAILED" : "all passed");
+    return s_failed ? 1 : 0;
+}
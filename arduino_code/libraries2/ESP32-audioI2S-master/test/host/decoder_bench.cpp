@@ -0,0 +1,658 @@
+/*
+ * decoder_bench.cpp
+ *
+ * Created on: Oct 18,2026
+ *
+ *  Host conformance and throughput bench for the decoders in src/ (MP3, AAC/M4A, FLAC, Opus, Vorbis).
+ *
+ *  The file is fed to the decoder the same way Audio::sendBytes() does it: find the syncword, decode with a window
+ *  of the codec's max block size, skip on error, continue on res > 99. Everything the decoder outputs is reduced to
+ *  a signature (frames, CRC32 of the PCM, RMS and peak per channel for every block of 4096 frames). With --update
+ *  the signature is written to the golden directory, otherwise it is compared against the golden file:
+ *
+ *      codec, channels, samplerate and number of frames must be identical
+ *      FLAC (lossless) must be bit exact (CRC32), native 16 bit FLAC is also checked against the STREAMINFO MD5
+ *      lossy codecs: RMS and peak of every block may differ by SIG_TOL_PERCENT, at least SIG_TOL_LSB
+ *
+ *  If a reference decode of the file exists as raw PCM (<name>.s16, interleaved int16 little endian, e.g. from
+ *  "ffmpeg -i file -f s16le file.s16") in --ref-dir, the output is additionally compared sample by sample. The
+ *  decoder delay is compensated by searching the best alignment, SNR must reach --min-snr.
+ *
+ *  Throughput is the best of --repeat runs as multiple of realtime (with --repeat > 1 the first run, which builds the
+ *  signature, is not timed), peak memory is the high water mark of all heap allocations between AllocateBuffers()
+ *  and FreeBuffers().
+ *
+ *  --dump writes the decoded PCM as <name>.s16, a dump of the unmodified decoder can serve as --ref-dir for a
+ *  sample exact comparison after an optimization.
+ *
+ *  usage: decoder_bench [--update] [--golden-dir DIR] [--ref-dir DIR] [--repeat N] [--min-snr dB] [--dump DIR] file...
+ *
+ */
+#include "Arduino.h"
+#include <chrono>   // before the decoder headers, some of them define min/max macros
+#include "mem_track.h"
+#include "aac_decoder/aac_decoder.h"
+#include "flac_decoder/flac_decoder.h"
+#include "mp3_decoder/mp3_decoder.h"
+#include "opus_decoder/opus_decoder.h"
+#include "vorbis_decoder/vorbis_decoder.h"
+
+#define SIG_BLOCK_FRAMES   4096
+#define SIG_TOL_PERCENT    2.0     // lossy codecs, per block RMS and peak
+#define SIG_TOL_LSB        8
+#define OUTBUFF_SAMPLES    (4096 * 2)  // same as Audio::m_outbuffSize
+
+enum : uint8_t { CODEC_NONE, CODEC_MP3, CODEC_M4A, CODEC_FLAC, CODEC_OPUS, CODEC_VORBIS };
+static const char* codecName[] = {"none", "mp3", "m4a", "flac", "opus", "vorbis"};
+static const int32_t maxBlockSize[] = {0, 1600 * 2, 1600, 4096 * 6, 2048, 4096 * 2}; // Audio.cpp m_frameSizeXXX
+
+typedef struct _stream{
+    uint8_t             codec = CODEC_NONE;
+    std::vector<uint8_t> file;
+    uint32_t            dataStart = 0;      // first byte given to the decoder
+    uint32_t            dataEnd = 0;
+    uint8_t             flacChannels = 0;   // native FLAC, from STREAMINFO
+    uint32_t            flacSampleRate = 0;
+    uint8_t             flacBPS = 0;
+    uint64_t            flacTotalSamples = 0;
+    uint8_t             flacMD5[16] = {0};  // MD5 of the unencoded audio, all zero if not set by the encoder
+    uint8_t             m4aChannels = 0;    // M4A, from esds / mp4a
+    uint32_t            m4aSampleRate = 0;
+    uint8_t             m4aObjectType = 0;
+} stream_t;
+
+typedef struct _signature{
+    uint8_t             codec = CODEC_NONE;
+    uint8_t             channels = 0;
+    uint32_t            sampleRate = 0;
+    uint64_t            frames = 0;
+    uint32_t            crc = 0;
+    uint32_t            errors = 0;         // decoder errors (res < 0), not part of the golden file
+    uint8_t             md5[16] = {0};      // MD5 of the PCM, little endian as in the FLAC STREAMINFO
+    std::vector<int32_t> blocks;            // rms0, rms1, peak0, peak1 per block
+} signature_t;
+
+static int16_t s_outBuff[OUTBUFF_SAMPLES + 1024]; // some headroom, a decoder writing beyond m_outbuffSize is a bug though
+
+//----------------------------------------------------------------------------------------------------------------------
+static uint32_t crc32_update(uint32_t crc, const uint8_t* data, size_t len) {
+    static uint32_t table[256];
+    if(!table[1]) {
+        for(uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for(int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+            table[i] = c;
+        }
+    }
+    crc = ~crc;
+    while(len--) crc = table[(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+//----------------------------------------------------------------------------------------------------------------------
+class MD5 { // RFC 1321, only used to check native FLAC against the STREAMINFO signature
+  public:
+    void update(const uint8_t* data, size_t len) {
+        while(len) {
+            size_t n = min(len, (size_t)(64 - m_fill));
+            memcpy(m_block + m_fill, data, n);
+            m_fill += n; m_len += n; data += n; len -= n;
+            if(m_fill == 64) { transform(m_block); m_fill = 0; }
+        }
+    }
+    void final(uint8_t digest[16]) {
+        uint64_t bits = m_len * 8;
+        uint8_t  pad = 0x80;
+        update(&pad, 1);
+        pad = 0;
+        while(m_fill != 56) update(&pad, 1);
+        for(int i = 0; i < 8; i++) m_block[56 + i] = bits >> (8 * i);
+        transform(m_block);
+        for(int i = 0; i < 16; i++) digest[i] = m_h[i / 4] >> (8 * (i % 4));
+    }
+  private:
+    void transform(const uint8_t* blk) {
+        static const uint32_t K[64] = {
+            0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501, 0x698098d8, 0x8b44f7af,
+            0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821, 0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa,
+            0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8, 0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8,
+            0x676f02d9, 0x8d2a4c8a, 0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+            0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665, 0xf4292244, 0x432aff97,
+            0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1, 0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1,
+            0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391};
+        static const uint8_t R[64] = {7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 5, 9,  14, 20, 5, 9,  14, 20,
+                                      5, 9,  14, 20, 5, 9,  14, 20, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+                                      6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21};
+        uint32_t w[16];
+        for(int i = 0; i < 16; i++) w[i] = blk[i * 4] | (blk[i * 4 + 1] << 8) | (blk[i * 4 + 2] << 16) | ((uint32_t)blk[i * 4 + 3] << 24);
+        uint32_t a = m_h[0], b = m_h[1], c = m_h[2], d = m_h[3];
+        for(int i = 0; i < 64; i++) {
+            uint32_t f, g;
+            if     (i < 16) { f = (b & c) | (~b & d); g = i; }
+            else if(i < 32) { f = (d & b) | (~d & c); g = (5 * i + 1) & 15; }
+            else if(i < 48) { f = b ^ c ^ d;          g = (3 * i + 5) & 15; }
+            else            { f = c ^ (b | ~d);       g = (7 * i) & 15; }
+            uint32_t t = d; d = c; c = b;
+            uint32_t x = a + f + K[i] + w[g];
+            b += (x << R[i]) | (x >> (32 - R[i]));
+            a = t;
+        }
+        m_h[0] += a; m_h[1] += b; m_h[2] += c; m_h[3] += d;
+    }
+    uint32_t m_h[4] = {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476};
+    uint8_t  m_block[64];
+    uint32_t m_fill = 0;
+    uint64_t m_len = 0;
+};
+//----------------------------------------------------------------------------------------------------------------------
+static uint32_t bigEndian(const uint8_t* base, uint8_t numBytes) {
+    uint32_t result = 0;
+    for(int i = 0; i < numBytes; i++) result = (result << 8) | base[i];
+    return result;
+}
+//----------------------------------------------------------------------------------------------------------------------
+static const char* baseName(const char* path) {
+    const char* p = strrchr(path, '/');
+    return p ? p + 1 : path;
+}
+//----------------------------------------------------------------------------------------------------------------------
+static bool readFile(const char* path, std::vector<uint8_t>& buf) {
+    FILE* f = fopen(path, "rb");
+    if(!f) return false;
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    buf.resize(size > 0 ? size : 0);
+    bool ok = fread(buf.data(), 1, buf.size(), f) == buf.size();
+    fclose(f);
+    return ok;
+}
+//----------------------------------------------------------------------------------------------------------------------
+//  container preparation, the part Audio does in read_ID3_Header(), read_FLAC_Header() and read_M4A_Header()
+//----------------------------------------------------------------------------------------------------------------------
+static bool prepareMP3(stream_t& s) {
+    const uint8_t* d = s.file.data();
+    if(s.dataEnd >= 10 && !memcmp(d, "ID3", 3)) { // skip ID3v2, synchsafe size
+        uint32_t tagSize = ((d[6] & 0x7F) << 21) | ((d[7] & 0x7F) << 14) | ((d[8] & 0x7F) << 7) | (d[9] & 0x7F);
+        s.dataStart = 10 + tagSize + ((d[5] & 0x10) ? 10 : 0);
+    }
+    if(s.dataEnd >= 128 && !memcmp(d + s.dataEnd - 128, "TAG", 3)) s.dataEnd -= 128; // ID3v1
+    return s.dataStart < s.dataEnd;
+}
+//----------------------------------------------------------------------------------------------------------------------
+static bool prepareFLAC(stream_t& s) {
+    const uint8_t* d = s.file.data();
+    if(s.dataEnd < 42 || memcmp(d, "fLaC", 4)) return false;
+    uint32_t pos = 4;
+    bool last = false;
+    while(!last && pos + 4 <= s.dataEnd) {
+        last = d[pos] & 0x80;
+        uint8_t  type = d[pos] & 0x7F;
+        uint32_t len = bigEndian(d + pos + 1, 3);
+        if(type == 0 && len >= 18) { // STREAMINFO
+            const uint8_t* si = d + pos + 4;
+            s.flacSampleRate = (si[10] << 12) | (si[11] << 4) | (si[12] >> 4);
+            s.flacChannels = ((si[12] >> 1) & 0x07) + 1;
+            s.flacBPS = (((si[12] & 0x01) << 4) | (si[13] >> 4)) + 1;
+            s.flacTotalSamples = ((uint64_t)(si[13] & 0x0F) << 32) | bigEndian(si + 14, 4);
+            memcpy(s.flacMD5, si + 18, 16);
+        }
+        pos += 4 + len;
+    }
+    s.dataStart = pos;
+    return s.flacSampleRate && s.dataStart < s.dataEnd;
+}
+//----------------------------------------------------------------------------------------------------------------------
+static bool m4aFindAtom(const uint8_t* d, uint32_t start, uint32_t end, const char* name, uint32_t* atomStart, uint32_t* atomSize) {
+    uint32_t pos = start;
+    while(pos + 8 <= end) {
+        uint32_t size = bigEndian(d + pos, 4);
+        if(size < 8 || pos + size > end) return false;
+        if(!memcmp(d + pos + 4, name, 4)) { *atomStart = pos; *atomSize = size; return true; }
+        pos += size;
+    }
+    return false;
+}
+//----------------------------------------------------------------------------------------------------------------------
+static bool prepareM4A(stream_t& s) {
+    const uint8_t* d = s.file.data();
+    uint32_t moov, moovSize, mdat, mdatSize;
+    if(!m4aFindAtom(d, 0, s.dataEnd, "moov", &moov, &moovSize)) return false;
+    if(!m4aFindAtom(d, 0, s.dataEnd, "mdat", &mdat, &mdatSize)) return false;
+    s.dataStart = mdat + 8;
+    s.dataEnd = mdat + mdatSize;
+
+    // moov/trak/mdia/minf/stbl/stsd/mp4a/esds, the path is fixed for audio files, search instead of walking it
+    for(uint32_t i = moov; i + 8 < moov + moovSize; i++) {
+        if(memcmp(d + i, "mp4a", 4) || s.m4aChannels) continue;
+        s.m4aChannels = bigEndian(d + i + 4 + 16, 2);       // 6 reserved, 2 dref, 8 reserved, channelcount
+        s.m4aSampleRate = bigEndian(d + i + 4 + 24, 2);       // 16.16 fixed point, integer part
+    }
+    for(uint32_t i = moov; i + 8 < moov + moovSize; i++) {
+        if(memcmp(d + i, "esds", 4)) continue;
+        for(uint32_t j = i + 8; j + 2 < i + 64 && j + 2 < moov + moovSize; j++) {
+            if(d[j] != 0x05) continue; // DecoderSpecificInfo tag
+            uint32_t k = j + 1;
+            while(d[k] & 0x80) k++;     // expandable length
+            k++;
+            uint8_t objectType = d[k] >> 3;
+            uint8_t srIndex = ((d[k] & 0x07) << 1) | (d[k + 1] >> 7);
+            uint8_t chConfig = (d[k + 1] >> 3) & 0x0F;
+            static const uint32_t srTab[] = {96000, 88200, 64000, 48000, 44100, 32000, 24000, 22050, 16000, 12000, 11025, 8000, 7350};
+            if(objectType) s.m4aObjectType = objectType;
+            if(srIndex < 13) s.m4aSampleRate = srTab[srIndex];
+            if(chConfig) s.m4aChannels = chConfig;
+            break;
+        }
+        break;
+    }
+    return s.dataStart < s.dataEnd;
+}
+//----------------------------------------------------------------------------------------------------------------------
+static uint8_t detectCodec(const char* path, const std::vector<uint8_t>& f) {
+    const char* ext = strrchr(path, '.');
+    if(!ext) return CODEC_NONE;
+    if(!strcasecmp(ext, ".mp3")) return CODEC_MP3;
+    if(!strcasecmp(ext, ".m4a") || !strcasecmp(ext, ".aac") || !strcasecmp(ext, ".mp4")) return CODEC_M4A;
+    if(!strcasecmp(ext, ".flac")) return CODEC_FLAC;
+    if(!strcasecmp(ext, ".opus")) return CODEC_OPUS;
+    if(!strcasecmp(ext, ".ogg") || !strcasecmp(ext, ".oga")) { // look at the first packet of the first page
+        if(f.size() < 64 || memcmp(f.data(), "OggS", 4)) return CODEC_NONE;
+        const uint8_t* pkt = f.data() + 27 + f[26];
+        if(!memcmp(pkt, "\x01vorbis", 7)) return CODEC_VORBIS;
+        if(!memcmp(pkt, "OpusHead", 8))   return CODEC_OPUS;
+        if(!memcmp(pkt, "\x7F" "FLAC", 5)) return CODEC_FLAC;
+    }
+    return CODEC_NONE;
+}
+//----------------------------------------------------------------------------------------------------------------------
+static bool openStream(const char* path, stream_t& s) {
+    if(!readFile(path, s.file)) { printf("%s: can't read\n", path); return false; }
+    s.codec = detectCodec(path, s.file);
+    s.dataStart = 0;
+    s.dataEnd = s.file.size();
+    bool ok = false;
+    switch(s.codec) {
+        case CODEC_MP3:    ok = prepareMP3(s); break;
+        case CODEC_M4A:    ok = prepareM4A(s); break;
+        case CODEC_FLAC:   ok = memcmp(s.file.data(), "OggS", 4) ? prepareFLAC(s) : true; break;
+        case CODEC_OPUS:   ok = true; break;
+        case CODEC_VORBIS: ok = true; break;
+        default: printf("%s: unsupported format\n", path); return false;
+    }
+    if(!ok) printf("%s: invalid %s container\n", path, codecName[s.codec]);
+    return ok;
+}
+//----------------------------------------------------------------------------------------------------------------------
+//  decoder glue
+//----------------------------------------------------------------------------------------------------------------------
+static bool decoderAllocate(const stream_t& s) {
+    switch(s.codec) {
+        case CODEC_MP3:    return MP3Decoder_AllocateBuffers();
+        case CODEC_M4A:    return AACDecoder_AllocateBuffers();
+        case CODEC_FLAC:   if(!FLACDecoder_AllocateBuffers()) return false;
+                           if(s.flacSampleRate) FLACSetRawBlockParams(s.flacChannels, s.flacSampleRate, s.flacBPS, s.flacTotalSamples, s.dataEnd - s.dataStart);
+                           return true;
+        case CODEC_OPUS:   return OPUSDecoder_AllocateBuffers();
+        case CODEC_VORBIS: return VORBISDecoder_AllocateBuffers();
+    }
+    return false;
+}
+//----------------------------------------------------------------------------------------------------------------------
+static void decoderFree(uint8_t codec) {
+    switch(codec) {
+        case CODEC_MP3:    MP3Decoder_FreeBuffers(); break;
+        case CODEC_M4A:    AACDecoder_FreeBuffers(); break;
+        case CODEC_FLAC:   FLACDecoder_FreeBuffers(); break;
+        case CODEC_OPUS:   OPUSDecoder_FreeBuffers(); break;
+        case CODEC_VORBIS: VORBISDecoder_FreeBuffers(); break;
+    }
+}
+//----------------------------------------------------------------------------------------------------------------------
+static int32_t findSync(const stream_t& s, uint8_t* data, int32_t len) { // Audio::findNextSync()
+    int32_t nextSync = -1;
+    switch(s.codec) {
+        case CODEC_MP3:    nextSync = MP3FindSyncWord(data, len); if(nextSync >= 0) MP3Decoder_ClearBuffer(); break;
+        case CODEC_M4A:    AACSetRawBlockParams(s.m4aChannels ? s.m4aChannels : 2, s.m4aSampleRate ? s.m4aSampleRate : 44100,
+                                                s.m4aObjectType ? s.m4aObjectType : 2);
+                           nextSync = 0; break;
+        case CODEC_FLAC:   nextSync = FLACFindSyncWord(data, len); break;
+        case CODEC_OPUS:   nextSync = OPUSFindSyncWord(data, len); break;
+        case CODEC_VORBIS: nextSync = VORBISFindSyncWord(data, len); break;
+    }
+    return nextSync;
+}
+//----------------------------------------------------------------------------------------------------------------------
+static int32_t decode(uint8_t codec, uint8_t* data, int32_t* bytesLeft) {
+    switch(codec) {
+        case CODEC_MP3:    return MP3Decode(data, bytesLeft, s_outBuff);
+        case CODEC_M4A:    return AACDecode(data, bytesLeft, s_outBuff);
+        case CODEC_FLAC:   return FLACDecode(data, bytesLeft, s_outBuff);
+        case CODEC_OPUS:   return OPUSDecode(data, bytesLeft, s_outBuff);
+        case CODEC_VORBIS: return VORBISDecode(data, bytesLeft, s_outBuff);
+    }
+    return -100;
+}
+//----------------------------------------------------------------------------------------------------------------------
+static bool decodeContinue(uint8_t codec, int32_t res) { // Audio::decodeContinue(), true: bytes are consumed
+    if(codec == CODEC_FLAC   && (res == FLAC_PARSE_OGG_DONE || res == FLAC_DECODE_FRAMES_LOOP)) return true;
+    if(codec == CODEC_OPUS   && (res == OPUS_PARSE_OGG_DONE || res == OPUS_END)) return true;
+    if(codec == CODEC_VORBIS && res == VORBIS_PARSE_OGG_DONE) return true;
+    return false;
+}
+//----------------------------------------------------------------------------------------------------------------------
+static void outputFormat(uint8_t codec, uint32_t* frames, uint8_t* channels, uint32_t* sampleRate) { // Audio::sendBytes()
+    switch(codec) {
+        case CODEC_MP3:    *channels = MP3GetChannels();  *sampleRate = MP3GetSampRate();
+                           *frames = MP3GetOutputSamps(); break;
+        case CODEC_M4A:    *channels = AACGetChannels();  *sampleRate = AACGetSampRate();
+                           *frames = *channels ? AACGetOutputSamps() / *channels : 0; break;
+        case CODEC_FLAC:   *channels = FLACGetChannels(); *sampleRate = FLACGetSampRate();
+                           *frames = *channels ? FLACGetOutputSamps() / *channels : 0; break;
+        case CODEC_OPUS:   *channels = OPUSGetChannels(); *sampleRate = OPUSGetSampRate();
+                           *frames = OPUSGetOutputSamps(); break;
+        case CODEC_VORBIS: *channels = VORBISGetChannels(); *sampleRate = VORBISGetSampRate();
+                           *frames = VORBISGetOutputSamps(); break;
+        default:           *frames = 0;
+    }
+}
+//----------------------------------------------------------------------------------------------------------------------
+//  signature
+//----------------------------------------------------------------------------------------------------------------------
+class SignatureBuilder {
+  public:
+    explicit SignatureBuilder(signature_t& sig) : m_sig(sig) {}
+    void add(const int16_t* pcm, uint32_t frames, uint8_t channels) {
+        if(!m_sig.channels) m_sig.channels = channels;
+        m_sig.crc = crc32_update(m_sig.crc, (const uint8_t*)pcm, frames * channels * sizeof(int16_t));
+        m_md5.update((const uint8_t*)pcm, frames * channels * sizeof(int16_t)); // host is little endian, like FLAC's MD5
+        m_sig.frames += frames;
+        for(uint32_t i = 0; i < frames; i++) {
+            for(uint8_t ch = 0; ch < channels && ch < 2; ch++) {
+                int32_t v = pcm[i * channels + ch];
+                m_sq[ch] += (double)v * v;
+                if(abs(v) > m_peak[ch]) m_peak[ch] = abs(v);
+            }
+            if(++m_cnt == SIG_BLOCK_FRAMES) flush();
+        }
+    }
+    void finish() { if(m_cnt) flush(); m_md5.final(m_sig.md5); }
+  private:
+    void flush() {
+        for(int ch = 0; ch < 2; ch++) m_sig.blocks.push_back((int32_t)lround(sqrt(m_sq[ch] / m_cnt)));
+        for(int ch = 0; ch < 2; ch++) m_sig.blocks.push_back(m_peak[ch]);
+        m_sq[0] = m_sq[1] = 0;
+        m_peak[0] = m_peak[1] = 0;
+        m_cnt = 0;
+    }
+    signature_t& m_sig;
+    MD5          m_md5;
+    double       m_sq[2] = {0, 0};
+    int32_t      m_peak[2] = {0, 0};
+    uint32_t     m_cnt = 0;
+};
+//----------------------------------------------------------------------------------------------------------------------
+static bool writeGolden(const char* path, const char* name, const signature_t& sig) {
+    FILE* f = fopen(path, "w");
+    if(!f) return false;
+    fprintf(f, "# decoder_bench signature of %s, regenerate with --update\n", name);
+    fprintf(f, "codec %s\nchannels %u\nsamplerate %u\nframes %llu\ncrc32 0x%08x\nblock %u\n", codecName[sig.codec], sig.channels,
+            sig.sampleRate, (unsigned long long)sig.frames, sig.crc, SIG_BLOCK_FRAMES);
+    for(size_t i = 0; i + 3 < sig.blocks.size(); i += 4)
+        fprintf(f, "b %d %d %d %d\n", sig.blocks[i], sig.blocks[i + 1], sig.blocks[i + 2], sig.blocks[i + 3]);
+    fclose(f);
+    return true;
+}
+//----------------------------------------------------------------------------------------------------------------------
+static bool readGolden(const char* path, signature_t& sig) {
+    FILE* f = fopen(path, "r");
+    if(!f) return false;
+    char line[256], str[32];
+    unsigned long long ull;
+    unsigned int u;
+    int b[4];
+    while(fgets(line, sizeof(line), f)) {
+        if(line[0] == '#') continue;
+        if(sscanf(line, "codec %31s", str) == 1) {
+            for(uint8_t c = 0; c <= CODEC_VORBIS; c++) if(!strcmp(str, codecName[c])) sig.codec = c;
+        }
+        else if(sscanf(line, "channels %u", &u) == 1)   sig.channels = u;
+        else if(sscanf(line, "samplerate %u", &u) == 1) sig.sampleRate = u;
+        else if(sscanf(line, "frames %llu", &ull) == 1) sig.frames = ull;
+        else if(sscanf(line, "crc32 %x", &u) == 1)      sig.crc = u;
+        else if(sscanf(line, "block %u", &u) == 1)      { if(u != SIG_BLOCK_FRAMES) { fclose(f); return false; } }
+        else if(sscanf(line, "b %d %d %d %d", &b[0], &b[1], &b[2], &b[3]) == 4) sig.blocks.insert(sig.blocks.end(), b, b + 4);
+    }
+    fclose(f);
+    return true;
+}
+//----------------------------------------------------------------------------------------------------------------------
+static bool compareGolden(const signature_t& gold, const signature_t& sig, char* msg, size_t msgLen) {
+    if(gold.codec != sig.codec || gold.channels != sig.channels || gold.sampleRate != sig.sampleRate) {
+        snprintf(msg, msgLen, "format %s/%u/%u, expected %s/%u/%u", codecName[sig.codec], sig.channels, sig.sampleRate,
+                 codecName[gold.codec], gold.channels, gold.sampleRate);
+        return false;
+    }
+    if(gold.frames != sig.frames) {
+        snprintf(msg, msgLen, "%llu frames, expected %llu", (unsigned long long)sig.frames, (unsigned long long)gold.frames);
+        return false;
+    }
+    if(gold.crc == sig.crc) { snprintf(msg, msgLen, "bit exact"); return true; }
+    if(sig.codec == CODEC_FLAC) { snprintf(msg, msgLen, "lossless codec not bit exact, crc32 0x%08x", sig.crc); return false; }
+    if(gold.blocks.size() != sig.blocks.size()) { snprintf(msg, msgLen, "block count differs"); return false; }
+    int32_t worst = 0;
+    size_t  worstIdx = 0;
+    for(size_t i = 0; i < sig.blocks.size(); i++) {
+        int32_t diff = abs(sig.blocks[i] - gold.blocks[i]);
+        int32_t tol = max((int32_t)(gold.blocks[i] * SIG_TOL_PERCENT / 100), (int32_t)SIG_TOL_LSB);
+        if(diff > tol) {
+            snprintf(msg, msgLen, "block %zu %s%zu is %d, expected %d", i / 4, (i & 2) ? "peak" : "rms", i & 1, sig.blocks[i], gold.blocks[i]);
+            return false;
+        }
+        if(diff > worst) { worst = diff; worstIdx = i; }
+    }
+    snprintf(msg, msgLen, "within tolerance, max deviation %d LSB (block %zu)", worst, worstIdx / 4);
+    return true;
+}
+//----------------------------------------------------------------------------------------------------------------------
+//  reference PCM, optional
+//----------------------------------------------------------------------------------------------------------------------
+static bool compareReference(const std::vector<int16_t>& pcm, const std::vector<uint8_t>& refRaw, uint8_t channels, double minSnr,
+                             char* msg, size_t msgLen) {
+    const int16_t* ref = (const int16_t*)refRaw.data();
+    int64_t refFrames = refRaw.size() / 2 / channels;
+    int64_t outFrames = pcm.size() / channels;
+    const int64_t maxLag = 4096, winStart = 8192, winLen = 8192;
+    if(refFrames < winStart + winLen + maxLag || outFrames < winStart + winLen + maxLag) {
+        snprintf(msg, msgLen, "reference too short");
+        return false;
+    }
+    int64_t bestLag = 0;
+    double  bestErr = -1;
+    for(int64_t lag = -maxLag; lag <= maxLag; lag++) { // out[i + lag] ~ ref[i]
+        double err = 0;
+        for(int64_t i = winStart; i < winStart + winLen && (bestErr < 0 || err < bestErr); i++) {
+            for(uint8_t ch = 0; ch < channels; ch++) {
+                double d = pcm[(i + lag) * channels + ch] - ref[i * channels + ch];
+                err += d * d;
+            }
+        }
+        if(bestErr < 0 || err < bestErr) { bestErr = err; bestLag = lag; }
+    }
+    double sig = 0, noise = 0;
+    int32_t maxDiff = 0;
+    for(int64_t i = max((int64_t)0, -bestLag); i < refFrames && i + bestLag < outFrames; i++) {
+        for(uint8_t ch = 0; ch < channels; ch++) {
+            int32_t r = ref[i * channels + ch];
+            int32_t d = pcm[(i + bestLag) * channels + ch] - r;
+            sig += (double)r * r;
+            noise += (double)d * d;
+            if(abs(d) > maxDiff) maxDiff = abs(d);
+        }
+    }
+    double snr = noise > 0 ? 10 * log10(sig / noise) : 999;
+    snprintf(msg, msgLen, "SNR %.1f dB, max diff %d, delay %lld frames", snr, maxDiff, (long long)bestLag);
+    return snr >= minSnr;
+}
+//----------------------------------------------------------------------------------------------------------------------
+//  the driver loop, Audio::playAudioData() / sendBytes() without the audio buffer
+//----------------------------------------------------------------------------------------------------------------------
+static bool runDecoder(stream_t& s, signature_t* sig, std::vector<int16_t>* pcm, bool timingOnly, double* seconds, size_t* peakMem) {
+    memResetPeak();
+    size_t memBase = memCurrent();
+    if(!decoderAllocate(s)) { printf("%s decoder could not be initialized\n", codecName[s.codec]); return false; }
+
+    SignatureBuilder builder(*sig);
+    uint8_t* buf = s.file.data();
+    uint32_t pos = s.dataStart;
+    bool     playing = false;
+    uint32_t stall = 0;
+    bool     ok = true;
+    auto     t0 = std::chrono::steady_clock::now();
+
+    while(pos < s.dataEnd) {
+        int32_t  len = min((int32_t)(s.dataEnd - pos), maxBlockSize[s.codec]);
+        uint8_t* data = buf + pos;
+        if(!playing) {
+            int32_t nextSync = findSync(s, data, len);
+            if(nextSync < 0) { pos += len; continue; }
+            if(nextSync > 0) { pos += nextSync; continue; }
+            playing = true;
+        }
+        int32_t bytesLeft = len;
+        int32_t res = decode(s.codec, data, &bytesLeft);
+        int32_t bytesDecoded = len - bytesLeft;
+
+        if(res < 0) {
+            if(res == -100) { printf("%s: fatal decoder error at %u\n", codecName[s.codec], pos); ok = false; break; }
+            sig->errors++;
+            playing = false;
+            pos += bytesDecoded ? bytesDecoded : 1;
+            continue;
+        }
+        if(res > 99) {
+            if(decodeContinue(s.codec, res)) pos += bytesDecoded;
+            if(!bytesDecoded && ++stall > 64) break; // e.g. OPUS_END without consuming data
+            continue;
+        }
+        if(bytesDecoded == 0 && s.codec != CODEC_VORBIS && s.codec != CODEC_FLAC) {
+            playing = false;
+            pos += 1;
+            continue;
+        }
+        stall = bytesDecoded ? 0 : stall + 1;
+        if(stall > 64) break;
+        pos += bytesDecoded;
+
+        uint32_t frames; uint8_t channels; uint32_t sampleRate;
+        outputFormat(s.codec, &frames, &channels, &sampleRate);
+        if(!frames) continue;
+        if(frames * channels > OUTBUFF_SAMPLES) { printf("%s: %u samples exceed the output buffer\n", codecName[s.codec], frames * channels); ok = false; break; }
+        if(timingOnly) continue;           // the signature costs as much as a fast decoder
+        if(sig->sampleRate == 0) sig->sampleRate = sampleRate;
+        builder.add(s_outBuff, frames, channels);
+        if(pcm) pcm->insert(pcm->end(), s_outBuff, s_outBuff + frames * channels);
+    }
+    *seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    if(!timingOnly) builder.finish();
+    *peakMem = memPeak() - memBase;
+    decoderFree(s.codec);
+    return ok;
+}
+//----------------------------------------------------------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+    const char* goldenDir = nullptr;
+    const char* refDir = nullptr;
+    const char* dumpDir = nullptr;
+    bool        update = false;
+    int         repeat = 3;
+    double      minSnr = 40.0;
+    std::vector<const char*> files;
+
+    for(int i = 1; i < argc; i++) {
+        if     (!strcmp(argv[i], "--update"))                    update = true;
+        else if(!strcmp(argv[i], "--golden-dir") && i + 1 < argc) goldenDir = argv[++i];
+        else if(!strcmp(argv[i], "--ref-dir") && i + 1 < argc)    refDir = argv[++i];
+        else if(!strcmp(argv[i], "--dump") && i + 1 < argc)       dumpDir = argv[++i];
+        else if(!strcmp(argv[i], "--repeat") && i + 1 < argc)     repeat = atoi(argv[++i]);
+        else if(!strcmp(argv[i], "--min-snr") && i + 1 < argc)    minSnr = atof(argv[++i]);
+        else if(argv[i][0] == '-') { printf("unknown option %s\n", argv[i]); return 2; }
+        else files.push_back(argv[i]);
+    }
+    if(repeat < 1) repeat = 1;
+    if(files.empty() || (update && !goldenDir)) {
+        printf("usage: %s [--update] [--golden-dir DIR] [--ref-dir DIR] [--repeat N] [--min-snr dB] [--dump DIR] file...\n", argv[0]);
+        return 2;
+    }
+
+    int failed = 0;
+    char path[512], msg[sizeof(path) + 64];   // msg may carry the golden path
+    printf("%-28s %-6s %3s %6s %9s %8s %8s %9s  %s\n", "file", "codec", "ch", "rate", "frames", "audio s", "x rt", "peak KB", "result");
+
+    for(const char* file : files) {
+        stream_t s;
+        if(!openStream(file, s)) { failed++; continue; }
+
+        std::vector<uint8_t> refRaw;
+        std::vector<int16_t> pcm;
+        bool haveRef = false;
+        if(refDir) {
+            snprintf(path, sizeof(path), "%s/%s.s16", refDir, baseName(file));
+            haveRef = readFile(path, refRaw);
+            if(haveRef) pcm.reserve(refRaw.size() / 2 + 65536); // before the measurement, not part of the peak
+        }
+        if(dumpDir && !haveRef) pcm.reserve(s.file.size() * 16);
+
+        signature_t sig;
+        sig.codec = s.codec;
+        double best = 1e9, seconds;
+        size_t peakMem = 0, mem;
+        bool ok = runDecoder(s, &sig, (haveRef || dumpDir) ? &pcm : nullptr, false, &seconds, &peakMem);
+        if(repeat == 1) best = seconds;     // includes the signature
+        for(int r = 1; ok && r < repeat; r++) { // further runs for timing only
+            signature_t tmp;
+            ok = runDecoder(s, &tmp, nullptr, true, &seconds, &mem);
+            best = min(best, seconds);
+            peakMem = max(peakMem, mem);
+        }
+        double audioSec = sig.sampleRate ? (double)sig.frames / sig.sampleRate : 0;
+
+        if(ok && !sig.frames) { ok = false; snprintf(msg, sizeof(msg), "no output"); }
+        else if(!ok) snprintf(msg, sizeof(msg), "decoder failed");
+        else if(goldenDir) {
+            snprintf(path, sizeof(path), "%s/%s.sig", goldenDir, baseName(file));
+            if(update) {
+                ok = writeGolden(path, baseName(file), sig);
+                snprintf(msg, sizeof(msg), ok ? "golden written" : "can't write golden");
+            }
+            else {
+                signature_t gold;
+                if(!readGolden(path, gold)) { ok = false; snprintf(msg, sizeof(msg), "no golden file %s", path); }
+                else ok = compareGolden(gold, sig, msg, sizeof(msg));
+            }
+        }
+        else snprintf(msg, sizeof(msg), "crc32 0x%08x", sig.crc);
+
+        printf("%-28.28s %-6s %3u %6u %9llu %8.2f %8.1f %9.1f  %s %s", baseName(file), codecName[s.codec], sig.channels, sig.sampleRate,
+               (unsigned long long)sig.frames, audioSec, best > 0 ? audioSec / best : 0, peakMem / 1024.0, ok ? "PASS" : "FAIL", msg);
+        if(sig.errors) printf(", %u decode errors", sig.errors);
+        printf("\n");
+
+        static const uint8_t noMD5[16] = {0};
+        if(ok && s.flacSampleRate && s.flacBPS == 16 && memcmp(s.flacMD5, noMD5, 16)) { // native FLAC carries its own reference
+            ok = !memcmp(s.flacMD5, sig.md5, 16);
+            printf("%-28s STREAMINFO MD5 %s\n", "", ok ? "PASS" : "FAIL");
+        }
+        if(ok && haveRef) {
+            ok = compareReference(pcm, refRaw, sig.channels, s.codec == CODEC_FLAC ? 999 : minSnr, msg, sizeof(msg));
+            printf("%-28s reference %s %s\n", "", ok ? "PASS" : "FAIL", msg);
+        }
+        if(dumpDir) {
+            snprintf(path, sizeof(path), "%s/%s.s16", dumpDir, baseName(file));
+            FILE* f = fopen(path, "wb");
+            if(!f || fwrite(pcm.data(), sizeof(int16_t), pcm.size(), f) != pcm.size()) { printf("can't write %s\n", path); ok = false; }
+            if(f) fclose(f);
+        }
+        if(!ok) failed++;
+    }
+    return failed ? 1 : 0;
+}
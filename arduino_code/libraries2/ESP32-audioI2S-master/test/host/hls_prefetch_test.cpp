@@ -0,0 +1,307 @@
+/*
+ * hls_prefetch_test.cpp
+ *
+ * Created on: Oct 18,2026
+ *
+ *  Runs src/hls_prefetch against a local HTTP/1.1 server stand-in on 127.0.0.1. The server produces deterministic
+ *  segment bodies, counts accepted connections and requests and can throttle, use chunked encoding, redirect,
+ *  answer 404 or drop idle keep-alive connections. The consumer behaves like Audio::loop(): enqueue the rest of
+ *  the playlist, select() the next segment, read it, "play" it for a while.
+ *
+ *      hls_prefetch_test            all cases, exit code 0 if everything passed
+ *
+ */
+#include "Arduino.h"
+#include "hls_prefetch/hls_prefetch.h"
+#include <atomic>
+#include <arpa/inet.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+//  server stand-in
+struct server_cfg_t {
+    uint32_t kbps = 0;          // 0 = unlimited, else send rate per connection
+    bool     chunked = false;
+    uint16_t dropAfter = 0;     // close an idle connection after this many requests (stale keep-alive)
+};
+
+class TestServer {
+  public:
+    std::atomic<uint32_t> connections{0};
+    std::atomic<uint32_t> requests{0};
+    server_cfg_t          cfg;
+
+    bool begin() {
+        m_fd = socket(AF_INET, SOCK_STREAM, 0);
+        int one = 1;
+        setsockopt(m_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        sockaddr_in a = {};
+        a.sin_family = AF_INET;
+        a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if(bind(m_fd, (sockaddr*)&a, sizeof(a)) < 0 || listen(m_fd, 8) < 0) return false;
+        socklen_t len = sizeof(a);
+        getsockname(m_fd, (sockaddr*)&a, &len);
+        m_port = ntohs(a.sin_port);
+        std::thread([this]{ acceptLoop(); }).detach();
+        return true;
+    }
+    uint16_t port() { return m_port; }
+    void reset(const server_cfg_t& c) { cfg = c; connections = 0; requests = 0; }
+
+    static uint32_t segSize(uint32_t n) { return 20000 + (n * 7919) % 40000; }
+    static uint8_t  segByte(uint32_t n, uint32_t i) { return (uint8_t)(n * 131 + i * 7 + (i >> 8)); }
+
+  private:
+    int      m_fd = -1;
+    uint16_t m_port = 0;
+
+    void acceptLoop() {
+        while(true) {
+            int c = accept(m_fd, nullptr, nullptr);
+            if(c < 0) continue;
+            int one = 1;
+            setsockopt(c, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one)); // header and body in separate sends
+            connections++;
+            std::thread([this, c]{ serve(c); }).detach();
+        }
+    }
+
+    bool sendAll(int c, const void* data, size_t len) {
+        const uint8_t* p = (const uint8_t*)data;
+        while(len) {
+            size_t slice = len;
+            if(cfg.kbps) slice = min(len, (size_t)1024);
+            ssize_t n = send(c, p, slice, MSG_NOSIGNAL);
+            if(n <= 0) return false;
+            p += n;
+            len -= n;
+            if(cfg.kbps) std::this_thread::sleep_for(std::chrono::microseconds((uint64_t)n * 8000 / cfg.kbps));
+        }
+        return true;
+    }
+
+    void serve(int c) {
+        std::string in;
+        uint16_t served = 0;
+        char buf[2048];
+        while(true) {
+            size_t end;
+            while((end = in.find("\r\n\r\n")) == std::string::npos) {
+                ssize_t n = recv(c, buf, sizeof(buf), 0);
+                if(n <= 0) {close(c); return;}
+                in.append(buf, n);
+            }
+            std::string req = in.substr(0, end);
+            in.erase(0, end + 4);
+            requests++;
+            served++;
+            char path[256] = {0};
+            sscanf(req.c_str(), "GET %255s", path);
+            uint32_t n = 0;
+            std::string hdr;
+            if(sscanf(path, "/redir/%u", &n) == 1) {
+                hdr = "HTTP/1.1 302 Found\r\nLocation: /seg/" + std::to_string(n) + ".aac\r\nContent-Length: 0\r\n\r\n";
+                if(!sendAll(c, hdr.data(), hdr.size())) break;
+            }
+            else if(sscanf(path, "/seg/%u", &n) == 1) {
+                std::vector<uint8_t> body(segSize(n));
+                for(uint32_t i = 0; i < body.size(); i++) body[i] = segByte(n, i);
+                if(cfg.chunked) {
+                    hdr = "HTTP/1.1 200 OK\r\nContent-Type: audio/aac\r\nTransfer-Encoding: chunked\r\n\r\n";
+                    if(!sendAll(c, hdr.data(), hdr.size())) break;
+                    size_t pos = 0, cs = 777;
+                    while(pos < body.size()) {
+                        size_t len = min(cs, body.size() - pos);
+                        char sz[32];
+                        int l = snprintf(sz, sizeof(sz), "%zx;ext=1\r\n", len);
+                        if(!sendAll(c, sz, l) || !sendAll(c, &body[pos], len) || !sendAll(c, "\r\n", 2)) goto out;
+                        pos += len;
+                        cs = cs * 3 % 9001 + 1;
+                    }
+                    if(!sendAll(c, "0\r\nX-Trailer: 1\r\n\r\n", 19)) break;
+                }
+                else {
+                    hdr = "HTTP/1.1 200 OK\r\nContent-Type: audio/aac\r\nContent-Length: " + std::to_string(body.size()) + "\r\n\r\n";
+                    if(!sendAll(c, hdr.data(), hdr.size()) || !sendAll(c, body.data(), body.size())) break;
+                }
+            }
+            else {
+                hdr = "HTTP/1.1 404 Not Found\r\nContent-Length: 9\r\n\r\nnot found";
+                if(!sendAll(c, hdr.data(), hdr.size())) break;
+            }
+            if(cfg.dropAfter && served >= cfg.dropAfter) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20)); // idle, then gone (keep-alive timeout)
+                break;
+            }
+        }
+    out:
+        close(c);
+    }
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+static int s_failed = 0;
+#define CHECK(cond, ...) do{ if(!(cond)) {printf("    FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); s_failed++;} }while(0)
+
+typedef struct _run{
+    uint32_t bytes;
+    uint32_t corrupt;           // segments with wrong content
+    uint32_t notSelected;       // select() returned false
+    uint32_t readyAtSelect;     // segments that were loaded completely when they were selected
+    HLSPrefetch::stats_t st;
+} run_t;
+
+// consumer as in Audio::loop(): the whole rest of the playlist is offered, duplicates are ignored by the prefetcher
+static run_t consume(HLSPrefetch& pf, uint16_t port, const char* dir, uint32_t first, uint32_t count, uint32_t playMs) {
+    run_t r = {};
+    std::vector<std::string> urls;
+    for(uint32_t n = first; n < first + count; n++) urls.push_back("http://127.0.0.1:" + std::to_string(port) + dir + std::to_string(n) + (strcmp(dir, "/seg/") ? "" : ".aac"));
+    std::vector<uint8_t> got;
+    uint8_t buf[1500];
+    for(uint32_t k = 0; k < count; k++) {
+        for(uint32_t j = k; j < count; j++) pf.enqueue(urls[j].c_str());
+        if(!pf.select(urls[k].c_str())) {r.notSelected++; continue;}
+        if(pf.available() == TestServer::segSize(first + k)) r.readyAtSelect++;
+        got.clear();
+        uint32_t t0 = millis();
+        while(!pf.eos() && millis() - t0 < 10000) {
+            int32_t n = pf.read(buf, sizeof(buf));
+            if(n > 0) got.insert(got.end(), buf, buf + n);
+            else vTaskDelay(1);
+        }
+        if(pf.read() >= 0) got.push_back(0); // nothing may follow eos()
+        bool ok = got.size() == TestServer::segSize(first + k);
+        for(uint32_t i = 0; ok && i < got.size(); i++) ok = got[i] == TestServer::segByte(first + k, i);
+        if(!ok) r.corrupt++;
+        r.bytes += got.size();
+        vTaskDelay(playMs);
+    }
+    pf.getStats(r.st);
+    return r;
+}
+
+static void printRun(const char* name, TestServer& srv, const run_t& r) {
+    printf("  %-22s conns %2u  requests %2u  reused %2u  depth %u  %6u kbit/s  ready at select %u\n",
+           name, (unsigned)srv.connections.load(), (unsigned)r.st.requests, (unsigned)r.st.reused, r.st.depth,
+           (unsigned)r.st.kbps, (unsigned)r.readyAtSelect);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+int main() {
+    g_hostPsram = true;
+    TestServer srv;
+    if(!srv.begin()) {printf("can't open the server socket\n"); return 1;}
+    HLSPrefetch pf;
+    printf("HLS prefetch against 127.0.0.1:%u\n", srv.port());
+
+    { // one keep-alive connection carries all segments, they are loaded before they are needed
+        srv.reset({});
+        pf.start();
+        run_t r = consume(pf, srv.port(), "/seg/", 0, 12, 60);
+        pf.stop();
+        printRun("keep-alive", srv, r);
+        CHECK(r.corrupt == 0 && r.notSelected == 0, "corrupt %u, not selected %u", r.corrupt, r.notSelected);
+        CHECK(srv.connections == 1, "%u connections, expected 1", (unsigned)srv.connections.load());
+        CHECK(r.st.reused == 11, "reused %u, expected 11", (unsigned)r.st.reused);
+        CHECK(r.readyAtSelect >= 10, "only %u segments were ready at select()", r.readyAtSelect);
+        CHECK(r.st.depth <= 2, "fast link, depth %u", r.st.depth);
+    }
+    { // chunked transfer encoding with chunk extensions and trailer
+        server_cfg_t c; c.chunked = true;
+        srv.reset(c);
+        pf.start();
+        run_t r = consume(pf, srv.port(), "/seg/", 100, 6, 60);
+        pf.stop();
+        printRun("chunked", srv, r);
+        CHECK(r.corrupt == 0 && r.notSelected == 0, "corrupt %u, not selected %u", r.corrupt, r.notSelected);
+        CHECK(r.st.reused + 2 >= r.st.requests, "requests %u, reused %u", (unsigned)r.st.requests, (unsigned)r.st.reused);
+    }
+    { // 302 to the real segment, on the same connection
+        srv.reset({});
+        pf.start();
+        run_t r = consume(pf, srv.port(), "/redir/", 200, 4, 60);
+        pf.stop();
+        printRun("redirect", srv, r);
+        CHECK(r.corrupt == 0 && r.notSelected == 0, "corrupt %u, not selected %u", r.corrupt, r.notSelected);
+        CHECK(srv.requests == 8 && srv.connections == 1, "requests %u, connections %u", (unsigned)srv.requests.load(), (unsigned)srv.connections.load());
+    }
+    { // the server drops idle connections, the next request must reconnect silently
+        server_cfg_t c; c.dropAfter = 3;
+        srv.reset(c);
+        pf.start();
+        run_t r = consume(pf, srv.port(), "/seg/", 300, 9, 80);
+        pf.stop();
+        printRun("server drops idle", srv, r);
+        CHECK(r.corrupt == 0 && r.notSelected == 0, "corrupt %u, not selected %u", r.corrupt, r.notSelected);
+        CHECK(r.st.failed == 0, "%u failed", (unsigned)r.st.failed);
+        CHECK(srv.connections >= 3, "%u connections, expected at least 3", (unsigned)srv.connections.load());
+    }
+    { // 404: select() refuses the segment, Audio loads it the usual way
+        srv.reset({});
+        pf.start();
+        std::string bad = "http://127.0.0.1:" + std::to_string(srv.port()) + "/missing/1.aac";
+        pf.enqueue(bad.c_str());
+        uint32_t t0 = millis();
+        HLSPrefetch::stats_t st;
+        do {vTaskDelay(10); pf.getStats(st);} while(!st.failed && millis() - t0 < 5000);
+        CHECK(st.failed == 1 && !pf.select(bad.c_str()), "404 not reported");
+        pf.stop();
+        printf("  %-22s requests %u (1 + %u retries)\n", "404", (unsigned)srv.requests.load(), HLS_PREFETCH_RETRIES);
+    }
+    { // slow link: a segment needs about 60% of its play time, the prefetcher goes deeper and uses both connections
+        server_cfg_t c; c.kbps = 3200;  // ~100 ms for 40 KB, play time 150 ms
+        srv.reset(c);
+        pf.start();
+        run_t r = consume(pf, srv.port(), "/seg/", 400, 14, 150);
+        pf.stop();
+        printRun("slow link", srv, r);
+        CHECK(r.corrupt == 0 && r.notSelected == 0, "corrupt %u, not selected %u", r.corrupt, r.notSelected);
+        CHECK(r.st.depth >= 3, "slow link, depth %u", r.st.depth);
+        CHECK(srv.connections == 2, "%u connections, expected 2", (unsigned)srv.connections.load());
+    }
+    { // stop() while the task hangs in connect(): returns at once, a start() right after it takes the task over
+        int hole = socket(AF_INET, SOCK_STREAM, 0); // listens but never accepts, the SYN queue is full after a few connects
+        sockaddr_in a = {};
+        a.sin_family = AF_INET;
+        a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t len = sizeof(a);
+        bind(hole, (sockaddr*)&a, sizeof(a));
+        listen(hole, 0);
+        getsockname(hole, (sockaddr*)&a, &len);
+        std::vector<int> fill;
+        for(int i = 0; i < 4; i++) {
+            int f = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+            ::connect(f, (sockaddr*)&a, sizeof(a));
+            fill.push_back(f);
+        }
+        srv.reset({});
+        pf.setTimeout(1500, 1500);
+        pf.start();
+        std::string url = "http://127.0.0.1:" + std::to_string(ntohs(a.sin_port)) + "/seg/1.aac";
+        pf.enqueue(url.c_str());
+        vTaskDelay(100);
+        auto t0 = std::chrono::steady_clock::now();
+        pf.stop();
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+        printf("  %-22s stop() %.2f ms\n", "stop in connect", ms);
+        CHECK(ms < 50, "stop() blocked for %.0f ms", ms);
+        CHECK(!pf.isRunning() && !pf.enqueue(url.c_str()), "still running after stop()");
+        pf.start(); // the task is still in connect()
+        run_t r = consume(pf, srv.port(), "/seg/", 500, 4, 60);
+        pf.stop();
+        printRun("restart while stopping", srv, r);
+        CHECK(r.corrupt == 0 && r.notSelected == 0, "corrupt %u, not selected %u", r.corrupt, r.notSelected);
+        CHECK(r.st.requests == 4 && srv.requests == 4, "requests %u, server %u", (unsigned)r.st.requests, (unsigned)srv.requests.load());
+        vTaskDelay(1600); // the abandoned connect has timed out, the task has ended, the next start() creates a new one
+        srv.reset({});
+        pf.start();
+        r = consume(pf, srv.port(), "/seg/", 600, 3, 60);
+        pf.stop();
+        printRun("restart after stop", srv, r);
+        CHECK(r.corrupt == 0 && r.notSelected == 0 && srv.connections == 1, "corrupt %u, not selected %u, connections %u",
+              r.corrupt, r.notSelected, (unsigned)srv.connections.load());
+        for(int f : fill) close(f);
+        close(hole);
+    }
+    printf("%s\n", s_failed ? "FAILED" : "all passed");
+    return s_failed ? 1 : 0;
+}
@@ -0,0 +1,148 @@
+/*
+ * level_meter_test.cpp
+ *
+ * Created on: Oct 18,2026
+ *
+ *  Checks AudioLevelMeter (libraries2/AudioLevelMeter, used by Audio::playChunk()) with synthetic signals: peak and
+ *  RMS of sines, BS.1770 loudness at 48 and 44.1 kHz (a -20 dBFS 1 kHz sine on both channels reads -20 LUFS),
+ *  mono, independence from the buffer size, and a reader thread that must never see a torn snapshot while the
+ *  writer publishes. Prints the cost per frame at the end.
+ *
+ *      level_meter_test            exit code 0 if everything passed
+ *
+ */
+#include "Arduino.h"
+#include "AudioLevelMeter.h"
+#include <atomic>
+#include <chrono>
+
+static int s_failed = 0;
+#define CHECK(cond, ...) do{ if(!(cond)) {printf("    FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); s_failed++;} }while(0)
+
+//----------------------------------------------------------------------------------------------------------------------
+static std::vector<int16_t> sine(uint32_t rate, float hz, float dBFS, float seconds, uint8_t channels, bool rightSilent = false) {
+    uint32_t frames = rate * seconds;
+    std::vector<int16_t> v(frames * channels);
+    float amp = 32767.0f * powf(10.0f, dBFS / 20.0f);
+    for(uint32_t i = 0; i < frames; i++) {
+        int16_t s = (int16_t)lrintf(amp * sinf(2.0f * (float)M_PI * hz * i / rate));
+        v[i * channels] = s;
+        if(channels == 2) v[i * 2 + 1] = rightSilent ? 0 : s;
+    }
+    return v;
+}
+
+static void feed(AudioLevelMeter& m, const std::vector<int16_t>& pcm, uint8_t channels, uint32_t chunk) {
+    size_t frames = pcm.size() / channels;
+    for(size_t i = 0; i < frames; i += chunk) m.process(pcm.data() + i * channels, min((size_t)chunk, frames - i), channels);
+}
+
+static bool near(float a, float b, float tol) { return fabsf(a - b) <= tol; }
+
+//----------------------------------------------------------------------------------------------------------------------
+static void testSine(uint32_t rate) {
+    AudioLevelMeter m;
+    m.setSampleRate(rate);
+    m.setLoudness(true);
+    feed(m, sine(rate, 1000, -20, 3.5f, 2), 2, 512);
+    AudioLevelMeter::levels_t lv;
+    CHECK(m.getLevels(lv), "no levels");
+    printf("  sine -20 dBFS %5u Hz  peak %.2f dB, rms %.2f dB, M %.2f LUFS, S %.2f LUFS, %u blocks\n",
+           rate, lv.peakDb[0], lv.rmsDb[0], lv.lufsM, lv.lufsS, lv.blocks);
+    CHECK(near(lv.peakDb[0], -20.0f, 0.05f) && near(lv.peakDb[1], -20.0f, 0.05f), "peak %.3f / %.3f", lv.peakDb[0], lv.peakDb[1]);
+    CHECK(near(lv.rmsDb[0], -23.01f, 0.05f) && near(lv.rmsDb[1], -23.01f, 0.05f), "rms %.3f / %.3f", lv.rmsDb[0], lv.rmsDb[1]);
+    CHECK(abs((int)lv.rms[0] - 2317) <= 2, "rms %u", lv.rms[0]);
+    CHECK(near(lv.lufsM, -20.0f, 0.1f), "momentary %.3f LUFS", lv.lufsM);
+    CHECK(near(lv.lufsS, -20.0f, 0.1f), "short-term %.3f LUFS", lv.lufsS);
+    CHECK(lv.blocks == (uint32_t)(3.5f * 1000 / 20), "%u blocks", lv.blocks);
+}
+//----------------------------------------------------------------------------------------------------------------------
+static void testChannels() {
+    AudioLevelMeter m;
+    m.setSampleRate(48000);
+    m.setLoudness(true);
+    AudioLevelMeter::levels_t lv;
+
+    feed(m, sine(48000, 1000, -20, 1.0f, 1), 1, 480);        // mono counts once: 3 dB below the stereo reading
+    CHECK(m.getLevels(lv), "no levels");
+    CHECK(lv.peak[0] == lv.peak[1] && lv.rms[0] == lv.rms[1], "mono not mirrored");
+    CHECK(near(lv.lufsM, -23.01f, 0.1f), "mono momentary %.3f LUFS", lv.lufsM);
+
+    feed(m, sine(48000, 440, 0, 1.0f, 2, true), 2, 480);     // left only, the format change restarts the meter
+    CHECK(m.getLevels(lv), "no levels");
+    CHECK(lv.peak[0] == 32767 && lv.peak[1] == 0, "peak %u / %u", lv.peak[0], lv.peak[1]);
+    CHECK(lv.rmsDb[1] == LEVELMETER_SILENCE_DB, "silent channel %.2f dB", lv.rmsDb[1]);
+    CHECK(lv.blocks == 50, "%u blocks after the format change", lv.blocks);
+    printf("  channels              mono and left-only ok\n");
+}
+//----------------------------------------------------------------------------------------------------------------------
+static void testChunking() {
+    // the result must not depend on how the audio path slices its buffers
+    std::vector<int16_t> pcm = sine(44100, 997, -6, 1.0f, 2);
+    for(size_t i = 0; i < pcm.size(); i += 2) pcm[i] = (int16_t)(pcm[i] * ((i / 2) % 3000) / 3000); // ramped left
+    AudioLevelMeter a, b, c;
+    feed(a, pcm, 2, 44100);
+    feed(b, pcm, 2, 1);
+    feed(c, pcm, 2, 333);
+    AudioLevelMeter::levels_t la, lb, lc;
+    a.getLevels(la); b.getLevels(lb); c.getLevels(lc);
+    bool same = true;
+    for(int ch = 0; ch < 2; ch++) same &= la.peak[ch] == lb.peak[ch] && la.peak[ch] == lc.peak[ch] && la.rms[ch] == lb.rms[ch] && la.rms[ch] == lc.rms[ch];
+    CHECK(same && la.blocks == lb.blocks && la.blocks == lc.blocks, "buffer size changes the result");
+    printf("  chunking              1, 333, 44100 frames per call give the same levels\n");
+}
+//----------------------------------------------------------------------------------------------------------------------
+static void testSnapshot() {
+    // every block holds one DC value on both channels, so a consistent snapshot has peak == rms on L and R
+    AudioLevelMeter m;
+    m.setSampleRate(48000);
+    m.setBlockTime(10);
+    std::atomic<bool> done{false};
+    std::atomic<uint32_t> reads{0}, torn{0}, backwards{0};
+    std::thread reader([&] {
+        uint32_t last = 0;
+        while(!done) {
+            AudioLevelMeter::levels_t lv;
+            if(!m.getLevels(lv)) continue;
+            reads++;
+            if(lv.peak[0] != lv.peak[1] || lv.rms[0] != lv.rms[1] || lv.peak[0] != lv.rms[0] || lv.peakDb[0] != lv.peakDb[1]) torn++;
+            if(lv.blocks < last) backwards++;
+            last = lv.blocks;
+        }
+    });
+    std::vector<int16_t> block(480 * 2);
+    for(uint32_t k = 0; k < 100000; k++) {
+        int16_t v = (int16_t)(100 + (k * 37) % 30000);
+        std::fill(block.begin(), block.end(), v);
+        m.process(block.data(), 480, 2);
+    }
+    done = true;
+    reader.join();
+    printf("  snapshot              %u reads during 100000 blocks, %u torn\n", (unsigned)reads.load(), (unsigned)torn.load());
+    CHECK(reads > 0 && torn == 0 && backwards == 0, "torn %u, backwards %u", (unsigned)torn.load(), (unsigned)backwards.load());
+}
+//----------------------------------------------------------------------------------------------------------------------
+static void bench() {
+    std::vector<int16_t> pcm = sine(48000, 1000, -10, 4.0f, 2);
+    for(int loud = 0; loud < 2; loud++) {
+        AudioLevelMeter m;
+        m.setSampleRate(48000);
+        m.setLoudness(loud);
+        auto t0 = std::chrono::steady_clock::now();
+        for(int r = 0; r < 5; r++) feed(m, pcm, 2, 1152);
+        double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+        printf("  bench %-15s %.2f ns per stereo frame\n", loud ? "peak+rms+LUFS" : "peak+rms", ns / (5.0 * pcm.size() / 2));
+    }
+}
+//----------------------------------------------------------------------------------------------------------------------
+int main() {
+    printf("AudioLevelMeter\n");
+    testSine(48000);
+    testSine(44100);
+    testChannels();
+    testChunking();
+    testSnapshot();
+    bench();
+    printf("%s\n", s_failed ? "FAILED" : "all passed");
+    return s_failed ? 1 : 0;
+}
@@ -0,0 +1,61 @@
+/*
+ * mem_track.cpp
+ *
+ * Created on: Oct 18,2026
+ *
+ *  Heap accounting for the host decoder bench. malloc/calloc/realloc/free are interposed and forwarded to the
+ *  glibc implementation, so every allocation is seen: ps_malloc() from the shim, heap_caps_malloc_prefer(),
+ *  ps_ptr<T> and operator new inside libstdc++. Sizes are taken from malloc_usable_size(), therefore the numbers
+ *  include the allocator rounding and are a little higher than on the ESP32.
+ *
+ */
+#include "mem_track.h"
+#include <atomic>
+#include <malloc.h>
+
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t n, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void  __libc_free(void* ptr);
+}
+
+static std::atomic<size_t> s_current{0};
+static std::atomic<size_t> s_peak{0};
+
+static inline void track_add(void* ptr) {
+    if(!ptr) return;
+    size_t now = s_current.fetch_add(malloc_usable_size(ptr), std::memory_order_relaxed) + malloc_usable_size(ptr);
+    size_t peak = s_peak.load(std::memory_order_relaxed);
+    while(now > peak && !s_peak.compare_exchange_weak(peak, now, std::memory_order_relaxed)) {}
+}
+static inline void track_sub(void* ptr) {
+    if(!ptr) return;
+    s_current.fetch_sub(malloc_usable_size(ptr), std::memory_order_relaxed);
+}
+//----------------------------------------------------------------------------------------------------------------------
+extern "C" void* malloc(size_t size) {
+    void* p = __libc_malloc(size);
+    track_add(p);
+    return p;
+}
+extern "C" void* calloc(size_t n, size_t size) {
+    void* p = __libc_calloc(n, size);
+    track_add(p);
+    return p;
+}
+extern "C" void* realloc(void* ptr, size_t size) {
+    track_sub(ptr);
+    void* p = __libc_realloc(ptr, size);
+    if(p) track_add(p);
+    else if(ptr && size) track_add(ptr); // failed, the old block is still valid
+    return p;
+}
+extern "C" void free(void* ptr) {
+    track_sub(ptr);
+    __libc_free(ptr);
+}
+//----------------------------------------------------------------------------------------------------------------------
+size_t memCurrent() { return s_current.load(std::memory_order_relaxed); }
+size_t memPeak()    { return s_peak.load(std::memory_order_relaxed); }
+void   memResetPeak() { s_peak.store(s_current.load(std::memory_order_relaxed), std::memory_order_relaxed); }
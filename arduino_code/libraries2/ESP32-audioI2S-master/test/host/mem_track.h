@@ -0,0 +1,6 @@
+#pragma once
+#include <stddef.h>
+
+size_t memCurrent();   // bytes currently allocated
+size_t memPeak();      // high water mark since the last memResetPeak()
+void   memResetPeak();
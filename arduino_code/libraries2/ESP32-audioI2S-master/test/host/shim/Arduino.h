@@ -0,0 +1,119 @@
+/*
+ * Arduino.h
+ *
+ * Created on: Oct 18,2026
+ *
+ *  Minimal Arduino-ESP32 replacement for the host build of the decoders (test/host). It provides only what the
+ *  decoders in src/, src/hls_prefetch, src/audio_library, AudioLevelMeter and psram_unique_ptr.hpp use:
+ *  PSRAM/heap_caps allocators (mapped to malloc), PROGMEM accessors, the log_x macros, a FreeRTOS task/mutex subset
+ *  on std::thread and a few helpers. FS.h stands in for the Arduino file system.
+ *  Never include this file in a firmware build.
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <assert.h>
+#include <cctype>
+#include <cmath>
+#include <cstdarg>
+#include <new>
+#include <limits>
+#include <string>
+#include <vector>
+#include <functional>
+#include <stdexcept>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+
+#ifndef CORE_DEBUG_LEVEL
+    #define CORE_DEBUG_LEVEL 1  // errors only, set -DCORE_DEBUG_LEVEL=5 for everything
+#endif
+
+#define IRAM_ATTR
+#define PROGMEM
+#ifndef __unused
+    #define __unused __attribute__((unused))
+#endif
+
+#define pgm_read_byte(addr)  (*(const uint8_t*)(addr))
+#define pgm_read_word(addr)  (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+
+typedef bool boolean;
+
+using std::min;
+using std::max;
+#define _min(a, b) ((a) < (b) ? (a) : (b))
+#define _max(a, b) ((a) > (b) ? (a) : (b))
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+//----------------------------------------------------------------------------------------------------------------------
+//  logging, same levels as esp32-hal-log.h
+#define HOST_LOG(lvl, letter, fmt, ...) do{ if(CORE_DEBUG_LEVEL >= lvl) fprintf(stderr, "[" letter "] " fmt "\n", ##__VA_ARGS__); }while(0)
+#define log_e(fmt, ...) HOST_LOG(1, "E", fmt, ##__VA_ARGS__)
+#define log_w(fmt, ...) HOST_LOG(2, "W", fmt, ##__VA_ARGS__)
+#define log_i(fmt, ...) HOST_LOG(3, "I", fmt, ##__VA_ARGS__)
+#define log_d(fmt, ...) HOST_LOG(4, "D", fmt, ##__VA_ARGS__)
+#define log_v(fmt, ...) HOST_LOG(5, "V", fmt, ##__VA_ARGS__)
+
+//----------------------------------------------------------------------------------------------------------------------
+//  memory, there is no PSRAM on the host, every capability ends up in malloc (counted by mem_track.cpp)
+#define MALLOC_CAP_8BIT     (1 << 2)
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_DEFAULT  (1 << 12)
+
+inline bool  g_hostPsram = false;                              // a test may pretend to have PSRAM
+inline bool  psramFound()                                      { return g_hostPsram; }
+inline void* ps_malloc(size_t size)                            { return malloc(size); }
+inline void* ps_calloc(size_t n, size_t size)                  { return calloc(n, size); }
+inline void* heap_caps_malloc_prefer(size_t size, size_t, ...) { return malloc(size); }
+
+//----------------------------------------------------------------------------------------------------------------------
+inline char* ltoa(long value, char* buf, int radix) {
+    if(radix == 16) sprintf(buf, "%lx", value);
+    else            sprintf(buf, "%ld", value);
+    return buf;
+}
+inline unsigned long millis() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  FreeRTOS subset, a task is a detached std::thread, a mutex is a recursive timed mutex, one tick is one ms
+typedef int         BaseType_t;
+typedef uint32_t    TickType_t;
+typedef void*       TaskHandle_t;
+typedef std::recursive_timed_mutex* SemaphoreHandle_t;
+#define pdPASS                  1
+#define pdTRUE                  1
+#define pdFALSE                 0
+#define portMAX_DELAY           0xFFFFFFFFu
+#define configTICK_RATE_HZ      1000
+#define portTICK_PERIOD_MS      1
+
+inline void vTaskDelay(TickType_t ticks) { std::this_thread::sleep_for(std::chrono::milliseconds(ticks)); }
+inline void vTaskDelete(TaskHandle_t)    {}    // the thread ends when the task function returns
+inline BaseType_t xTaskCreatePinnedToCore(void (*fn)(void*), const char*, uint32_t, void* param, int, TaskHandle_t* handle, int) {
+    std::thread t(fn, param);
+    if(handle) *handle = (TaskHandle_t)1;
+    t.detach();
+    return pdPASS;
+}
+inline SemaphoreHandle_t xSemaphoreCreateMutex()         { return new std::recursive_timed_mutex; }
+inline void              vSemaphoreDelete(SemaphoreHandle_t m) { delete m; }
+inline BaseType_t        xSemaphoreGive(SemaphoreHandle_t m)   { m->unlock(); return pdTRUE; }
+inline BaseType_t        xSemaphoreTake(SemaphoreHandle_t m, TickType_t ticks) {
+    if(ticks == portMAX_DELAY) {m->lock(); return pdTRUE;}
+    return m->try_lock_for(std::chrono::milliseconds(ticks)) ? pdTRUE : pdFALSE;
+}
@@ -0,0 +1,113 @@
+/*
+ * NetworkClient.h
+ *
+ * Created on: Oct 18,2026
+ *
+ *  Host replacement of the arduino-esp32 NetworkClient on top of POSIX sockets, only the calls used by
+ *  src/hls_prefetch. connect() blocks up to the timeout given by setTimeout(), read() and available() never block.
+ *
+ */
+#pragma once
+
+#include "Arduino.h"
+#include <errno.h>
+#include <netdb.h>
+#include <poll.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+class NetworkClient {
+  public:
+    virtual ~NetworkClient() { stop(); }
+
+    void setTimeout(uint32_t timeout_ms) { m_timeout = timeout_ms; }
+
+    virtual int connect(const char* host, uint16_t port) {
+        stop();
+        struct addrinfo hints = {}, *res = nullptr;
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+        char portStr[8];
+        snprintf(portStr, sizeof(portStr), "%u", port);
+        if(getaddrinfo(host, portStr, &hints, &res) != 0 || !res) return 0;
+        m_fd = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+        if(m_fd < 0) {freeaddrinfo(res); return 0;}
+        fcntl(m_fd, F_SETFL, fcntl(m_fd, F_GETFL) | O_NONBLOCK);
+        int r = ::connect(m_fd, res->ai_addr, res->ai_addrlen);
+        freeaddrinfo(res);
+        if(r < 0 && errno == EINPROGRESS) {
+            struct pollfd pfd = {m_fd, POLLOUT, 0};
+            int err = 0;
+            socklen_t len = sizeof(err);
+            if(poll(&pfd, 1, m_timeout) == 1) getsockopt(m_fd, SOL_SOCKET, SO_ERROR, &err, &len);
+            else err = ETIMEDOUT;
+            r = err ? -1 : 0;
+        }
+        if(r < 0) {stop(); return 0;}
+        int one = 1;
+        setsockopt(m_fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        m_eof = false;
+        return 1;
+    }
+
+    int available() {
+        if(m_fd < 0) return 0;
+        int n = 0;
+        if(ioctl(m_fd, FIONREAD, &n) < 0) return 0;
+        return n;
+    }
+
+    int read(uint8_t* buf, size_t len) {
+        if(m_fd < 0) return -1;
+        ssize_t n = recv(m_fd, buf, len, MSG_DONTWAIT);
+        if(n == 0) {m_eof = true; return -1;}
+        if(n < 0) return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+        return (int)n;
+    }
+
+    int read() {
+        uint8_t b;
+        return read(&b, 1) == 1 ? b : -1;
+    }
+
+    size_t write(const uint8_t* buf, size_t len) {
+        if(m_fd < 0) return 0;
+        size_t sent = 0;
+        while(sent < len) {
+            ssize_t n = send(m_fd, buf + sent, len - sent, MSG_NOSIGNAL);
+            if(n > 0) {sent += n; continue;}
+            if(n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                struct pollfd pfd = {m_fd, POLLOUT, 0};
+                if(poll(&pfd, 1, m_timeout) == 1) continue;
+            }
+            break;
+        }
+        return sent;
+    }
+
+    size_t print(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+
+    uint8_t connected() {
+        if(m_fd < 0 || m_eof) return 0;
+        uint8_t b;
+        ssize_t n = recv(m_fd, &b, 1, MSG_PEEK | MSG_DONTWAIT);
+        if(n == 0) {m_eof = true; return 0;}       // orderly shutdown by the peer
+        if(n < 0 && errno != EAGAIN && errno != EWOULDBLOCK) return 0;
+        return 1;
+    }
+
+    void stop() {
+        if(m_fd >= 0) close(m_fd);
+        m_fd = -1;
+        m_eof = false;
+    }
+
+  protected:
+    int      m_fd = -1;
+    bool     m_eof = false;
+    uint32_t m_timeout = 3000;
+};
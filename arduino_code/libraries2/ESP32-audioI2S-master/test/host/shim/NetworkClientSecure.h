@@ -0,0 +1,16 @@
+/*
+ * NetworkClientSecure.h
+ *
+ * Created on: Oct 18,2026
+ *
+ *  Host stand-in without TLS, the host tests use plain http only.
+ *
+ */
+#pragma once
+
+#include "NetworkClient.h"
+
+class NetworkClientSecure : public NetworkClient {
+  public:
+    void setInsecure() {}
+};
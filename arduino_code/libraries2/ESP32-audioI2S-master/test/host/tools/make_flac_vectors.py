@@ -0,0 +1,264 @@
+#!/usr/bin/env python3
+"""
+make_flac_vectors.py
+
+Writes small FLAC files that exercise the decoder paths the reference files in additional_info/Testfiles don't
+reach: LPC subframes of every order 1...32, coefficient precision up to 15 bits (64 bit accumulation), all four
+stereo modes, mono, wasted bits, escaped rice partitions, constant and verbatim subframes.
+
+The encoder is deliberately simple (no search, no windowing tricks), but the files are valid FLAC with the MD5 of
+the source PCM in STREAMINFO, so decoder_bench checks them bit exact without any golden data.
+
+    python3 make_flac_vectors.py <outdir>
+"""
+import hashlib
+import math
+import random
+import struct
+import sys
+
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.acc = 0
+        self.n = 0
+
+    def bits(self, value, n):
+        if n == 0:
+            return
+        self.acc = (self.acc << n) | (value & ((1 << n) - 1))
+        self.n += n
+        while self.n >= 8:
+            self.n -= 8
+            self.out.append((self.acc >> self.n) & 0xFF)
+        self.acc &= (1 << self.n) - 1
+
+    def signed(self, value, n):
+        self.bits(value & ((1 << n) - 1), n)
+
+    def unary(self, q):
+        while q >= 32:
+            self.bits(0, 32)
+            q -= 32
+        self.bits(1, q + 1)
+
+    def align(self):
+        if self.n:
+            self.bits(0, 8 - self.n)
+
+
+def crc8(data):
+    crc = 0
+    for b in data:
+        crc ^= b
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+    return crc
+
+
+def crc16(data):
+    crc = 0
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x8005) & 0xFFFF if crc & 0x8000 else (crc << 1) & 0xFFFF
+    return crc
+
+
+def utf8_number(n):
+    if n < 0x80:
+        return bytes([n])
+    out = []
+    while True:
+        out.insert(0, 0x80 | (n & 0x3F))
+        n >>= 6
+        if n < (0x40 >> len(out)):
+            out.insert(0, ((0xFF00 >> len(out)) & 0xFF) | n)
+            return bytes(out)
+
+
+def lpc_coefs(x, order):
+    """autocorrelation + Levinson-Durbin, returns float predictor coefficients"""
+    n = len(x)
+    w = [x[i] * (0.5 - 0.5 * math.cos(2 * math.pi * i / (n - 1))) for i in range(n)]
+    r = [sum(w[i] * w[i - k] for i in range(k, n)) for k in range(order + 1)]
+    if r[0] == 0:
+        return [0.0] * order
+    a = [0.0] * order
+    err = r[0] * (1 + 1e-9)
+    for i in range(order):
+        acc = r[i + 1] - sum(a[j] * r[i - j] for j in range(i))
+        k = acc / err
+        new = a[:]
+        new[i] = k
+        for j in range(i):
+            new[j] = a[j] - k * a[i - 1 - j]
+        a = new
+        err *= (1 - k * k)
+        if err <= 0:
+            break
+    return a
+
+
+def quantize(coefs, precision):
+    cmax = max(abs(c) for c in coefs) or 1.0
+    shift = precision - 1 - max(0, math.frexp(cmax)[1])
+    shift = max(0, min(15, shift))
+    lim = (1 << (precision - 1)) - 1
+    q = [max(-lim - 1, min(lim, int(round(c * (1 << shift))))) for c in coefs]
+    return q, shift
+
+
+def write_residual(bw, res, blocksize, order, partition_order, escape_first=False):
+    parts = 1 << partition_order
+    psize = blocksize // parts
+    bw.bits(1, 2)                       # RICE2, 5 bit parameters
+    bw.bits(partition_order, 4)
+    idx = 0
+    for p in range(parts):
+        cnt = psize - (order if p == 0 else 0)
+        chunk = res[idx:idx + cnt]
+        idx += cnt
+        if escape_first and p == 0:
+            nbits = max(1, max((abs(v) for v in chunk), default=0).bit_length() + 1)
+            bw.bits(31, 5)
+            bw.bits(nbits, 5)
+            for v in chunk:
+                bw.signed(v, nbits)
+            continue
+        mean = sum(abs(v) for v in chunk) / max(1, len(chunk))
+        k = max(0, min(30, int(math.log2(mean + 1)) if mean > 0 else 0))
+        bw.bits(k, 5)
+        for v in chunk:
+            u = (v << 1) if v >= 0 else ((-v) << 1) - 1
+            bw.unary(u >> k)
+            bw.bits(u & ((1 << k) - 1), k)
+
+
+def write_subframe(bw, x, bps, kind, order=0, precision=12, wasted=0, escape=False, saturate=False):
+    bw.bits(0, 1)
+    if kind == 'constant':
+        bw.bits(0, 6)
+    elif kind == 'verbatim':
+        bw.bits(1, 6)
+    elif kind == 'fixed':
+        bw.bits(8 + order, 6)
+    else:
+        bw.bits(32 + order - 1, 6)
+    if wasted:
+        bw.bits(1, 1)
+        bw.unary(wasted - 1)
+        x = [v >> wasted for v in x]
+        bps -= wasted
+    else:
+        bw.bits(0, 1)
+    n = len(x)
+    if kind == 'constant':
+        bw.signed(x[0], bps)
+        return
+    if kind == 'verbatim':
+        for v in x:
+            bw.signed(v, bps)
+        return
+    for i in range(order):
+        bw.signed(x[i], bps)
+    if kind == 'fixed':
+        fc = [[], [1], [2, -1], [3, -3, 1], [4, -6, 4, -1]][order]
+        res = [x[i] - sum(fc[j] * x[i - 1 - j] for j in range(order)) for i in range(order, n)]
+    else:
+        if saturate:                    # legal but poor predictor, every product near 2^31: needs the 64 bit path
+            q, shift = [(1 << (precision - 1)) - 1] * order, precision - 1
+        else:
+            q, shift = quantize(lpc_coefs(x, order), precision)
+        bw.bits(precision - 1, 4)
+        bw.signed(shift, 5)
+        for c in q:
+            bw.signed(c, precision)
+        res = [x[i] - (sum(q[j] * x[i - 1 - j] for j in range(order)) >> shift) for i in range(order, n)]
+    write_residual(bw, res, n, order, 2 if n % 4 == 0 and n // 4 >= order else 0, escape)
+
+
+def encode(path, channels, rate, frames_plan, signal):
+    bps = 16
+    blocksize = 1152
+    total = blocksize * len(frames_plan)
+    pcm = [signal(ch, i) for i in range(total) for ch in range(channels)]
+    md5 = hashlib.md5(struct.pack('<%dh' % len(pcm), *pcm)).digest()
+
+    out = bytearray(b'fLaC')
+    si = BitWriter()
+    si.bits(blocksize, 16); si.bits(blocksize, 16); si.bits(0, 24); si.bits(0, 24)
+    si.bits(rate, 20); si.bits(channels - 1, 3); si.bits(bps - 1, 5); si.bits(total, 36)
+    out += bytes([0x80, 0, 0, 34]) + si.out + md5
+
+    for fn, plan in enumerate(frames_plan):
+        chs = [[pcm[(fn * blocksize + i) * channels + ch] for i in range(blocksize)] for ch in range(channels)]
+        mode = plan.get('stereo', 1) if channels == 2 else 0
+        depth = [bps] * channels
+        if mode == 8:
+            chs = [chs[0], [l - r for l, r in zip(chs[0], chs[1])]]; depth = [bps, bps + 1]
+        elif mode == 9:
+            chs = [[l - r for l, r in zip(chs[0], chs[1])], chs[1]]; depth = [bps + 1, bps]
+        elif mode == 10:
+            chs = [[(l + r) >> 1 for l, r in zip(chs[0], chs[1])], [l - r for l, r in zip(chs[0], chs[1])]]
+            depth = [bps, bps + 1]
+        hdr = BitWriter()
+        hdr.bits(0x3FFE, 14); hdr.bits(0, 1); hdr.bits(0, 1)
+        hdr.bits(3, 4)                  # 1152 samples
+        hdr.bits(0, 4)                  # sample rate from STREAMINFO
+        hdr.bits(mode, 4)
+        hdr.bits(4, 3)                  # 16 bit
+        hdr.bits(0, 1)
+        for b in utf8_number(fn):
+            hdr.bits(b, 8)
+        hdr.bits(crc8(hdr.out), 8)
+        bw = BitWriter()
+        bw.out = bytearray(hdr.out)
+        for ch in range(len(chs)):
+            write_subframe(bw, chs[ch], depth[ch], plan.get('kind', 'lpc'), plan.get('order', 8), plan.get('precision', 12),
+                           plan.get('wasted', 0) if ch == 0 else 0, plan.get('escape', False), plan.get('saturate', False))
+        bw.align()
+        bw.bits(crc16(bw.out), 16)
+        out += bw.out
+    with open(path, 'wb') as f:
+        f.write(out)
+
+
+def main():
+    outdir = sys.argv[1] if len(sys.argv) > 1 else '.'
+    rnd = random.Random(4711)
+    noise = [rnd.gauss(0, 1) for _ in range(1 << 16)]
+
+    def music(ch, i):
+        t = i / 16000.0
+        v = 9000 * math.sin(2 * math.pi * 220 * t + ch) + 6000 * math.sin(2 * math.pi * 1375 * t * (1 + ch * 0.01)) \
+            + 2500 * math.sin(2 * math.pi * 4100 * t) + 400 * noise[(i * 2 + ch) & 0xFFFF]
+        return max(-32768, min(32767, int(v)))
+
+    def loud(ch, i):  # close to full scale, the side channel needs all 17 bits
+        v = 32000 * math.sin(2 * math.pi * 97 * i / 16000.0 + ch * 3.0) + 300 * noise[(i * 3 + ch) & 0xFFFF]
+        return max(-32768, min(32767, int(v)))
+
+    plan = []
+    for order in list(range(1, 13)) + [16, 20, 24, 32]:
+        plan.append({'order': order, 'precision': 12, 'stereo': [1, 8, 9, 10][order % 4]})
+    for order in (8, 12, 32):
+        plan.append({'order': order, 'precision': 15, 'stereo': 10})      # 17 + 15 + 5 bits, 64 bit accumulator
+    for order in range(0, 5):
+        plan.append({'kind': 'fixed', 'order': order, 'stereo': [8, 9, 10, 1, 8][order]})
+    plan.append({'kind': 'verbatim', 'stereo': 1})
+    plan.append({'order': 6, 'stereo': 1, 'escape': True})
+    plan.append({'order': 4, 'stereo': 1, 'wasted': 2})
+    encode(outdir + '/lpc_orders_stereo.flac', 2, 16000, plan, lambda ch, i: music(ch, i) & ~3 if i // 1152 == len(plan) - 1 else music(ch, i))
+
+    plan = [{'order': o, 'precision': 15, 'stereo': 10} for o in (2, 7, 12, 13, 31, 32)]
+    plan += [{'order': o, 'precision': 15, 'stereo': s, 'saturate': True} for o, s in ((4, 1), (8, 10), (12, 8))]
+    encode(outdir + '/lpc_wide_stereo.flac', 2, 16000, plan, loud)
+
+    plan = [{'order': o, 'precision': 13} for o in (1, 5, 9, 12, 17)] + [{'kind': 'constant'}, {'kind': 'fixed', 'order': 2}]
+    encode(outdir + '/lpc_mono.flac', 1, 16000, plan, lambda ch, i: 0 if i // 1152 == 5 else music(0, i))
+
+
+if __name__ == '__main__':
+    main()
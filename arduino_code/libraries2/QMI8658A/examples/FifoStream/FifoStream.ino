@@ -0,0 +1,41 @@
+#include "QMI8658A.h"
+
+QMI8658A imu;
+
+// 传感器中断引脚接到的 GPIO
+#define IMU_INT_PIN 4
+
+void setup() {
+    Serial.begin(115200);
+    delay(2000);
+
+    Serial.println("QMI8658A FIFO Stream");
+    Serial.println("====================");
+
+    imu.begin(0x6B, 400000);
+    imu.setAccScale(acc_scale_4g);
+    imu.setGyroScale(gyro_scale_512dps);
+    imu.setAccODR(acc_odr_norm_250);
+    imu.setGyroODR(gyro_odr_norm_250);   // 实际约 224Hz
+
+    // FIFO 接 INT1，每 8 个采样一次中断，由核心 0 上的任务读取
+    if (!imu.beginFifo(IMU_INT_PIN, 1, 8, 0)) {
+        Serial.println("FIFO start failed");
+    }
+}
+
+void loop() {
+    // 不会阻塞在 I2C 上，只从环形缓冲区取数据
+    qmi8658_sample_t s;
+    while (imu.readSample(&s)) {
+        Serial.printf("%lu, %d, %d, %d, %d, %d, %d\n", (unsigned long)s.timestamp_us,
+                      s.acc[0], s.acc[1], s.acc[2], s.gyro[0], s.gyro[1], s.gyro[2]);
+    }
+
+    static uint32_t lastReport = 0;
+    if (millis() - lastReport > 5000) {
+        lastReport = millis();
+        Serial.printf("dropped: %lu\n", (unsigned long)imu.getDroppedSamples());
+    }
+    delay(20);
+}
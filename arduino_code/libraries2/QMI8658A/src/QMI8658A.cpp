@@ -14,6 +14,30 @@ QMI8658A::QMI8658A()
     this->acc_odr = acc_odr_norm_8000;
     this->gyro_odr = gyro_odr_norm_8000;
     this->sensor_state = sensor_default;
+    this->bus_transfer = nullptr;
+    this->bus_arg = nullptr;
+    this->fifo_pin = -1;
+    this->fifo_ctrl = 0;
+    this->fifo_watermark = 0;
+    this->fifo_stop = false;
+    this->fifo_irq_us = 0;
+    this->fifo_task = nullptr;
+    this->fifo_head = 0;
+    this->fifo_tail = 0;
+    this->fifo_dropped = 0;
+    this->fifo_latest_seq = 0;
+}
+
+/**
+ * Route all bus access through a user function instead of Wire.
+ * Call before begin(), begin() then leaves Wire alone.
+ * @param transfer bus function, nullptr to go back to Wire
+ * @param arg passed to every call of transfer
+ */
+void QMI8658A::setTransfer(qmi8658_transfer_t transfer, void* arg)
+{
+    this->bus_transfer = transfer;
+    this->bus_arg = arg;
 }
 
 /**
@@ -22,7 +46,8 @@ QMI8658A::QMI8658A()
  */
 void QMI8658A::begin(byte addr)
 {
-    Wire.begin();
+    if (this->bus_transfer == nullptr)
+        Wire.begin();
     this->device_addr = addr;
     setState(sensor_running);
     setAccScale(this->acc_scale);
@@ -41,7 +66,29 @@ void QMI8658A::begin(byte addr)
 void QMI8658A::begin(byte addr, uint32_t speed)
 {
     begin(addr);
-    Wire.setClock(speed);
+    if (this->bus_transfer == nullptr)
+        Wire.setClock(speed);
+}
+
+/**
+ * Write tx_len bytes to QMI8658A, then read rx_len bytes after a repeated start.
+ * Goes through the transfer function if one was set, Wire otherwise.
+ * @return false if the device did not answer with all bytes
+ */
+bool QMI8658A::QMI8658A_transfer(const uint8_t* tx, uint8_t tx_len, uint8_t* rx, uint8_t rx_len)
+{
+    if (this->bus_transfer != nullptr)
+        return this->bus_transfer(this->device_addr, tx, tx_len, rx, rx_len, this->bus_arg);
+
+    Wire.beginTransmission(this->device_addr);
+    Wire.write(tx, tx_len);
+    if (rx_len == 0)
+        return Wire.endTransmission() == 0;
+    Wire.endTransmission(false);
+    if (Wire.requestFrom(this->device_addr, rx_len) != rx_len)
+        return false;
+    Wire.readBytes(rx, rx_len);
+    return true;
 }
 
 /**
@@ -51,10 +98,8 @@ void QMI8658A::begin(byte addr, uint32_t speed)
  */
 void QMI8658A::QMI8658A_transmit(byte addr, byte data)
 {
-    Wire.beginTransmission(this->device_addr);
-    Wire.write(addr);
-    Wire.write(data);
-    Wire.endTransmission();
+    uint8_t tx[2] = {addr, data};
+    QMI8658A_transfer(tx, 2, nullptr, 0);
 }
 
 /**
@@ -64,30 +109,30 @@ void QMI8658A::QMI8658A_transmit(byte addr, byte data)
  */
 byte QMI8658A::QMI8658A_receive(byte addr)
 {
-    Wire.beginTransmission(this->device_addr);
-    unsigned long beforeRequest = millis();
-    Wire.write(addr);
-    Wire.endTransmission(false);
-    Wire.requestFrom(this->device_addr, (uint8_t)1);
-    while (Wire.available() == 0)
-    {
-        if (millis() - beforeRequest > QMI8658_COMM_TIMEOUT)
-            return 0; // may need work, cleanest way I could think of
-                      // to deal with this situation
-    }
-    byte retval = Wire.read();
-    Wire.endTransmission();
+    byte retval = 0;
+    if (!QMI8658A_transfer(&addr, 1, &retval, 1))
+        return 0; // may need work, cleanest way I could think of
+                  // to deal with this situation
     return retval;
 }
 
 /**
- * Writes data to CTRL9 (command register) and waits for ACK.
+ * Writes data to CTRL9 (command register), waits for CmdDone and acknowledges it.
  * @param command the command to be executed
+ * @return false if the sensor did not finish the command within QMI8658_COMM_TIMEOUT
  */
-void QMI8658A::QMI8658A_CTRL9_Write(byte command)
+bool QMI8658A::QMI8658A_CTRL9_Write(byte command)
 {
     QMI8658A_transmit(QMI8658_CTRL9, command);
-    while ((QMI8658A_receive(QMI8658_STATUSINT) & 0x80) == 0x00);  // 添加括号
+    unsigned long beforeRequest = millis();
+    while ((QMI8658A_receive(QMI8658_STATUSINT) & 0x80) == 0x00)  // 添加括号
+    {
+        if (millis() - beforeRequest > QMI8658_COMM_TIMEOUT)
+            return false;
+    }
+    // the sensor clears CmdDone after the acknowledge
+    QMI8658A_transmit(QMI8658_CTRL9, QMI8658_CTRL_CMD_ACK);
+    return true;
 }
 
 /**
@@ -115,31 +160,27 @@ void QMI8658A::QMI8658_sensor_update()
     this->reading_timestamp_us = micros();
 
     // load actual data
-    Wire.beginTransmission(this->device_addr);
-    unsigned long beforeRequest = millis();
-    Wire.write(QMI8658_AX_L);
-    Wire.endTransmission(false);
-    Wire.requestFrom(this->device_addr, (uint8_t)12, (uint8_t)true);
-    for (int i = 0; i < 12; i++) {
-        while(Wire.available() == 0)
-        {
-            if (millis() - beforeRequest > QMI8658_COMM_TIMEOUT)
-                return;
-        }
-        if (i % 2 == 0)
-        {
-            readings[i >> 1] = (int16_t)Wire.read();
-        }
-        else
-        {
-            readings[i >> 1] |= (int16_t)Wire.read() << 8;
-        }
-    }
+    uint8_t reg = QMI8658_AX_L;
+    uint8_t raw[12];
+    if (!QMI8658A_transfer(&reg, 1, raw, 12))
+        return;
+    for (int i = 0; i < 6; i++)
+        readings[i] = (int16_t)(raw[i * 2] | (raw[i * 2 + 1] << 8));
 }
 
 inline void QMI8658A::QMI8658_update_if_needed()
 {
-    if (sensor_state == sensor_locking
+    if (sensor_state == sensor_fifo)
+    {   // copy of the newest sample, no I2C here and the ring is left to readSample()
+        qmi8658_sample_t sample;
+        if (QMI8658_fifo_latest(&sample))
+        {
+            memcpy((void*)readings, (void*)sample.acc, sizeof(sample.acc));
+            memcpy((void*)(readings + 3), (void*)sample.gyro, sizeof(sample.gyro));
+            this->reading_timestamp_us = sample.timestamp_us;
+        }
+    }
+    else if (sensor_state == sensor_locking
         && micros() - reading_timestamp_us > QMI8658_REFRESH_DELAY)
     {
         QMI8658_sensor_update();
@@ -250,6 +291,9 @@ void QMI8658A::setGyroLPF(lpf_t lpf)
 void QMI8658A::setState(sensor_state_t state)
 {
     byte ctrl1;
+    // leaving FIFO mode stops the FIFO task, entering it needs beginFifo()
+    if (this->sensor_state == sensor_fifo)
+        endFifo();
     switch (state)
     {
     case sensor_running:
@@ -314,10 +358,302 @@ void QMI8658A::setState(sensor_state_t state)
  */
 void QMI8658A::getRawReadings(int16_t* buf)
 {
-    QMI8658A::QMI8658_sensor_update();
+    if (sensor_state == sensor_fifo)
+        QMI8658_update_if_needed();
+    else
+        QMI8658A::QMI8658_sensor_update();
     memcpy((void*) buf, (void*)readings, sizeof(readings));
 }
 
+/**
+ * Start FIFO mode: the sensor buffers samples in its 64 sample FIFO and raises
+ * an interrupt at the watermark, a task burst-reads the FIFO and publishes
+ * timestamped samples into a lock-free ring. Read them with readSample(), the
+ * getters return a copy of the newest sample and leave the ring alone, they can
+ * be called from any task. Neither touches the I2C bus.
+ * Use an ODR of 1000Hz or less, the task wakes up every watermark samples.
+ * @param int_pin GPIO connected to the sensor interrupt pin
+ * @param int_line sensor interrupt pin used for the FIFO, 1 (INT1) or 2 (INT2)
+ * @param watermark samples per interrupt, 1 to 63
+ * @param core core the FIFO task runs on
+ * @return true if the FIFO and the task are running
+ */
+bool QMI8658A::beginFifo(int int_pin, byte int_line, byte watermark, int core)
+{
+    if (this->sensor_state == sensor_fifo)
+        endFifo();
+    if (this->sensor_state != sensor_running)
+        setState(sensor_running);
+
+    if (watermark < 1)
+        watermark = 1;
+    if (watermark > 63)
+        watermark = 63;
+    this->fifo_watermark = watermark;
+
+    // stream mode keeps the newest 64 samples if the task falls behind
+    this->fifo_ctrl = QMI8658_FIFO_SIZE_64 | QMI8658_FIFO_MODE_STREAM;
+    QMI8658A_transmit(QMI8658_FIFO_WTM_TH, watermark);
+    QMI8658A_transmit(QMI8658_FIFO_CTRL, this->fifo_ctrl);
+    if (!QMI8658A_CTRL9_Write(QMI8658_CTRL_CMD_RST_FIFO))
+        return false;
+
+    byte ctrl1 = QMI8658A_receive(QMI8658_CTRL1);
+    if (int_line == 1)
+        ctrl1 |= 0x0C; // INT1 output enable, FIFO interrupt on INT1
+    else
+        ctrl1 = (ctrl1 & ~0x04) | 0x10; // INT2 output enable, FIFO interrupt on INT2
+    QMI8658A_transmit(QMI8658_CTRL1, ctrl1);
+
+    // no data ready pulses on INT2
+    QMI8658A_transmit(QMI8658_CTRL7, QMI8658A_receive(QMI8658_CTRL7) | 0x20);
+
+    this->fifo_head = 0;
+    this->fifo_tail = 0;
+    this->fifo_dropped = 0;
+    this->fifo_latest_seq = 0;
+    this->fifo_stop = false;
+    this->fifo_pin = int_pin;
+    this->sensor_state = sensor_fifo;
+
+    if (xTaskCreatePinnedToCore(QMI8658_fifo_task, "qmi8658_fifo", QMI8658_FIFO_TASK_STACK,
+                                this, 5, &this->fifo_task, core) != pdPASS)
+    {
+        this->fifo_task = nullptr;
+        endFifo();
+        return false;
+    }
+
+    pinMode(int_pin, INPUT);
+    attachInterruptArg(digitalPinToInterrupt(int_pin), QMI8658_fifo_isr, this, RISING);
+    return true;
+}
+
+/**
+ * Stop FIFO mode and go back to running mode.
+ * Samples still in the ring can be read afterwards.
+ */
+void QMI8658A::endFifo()
+{
+    if (this->sensor_state != sensor_fifo)
+        return;
+
+    if (this->fifo_task != nullptr)
+    {
+        detachInterrupt(digitalPinToInterrupt(this->fifo_pin));
+        // the task clears fifo_stop when it is done with the bus
+        this->fifo_stop = true;
+        xTaskNotifyGive(this->fifo_task);
+        while (this->fifo_stop)
+            delay(1);
+        this->fifo_task = nullptr;
+    }
+
+    // FIFO bypass, interrupt outputs off, data ready back on
+    QMI8658A_transmit(QMI8658_FIFO_CTRL, 0x00);
+    QMI8658A_transmit(QMI8658_CTRL1, QMI8658A_receive(QMI8658_CTRL1) & ~0x1C);
+    QMI8658A_transmit(QMI8658_CTRL7, QMI8658A_receive(QMI8658_CTRL7) & ~0x20);
+    this->sensor_state = sensor_running;
+}
+
+/**
+ * Number of FIFO samples waiting in the ring.
+ * @return samples readSample() can return without waiting
+ */
+uint16_t QMI8658A::sampleAvailable()
+{
+    return fifo_head.load(std::memory_order_acquire) - fifo_tail.load(std::memory_order_relaxed);
+}
+
+/**
+ * Pop the oldest FIFO sample from the ring, never blocks.
+ * Call from one task only.
+ * @param sample destination of the sample
+ * @return false if the ring is empty
+ */
+bool QMI8658A::readSample(qmi8658_sample_t* sample)
+{
+    uint16_t tail = fifo_tail.load(std::memory_order_relaxed);
+    if (tail == fifo_head.load(std::memory_order_acquire))
+        return false;
+    *sample = fifo_ring[tail & (QMI8658_FIFO_RING_SIZE - 1)];
+    fifo_tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+/**
+ * Publish the newest sample for the getters (FIFO task only).
+ * Seqlock: the sequence is odd while the copy is written.
+ * @param sample newest sample read from the FIFO
+ */
+void QMI8658A::QMI8658_fifo_publish(const qmi8658_sample_t* sample)
+{
+    uint32_t seq = fifo_latest_seq.load(std::memory_order_relaxed);
+    fifo_latest_seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    fifo_latest = *sample;
+    fifo_latest_seq.store(seq + 2, std::memory_order_release);
+}
+
+/**
+ * Copy the newest sample published by the FIFO task, from any task.
+ * Retries while the FIFO task is writing it, never blocks on it.
+ * @param sample destination of the sample
+ * @return false if no sample has been read since beginFifo()
+ */
+bool QMI8658A::QMI8658_fifo_latest(qmi8658_sample_t* sample)
+{
+    for (;;)
+    {
+        uint32_t seq = fifo_latest_seq.load(std::memory_order_acquire);
+        if (seq == 0)
+            return false;
+        if (seq & 1)
+            continue;
+        *sample = fifo_latest;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (fifo_latest_seq.load(std::memory_order_relaxed) == seq)
+            return true;
+    }
+}
+
+/**
+ * Samples lost since beginFifo(): ring full, plus one for every
+ * FIFO overflow in the sensor (the number lost there is unknown).
+ * @return number of dropped samples
+ */
+uint32_t QMI8658A::getDroppedSamples()
+{
+    return fifo_dropped.load(std::memory_order_relaxed);
+}
+
+/**
+ * Time between two samples at the current ODR.
+ * With the gyro running all rates are derived from 7174.4Hz.
+ * @return sample period in us
+ */
+uint32_t QMI8658A::QMI8658_sample_period_us()
+{
+    static const uint32_t period_us[] = {139, 279, 558, 1115, 2230, 4460, 8921, 17841, 35682};
+    return period_us[gyro_odr];
+}
+
+/**
+ * FIFO watermark interrupt, wakes the FIFO task.
+ */
+void IRAM_ATTR QMI8658A::QMI8658_fifo_isr(void* arg)
+{
+    QMI8658A* imu = (QMI8658A*)arg;
+    BaseType_t woken = pdFALSE;
+    imu->fifo_irq_us = micros();
+    vTaskNotifyGiveFromISR(imu->fifo_task, &woken);
+    if (woken)
+        portYIELD_FROM_ISR();
+}
+
+/**
+ * FIFO task, reads the FIFO on every interrupt. It also polls after twice the
+ * watermark time in case an edge was missed while the FIFO was being read.
+ */
+void QMI8658A::QMI8658_fifo_task(void* arg)
+{
+    QMI8658A* imu = (QMI8658A*)arg;
+    uint32_t timeout_ms = imu->fifo_watermark * imu->QMI8658_sample_period_us() * 2 / 1000;
+    if (timeout_ms < 10)
+        timeout_ms = 10;
+
+    while (!imu->fifo_stop)
+    {
+        bool on_interrupt = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeout_ms)) > 0;
+        if (!imu->fifo_stop)
+            imu->QMI8658_fifo_read(on_interrupt);
+    }
+
+    imu->fifo_stop = false; // tell endFifo() we are gone
+    vTaskDelete(NULL);
+}
+
+/**
+ * Burst-read all samples in the FIFO, QMI8658_FIFO_BURST samples per
+ * I2C transaction, and push them into the ring.
+ * @param on_interrupt true if woken by the watermark interrupt
+ */
+void QMI8658A::QMI8658_fifo_read(bool on_interrupt)
+{
+    uint32_t now_us = micros();
+
+    // fill level and status in one read
+    uint8_t reg = QMI8658_FIFO_SMPL_CNT;
+    uint8_t fill[2];
+    if (!QMI8658A_transfer(&reg, 1, fill, 2))
+        return;
+    byte count_l = fill[0];
+    byte status = fill[1];
+    uint16_t samples = ((((uint16_t)(status & 0x03) << 8) | count_l) * 2) / QMI8658_FIFO_SAMPLE_BYTES;
+
+    if (status & QMI8658_FIFO_STATUS_OVERFLOW)
+        fifo_dropped++;
+    if (samples == 0)
+        return;
+
+    // the watermark was reached at the interrupt, later samples followed one period apart
+    uint32_t period_us = QMI8658_sample_period_us();
+    uint32_t newest_us = now_us;
+    if (on_interrupt && samples >= fifo_watermark)
+    {
+        newest_us = fifo_irq_us + (samples - fifo_watermark) * period_us;
+        if ((int32_t)(newest_us - now_us) > 0)
+            newest_us = now_us;
+    }
+
+    if (!QMI8658A_CTRL9_Write(QMI8658_CTRL_CMD_REQ_FIFO))
+        return;
+
+    uint8_t raw[QMI8658_FIFO_BURST * QMI8658_FIFO_SAMPLE_BYTES];
+    qmi8658_sample_t newest;
+    bool fresh = false;
+    uint16_t done = 0;
+    while (done < samples)
+    {
+        uint16_t n = samples - done;
+        if (n > QMI8658_FIFO_BURST)
+            n = QMI8658_FIFO_BURST;
+        uint8_t len = n * QMI8658_FIFO_SAMPLE_BYTES;
+
+        reg = QMI8658_FIFO_DATA;
+        if (!QMI8658A_transfer(&reg, 1, raw, len))
+            break;
+
+        for (uint16_t i = 0; i < n; i++, done++)
+        {
+            const uint8_t* p = raw + i * QMI8658_FIFO_SAMPLE_BYTES;
+            newest.timestamp_us = newest_us - (uint32_t)(samples - 1 - done) * period_us;
+            for (int axis = 0; axis < 3; axis++)
+            {
+                newest.acc[axis] = (int16_t)(p[axis * 2] | (p[axis * 2 + 1] << 8));
+                newest.gyro[axis] = (int16_t)(p[6 + axis * 2] | (p[6 + axis * 2 + 1] << 8));
+            }
+            fresh = true;
+
+            uint16_t head = fifo_head.load(std::memory_order_relaxed);
+            if ((uint16_t)(head - fifo_tail.load(std::memory_order_acquire)) >= QMI8658_FIFO_RING_SIZE)
+            {
+                fifo_dropped++; // the reader is too slow, keep the older samples
+                continue;
+            }
+            fifo_ring[head & (QMI8658_FIFO_RING_SIZE - 1)] = newest;
+            fifo_head.store(head + 1, std::memory_order_release);
+        }
+    }
+
+    // the getters see the newest sample even if the ring was full
+    if (fresh)
+        QMI8658_fifo_publish(&newest);
+
+    // leave FIFO read mode
+    QMI8658A_transmit(QMI8658_FIFO_CTRL, this->fifo_ctrl);
+}
+
 /**
  * Get X-axis acceleration in floating point g units.
  * If in locking mode, this will retrieve new data
@@ -330,7 +666,7 @@ float QMI8658A::getAccX()
 {
     float xval;
     QMI8658_update_if_needed();
-    if (sensor_state == sensor_locking) {  // 修复：== 而不是 =
+    if (sensor_state == sensor_locking || sensor_state == sensor_fifo) {  // 修复：== 而不是 =
         xval = (float)readings[0];
     }
     else {
@@ -356,7 +692,7 @@ float QMI8658A::getAccY()
     float yval;
     // update sensor values if necessary
     QMI8658_update_if_needed();
-    if (sensor_state = sensor_locking) {
+    if (sensor_state == sensor_locking || sensor_state == sensor_fifo) {
         yval = (float)readings[1];
     }
     else {
@@ -382,7 +718,7 @@ float QMI8658A::getAccZ()
     float zval;
     // update sensor values if necessary
     QMI8658_update_if_needed();
-    if (sensor_state = sensor_locking) {
+    if (sensor_state == sensor_locking || sensor_state == sensor_fifo) {
         zval = (float)readings[2];
     }
     else {
@@ -408,7 +744,7 @@ float QMI8658A::getGyroX()
     float xval;
     // update sensor values if necessary
     QMI8658_update_if_needed();
-    if (sensor_state = sensor_locking) {
+    if (sensor_state == sensor_locking || sensor_state == sensor_fifo) {
         xval = (float)readings[3];
     }
     else {
@@ -434,7 +770,7 @@ float QMI8658A::getGyroY()
     float yval;
     // update sensor values if necessary
     QMI8658_update_if_needed();
-    if (sensor_state = sensor_locking) {
+    if (sensor_state == sensor_locking || sensor_state == sensor_fifo) {
         yval = (float)readings[4];
     }
     else {
@@ -460,7 +796,7 @@ float QMI8658A::getGyroZ()
     float zval;
     // update sensor values if necessary
     QMI8658_update_if_needed();
-    if (sensor_state = sensor_locking) {
+    if (sensor_state == sensor_locking || sensor_state == sensor_fifo) {
         zval = (float)readings[5];
     }
     else {
@@ -475,4 +811,5 @@ float QMI8658A::getGyroZ()
 
 QMI8658A::~QMI8658A()
 {
+    endFifo();
 }
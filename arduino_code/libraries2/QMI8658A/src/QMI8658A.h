@@ -3,6 +3,7 @@
 #define QMI8658A_h
 
 #include "Arduino.h"
+#include <atomic>
 
 #define QMI8658_WHO_AM_I 0x00 // devide identifier
 #define QMI8658_REVISION_ID 0x01
@@ -28,6 +29,12 @@
 #define QMI8658_CAL4_L  0x11  // calibration 4 register, lower bits
 #define QMI8658_CAL4_H  0x12  // calibration 4 register, higher bits
 
+#define QMI8658_FIFO_WTM_TH   0x13 // FIFO watermark, in samples
+#define QMI8658_FIFO_CTRL     0x14 // FIFO mode and size
+#define QMI8658_FIFO_SMPL_CNT 0x15 // FIFO fill level LSB, in 2 byte units
+#define QMI8658_FIFO_STATUS   0x16 // FIFO flags + fill level MSB
+#define QMI8658_FIFO_DATA     0x17 // FIFO read port
+
 #define QMI8658_TEMP_L 0x33 // lower bits of temperature data
 #define QMI8658_TEMP_H 0x34 // upper bits of temperature data
 
@@ -69,6 +76,23 @@
 // control clock gating (necessary to use data locking)
 #define QMI8658_CTRL_CMD_AHB_CLOCK_GATING 0x12
 
+// CTRL9 commands and acknowledge
+#define QMI8658_CTRL_CMD_ACK      0x00
+#define QMI8658_CTRL_CMD_RST_FIFO 0x04
+#define QMI8658_CTRL_CMD_REQ_FIFO 0x05
+
+#define QMI8658_FIFO_MODE_STREAM 0x02 // FIFO_CTRL, overwrite the oldest sample when full
+#define QMI8658_FIFO_SIZE_64     0x08 // FIFO_CTRL, 64 samples
+#define QMI8658_FIFO_STATUS_OVERFLOW 0x20
+
+// one FIFO sample with acc and gyro enabled: AX..AZ, GX..GZ
+#define QMI8658_FIFO_SAMPLE_BYTES 12
+// samples per I2C read, the ESP32 Wire buffer holds 128 bytes
+#define QMI8658_FIFO_BURST 10
+// samples buffered for the sketch, power of 2
+#define QMI8658_FIFO_RING_SIZE 64
+#define QMI8658_FIFO_TASK_STACK 3072
+
 
 typedef enum {
     acc_odr_norm_8000 = 0x0,
@@ -127,9 +151,22 @@ typedef enum {
     sensor_default,
     sensor_power_down,
     sensor_running,
-    sensor_locking
+    sensor_locking,
+    sensor_fifo
 } sensor_state_t;
 
+// bus access used instead of Wire, e.g. to share the bus through a transaction scheduler.
+// write tx_len bytes to the device, then read rx_len bytes after a repeated start
+// (no read if rx_len is 0). return true on success.
+typedef bool (*qmi8658_transfer_t)(byte addr, const uint8_t* tx, uint8_t tx_len, uint8_t* rx, uint8_t rx_len, void* arg);
+
+// timestamped sample from the FIFO, raw 16-bit values
+typedef struct {
+    uint32_t timestamp_us; // arduino micros() time the sample was taken
+    int16_t acc[3];
+    int16_t gyro[3];
+} qmi8658_sample_t;
+
 class QMI8658A
 {
 private:
@@ -143,13 +180,37 @@ private:
     byte device_addr;
     int16_t readings[6];
     uint32_t reading_timestamp_us; // timestamp in arduino micros() time
+    qmi8658_transfer_t bus_transfer;
+    void* bus_arg;
+    bool QMI8658A_transfer(const uint8_t* tx, uint8_t tx_len, uint8_t* rx, uint8_t rx_len);
     void QMI8658A_transmit(byte addr, byte data);
     byte QMI8658A_receive(byte addr);
-    void QMI8658A_CTRL9_Write(byte command);
+    bool QMI8658A_CTRL9_Write(byte command);
     void QMI8658_sensor_update();
     inline void QMI8658_update_if_needed();
+
+    // FIFO mode: the task reads the FIFO on the interrupt, the sketch pops samples from the ring
+    int fifo_pin;
+    byte fifo_ctrl;
+    byte fifo_watermark;
+    volatile bool fifo_stop;
+    volatile uint32_t fifo_irq_us;
+    TaskHandle_t fifo_task;
+    qmi8658_sample_t fifo_ring[QMI8658_FIFO_RING_SIZE];
+    std::atomic<uint16_t> fifo_head; // written by the FIFO task only
+    std::atomic<uint16_t> fifo_tail; // written by the reader only
+    std::atomic<uint32_t> fifo_dropped;
+    qmi8658_sample_t fifo_latest;           // newest sample for the getters, written by the FIFO task
+    std::atomic<uint32_t> fifo_latest_seq;  // seqlock for fifo_latest, odd while written, 0 = none yet
+    void QMI8658_fifo_publish(const qmi8658_sample_t* sample);
+    bool QMI8658_fifo_latest(qmi8658_sample_t* sample);
+    static void IRAM_ATTR QMI8658_fifo_isr(void* arg);
+    static void QMI8658_fifo_task(void* arg);
+    void QMI8658_fifo_read(bool on_interrupt);
+    uint32_t QMI8658_sample_period_us();
 public:
     QMI8658A();
+    void setTransfer(qmi8658_transfer_t transfer, void* arg = nullptr);
     void begin(byte addr);
     void begin(byte addr, uint32_t speed);
     void setAccODR(acc_odr_t odr);
@@ -160,6 +221,11 @@ public:
     void setGyroLPF(lpf_t lpf);
     void setState(sensor_state_t state);
     void getRawReadings(int16_t* buf);
+    bool beginFifo(int int_pin, byte int_line = 1, byte watermark = 8, int core = 0);
+    void endFifo();
+    uint16_t sampleAvailable();
+    bool readSample(qmi8658_sample_t* sample);
+    uint32_t getDroppedSamples();
     float getAccX();
     float getAccY();
     float getAccZ();
@@ -1245,6 +1245,75 @@ void  TFT_eSprite::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const u
 }
 
 
+/***************************************************************************************
+** Function name:           drawBitmapBits
+** Description:             Draw a scaled 1bpp bitmap directly into the Sprite memory
+***************************************************************************************/
+void TFT_eSprite::drawBitmapBits(int32_t x, int32_t y, const uint8_t *bitmap, int32_t w, int32_t h, uint8_t scale,
+                                 uint16_t fgcolor, uint16_t bgcolor, bool transparent)
+{
+  if (!_created || _vpOoB || bitmap == nullptr || scale < 1) return;
+
+  uint16_t bsw = (w + 7) >> 3; // Width in bytes of bitmap line
+
+  if (_bpp != 16)
+  {
+    // Other colour depths draw each bit as a filled block
+    for (int32_t yb = 0; yb < h; yb++)
+    {
+      for (int32_t xb = 0; xb < w; xb++)
+      {
+        bool set = bitmap[yb * bsw + (xb >> 3)] & (0x80 >> (xb & 7));
+        if (set) fillRect(x + xb * scale, y + yb * scale, scale, scale, fgcolor);
+        else if (!transparent) fillRect(x + xb * scale, y + yb * scale, scale, scale, bgcolor);
+      }
+    }
+    return;
+  }
+
+  x+= _xDatum;
+  y+= _yDatum;
+
+  // Clip the scaled bitmap to the viewport, in Sprite pixels
+  int32_t xs = x, xe = x + w * scale;
+  int32_t ys = y, ye = y + h * scale;
+  if (xs < _vpX) xs = _vpX;
+  if (ys < _vpY) ys = _vpY;
+  if (xe > _vpW) xe = _vpW;
+  if (ye > _vpH) ye = _vpH;
+  if (xs >= xe || ys >= ye) return;
+
+  // Sprite stores colours byte swapped
+  uint16_t fg = (fgcolor >> 8) | (fgcolor << 8);
+  uint16_t bg = (bgcolor >> 8) | (bgcolor << 8);
+
+  // First bitmap column and the sub-pixel within it after clipping
+  int32_t xb0  = (xs - x) / scale;
+  int32_t sub0 = (xs - x) - xb0 * scale;
+
+  for (int32_t yp = ys; yp < ye; yp++)
+  {
+    const uint8_t *src = bitmap + ((yp - y) / scale) * bsw + (xb0 >> 3);
+    uint8_t  mask = 0x80 >> (xb0 & 7);
+    int32_t  sub  = sub0;
+    uint16_t *dst = _img + yp * _iwidth + xs;
+    uint16_t *end = _img + yp * _iwidth + xe;
+    while (dst < end)
+    {
+      if (*src & mask) *dst = fg;
+      else if (!transparent) *dst = bg;
+      dst++;
+      if (++sub == scale)
+      {
+        sub = 0;
+        mask >>= 1;
+        if (!mask) { mask = 0x80; src++; }
+      }
+    }
+  }
+}
+
+
 /***************************************************************************************
 ** Function name:           setWindow
 ** Description:             Set the bounds of a window in the sprite
@@ -118,6 +118,12 @@ class TFT_eSprite : public TFT_eSPI {
   void     pushImage(int32_t x0, int32_t y0, int32_t w, int32_t h, uint16_t *data, uint8_t sbpp = 0);
   void     pushImage(int32_t x0, int32_t y0, int32_t w, int32_t h, const uint16_t *data);
 
+           // Draw a 1 bit per pixel bitmap (MSB first, each row padded to a whole byte) straight
+           // into the Sprite memory, each bit as a scale x scale block. Clear bits are drawn in
+           // bgcolor unless transparent is true. Used for cached font glyphs.
+  void     drawBitmapBits(int32_t x, int32_t y, const uint8_t *bitmap, int32_t w, int32_t h, uint8_t scale,
+                          uint16_t fgcolor, uint16_t bgcolor, bool transparent);
+
            // Push the sprite to the TFT screen, this fn calls pushImage() in the TFT class.
            // Optionally a "transparent" colour can be defined, pixels of that colour will not be rendered
   void     pushSprite(int32_t x, int32_t y);
@@ -150,8 +156,6 @@ class TFT_eSprite : public TFT_eSPI {
 
  private:
 
-  TFT_eSPI *_tft;
-
            // Reserve memory for the Sprite and return a pointer
   void*    callocSprite(int16_t width, int16_t height, uint8_t frames = 1);
 
@@ -161,6 +165,8 @@ class TFT_eSprite : public TFT_eSPI {
 
  protected:
 
+  TFT_eSPI *_tft;
+
   uint8_t  _bpp;     // bits per pixel (1, 4, 8 or 16)
   uint16_t *_img;    // pointer to 16-bit sprite
   uint8_t  *_img8;   // pointer to  1 and 8-bit sprite frame 1 or frame 2
@@ -0,0 +1,224 @@
+/**************************************************************************************
+// The following class renders an area of the screen as a sequence of horizontal bands
+// using two small band buffers, see Strip.h for the drawing loop.
+// Based on the TFT_eSprite class by Bodmer, see license file in root folder
+***************************************************************************************/
+#if defined (ESP32)
+  #include <esp_heap_caps.h>
+#endif
+
+// Bands are sent with DMA on processors that support it, otherwise with pushImage()
+#if defined (ESP32_DMA) || defined (RP2040_DMA) || defined (STM32_DMA)
+  #define STRIP_DMA
+#endif
+
+/***************************************************************************************
+** Function name:           TFT_eStrip
+** Description:             Class constructor
+***************************************************************************************/
+TFT_eStrip::TFT_eStrip(TFT_eSPI *tft) : TFT_eSprite(tft)
+{
+  _capacity = 0;
+  _areaX = _areaY = _areaW = _areaH = 0;
+  _bandY = _bandH = 0;
+  _band  = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           ~TFT_eStrip
+** Description:             Class destructor
+***************************************************************************************/
+TFT_eStrip::~TFT_eStrip(void)
+{
+  deleteStrip();
+}
+
+
+/***************************************************************************************
+** Function name:           createStrip
+** Description:             Reserve the two band buffers
+***************************************************************************************/
+bool TFT_eStrip::createStrip(int16_t w, int16_t lines)
+{
+  if ( _created ) return true;
+
+  if ( w < 1 || lines < 1 ) return false;
+
+  _capacity = (int32_t)w * lines;
+
+  // One block for both bands, each with the extra "off screen" pixel a Sprite expects,
+  // so deleteSprite() in the base class frees it correctly
+  size_t bytes = (_capacity + 1) * 2 * sizeof(uint16_t);
+#if defined (ESP32)
+  _img8 = (uint8_t*) heap_caps_malloc(bytes, MALLOC_CAP_DMA);
+#else
+  _img8 = (uint8_t*) malloc(bytes);
+#endif
+  if (_img8 == nullptr) return false;
+
+  _bpp    = 16;
+  _img8_1 = _img8;
+  _img8_2 = _img8 + (_capacity + 1) * sizeof(uint16_t);
+  _img    = (uint16_t*) _img8;
+  _img4   = _img8;
+
+  _iwidth  = _dwidth  = _bitwidth = w;
+  _iheight = _dheight = lines;
+
+  cursor_x = 0;
+  cursor_y = 0;
+
+  _sx = 0;
+  _sy = 0;
+  _sw = w;
+  _sh = lines;
+  _scolor = TFT_BLACK;
+
+  _created = true;
+  rotation = 0;
+  setViewport(0, 0, _dwidth, _dheight);
+  setPivot(_iwidth/2, _iheight/2);
+
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           deleteStrip
+** Description:             Free the band buffers
+***************************************************************************************/
+void TFT_eStrip::deleteStrip(void)
+{
+  if (!_created) return;
+
+#ifdef STRIP_DMA
+  // A band may still be in flight
+  if (_tft->DMA_Enabled) _tft->dmaWait();
+#endif
+
+  deleteSprite();
+  _capacity = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           startStrip
+** Description:             Start rendering an area, select the first band
+***************************************************************************************/
+bool TFT_eStrip::startStrip(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  if (!_created) return false;
+
+  // Clip the area to the screen
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if ((x + w) > _tft->width())  w = _tft->width()  - x;
+  if ((y + h) > _tft->height()) h = _tft->height() - y;
+
+  // A band must hold at least one line of the area
+  if (w < 1 || h < 1 || w > _capacity) return false;
+
+  _areaX = x;
+  _areaY = y;
+  _areaW = w;
+  _areaH = h;
+  _bandY = y;
+  _band  = 0;
+
+  _tft->startWrite();
+  selectBand();
+
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           nextBand
+** Description:             Send the current band and select the next one
+***************************************************************************************/
+bool TFT_eStrip::nextBand(void)
+{
+  if (!_created || _areaH < 1) return false;
+
+  sendBand();
+
+  _bandY += _bandH;
+  if (_bandY >= _areaY + _areaH)
+  {
+#ifdef STRIP_DMA
+    // Last band: wait for it before releasing the bus
+    if (_tft->DMA_Enabled) _tft->dmaWait();
+#endif
+    _tft->endWrite();
+    _areaH = 0;
+    resetViewport();
+    return false;
+  }
+
+  _band++;
+  selectBand();
+
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           getBand
+** Description:             Screen area of the selected band
+***************************************************************************************/
+void TFT_eStrip::getBand(int32_t *x, int32_t *y, int32_t *w, int32_t *h)
+{
+  *x = _areaX;
+  *y = _bandY;
+  *w = _areaW;
+  *h = _bandH;
+}
+
+
+/***************************************************************************************
+** Function name:           selectBand
+** Description:             Point the Sprite at a free buffer sized for the next band
+***************************************************************************************/
+void TFT_eStrip::selectBand(void)
+{
+  // The buffer used two bands ago has been sent: pushImageDMA() waited for it before
+  // queueing the band after it
+  frameBuffer((_band & 1) ? 2 : 1);
+
+  _bandH = _capacity / _areaW;
+  if (_bandH > _areaY + _areaH - _bandY) _bandH = _areaY + _areaH - _bandY;
+
+  // Band is stored packed, _areaW pixels per line, so it can be sent as one DMA block
+  _iwidth  = _dwidth  = _bitwidth = _areaW;
+  _iheight = _dheight = _bandH;
+
+  // Datum at the screen origin, clipped to the band: drawing uses screen coordinates
+  setViewport(-_areaX, -_bandY, _areaX + _areaW, _bandY + _bandH, true);
+}
+
+
+/***************************************************************************************
+** Function name:           sendBand
+** Description:             Send the selected band to the TFT
+***************************************************************************************/
+void TFT_eStrip::sendBand(void)
+{
+  // Sprite pixels are already byte swapped
+  bool oldSwapBytes = _tft->getSwapBytes();
+  _tft->setSwapBytes(false);
+
+#ifdef STRIP_DMA
+  if (_tft->DMA_Enabled)
+  {
+    // Waits for the previous band, then returns while this one is sent
+    _tft->pushImageDMA(_areaX, _bandY, _areaW, _bandH, _img);
+  }
+  else
+#endif
+  {
+    _tft->pushImage(_areaX, _bandY, _areaW, _bandH, _img);
+  }
+
+  _tft->setSwapBytes(oldSwapBytes);
+}
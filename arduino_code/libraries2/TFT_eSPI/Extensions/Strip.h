@@ -0,0 +1,49 @@
+/***************************************************************************************
+// The following class renders an area of the screen as a sequence of horizontal bands
+// using two small band buffers instead of a full screen Sprite. While one band is sent
+// to the TFT with DMA the sketch draws the next band into the other buffer, so drawing
+// overlaps the SPI transfer. The drawing code is replayed once per band, in screen
+// coordinates; the band is selected as the draw target and everything is clipped to it.
+//
+//   if (strip.startStrip(x, y, w, h)) do {
+//     strip.fillSprite(TFT_BLACK);
+//     ... draw the scene ...
+//   } while (strip.nextBand());
+***************************************************************************************/
+
+class TFT_eStrip : public TFT_eSprite {
+
+ public:
+
+  explicit TFT_eStrip(TFT_eSPI *tft);
+  ~TFT_eStrip(void);
+
+           // Reserve two 16-bit band buffers of width x lines pixels each, in DMA capable
+           // RAM on ESP32. RAM required is 4 * width * lines bytes. Returns false on failure.
+           // Narrower areas get taller bands from the same buffers.
+  bool     createStrip(int16_t width, int16_t lines);
+
+           // Free the band buffers (also done by the destructor)
+  void     deleteStrip(void);
+
+           // Start rendering the screen area x,y,w,h and select the first band for drawing.
+           // Returns false if the area is empty or off screen, nothing needs drawing then.
+  bool     startStrip(int32_t x, int32_t y, int32_t w, int32_t h);
+
+           // Send the band just drawn and select the next one. Returns false once the last
+           // band has been sent, the area is then complete on the screen.
+  bool     nextBand(void);
+
+           // Screen area covered by the band currently selected for drawing
+  void     getBand(int32_t *x, int32_t *y, int32_t *w, int32_t *h);
+
+ private:
+
+  void     selectBand(void);
+  void     sendBand(void);
+
+  int32_t  _capacity;                 // Pixels in each band buffer
+  int32_t  _areaX, _areaY, _areaW, _areaH;  // Area being rendered
+  int32_t  _bandY, _bandH;            // Band currently selected
+  uint8_t  _band;                     // Band count within the area, selects the buffer
+};
@@ -6147,6 +6147,8 @@ void TFT_eSPI::getSetup(setup_t &tft_settings)
 
 #include "Extensions/Sprite.cpp"
 
+#include "Extensions/Strip.cpp"
+
 #ifdef SMOOTH_FONT
   #include "Extensions/Smooth_font.cpp"
 #endif
@@ -1008,4 +1008,7 @@ fastBlend(A alpha, F fgc, B bgc)
 // Load the Sprite Class
 #include "Extensions/Sprite.h"
 
+// Load the Strip Class (band rendering with two small Sprite buffers)
+#include "Extensions/Strip.h"
+
 #endif // ends #ifndef _TFT_eSPIH_
@@ -0,0 +1,85 @@
+// Example for library:
+// https://github.com/Bodmer/TJpg_Decoder
+
+// This example is for an ESP32, it renders a Jpeg file that is stored in an array within Flash (program) memory
+// see panda.h tab. Like the ESP32_Dual_Core_Flash_Jpg example the decoding is done by processor core 0 and the
+// rendering by core 1, but the library does the work: enablePipeline() starts a decoder task on core 0 and the
+// callback below is then called on core 1 with complete rows of MCU blocks (image width x 16 pixels here).
+
+// A row buffer is only refilled by the decoder after the callback for the next row has returned (pushImageDMA()
+// waits for the previous transfer first), so the callback can start a DMA transfer and return at once. Decoding,
+// SPI transfer and the callback then all run in parallel. The last row may still be in transfer when drawJpg()
+// returns: call tft.dmaWait() before the next drawJpg(), which hands every row buffer back to the decoder.
+
+// Include the array
+#include "panda.h"
+
+// Include the jpeg decoder library
+#include <TJpg_Decoder.h>
+
+// Include the TFT library https://github.com/Bodmer/TFT_eSPI
+#include "SPI.h"
+#include <TFT_eSPI.h>              // Hardware-specific library
+TFT_eSPI tft = TFT_eSPI();         // Invoke custom library
+
+// This next function will be called on the sketch core with each decoded row of the image
+bool tft_output(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t* bitmap)
+{
+  // Stop further decoding as image is running off bottom of screen
+  if ( y >= tft.height() ) return 0;
+
+  // pushImageDMA() clips at screen boundaries, waits for the last DMA transfer to end and starts a new one
+  tft.pushImageDMA(x, y, w, h, bitmap);
+
+  // Return 1 to decode next row
+  return 1;
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println("\n\n Testing TJpg_Decoder library");
+
+  // Initialise the TFT
+  tft.begin();
+  tft.setTextColor(0xFFFF, 0x0000);
+  tft.fillScreen(TFT_BLACK);
+  tft.initDMA(); // To use SPI DMA you must call initDMA() to setup the DMA engine
+
+  // The jpeg image can be scaled by a factor of 1, 2, 4, or 8
+  TJpgDec.setJpgScale(1);
+
+  // The byte order is swapped by the decoder, DMA sends the row buffers unchanged
+  TJpgDec.setSwapBytes(true);
+
+  // The decoder must be given the exact name of the rendering function above
+  TJpgDec.setCallback(tft_output);
+
+  // Decoder task on core 0 with 3 row buffers, falls back to normal decoding if this fails
+  if (!TJpgDec.enablePipeline(3, 0)) Serial.println("Pipeline not started");
+}
+
+void loop()
+{
+  tft.fillScreen(TFT_RED);
+
+  // Time recorded for test purposes
+  uint32_t t = millis();
+
+  // Must use startWrite first so TFT chip select stays low during DMA and SPI channel settings remain configured
+  tft.startWrite();
+
+  // Returns when the last row has been passed to tft_output()
+  TJpgDec.drawJpg(0, 0, panda, sizeof(panda));
+
+  // Wait for the last DMA transfer before the chip select is released and before the next drawJpg()
+  tft.dmaWait();
+  tft.endWrite();
+
+  // How much time did rendering take
+  t = millis() - t;
+  Serial.print(t); Serial.println(" ms");
+
+  // Wait before drawing again
+  delay(2000);
+}
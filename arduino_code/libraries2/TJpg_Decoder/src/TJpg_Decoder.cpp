@@ -9,6 +9,10 @@ https://github.com/Bodmer/TJpg_Decoder
 
 #include "TJpg_Decoder.h"
 
+#ifdef TJPGD_PIPELINE
+  #include "esp_heap_caps.h"
+#endif
+
 // Create a class instance to be used by the sketch (defined as extern in header)
 TJpg_Decoder TJpgDec;
 
@@ -26,7 +30,7 @@ TJpg_Decoder::TJpg_Decoder(){
 ** Description:             Destructor
 ***************************************************************************************/
 TJpg_Decoder::~TJpg_Decoder(){
-  // Bye
+  disablePipeline();
 }
 
 /***************************************************************************************
@@ -71,11 +75,107 @@ void TJpg_Decoder::setCallback(SketchCallback sketchCallback)
   tft_output = sketchCallback;
 }
 
+#if defined (TJPGD_LOAD_SD_LIBRARY) || defined (TJPGD_LOAD_FFS)
+/***************************************************************************************
+** Function name:           beginReadAhead
+** Description:             Allocate the file read-ahead buffer (TJPGD_READ_AHEAD bytes)
+***************************************************************************************/
+void TJpg_Decoder::beginReadAhead()
+{
+  readIndex = 0;
+  readCount = 0;
+#ifdef TJPGD_READ_AHEAD
+  // If there is not enough memory the file is read directly
+  readBuffer = (uint8_t*)malloc(TJPGD_READ_AHEAD);
+#endif
+}
+
+/***************************************************************************************
+** Function name:           endReadAhead
+** Description:             Free the file read-ahead buffer
+***************************************************************************************/
+void TJpg_Decoder::endReadAhead()
+{
+  if (readBuffer) free(readBuffer);
+  readBuffer = nullptr;
+}
+
+/***************************************************************************************
+** Function name:           readFile
+** Description:             Read or skip (buf == nullptr) len bytes of an SD or FS file
+***************************************************************************************/
+template <class T> size_t TJpg_Decoder::readFile(T &file, uint8_t* buf, size_t len)
+{
+  if (!readBuffer) {
+    // Check how many bytes are available
+    uint32_t bytesLeft = file.available();
+    if (bytesLeft < len) len = bytesLeft;
+
+    if (buf) {
+      // Read into buffer, pointer moved as well
+      file.read(buf, len);
+    }
+    else {
+      // Buffer is null, so skip data by moving pointer
+      file.seek(file.position() + len);
+    }
+    return len;
+  }
+
+#ifdef TJPGD_READ_AHEAD
+  size_t count = 0;
+
+  while (count < len) {
+    if (readIndex >= readCount) {
+      uint32_t bytesLeft = file.available();
+      if (bytesLeft == 0) break;
+
+      // Skip a long segment (e.g. an EXIF thumbnail) by moving the pointer, stop on a
+      // 512 byte boundary so the following reads stay aligned
+      if (!buf && len - count >= TJPGD_READ_AHEAD) {
+        uint32_t skip = len - count;
+        if (skip >= bytesLeft) {
+          // The segment runs to (or past) the end of the file, nothing follows to align
+          file.seek(file.position() + bytesLeft);
+          count += bytesLeft;
+          break;
+        }
+        // Too close to a boundary to skip a whole block, the buffered refill below takes over
+        uint32_t tail = (file.position() + skip) % 512;
+        if (skip - tail >= 512) {
+          file.seek(file.position() + skip - tail);
+          count += skip - tail;
+          continue;
+        }
+      }
+
+      // Refill up to a 512 byte boundary of the file, after the first read all reads are aligned
+      int n = file.read(readBuffer, TJPGD_READ_AHEAD - file.position() % 512);
+      if (n <= 0) break;
+      readIndex = 0;
+      readCount = n;
+    }
+
+    size_t n = readCount - readIndex;
+    if (n > len - count) n = len - count;
+
+    if (buf) memcpy(buf + count, readBuffer + readIndex, n);
+    readIndex += n;
+    count += n;
+  }
+
+  return count;
+#else
+  return 0;
+#endif
+}
+#endif
+
 /***************************************************************************************
 ** Function name:           jd_input (declared static)
 ** Description:             Called by tjpgd.c to get more data
 ***************************************************************************************/
-unsigned int TJpg_Decoder::jd_input(JDEC* jdec, uint8_t* buf, unsigned int len)
+size_t TJpg_Decoder::jd_input(JDEC* jdec, uint8_t* buf, size_t len)
 {
   TJpg_Decoder *thisPtr = TJpgDec.thisPtr;
   jdec = jdec; // Supress warning
@@ -97,36 +197,14 @@ unsigned int TJpg_Decoder::jd_input(JDEC* jdec, uint8_t* buf, unsigned int len)
 #ifdef TJPGD_LOAD_FFS
   // Handle SPIFFS input
   else if (thisPtr->jpg_source == TJPG_FS_FILE) {
-    // Check how many bytes are available
-    uint32_t bytesLeft = thisPtr->jpgFile.available();
-    if (bytesLeft < len) len = bytesLeft;
-
-    if (buf) {
-      // Read into buffer, pointer moved as well
-      thisPtr->jpgFile.read(buf, len);
-    }
-    else {
-      // Buffer is null, so skip data by moving pointer
-      thisPtr->jpgFile.seek(thisPtr->jpgFile.position() + len);
-    }
+    len = thisPtr->readFile(thisPtr->jpgFile, buf, len);
   }
 #endif
 
 #if defined (TJPGD_LOAD_SD_LIBRARY)
   // Handle SD library input
   else if (thisPtr->jpg_source == TJPG_SD_FILE) {
-    // Check how many bytes are available
-    uint32_t bytesLeft = thisPtr->jpgSdFile.available();
-    if (bytesLeft < len) len = bytesLeft;
-
-    if (buf) {
-      // Read into buffer, pointer moved as well
-      thisPtr->jpgSdFile.read(buf, len);
-    }
-    else {
-      // Buffer is null, so skip data by moving pointer
-      thisPtr->jpgSdFile.seek(thisPtr->jpgSdFile.position() + len);
-    }
+    len = thisPtr->readFile(thisPtr->jpgSdFile, buf, len);
   }
 #endif
 
@@ -156,6 +234,188 @@ int TJpg_Decoder::jd_output(JDEC* jdec, void* bitmap, JRECT* jrect)
 }
 
 
+/***************************************************************************************
+** Function name:           enablePipeline
+** Description:             Decode on another core while the sketch renders complete rows
+***************************************************************************************/
+// The decoder task runs on "core", the sketch callback is still called on the core that
+// calls drawJpg, but once per MCU row (image width x 8 or 16 pixels / scale) from one of
+// "buffers" DMA capable row buffers. A buffer is reused only after the callback for the
+// following row has returned, so the callback can start a pushImageDMA() and return.
+// The last row of an image may still be in transfer when drawJpg returns, call
+// tft.dmaWait() before the next drawJpg, which hands all buffers back to the decoder.
+bool TJpg_Decoder::enablePipeline(uint8_t buffers, int8_t core)
+{
+#ifdef TJPGD_PIPELINE
+  disablePipeline();
+
+  if (buffers < 2) buffers = 2;
+  if (buffers > TJPGD_PIPE_BUFFERS_MAX) buffers = TJPGD_PIPE_BUFFERS_MAX;
+  pipeBuffers = buffers;
+
+  pipeJobs = xQueueCreate(1, sizeof(JDEC*));
+  pipeFree = xQueueCreate(buffers, sizeof(uint16_t*));
+  pipeRows = xQueueCreate(buffers + 1, sizeof(TJpgRow)); // + end of image
+
+  if (pipeJobs && pipeFree && pipeRows &&
+      xTaskCreatePinnedToCore(decodeTask, "TJpgDec", 4096, this, 1, &pipeTask, core) == pdPASS) {
+    return true;
+  }
+
+  pipeTask = nullptr;
+  disablePipeline();
+#else
+  buffers = buffers; // Supress warnings
+  core = core;
+#endif
+  return false;
+}
+
+/***************************************************************************************
+** Function name:           disablePipeline
+** Description:             Stop the decoder task and free the row buffers
+***************************************************************************************/
+void TJpg_Decoder::disablePipeline(void)
+{
+#ifdef TJPGD_PIPELINE
+  if (pipeTask) {
+    // A null job ends the task, wait for its reply
+    JDEC* stop = nullptr;
+    TJpgRow row;
+    xQueueSend(pipeJobs, &stop, portMAX_DELAY);
+    xQueueReceive(pipeRows, &row, portMAX_DELAY);
+    pipeTask = nullptr;
+  }
+
+  if (pipeJobs) vQueueDelete(pipeJobs);
+  if (pipeFree) vQueueDelete(pipeFree);
+  if (pipeRows) vQueueDelete(pipeRows);
+  pipeJobs = pipeFree = pipeRows = nullptr;
+
+  for (uint8_t i = 0; i < TJPGD_PIPE_BUFFERS_MAX; i++) {
+    if (pipeBuffer[i]) heap_caps_free(pipeBuffer[i]);
+    pipeBuffer[i] = nullptr;
+  }
+  pipeBuffers  = 0;
+  pipeCapacity = 0;
+#endif
+}
+
+#ifdef TJPGD_PIPELINE
+/***************************************************************************************
+** Function name:           decodeTask (declared static)
+** Description:             Decoder task, runs jd_decomp() for each job
+***************************************************************************************/
+void TJpg_Decoder::decodeTask(void *p)
+{
+  TJpg_Decoder *thisPtr = (TJpg_Decoder*)p;
+  TJpgRow done = { nullptr, 0, 0, JDR_OK };
+  JDEC* jdec;
+
+  for (;;) {
+    xQueueReceive(thisPtr->pipeJobs, &jdec, portMAX_DELAY);
+    if (!jdec) break;
+
+    thisPtr->pipeRow = nullptr;
+    done.result = jd_decomp(jdec, jd_output_row, thisPtr->jpgScale);
+
+    // Hand back a part filled row after an error or abort
+    if (thisPtr->pipeRow) xQueueSend(thisPtr->pipeFree, &thisPtr->pipeRow, portMAX_DELAY);
+    xQueueSend(thisPtr->pipeRows, &done, portMAX_DELAY);
+  }
+
+  xQueueSend(thisPtr->pipeRows, &done, portMAX_DELAY);
+  vTaskDelete(NULL);
+}
+
+/***************************************************************************************
+** Function name:           jd_output_row (declared static)
+** Description:             Called by tjpgd.c in the decoder task, collects MCUs into rows
+***************************************************************************************/
+int TJpg_Decoder::jd_output_row(JDEC* jdec, void* bitmap, JRECT* jrect)
+{
+  TJpg_Decoder *thisPtr = TJpgDec.thisPtr;
+
+  // Stop decoding, the sketch callback returned false
+  if (thisPtr->pipeAbort) return 0;
+
+  // Scaled image width, the last MCU of a row ends here
+  uint16_t width = jdec->width >> jdec->scale;
+  uint16_t w = jrect->right  + 1 - jrect->left;
+  uint16_t h = jrect->bottom + 1 - jrect->top;
+
+  if (!thisPtr->pipeRow) xQueueReceive(thisPtr->pipeFree, &thisPtr->pipeRow, portMAX_DELAY);
+
+  uint16_t* src = (uint16_t*)bitmap;
+  uint16_t* dst = thisPtr->pipeRow + jrect->left;
+  for (uint16_t i = 0; i < h; i++) {
+    memcpy(dst, src, w << 1);
+    src += w;
+    dst += width;
+  }
+
+  if (jrect->right + 1 >= width) {
+    TJpgRow row = { thisPtr->pipeRow, jrect->top, h, JDR_OK };
+    xQueueSend(thisPtr->pipeRows, &row, portMAX_DELAY);
+    thisPtr->pipeRow = nullptr;
+  }
+
+  return 1;
+}
+#endif
+
+/***************************************************************************************
+** Function name:           decompress
+** Description:             Decode a prepared image, pipelined if enabled
+***************************************************************************************/
+JRESULT TJpg_Decoder::decompress(JDEC* jdec)
+{
+#ifdef TJPGD_PIPELINE
+  if (pipeTask) {
+    uint16_t width  = jdec->width >> jpgScale;
+    uint32_t pixels = (uint32_t)width * ((jdec->msy * 8) >> jpgScale);
+
+    // Grow the row buffers if needed, they are kept for the next image
+    if (pixels > pipeCapacity) {
+      pipeCapacity = pixels;
+      for (uint8_t i = 0; i < pipeBuffers; i++) {
+        if (pipeBuffer[i]) heap_caps_free(pipeBuffer[i]);
+        pipeBuffer[i] = (uint16_t*)heap_caps_malloc(pixels << 1, MALLOC_CAP_DMA);
+        if (!pipeBuffer[i]) pipeCapacity = 0;
+      }
+    }
+
+    // Not enough memory, decode on this core
+    if (pipeCapacity == 0) return jd_decomp(jdec, jd_output, jpgScale);
+
+    xQueueReset(pipeFree);
+    for (uint8_t i = 0; i < pipeBuffers; i++) xQueueSend(pipeFree, &pipeBuffer[i], 0);
+    pipeAbort = false;
+
+    xQueueSend(pipeJobs, &jdec, portMAX_DELAY);
+
+    // Render rows until the decoder task reports the end of the image
+    uint16_t* pending = nullptr;
+    TJpgRow row;
+    for (;;) {
+      xQueueReceive(pipeRows, &row, portMAX_DELAY);
+      if (!row.data) break;
+
+      if (!pipeAbort && !tft_output(jpeg_x, row.y + jpeg_y, width, row.h, row.data)) pipeAbort = true;
+
+      // The callback for this row has waited for the transfer of the previous one (dmaWait()
+      // in pushImageDMA()), only now can the previous row buffer be refilled
+      if (pending) xQueueSend(pipeFree, &pending, portMAX_DELAY);
+      pending = row.data;
+    }
+
+    return row.result;
+  }
+#endif
+
+  return jd_decomp(jdec, jd_output, jpgScale);
+}
+
 #if defined (TJPGD_LOAD_SD_LIBRARY) || defined (TJPGD_LOAD_FFS)
 
 /***************************************************************************************
@@ -291,14 +551,17 @@ JRESULT TJpg_Decoder::drawFsJpg(int32_t x, int32_t y, fs::File inFile) {
   jdec.swap = _swap;
 
   jpgFile = inFile;
+  beginReadAhead();
 
   jresult = jd_prepare(&jdec, jd_input, workspace, TJPGD_WORKSPACE_SIZE, (unsigned int)0);
 
   // Extract image and render
   if (jresult == JDR_OK) {
-    jresult = jd_decomp(&jdec, jd_output, jpgScale);
+    jresult = decompress(&jdec);
   }
 
+  endReadAhead();
+
   // Close file
   if (jpgFile) jpgFile.close();
 
@@ -418,14 +681,17 @@ JRESULT TJpg_Decoder::drawSdJpg(int32_t x, int32_t y, File inFile) {
   jdec.swap = _swap;
 
   jpgSdFile = inFile;
+  beginReadAhead();
 
   jresult = jd_prepare(&jdec, jd_input, workspace, TJPGD_WORKSPACE_SIZE, 0);
 
   // Extract image and render
   if (jresult == JDR_OK) {
-    jresult = jd_decomp(&jdec, jd_output, jpgScale);
+    jresult = decompress(&jdec);
   }
 
+  endReadAhead();
+
   // Close file
   if (jpgSdFile) jpgSdFile.close();
 
@@ -519,7 +785,7 @@ JRESULT TJpg_Decoder::drawJpg(int32_t x, int32_t y, const uint8_t jpeg_data[], u
 
   // Extract image and render
   if (jresult == JDR_OK) {
-    jresult = jd_decomp(&jdec, jd_output, jpgScale);
+    jresult = decompress(&jdec);
   }
 
   return jresult;
@@ -36,6 +36,25 @@ https://github.com/Bodmer/TJpg_Decoder
   #include <SD.h>
 #endif
 
+// Pipelined decoding, the decoder runs as a task on the other core and hands over complete MCU rows
+#ifdef ESP32
+  #include "freertos/FreeRTOS.h"
+  #include "freertos/queue.h"
+  #include "freertos/task.h"
+  #define TJPGD_PIPELINE
+  #define TJPGD_PIPE_BUFFERS_MAX 4
+#endif
+
+#ifdef TJPGD_PIPELINE
+// A decoded MCU row handed from the decoder task to the calling core
+typedef struct {
+  uint16_t* data;   // nullptr = decoding has ended
+  uint16_t  y;
+  uint16_t  h;
+  JRESULT   result;
+} TJpgRow;
+#endif
+
 enum {
 	TJPG_ARRAY = 0,
 	TJPG_FS_FILE,
@@ -57,17 +76,55 @@ private:
   fs::File jpgFile;
 #endif
 
+#if defined (TJPGD_LOAD_SD_LIBRARY) || defined (TJPGD_LOAD_FFS)
+  // Read-ahead buffer for file input (TJPGD_READ_AHEAD), only allocated while a file is drawn
+  uint8_t* readBuffer = nullptr;
+  uint16_t readIndex  = 0;
+  uint16_t readCount  = 0;
+
+  template <class T> size_t readFile(T &file, uint8_t* buf, size_t len);
+  void beginReadAhead();
+  void endReadAhead();
+#endif
+
+#ifdef TJPGD_PIPELINE
+  // Decoder task and the queues between the two cores
+  TaskHandle_t  pipeTask  = nullptr;
+  QueueHandle_t pipeJobs  = nullptr; // Start/stop requests for the decoder task
+  QueueHandle_t pipeFree  = nullptr; // Row buffers the decoder can fill
+  QueueHandle_t pipeRows  = nullptr; // Complete rows for the calling core, nullptr buffer = done
+
+  uint16_t* pipeBuffer[TJPGD_PIPE_BUFFERS_MAX] = { nullptr };
+  uint8_t   pipeBuffers  = 0;
+  uint32_t  pipeCapacity = 0; // Pixels per row buffer
+
+  uint16_t* pipeRow = nullptr; // Row buffer being filled, used by the decoder task only
+
+  volatile bool pipeAbort = false; // Set when the sketch callback returns false
+
+  static void decodeTask(void *p);
+  static int jd_output_row(JDEC* jdec, void* bitmap, JRECT* jrect);
+#endif
+
+  JRESULT decompress(JDEC* jdec);
+
 public:
 
   TJpg_Decoder();
   ~TJpg_Decoder();
 
   static int jd_output(JDEC* jdec, void* bitmap, JRECT* jrect);
-  static unsigned int jd_input(JDEC* jdec, uint8_t* buf, unsigned int len);
+  static size_t jd_input(JDEC* jdec, uint8_t* buf, size_t len);
 
   void setJpgScale(uint8_t scale);
   void setCallback(SketchCallback sketchCallback);
 
+  // Decode on another core (ESP32 only), the callback is then called with complete MCU rows.
+  // A row buffer is refilled once the callback for the next row has returned; call
+  // tft.dmaWait() after drawJpg and before the next one, the last row may still be in DMA
+  bool enablePipeline(uint8_t buffers = 3, int8_t core = 0);
+  void disablePipeline(void);
+
 
 #if defined (TJPGD_LOAD_SD_LIBRARY) || defined (TJPGD_LOAD_FFS)
   JRESULT drawJpg (int32_t x, int32_t y, const char *pFilename);
@@ -3,3 +3,8 @@
 #endif
 
 #define TJPGD_LOAD_SD_LIBRARY
+
+// Size of the read-ahead buffer used for SPIFFS/LittleFS/SD input, the decoder asks for at most
+// 512 bytes at a time, larger reads starting on a 512 byte file offset are much faster on SD cards
+// Comment out to read the file directly
+#define TJPGD_READ_AHEAD 4096
@@ -0,0 +1,210 @@
+/*
+ * jpeg_bench.cpp
+ *
+ * Created on: Oct 18,2026
+ *
+ *  Host bench for TJpg_Decoder: the synchronous decoder (MCU callback on the calling core) against the pipelined
+ *  decoder (enablePipeline(), decoder task on another thread, row callback on the calling core).
+ *
+ *  Every file is decoded from an array and through drawFsJpg() at scale 1, 2, 4 and 8. All decodes must return
+ *  JDR_OK and produce the same frame buffer as the synchronous array decode. A decode stopped by the callback must
+ *  return JDR_INTR in both modes and leave the pipeline usable. Truncated copies of every file, also with a long
+ *  segment in front that the file input skips, must give the same result from a file as from an array.
+ *
+ *  Throughput is the best of --repeat runs at scale 1 in ms per image. The display is modelled as an SPI bus at
+ *  --spi-mhz (16 bit per pixel, 0 = no display): the synchronous callback waits for its transfer like pushImage(),
+ *  the pipelined callback only waits for the previous transfer and starts its own like pushImageDMA(). The bus is
+ *  simulated with absolute deadlines, the pipelined wait sleeps (DMA needs no CPU), so the overlap shows on a single
+ *  core host too. A pipelined row only reaches the frame buffer when its transfer ends, so a row buffer handed back
+ *  to the decoder while its transfer still runs shows up as a mismatch.
+ *  File input reports the read() and seek() calls that reach the file system per image (TJPGD_READ_AHEAD).
+ *
+ *  usage: jpeg_bench [--repeat N] [--spi-mhz F] file.jpg...
+ *
+ */
+#include "TJpg_Decoder.h"
+#include <unistd.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+typedef std::chrono::steady_clock clk;
+
+static std::vector<uint16_t> frame;     // decoded image, scaled size
+static uint16_t frameW = 0, frameH = 0;
+static int16_t  stopAtY = -1;           // callback returns false from this row on, -1 = never
+static double   spiMHz = 40.0;
+static bool     dmaMode = false;
+static clk::time_point busUntil;        // end of the current SPI transfer
+
+// The transfer in flight, DMA reads the buffer until it ends, so its pixels are only copied to the frame then
+static struct { int16_t x, y; uint16_t w, h; uint16_t* bitmap; } dma = { 0, 0, 0, 0, nullptr };
+
+static void copyToFrame(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t* bitmap) {
+    for (uint16_t j = 0; j < h; j++) {
+        if (y + j >= frameH) break;
+        uint16_t n = (x + w > frameW) ? frameW - x : w;
+        memcpy(&frame[(y + j) * frameW + x], bitmap + j * w, n * 2);
+    }
+}
+
+static void dmaWait() {
+    if (spiMHz > 0 && busUntil > clk::now()) std::this_thread::sleep_until(busUntil);
+    if (dma.bitmap) copyToFrame(dma.x, dma.y, dma.w, dma.h, dma.bitmap);
+    dma.bitmap = nullptr;
+}
+
+static void busTransfer(uint32_t pixels) {
+    if (spiMHz <= 0) return;
+    clk::time_point now = clk::now();
+    if (busUntil > now) { std::this_thread::sleep_until(busUntil); now = busUntil; }
+    busUntil = now + std::chrono::nanoseconds((int64_t)(pixels * 16 * 1000.0 / spiMHz));
+    if (!dmaMode) while (clk::now() < busUntil) {}          // pushImage() blocks, spin, a sleep per block overshoots
+}
+
+static bool tft_output(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t* bitmap) {
+    if (stopAtY >= 0 && y >= stopAtY) return false;
+    if (!dmaMode) {
+        copyToFrame(x, y, w, h, bitmap);
+        busTransfer((uint32_t)w * h);
+        return true;
+    }
+    // pushImageDMA(): wait for the previous transfer, then start this one and return while it reads the buffer
+    dmaWait();
+    dma = { x, y, w, h, bitmap };
+    busTransfer((uint32_t)w * h);
+    return true;
+}
+
+static JRESULT decode(const std::vector<uint8_t>& jpg, const char* path, uint8_t scale, bool pipelined) {
+    uint16_t w = 0, h = 0;
+    TJpgDec.getJpgSize(&w, &h, jpg.data(), jpg.size());
+    frameW = w / scale;
+    frameH = h / scale;
+    frame.assign((size_t)frameW * frameH, 0);
+    TJpgDec.setJpgScale(scale);
+    dmaMode = pipelined;
+    busUntil = clk::now();
+
+    if (pipelined) TJpgDec.enablePipeline(3);
+    else TJpgDec.disablePipeline();
+
+    JRESULT res = path ? TJpgDec.drawFsJpg(0, 0, path) : TJpgDec.drawJpg(0, 0, jpg.data(), jpg.size());
+    if (dmaMode) dmaWait();                                     // the last row buffer is in use until its transfer ends
+    else if (spiMHz > 0) std::this_thread::sleep_until(busUntil);
+    return res;
+}
+
+int main(int argc, char** argv) {
+    int repeat = 5;
+    std::vector<const char*> files;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--repeat") && i + 1 < argc) repeat = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--spi-mhz") && i + 1 < argc) spiMHz = atof(argv[++i]);
+        else files.push_back(argv[i]);
+    }
+    if (files.empty()) {
+        fprintf(stderr, "usage: jpeg_bench [--repeat N] [--spi-mhz F] file.jpg...\n");
+        return 2;
+    }
+
+    TJpgDec.setSwapBytes(true);
+    TJpgDec.setCallback(tft_output);
+    int failures = 0;
+    double spi = spiMHz;
+
+    printf("%-14s %9s %7s | %9s %9s %7s | %9s %9s %7s | %s\n", "file", "size", "bytes", "sync ms", "pipe ms", "gain",
+           "sync ms", "pipe ms", "gain", "file reads/seeks");
+    printf("%-14s %9s %7s | %-27s | %-27s |\n", "", "", "", "decode only", "with SPI display");
+
+    for (const char* path : files) {
+        FILE* f = fopen(path, "rb");
+        if (!f) { fprintf(stderr, "%s: cannot open\n", path); failures++; continue; }
+        std::vector<uint8_t> jpg;
+        uint8_t chunk[4096];
+        size_t n;
+        while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) jpg.insert(jpg.end(), chunk, chunk + n);
+        fclose(f);
+        const char* name = strrchr(path, '/') ? strrchr(path, '/') + 1 : path;
+
+        // conformance, no display timing
+        spiMHz = 0;
+        for (uint8_t scale = 1; scale <= 8; scale *= 2) {
+            JRESULT res = decode(jpg, nullptr, scale, false);
+            std::vector<uint16_t> ref = frame;
+            if (res != JDR_OK) { printf("%s scale %u: sync decode returned %d\n", name, scale, res); failures++; continue; }
+            for (int mode = 0; mode < 3; mode++) {
+                res = decode(jpg, mode == 0 ? nullptr : path, scale, mode != 1);
+                if (res != JDR_OK || frame != ref) {
+                    printf("%s scale %u: %s %s decode %s\n", name, scale, mode == 1 ? "sync" : "pipelined",
+                           mode == 0 ? "array" : "file", res != JDR_OK ? "failed" : "differs");
+                    failures++;
+                }
+            }
+        }
+        // truncated files, also a copy with an 8 KB APP1 segment (like an EXIF thumbnail) that the read-ahead skips by
+        // seeking: the file decode must end with the same result as the array decode of the same bytes, a skip clamped
+        // at the end of the file must neither hang nor run past it
+        std::vector<uint8_t> exif = { 0xFF, 0xD8, 0xFF, 0xE1, 0x20, 0x00 };   // SOI, APP1 of 0x2000 bytes
+        exif.resize(exif.size() + 0x2000 - 2, 0);
+        exif.insert(exif.end(), jpg.begin() + 2, jpg.end());
+        std::vector<std::pair<const std::vector<uint8_t>*, size_t>> cuts;
+        for (size_t cut : { (size_t)4196, (size_t)4608, jpg.size() / 2, jpg.size() - 1 }) cuts.push_back({ &jpg, cut });
+        for (size_t cut : { (size_t)4196, (size_t)4608, (size_t)5000, (size_t)8192, exif.size() - 1, exif.size() }) cuts.push_back({ &exif, cut });
+        for (auto& c : cuts) {
+            const std::vector<uint8_t>& src = *c.first;
+            size_t cut = c.second;
+            if (cut > src.size() || (cut == src.size() && &src == &jpg)) continue;
+            std::vector<uint8_t> part(src.begin(), src.begin() + cut);
+            char tmp[] = "/tmp/jpeg_bench_XXXXXX";
+            int fd = mkstemp(tmp);
+            if (fd < 0 || write(fd, part.data(), part.size()) != (ssize_t)part.size()) { perror("truncated file"); failures++; }
+            if (fd >= 0) close(fd);
+            JRESULT expect = decode(part, nullptr, 1, false);
+            for (int pipelined = 0; pipelined < 2; pipelined++) {
+                JRESULT res = decode(part, tmp, 1, pipelined);
+                if (res != expect) {
+                    printf("%s%s cut at %zu: %s file decode returned %d, array %d\n", name, &src == &exif ? " + APP1" : "", cut,
+                           pipelined ? "pipelined" : "sync", res, expect);
+                    failures++;
+                }
+            }
+            unlink(tmp);
+        }
+
+        // callback stops the decoder half way, the pipeline must drain and stay usable
+        for (int pipelined = 0; pipelined < 2; pipelined++) {
+            stopAtY = 40;
+            JRESULT res = decode(jpg, nullptr, 1, pipelined);
+            stopAtY = -1;
+            if (res != JDR_INTR) { printf("%s: abort returned %d (%s)\n", name, res, pipelined ? "pipelined" : "sync"); failures++; }
+        }
+
+        // throughput at scale 1, decode only and with the SPI model
+        double ms[2][2];
+        for (int display = 0; display < 2; display++) {
+            spiMHz = display ? spi : 0;
+            for (int pipelined = 0; pipelined < 2; pipelined++) {
+                double best = 1e30;
+                for (int r = 0; r < repeat; r++) {
+                    clk::time_point t0 = clk::now();
+                    decode(jpg, nullptr, 1, pipelined);
+                    best = std::min(best, std::chrono::duration<double, std::milli>(clk::now() - t0).count());
+                }
+                ms[display][pipelined] = best;
+            }
+        }
+
+        fs::stats = fs::FileStats();
+        spiMHz = 0;
+        decode(jpg, path, 1, false);
+        printf("%-14s %4ux%-4u %7zu | %9.2f %9.2f %6.2fx | %9.2f %9.2f %6.2fx | %u/%u\n", name, frameW, frameH,
+               jpg.size(), ms[0][0], ms[0][1], ms[0][0] / ms[0][1], ms[1][0], ms[1][1], ms[1][0] / ms[1][1],
+               fs::stats.reads, fs::stats.seeks);
+    }
+    TJpgDec.disablePipeline();
+
+    if (failures) printf("%d failure(s)\n", failures);
+    else printf("all decodes identical\n");
+    return failures ? 1 : 0;
+}
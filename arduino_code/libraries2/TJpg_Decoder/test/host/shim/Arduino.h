@@ -0,0 +1,42 @@
+/*
+ * Arduino.h
+ *
+ * Created on: Oct 18,2026
+ *
+ *  Minimal Arduino-ESP32 replacement for the host build of TJpg_Decoder (test/host). It provides only what
+ *  TJpg_Decoder.cpp uses: String, Serial, the PROGMEM accessors, heap_caps_malloc and, in freertos/, the queue
+ *  and task subset of the pipelined decoder on std::thread. FS.h, SD.h, SPIFFS.h and LittleFS.h map fs::File to
+ *  a stdio FILE and count the reads and seeks.
+ *  Never include this file in a firmware build.
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+#define F(s)                s
+#define PROGMEM
+#define memcpy_P            memcpy
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+
+class String {
+  public:
+    String(const char* s = "") : m_s(s) {}
+    const char* c_str() const { return m_s.c_str(); }
+    char        charAt(unsigned int i) const { return i < m_s.size() ? m_s[i] : 0; }
+    unsigned    length() const { return m_s.size(); }
+  private:
+    std::string m_s;
+};
+
+class HardwareSerial {
+  public:
+    void print(const char* s) { fputs(s, stderr); }
+    void println(const char* s) { fprintf(stderr, "%s\n", s); }
+};
+inline HardwareSerial Serial;
@@ -0,0 +1,72 @@
+/*
+ * FS.h
+ *
+ *  fs::FS and fs::File on stdio for the host build. Files are shared handles like on the ESP32, every read() and
+ *  seek() that reaches the "flash" is counted in fs::stats.
+ *
+ */
+#pragma once
+
+#include "Arduino.h"
+#include <memory>
+
+namespace fs {
+
+struct FileStats {
+    uint32_t reads = 0;
+    uint32_t seeks = 0;
+    uint64_t bytes = 0;
+};
+inline FileStats stats;
+
+class File {
+  public:
+    File() = default;
+    explicit File(FILE* f) : m_f(f, fclose) {
+        fseek(f, 0, SEEK_END);
+        m_size = ftell(f);
+        fseek(f, 0, SEEK_SET);
+    }
+    operator bool() const { return m_f != nullptr; }
+
+    size_t read(uint8_t* buf, size_t len) {
+        if (!m_f) return 0;
+        stats.reads++;
+        size_t n = fread(buf, 1, len, m_f.get());
+        stats.bytes += n;
+        return n;
+    }
+    bool seek(uint32_t pos) {
+        if (!m_f) return false;
+        stats.seeks++;
+        return fseek(m_f.get(), pos, SEEK_SET) == 0;
+    }
+    size_t position() const { return m_f ? ftell(m_f.get()) : 0; }
+    size_t size() const { return m_size; }
+    int    available() { return m_f ? (int)(m_size - position()) : 0; }
+    void   close() { m_f.reset(); }
+
+  private:
+    std::shared_ptr<FILE> m_f;
+    size_t                m_size = 0;
+};
+
+class FS {
+  public:
+    bool exists(const char* path) {
+        FILE* f = fopen(path, "rb");
+        if (f) fclose(f);
+        return f != nullptr;
+    }
+    bool exists(const String& path) { return exists(path.c_str()); }
+    File open(const char* path, const char* mode = "r") {
+        FILE* f = fopen(path, (mode[0] == 'r') ? "rb" : "wb");
+        return f ? File(f) : File();
+    }
+    File open(const String& path, const char* mode = "r") { return open(path.c_str(), mode); }
+};
+
+} // namespace fs
+
+using fs::FS;
+using fs::File;
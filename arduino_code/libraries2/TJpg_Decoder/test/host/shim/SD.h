@@ -0,0 +1,4 @@
+#pragma once
+#include "FS.h"
+#define FILE_READ "r"
+inline fs::FS SD;
@@ -0,0 +1,3 @@
+#pragma once
+#include "FS.h"
+inline fs::FS SPIFFS;   // paths are host paths
@@ -0,0 +1,28 @@
+/*
+ * freertos/FreeRTOS.h
+ *
+ *  The FreeRTOS subset of the pipelined TJpg_Decoder on std::thread: fixed size item queues and pinned tasks
+ *  (the core is ignored). vTaskDelete(NULL) does not stop the calling thread, the task function returns after it.
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+typedef uint32_t TickType_t;
+typedef int      BaseType_t;
+typedef unsigned UBaseType_t;
+
+#define pdPASS          1
+#define pdFAIL          0
+#define pdTRUE          1
+#define pdFALSE         0
+#define portMAX_DELAY   0xffffffffUL
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
@@ -0,0 +1,51 @@
+#pragma once
+#include "freertos/FreeRTOS.h"
+
+struct QueueDefinition {
+    size_t                            itemSize;
+    size_t                            length;
+    std::deque<std::vector<uint8_t>>  items;
+    std::mutex                        mtx;
+    std::condition_variable           cv;
+};
+typedef QueueDefinition* QueueHandle_t;
+
+inline QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+    QueueHandle_t q = new QueueDefinition;
+    q->itemSize = itemSize;
+    q->length = length;
+    return q;
+}
+
+inline void vQueueDelete(QueueHandle_t q) { delete q; }
+
+inline BaseType_t xQueueReset(QueueHandle_t q) {
+    std::lock_guard<std::mutex> lock(q->mtx);
+    q->items.clear();
+    q->cv.notify_all();
+    return pdPASS;
+}
+
+// ticks are milliseconds, portMAX_DELAY waits forever
+template <class Pred> inline bool queueWait(QueueHandle_t q, std::unique_lock<std::mutex>& lock, TickType_t ticks, Pred pred) {
+    if (ticks == portMAX_DELAY) { q->cv.wait(lock, pred); return true; }
+    return q->cv.wait_for(lock, std::chrono::milliseconds(ticks), pred);
+}
+
+inline BaseType_t xQueueSend(QueueHandle_t q, const void* item, TickType_t ticks) {
+    std::unique_lock<std::mutex> lock(q->mtx);
+    if (!queueWait(q, lock, ticks, [q] { return q->items.size() < q->length; })) return pdFAIL;
+    const uint8_t* p = (const uint8_t*)item;
+    q->items.emplace_back(p, p + q->itemSize);
+    q->cv.notify_all();
+    return pdPASS;
+}
+
+inline BaseType_t xQueueReceive(QueueHandle_t q, void* item, TickType_t ticks) {
+    std::unique_lock<std::mutex> lock(q->mtx);
+    if (!queueWait(q, lock, ticks, [q] { return !q->items.empty(); })) return pdFAIL;
+    memcpy(item, q->items.front().data(), q->itemSize);
+    q->items.pop_front();
+    q->cv.notify_all();
+    return pdPASS;
+}
@@ -0,0 +1,16 @@
+#pragma once
+#include "freertos/FreeRTOS.h"
+
+typedef void* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stack, void* param,
+                                          UBaseType_t prio, TaskHandle_t* handle, BaseType_t core) {
+    (void)name; (void)stack; (void)prio; (void)core;
+    std::thread t(fn, param);
+    if (handle) *handle = (TaskHandle_t)(uintptr_t)1;   // only compared against nullptr
+    t.detach();
+    return pdPASS;
+}
+
+inline void vTaskDelete(TaskHandle_t handle) { (void)handle; }
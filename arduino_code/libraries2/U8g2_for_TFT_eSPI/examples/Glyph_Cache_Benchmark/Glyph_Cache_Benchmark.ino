@@ -0,0 +1,82 @@
+/*
+
+  Glyph_Cache_Benchmark.ino
+
+  Measures the time to draw a line of 20 Chinese glyphs into a sprite
+  with and without the glyph cache.
+
+  Without the cache every glyph is searched in the font, run length decoded
+  and drawn with one line per run. With the cache the decoded glyphs and the
+  line layout are reused, so a redraw of unchanged text only copies bits
+  into the sprite.
+
+  List of all U8g2 fonts:    https://github.com/olikraus/u8g2/wiki/fntlistall
+
+  TFT_eSPI library:          https://github.com/Bodmer/TFT_eSPI
+  U8g2_for_TFT_eSPI library: https://github.com/Bodmer/U8g2_for_TFT_eSPI
+
+*/
+#include "SPI.h"
+#include "TFT_eSPI.h"
+#include "U8g2_for_TFT_eSPI.h"
+
+TFT_eSPI tft = TFT_eSPI();      // tft instance
+TFT_eSprite spr = TFT_eSprite(&tft);
+U8g2_for_TFT_eSPI u8f;          // U8g2 font instance
+
+#define FONT u8g2_font_wqy12_t_gb2312
+#define REPEAT 100
+
+const char text[] = "神农尝遍百草，他每次中毒都靠喝茶来解救。";   // 20 glyphs
+
+// Average time in microseconds to draw the text once
+uint32_t timeText(void)
+{
+  uint32_t t = micros();
+  for (int i = 0; i < REPEAT; i++)
+  {
+    spr.fillSprite(TFT_BLACK);
+    u8f.drawUTF8(0, 26, text);
+  }
+  return (micros() - t) / REPEAT;
+}
+
+void setup() {
+  Serial.begin(115200);
+  tft.begin();
+  tft.fillScreen(TFT_BLACK);
+
+  spr.createSprite(tft.width(), 32);
+  u8f.begin(spr);                     // connect u8g2 procedures to the sprite
+  u8f.setFont(FONT);
+  u8f.setFontMode(1);                 // use u8g2 transparent mode (this is default)
+  u8f.setFontDirection(0);            // left to right (this is default)
+  u8f.setForegroundColor(TFT_WHITE);
+
+  uint32_t fill = micros();
+  for (int i = 0; i < REPEAT; i++) spr.fillSprite(TFT_BLACK);
+  fill = (micros() - fill) / REPEAT;
+
+  u8f.disableGlyphCache();
+  uint32_t plain = timeText() - fill;
+
+  if (!u8f.enableGlyphCache())
+  {
+    Serial.println("Not enough memory for the glyph cache");
+    return;
+  }
+  uint32_t cached = timeText() - fill;
+
+  uint32_t hits, misses;
+  u8f.getGlyphCacheStats(&hits, &misses);
+
+  Serial.printf("Without cache: %u us per line\n", (unsigned)plain);
+  Serial.printf("With cache:    %u us per line (%u hits, %u misses)\n", (unsigned)cached, (unsigned)hits, (unsigned)misses);
+  Serial.printf("Text width:    %d pixels\n", u8f.getUTF8Width(text));
+
+  spr.pushSprite(0, 0);
+}
+
+void loop() {
+  delay(2000);
+}
@@ -37,6 +37,8 @@
 
 */
 
+#include <stdlib.h>
+#include <string.h>
 #include <TFT_eSPI.h>
 #include "U8g2_for_TFT_eSPI.h"
 
@@ -685,14 +687,239 @@ static int16_t u8g2_font_2x_draw_glyph(u8g2_font_t *u8g2, int16_t x, int16_t y,
   return dx;
 }
 
+/*========================================================================*/
+/* glyph cache */
+
+uint8_t u8g2_EnableGlyphCache(u8g2_font_t *u8g2, uint8_t slots)
+{
+  u8g2_glyph_cache_t *cache;
+  uint8_t i;
+
+  if ( slots == 0 || slots >= U8G2_GLYPH_CACHE_NONE )
+    return 0;
+  if ( u8g2->glyph_cache != NULL && u8g2->glyph_cache->slots == slots )
+    return 1;
+  u8g2_DisableGlyphCache(u8g2);
+
+  cache = (u8g2_glyph_cache_t *)malloc(sizeof(u8g2_glyph_cache_t) + (slots - 1) * sizeof(u8g2_cached_glyph_t));
+  if ( cache == NULL )
+    return 0;
+  memset(cache, 0, sizeof(u8g2_glyph_cache_t) + (slots - 1) * sizeof(u8g2_cached_glyph_t));
+  memset(cache->bucket, U8G2_GLYPH_CACHE_NONE, sizeof(cache->bucket));
+
+  /* all slots are unused (font == NULL) and chained from head to tail */
+  cache->slots = slots;
+  cache->lru_head = 0;
+  cache->lru_tail = slots - 1;
+  for( i = 0; i < slots; i++ )
+  {
+    cache->glyph[i].hash_next = U8G2_GLYPH_CACHE_NONE;
+    cache->glyph[i].lru_prev = i == 0 ? U8G2_GLYPH_CACHE_NONE : i - 1;
+    cache->glyph[i].lru_next = i == slots - 1 ? U8G2_GLYPH_CACHE_NONE : i + 1;
+  }
+  u8g2->glyph_cache = cache;
+  return 1;
+}
+
+void u8g2_DisableGlyphCache(u8g2_font_t *u8g2)
+{
+  if ( u8g2->glyph_cache != NULL )
+  {
+    free(u8g2->glyph_cache);
+    u8g2->glyph_cache = NULL;
+  }
+}
+
+static uint8_t u8g2_glyph_cache_bucket(const uint8_t *font, uint16_t encoding)
+{
+  /* Fibonacci hashing: consecutive CJK code points spread over all buckets */
+  uint32_t h = (encoding ^ ((uint32_t)(uintptr_t)font << 7)) * 2654435761UL;
+  return h >> (32 - U8G2_GLYPH_CACHE_BUCKET_BITS);
+}
+
+/* make a slot the most recently used one */
+static void u8g2_glyph_cache_touch(u8g2_glyph_cache_t *cache, uint8_t i)
+{
+  u8g2_cached_glyph_t *g = cache->glyph + i;
+
+  if ( cache->lru_head == i )
+    return;
+  /* unlink, i is not the head so lru_prev is valid */
+  cache->glyph[g->lru_prev].lru_next = g->lru_next;
+  if ( g->lru_next != U8G2_GLYPH_CACHE_NONE )
+    cache->glyph[g->lru_next].lru_prev = g->lru_prev;
+  else
+    cache->lru_tail = g->lru_prev;
+  /* insert at the head */
+  g->lru_prev = U8G2_GLYPH_CACHE_NONE;
+  g->lru_next = cache->lru_head;
+  cache->glyph[cache->lru_head].lru_prev = i;
+  cache->lru_head = i;
+}
+
+/* remove a slot from the hash chain of its bucket */
+static void u8g2_glyph_cache_unhash(u8g2_glyph_cache_t *cache, uint8_t i)
+{
+  u8g2_cached_glyph_t *g = cache->glyph + i;
+  uint8_t *link = cache->bucket + u8g2_glyph_cache_bucket(g->font, g->encoding);
+
+  while( *link != U8G2_GLYPH_CACHE_NONE )
+  {
+    if ( *link == i )
+    {
+      *link = g->hash_next;
+      break;
+    }
+    link = &(cache->glyph[*link].hash_next);
+  }
+  g->hash_next = U8G2_GLYPH_CACHE_NONE;
+  g->font = NULL;
+}
+
+/*
+  Description:
+    Decode a glyph into a 1 bit per pixel bitmap, MSB first, rows padded to bytes.
+    Same run length decoding as u8g2_font_decode_glyph(), but the runs set bits
+    instead of drawing lines.
+*/
+static void u8g2_font_decode_glyph_bitmap(u8g2_font_t *u8g2, const uint8_t *glyph_data, u8g2_cached_glyph_t *g)
+{
+  uint8_t a, b, i;
+  uint8_t row_bytes;
+  uint16_t pos, total, col;
+  u8g2_font_decode_t *decode = &(u8g2->font_decode);
+
+  u8g2_font_setup_decode(u8g2, glyph_data);
+  g->width = decode->glyph_width;
+  g->height = decode->glyph_height;
+  g->x = u8g2_font_decode_get_signed_bits(decode, u8g2->font_info.bits_per_char_x);
+  g->y = u8g2_font_decode_get_signed_bits(decode, u8g2->font_info.bits_per_char_y);
+  g->delta_x = u8g2_font_decode_get_signed_bits(decode, u8g2->font_info.bits_per_delta_x);
+  g->flags = U8G2_GLYPH_FOUND;
+
+  row_bytes = (g->width + 7) >> 3;
+  if ( g->width == 0 || row_bytes * g->height > U8G2_GLYPH_CACHE_BITMAP )
+    return;     /* nothing to draw or too large, drawn by the decoder */
+
+  memset(g->bitmap, 0, row_bytes * g->height);
+  total = g->width * g->height;
+  pos = 0;
+  col = 0;
+  for(;;)
+  {
+    a = u8g2_font_decode_get_unsigned_bits(decode, u8g2->font_info.bits_per_0);
+    b = u8g2_font_decode_get_unsigned_bits(decode, u8g2->font_info.bits_per_1);
+    do
+    {
+      /* background run */
+      pos += a;
+      col += a;
+      while( col >= g->width )
+        col -= g->width;
+      /* foreground run */
+      for( i = 0; i < b && pos < total; i++ )
+      {
+        g->bitmap[(pos / g->width) * row_bytes + (col >> 3)] |= 0x80 >> (col & 7);
+        pos++;
+        if ( ++col == g->width )
+          col = 0;
+      }
+    } while( u8g2_font_decode_get_unsigned_bits(decode, 1) != 0 );
+
+    if ( pos >= total )
+      break;
+  }
+  g->flags |= U8G2_GLYPH_BITMAP;
+}
+
+/*
+  Description:
+    Find a glyph of the current font in the cache, decode it into the least recently
+    used slot if it is not there.
+  Return:
+    The cached glyph, flags is 0 if the encoding is not in the font.
+    NULL if the cache is disabled.
+*/
+const u8g2_cached_glyph_t *u8g2_GetCachedGlyph(u8g2_font_t *u8g2, uint16_t encoding)
+{
+  u8g2_glyph_cache_t *cache = u8g2->glyph_cache;
+  u8g2_cached_glyph_t *g;
+  const uint8_t *glyph_data;
+  uint8_t bucket, i;
+
+  if ( cache == NULL )
+    return NULL;
+
+  bucket = u8g2_glyph_cache_bucket(u8g2->font, encoding);
+  for( i = cache->bucket[bucket]; i != U8G2_GLYPH_CACHE_NONE; i = cache->glyph[i].hash_next )
+  {
+    g = cache->glyph + i;
+    if ( g->encoding == encoding && g->font == u8g2->font )
+    {
+      cache->hits++;
+      u8g2_glyph_cache_touch(cache, i);
+      return g;
+    }
+  }
+
+  cache->misses++;
+  i = cache->lru_tail;
+  g = cache->glyph + i;
+  if ( g->font != NULL )
+    u8g2_glyph_cache_unhash(cache, i);
+
+  g->flags = 0;
+  g->width = 0;
+  g->height = 0;
+  g->x = 0;
+  g->y = 0;
+  g->delta_x = 0;
+  glyph_data = u8g2_font_get_glyph_data(u8g2, encoding);
+  if ( glyph_data != NULL )
+    u8g2_font_decode_glyph_bitmap(u8g2, glyph_data, g);
+
+  g->font = u8g2->font;
+  g->encoding = encoding;
+  g->hash_next = cache->bucket[bucket];
+  cache->bucket[bucket] = i;
+  u8g2_glyph_cache_touch(cache, i);
+  return g;
+}
+
+/* draw a glyph from the cache, scale is 1 or 2, only for direction 0 */
+static int16_t u8g2_font_cached_draw_glyph(u8g2_font_t *u8g2, int16_t x, int16_t y, uint16_t encoding, uint8_t scale)
+{
+  const u8g2_cached_glyph_t *g = u8g2_GetCachedGlyph(u8g2, encoding);
+  u8g2_font_decode_t *decode = &(u8g2->font_decode);
+
+  if ( g->flags == 0 )
+    return 0;
+  if ( (g->flags & U8G2_GLYPH_BITMAP) == 0 )
+  {
+    if ( g->width == 0 )
+      return g->delta_x * scale;
+    if ( scale == 2 )
+      return u8g2_font_2x_draw_glyph(u8g2, x, y, encoding);
+    return u8g2_font_draw_glyph(u8g2, x, y, encoding);
+  }
+
+  u8g2->tft->drawBitmapBits(x + g->x, y - (scale * g->height + g->y), g->bitmap, g->width, g->height,
+    scale, decode->fg_color, decode->bg_color, decode->is_transparent);
+  return g->delta_x * scale;
+}
+
 int16_t u8g2_DrawGlyph(u8g2_font_t *u8g2, int16_t x, int16_t y, uint16_t encoding)
 {
+  if ( u8g2->glyph_cache != NULL && u8g2->font_decode.dir == 0 )
+    return u8g2_font_cached_draw_glyph(u8g2, x, y, encoding, 1);
   return u8g2_font_draw_glyph(u8g2, x, y, encoding);
 }
 
 int16_t u8g2_DrawGlyphX2(u8g2_font_t *u8g2, int16_t x, int16_t y, uint16_t encoding)
 {
   // y += 2 * u8g2->font_info.descent_g;
+  if ( u8g2->glyph_cache != NULL && u8g2->font_decode.dir == 0 )
+    return u8g2_font_cached_draw_glyph(u8g2, x, y, encoding, 2);
   return u8g2_font_2x_draw_glyph(u8g2, x, y, encoding);
 }
 
@@ -815,11 +1042,137 @@ uint16_t U8g2_for_TFT_eSPI::utf8_next(uint8_t b)
   return encoding;
 }
 
-int16_t U8g2_for_TFT_eSPI::drawUTF8(int16_t x, int16_t y, const char *str)
+/*
+  Find a string in the line cache or decode it into the least recently used line.
+  The width is calculated like getUTF8Width() does it, but from the cached glyphs.
+  Returns NULL if the glyph cache is disabled or if the string can not be cached:
+  too many glyphs, line breaks or an incomplete UTF-8 sequence.
+*/
+const u8g2_cached_line_t *U8g2_for_TFT_eSPI::getCachedLine(const char *str, size_t bytes)
 {
+  u8g2_glyph_cache_t *cache = u8g2.glyph_cache;
+  u8g2_cached_line_t *line, *oldest;
+  const u8g2_cached_glyph_t *g;
+  uint32_t hash = 2166136261UL;
   uint16_t e;
+  uint8_t i, last_width;
+  int8_t last_x, dx;
+  size_t n;
+
+  if ( cache == NULL || bytes > 0x0ffff )
+    return NULL;
+
+  for( n = 0; n < bytes; n++ )
+  {
+    hash ^= (uint8_t)str[n];
+    hash *= 16777619UL;
+  }
+
+  line = NULL;
+  oldest = cache->line;
+  for( i = 0; i < U8G2_LINE_CACHE_LINES; i++ )
+  {
+    if ( cache->line[i].font == u8g2.font && cache->line[i].hash == hash && cache->line[i].bytes == bytes )
+      line = cache->line + i;
+    else if ( cache->line[i].age < 0x0ff )
+      cache->line[i].age++;
+    if ( cache->line[i].age > oldest->age )
+      oldest = cache->line + i;
+  }
+  if ( line != NULL )
+  {
+    line->age = 0;
+    return line;
+  }
+
+  line = oldest;
+  line->font = NULL;
+  line->glyph_cnt = 0;
+  utf8_state = 0;
+  for( n = 0; n < bytes; n++ )
+  {
+    e = utf8_next((uint8_t)str[n]);
+    if ( e == 0x0ffff )
+      break;
+    if ( e == 0x0fffe )
+      continue;
+    if ( e == '\n' || e == '\r' || line->glyph_cnt >= U8G2_LINE_CACHE_GLYPHS )
+    {
+      utf8_state = 0;
+      return NULL;
+    }
+    line->encoding[line->glyph_cnt++] = e;
+  }
+  if ( utf8_state != 0 )
+  {
+    utf8_state = 0;
+    return NULL;
+  }
+
+  /* glyph width and x offset of the last glyph found in the font, see getUTF8Width() */
+  line->width = 0;
+  last_width = 0;
+  last_x = 0;
+  dx = 0;
+  for( i = 0; i < line->glyph_cnt; i++ )
+  {
+    g = u8g2_GetCachedGlyph(&u8g2, line->encoding[i]);
+    dx = g->delta_x;
+    if ( g->flags != 0 )
+    {
+      last_width = g->width;
+      last_x = g->x;
+    }
+    line->width += dx;
+  }
+  if ( last_width != 0 )
+    line->width += last_width + last_x - dx;
+
+  line->font = u8g2.font;
+  line->hash = hash;
+  line->bytes = bytes;
+  line->age = 0;
+  return line;
+}
+
+/* print() a complete string from the line cache, direction 0 only */
+bool U8g2_for_TFT_eSPI::writeCachedLine(const uint8_t *buffer, size_t size)
+{
+  const u8g2_cached_line_t *line;
+  uint16_t i;
+
+  if ( u8g2.glyph_cache == NULL || utf8_state != 0 || u8g2.font_decode.dir != 0 )
+    return false;
+  line = getCachedLine((const char *)buffer, size);
+  if ( line == NULL )
+    return false;
+  for( i = 0; i < line->glyph_cnt; i++ )
+    tx += drawGlyph(tx, ty, line->encoding[i]);
+  return true;
+}
+
+int16_t U8g2_for_TFT_eSPI::drawUTF8(int16_t x, int16_t y, const char *str)
+{
+  const u8g2_cached_line_t *line;
+  uint16_t e, i;
   int16_t delta, sum;
 
+  if ( u8g2.glyph_cache != NULL && u8g2.font_decode.dir == 0 )
+  {
+    line = getCachedLine(str, strlen(str));
+    if ( line != NULL )
+    {
+      sum = 0;
+      for( i = 0; i < line->glyph_cnt; i++ )
+      {
+        delta = drawGlyph(x, y, line->encoding[i]);
+        x += delta;
+        sum += delta;
+      }
+      return sum;
+    }
+  }
+
   utf8_state = 0;
   sum = 0;
   for(;;)
@@ -856,9 +1209,14 @@ int16_t U8g2_for_TFT_eSPI::drawUTF8(int16_t x, int16_t y, const char *str)
 
 int16_t U8g2_for_TFT_eSPI::getUTF8Width(const char *str)
 {
+  const u8g2_cached_line_t *line;
   uint16_t e;
   int16_t dx, w;
   
+  line = getCachedLine(str, strlen(str));
+  if ( line != NULL )
+    return line->width;
+
   u8g2.font_decode.glyph_width = 0;
   utf8_state = 0;
   w = 0;
@@ -105,9 +105,68 @@ struct _u8g2_font_decode_t
 typedef struct _u8g2_font_decode_t u8g2_font_decode_t;
 
 
+/* 
+  Glyph cache: decoded glyphs are kept as 1 bit per pixel bitmaps so that drawing a
+  glyph again is a lookup and a blit into the sprite instead of a glyph data search,
+  a run-length decode and one drawFastHLine() per run. Slots are found in O(1) through
+  a hash of font and encoding and are recycled least recently used first.
+  The line cache keeps the decoded encodings and width of the last few strings.
+*/
+#define U8G2_GLYPH_CACHE_BITMAP 64      /* bytes per glyph bitmap: up to 24x21 or 16x32 pixels */
+#define U8G2_GLYPH_CACHE_BUCKET_BITS 7
+#define U8G2_GLYPH_CACHE_BUCKETS (1 << U8G2_GLYPH_CACHE_BUCKET_BITS)
+#define U8G2_GLYPH_CACHE_NONE 0xff
+#define U8G2_GLYPH_FOUND 1              /* encoding is in the font */
+#define U8G2_GLYPH_BITMAP 2             /* bitmap is valid, otherwise the glyph was too large */
+#define U8G2_LINE_CACHE_LINES 4
+#define U8G2_LINE_CACHE_GLYPHS 128
+
+struct _u8g2_cached_glyph_t
+{
+  const uint8_t *font;
+  uint16_t encoding;
+  uint8_t hash_next;    /* next slot in the same bucket */
+  uint8_t lru_prev;     /* towards most recently used */
+  uint8_t lru_next;     /* towards least recently used */
+  uint8_t flags;        /* U8G2_GLYPH_FOUND, U8G2_GLYPH_BITMAP */
+  uint8_t width;        /* 0 for glyphs without pixels, e.g. space */
+  uint8_t height;
+  int8_t x;             /* glyph offsets and advance as stored in the font */
+  int8_t y;
+  int8_t delta_x;
+  uint8_t bitmap[U8G2_GLYPH_CACHE_BITMAP];
+};
+typedef struct _u8g2_cached_glyph_t u8g2_cached_glyph_t;
+
+struct _u8g2_cached_line_t
+{
+  const uint8_t *font;
+  uint32_t hash;        /* FNV-1a of the UTF-8 bytes */
+  uint16_t bytes;
+  uint16_t glyph_cnt;
+  int16_t width;        /* result of getUTF8Width() */
+  uint8_t age;
+  uint16_t encoding[U8G2_LINE_CACHE_GLYPHS];
+};
+typedef struct _u8g2_cached_line_t u8g2_cached_line_t;
+
+struct _u8g2_glyph_cache_t
+{
+  uint8_t slots;
+  uint8_t lru_head;     /* most recently used */
+  uint8_t lru_tail;     /* least recently used, recycled next */
+  uint8_t bucket[U8G2_GLYPH_CACHE_BUCKETS];
+  uint32_t hits;
+  uint32_t misses;
+  u8g2_cached_line_t line[U8G2_LINE_CACHE_LINES];
+  u8g2_cached_glyph_t glyph[1];   /* "slots" entries are allocated */
+};
+typedef struct _u8g2_glyph_cache_t u8g2_glyph_cache_t;
+
 struct _u8g2_font_t
 {
   TFT_eSprite *tft;
+  u8g2_glyph_cache_t *glyph_cache;  /* NULL: decode every glyph (default) */
   
   /* information about the current font */
   const uint8_t *font;             /* current font for all text procedures */
@@ -136,6 +195,9 @@ void u8g2_SetFont(u8g2_font_t *u8g2, const uint8_t  *font);
 void u8g2_SetForegroundColor(u8g2_font_t *u8g2, uint16_t fg);
 uint16_t u8g2_GetForegroundColor(u8g2_font_t *u8g2);
 void u8g2_SetBackgroundColor(u8g2_font_t *u8g2, uint16_t bg);
+uint8_t u8g2_EnableGlyphCache(u8g2_font_t *u8g2, uint8_t slots);
+void u8g2_DisableGlyphCache(u8g2_font_t *u8g2);
+const u8g2_cached_glyph_t *u8g2_GetCachedGlyph(u8g2_font_t *u8g2, uint16_t encoding);
 
 
 class U8g2_for_TFT_eSPI : public Print {
@@ -152,8 +214,15 @@ class U8g2_for_TFT_eSPI : public Print {
     int16_t getCursorX(void) { return tx; }
     int16_t getCursorY(void) { return ty; }
   
-    U8g2_for_TFT_eSPI(void) {u8g2.font = NULL; u8g2.font_decode.fg_color = 1; u8g2.font_decode.is_transparent = 1; u8g2.font_decode.dir = 0; home(); } 
+    U8g2_for_TFT_eSPI(void) {u8g2.font = NULL; u8g2.glyph_cache = NULL; u8g2.font_decode.fg_color = 1; u8g2.font_decode.is_transparent = 1; u8g2.font_decode.dir = 0; home(); } 
+    ~U8g2_for_TFT_eSPI(void) { u8g2_DisableGlyphCache(&u8g2); }
     void begin(TFT_eSprite &tft) { u8g2.tft = &tft; }
+    bool enableGlyphCache(uint8_t slots = 64)     // keep up to "slots" decoded glyphs, about 80 bytes each plus 1 KB for lines
+      { return u8g2_EnableGlyphCache(&u8g2, slots); }
+    void disableGlyphCache(void)
+      { u8g2_DisableGlyphCache(&u8g2); }
+    void getGlyphCacheStats(uint32_t *hits, uint32_t *misses)
+      { *hits = u8g2.glyph_cache ? u8g2.glyph_cache->hits : 0; *misses = u8g2.glyph_cache ? u8g2.glyph_cache->misses : 0; }
     void setFont(const uint8_t *font)             // set u8g2 font
       { u8g2_SetFont(&u8g2, font); }
     void setFontMode(uint8_t is_transparent)      // is_transparent==0: Background is not drawn
@@ -190,6 +259,8 @@ class U8g2_for_TFT_eSPI : public Print {
     
 
     uint16_t utf8_next(uint8_t b);
+    const u8g2_cached_line_t *getCachedLine(const char *str, size_t bytes);
+    bool writeCachedLine(const uint8_t *buffer, size_t size);
 
     size_t write(uint8_t v) {
       uint16_t e = utf8_next(v);
@@ -227,6 +298,9 @@ class U8g2_for_TFT_eSPI : public Print {
      }
 
     size_t write(const uint8_t *buffer, size_t size) {
+      // whole strings from print() reuse a cached line when possible
+      if ( writeCachedLine(buffer, size) )
+        return size;
       size_t cnt = 0;
       while( size > 0 ) {
           cnt += write(*buffer++); 
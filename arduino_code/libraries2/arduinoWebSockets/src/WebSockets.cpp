@@ -223,6 +223,7 @@ bool WebSockets::sendFrame(WSclient_t * client, WSopcode_t opcode, uint8_t * pay
     uint8_t * payloadPtr = payload;
     bool useInternBuffer = false;
     bool ret             = true;
+    int8_t slot          = -1;
 
     // calculate header Size
     if(length < 126) {
@@ -240,9 +241,9 @@ bool WebSockets::sendFrame(WSclient_t * client, WSopcode_t opcode, uint8_t * pay
 #ifdef WEBSOCKETS_USE_BIG_MEM
     // only for ESP since AVR has less HEAP
     // try to send data in one TCP package (only if some free Heap is there)
-    if(!headerToPayload && ((length > 0) && (length < 1400)) && (GET_FREE_HEAP > 6000)) {
+    if(!headerToPayload && ((length > 0) && (length + WEBSOCKETS_MAX_HEADER_SIZE <= WEBSOCKETS_FRAME_POOL_MAX_SIZE)) && (GET_FREE_HEAP > 6000)) {
         DEBUG_WEBSOCKETS("[WS][%d][sendFrame] pack to one TCP package...\n", client->num);
-        uint8_t * dataPtr = (uint8_t *)malloc(length + WEBSOCKETS_MAX_HEADER_SIZE);
+        uint8_t * dataPtr = frameBufferGet(length + WEBSOCKETS_MAX_HEADER_SIZE, &client->txAllocs, &slot);
         if(dataPtr) {
             memcpy((dataPtr + WEBSOCKETS_MAX_HEADER_SIZE), payload, length);
             headerToPayload = true;
@@ -279,9 +280,7 @@ bool WebSockets::sendFrame(WSclient_t * client, WSopcode_t opcode, uint8_t * pay
             dataMaskPtr = payloadPtr;
         }
 
-        for(size_t x = 0; x < length; x++) {
-            dataMaskPtr[x] = (dataMaskPtr[x] ^ maskKey[x % 4]);
-        }
+        maskPayload(dataMaskPtr, length, maskKey);
     }
 
 #ifndef NODEBUG_WEBSOCKETS
@@ -313,13 +312,182 @@ bool WebSockets::sendFrame(WSclient_t * client, WSopcode_t opcode, uint8_t * pay
 
 #ifdef WEBSOCKETS_USE_BIG_MEM
     if(useInternBuffer && payloadPtr) {
-        free(payloadPtr);
+        frameBufferPut(payloadPtr, slot);
     }
 #endif
 
     return ret;
 }
 
+/**
+ * send one WS frame gathered from several buffers (e.g. a protocol header and the payload)
+ * the parts are copied into a pooled buffer and written with one TCP write,
+ * if the frame does not fit into the pool the parts are written one after the other
+ * @param client WSclient_t *   ptr to the client struct
+ * @param opcode WSopcode_t
+ * @param parts WSbuffer_t *    pieces of the payload, in order
+ * @param count size_t          number of pieces
+ * @param fin bool              can be used to send data in more then one frame (set fin on the last frame)
+ * @return true if ok
+ */
+bool WebSockets::sendFrame(WSclient_t * client, WSopcode_t opcode, const WSbuffer_t * parts, size_t count, bool fin) {
+    if(client->tcp && !client->tcp->connected()) {
+        DEBUG_WEBSOCKETS("[WS][%d][sendFrame] not Connected!?\n", client->num);
+        return false;
+    }
+
+    if(client->status != WSC_CONNECTED) {
+        DEBUG_WEBSOCKETS("[WS][%d][sendFrame] not in WSC_CONNECTED state!?\n", client->num);
+        return false;
+    }
+
+    size_t length = 0;
+    for(size_t i = 0; i < count; i++) {
+        length += parts[i].length;
+    }
+
+    uint8_t * buffer = NULL;
+    int8_t slot      = -1;
+    if(length + WEBSOCKETS_MAX_HEADER_SIZE <= WEBSOCKETS_FRAME_POOL_MAX_SIZE) {
+        buffer = frameBufferGet(length + WEBSOCKETS_MAX_HEADER_SIZE, &client->txAllocs, &slot);
+    }
+
+    if(!buffer) {
+        // unmasked (zero mask key), the parts can be sent from where they are
+        if(!sendFrameHeader(client, opcode, length, fin)) {
+            return false;
+        }
+        for(size_t i = 0; i < count; i++) {
+            if(parts[i].length && write(client, (uint8_t *)parts[i].data, parts[i].length) != parts[i].length) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    uint8_t * dataPtr = buffer + WEBSOCKETS_MAX_HEADER_SIZE;
+    for(size_t i = 0; i < count; i++) {
+        memcpy(dataPtr, parts[i].data, parts[i].length);
+        dataPtr += parts[i].length;
+    }
+
+    bool ret = sendFrame(client, opcode, buffer, length, fin, true);
+    frameBufferPut(buffer, slot);
+    return ret;
+}
+
+/**
+ * XOR the payload with the mask key, 32 bit at a time
+ * @param data uint8_t *        data to (un)mask in place
+ * @param length size_t
+ * @param maskKey uint8_t *     4 byte key
+ * @param offset size_t         position of data[0] in the frame payload (selects the key byte)
+ */
+void WebSockets::maskPayload(uint8_t * data, size_t length, const uint8_t * maskKey, size_t offset) {
+    typedef uint32_t __attribute__((__may_alias__)) word_t;
+
+    // bytes up to the first 32 bit boundary
+    while(length && ((uintptr_t)data & 3)) {
+        *data++ ^= maskKey[offset++ & 3];
+        length--;
+    }
+
+    if(length >= 4) {
+        // key rotated to the aligned position, the XOR is the same for every word
+        uint8_t key[4] = { maskKey[offset & 3], maskKey[(offset + 1) & 3], maskKey[(offset + 2) & 3], maskKey[(offset + 3) & 3] };
+        word_t k;
+        memcpy(&k, key, sizeof(k));
+
+        word_t * w   = (word_t *)data;
+        size_t words = length / 4;
+        for(; words >= 4; words -= 4, w += 4) {
+            w[0] ^= k;
+            w[1] ^= k;
+            w[2] ^= k;
+            w[3] ^= k;
+        }
+        while(words--) {
+            *w++ ^= k;
+        }
+
+        size_t done = length & ~(size_t)3;
+        data += done;
+        offset += done;
+        length -= done;
+    }
+
+    while(length--) {
+        *data++ ^= maskKey[offset++ & 3];
+    }
+}
+
+/**
+ * take a buffer of at least size bytes from the frame pool
+ * a free pool buffer that is too small grows to size (at most WEBSOCKETS_FRAME_POOL_MAX_SIZE),
+ * so after the first frames of each size the pool serves all frames without touching the heap
+ * @param size size_t
+ * @param allocs uint32_t *     counter incremented for every heap allocation
+ * @param slot int8_t *         set to the pool index of the buffer, -1 if it came from the heap
+ * @return buffer or NULL, give it back with frameBufferPut(buffer, slot)
+ */
+uint8_t * WebSockets::frameBufferGet(size_t size, uint32_t * allocs, int8_t * slot) {
+    *slot = -1;
+    if(size <= WEBSOCKETS_FRAME_POOL_MAX_SIZE) {
+        // a free buffer that is already big enough
+        for(uint8_t i = 0; i < WEBSOCKETS_FRAME_POOL_SIZE; i++) {
+            WSframeBuffer_t * fb = &_framePool[i];
+            if(fb->size >= size && !__atomic_test_and_set(&fb->used, __ATOMIC_ACQUIRE)) {
+                if(fb->size >= size) {
+                    *slot = i;
+                    return fb->data;
+                }
+                __atomic_clear(&fb->used, __ATOMIC_RELEASE);
+            }
+        }
+        // grow a free one, rounded up so small differences in the frame size do not reallocate again
+        for(uint8_t i = 0; i < WEBSOCKETS_FRAME_POOL_SIZE; i++) {
+            WSframeBuffer_t * fb = &_framePool[i];
+            if(!__atomic_test_and_set(&fb->used, __ATOMIC_ACQUIRE)) {
+                size_t newSize = (size + 63) & ~(size_t)63;
+                if(newSize > WEBSOCKETS_FRAME_POOL_MAX_SIZE) {
+                    newSize = WEBSOCKETS_FRAME_POOL_MAX_SIZE;
+                }
+                free(fb->data);
+                fb->data = (uint8_t *)malloc(newSize);
+                fb->size = fb->data ? newSize : 0;
+                (*allocs)++;
+                if(fb->data) {
+                    *slot = i;
+                    return fb->data;
+                }
+                __atomic_clear(&fb->used, __ATOMIC_RELEASE);
+                return NULL;
+            }
+        }
+        DEBUG_WEBSOCKETS("[WS][frameBufferGet] pool exhausted, using heap (%u)\n", size);
+    }
+
+    (*allocs)++;
+    return (uint8_t *)malloc(size);
+}
+
+/**
+ * give a buffer from frameBufferGet() back
+ * released by the slot index, the pool buffer may have been regrown by the time a pointer would be compared
+ * @param buffer uint8_t *
+ * @param slot int8_t           pool index from frameBufferGet(), -1 frees a heap buffer
+ */
+void WebSockets::frameBufferPut(uint8_t * buffer, int8_t slot) {
+    if(!buffer) {
+        return;
+    }
+    if(slot >= 0 && slot < WEBSOCKETS_FRAME_POOL_SIZE) {
+        __atomic_clear(&_framePool[slot].used, __ATOMIC_RELEASE);
+        return;
+    }
+    free(buffer);
+}
+
 /**
  * callen when HTTP header is done
  * @param client WSclient_t *  ptr to the client struct
@@ -339,6 +507,12 @@ void WebSockets::headerDone(WSclient_t * client) {
  * @param client WSclient_t *  ptr to the client struct
  */
 void WebSockets::handleWebsocket(WSclient_t * client) {
+#if(WEBSOCKETS_NETWORK_TYPE != NETWORK_ESP8266_ASYNC)
+    if(client->cStreaming) {
+        handleWebsocketStream(client);
+        return;
+    }
+#endif
     if(client->cWsRXsize == 0) {
         handleWebsocketCb(client);
     }
@@ -435,12 +609,6 @@ void WebSockets::handleWebsocketCb(WSclient_t * client) {
     DEBUG_WEBSOCKETS("[WS][%d][handleWebsocket] fin: %u rsv1: %u rsv2: %u rsv3 %u  opCode: %u\n", client->num, header->fin, header->rsv1, header->rsv2, header->rsv3, header->opCode);
     DEBUG_WEBSOCKETS("[WS][%d][handleWebsocket] mask: %u payloadLen: %u\n", client->num, header->mask, header->payloadLen);
 
-    if(header->payloadLen > WEBSOCKETS_MAX_DATA_SIZE) {
-        DEBUG_WEBSOCKETS("[WS][%d][handleWebsocket] payload too big! (%u)\n", client->num, header->payloadLen);
-        clientDisconnect(client, 1009);
-        return;
-    }
-
     if(header->mask) {
         headerLen += 4;
         if(!handleWebsocketWaitFor(client, headerLen)) {
@@ -450,22 +618,53 @@ void WebSockets::handleWebsocketCb(WSclient_t * client) {
         buffer += 4;
     }
 
+#if(WEBSOCKETS_NETWORK_TYPE != NETWORK_ESP8266_ASYNC)
+    if((header->opCode == WSop_text || header->opCode == WSop_binary || header->opCode == WSop_continuation) && streamFrame(client, header->opCode)) {
+        // no reassembly, so no WEBSOCKETS_MAX_DATA_SIZE limit
+        if(header->opCode != WSop_continuation) {
+            client->cStreamOpcode = header->opCode;
+            client->cStreamOffset = 0;
+        }
+        if(header->mask) {
+            memcpy(client->cStreamMask, header->maskKey, 4);
+        }
+        client->cStreamRemaining = header->payloadLen;
+        client->cStreamFramePos  = 0;
+        client->cStreamPos       = 0;
+        client->cStreamLen       = 0;
+        client->cStreaming       = true;
+        handleWebsocketStream(client);
+        return;
+    }
+    if(header->opCode == WSop_text || header->opCode == WSop_binary) {
+        // message is reassembled, so are its continuation frames
+        client->cStreamOpcode = WSop_continuation;
+    }
+#endif
+
+    if(header->payloadLen > WEBSOCKETS_MAX_DATA_SIZE) {
+        DEBUG_WEBSOCKETS("[WS][%d][handleWebsocket] payload too big! (%u)\n", client->num, header->payloadLen);
+        clientDisconnect(client, 1009);
+        return;
+    }
+
     if(header->payloadLen > 0) {
         // if text data we need one more
-        payload = (uint8_t *)malloc(header->payloadLen + 1);
+        int8_t slot;
+        payload = frameBufferGet(header->payloadLen + 1, &client->rxAllocs, &slot);
 
         if(!payload) {
             DEBUG_WEBSOCKETS("[WS][%d][handleWebsocket] to less memory to handle payload %d!\n", client->num, header->payloadLen);
             clientDisconnect(client, 1011);
             return;
         }
-        readCb(client, payload, header->payloadLen, std::bind(&WebSockets::handleWebsocketPayloadCb, this, std::placeholders::_1, std::placeholders::_2, payload));
+        readCb(client, payload, header->payloadLen, std::bind(&WebSockets::handleWebsocketPayloadCb, this, std::placeholders::_1, std::placeholders::_2, payload, slot));
     } else {
-        handleWebsocketPayloadCb(client, true, NULL);
+        handleWebsocketPayloadCb(client, true, NULL, -1);
     }
 }
 
-void WebSockets::handleWebsocketPayloadCb(WSclient_t * client, bool ok, uint8_t * payload) {
+void WebSockets::handleWebsocketPayloadCb(WSclient_t * client, bool ok, uint8_t * payload, int8_t slot) {
     WSMessageHeader_t * header = &client->cWsHeaderDecode;
     if(ok) {
         if(header->payloadLen > 0) {
@@ -473,9 +672,7 @@ void WebSockets::handleWebsocketPayloadCb(WSclient_t * client, bool ok, uint8_t
 
             if(header->mask) {
                 // decode XOR
-                for(size_t i = 0; i < header->payloadLen; i++) {
-                    payload[i] = (payload[i] ^ header->maskKey[i % 4]);
-                }
+                maskPayload(payload, header->payloadLen, header->maskKey);
             }
         }
 
@@ -519,9 +716,7 @@ void WebSockets::handleWebsocketPayloadCb(WSclient_t * client, bool ok, uint8_t
                 break;
         }
 
-        if(payload) {
-            free(payload);
-        }
+        frameBufferPut(payload, slot);
 
         // reset input
         client->cWsRXsize = 0;
@@ -532,11 +727,100 @@ void WebSockets::handleWebsocketPayloadCb(WSclient_t * client, bool ok, uint8_t
 
     } else {
         DEBUG_WEBSOCKETS("[WS][%d][handleWebsocket] missing data!\n", client->num);
-        free(payload);
+        frameBufferPut(payload, slot);
         clientDisconnect(client, 1002);
     }
 }
 
+#if(WEBSOCKETS_NETWORK_TYPE != NETWORK_ESP8266_ASYNC)
+/**
+ * deliver the payload of a streamed data frame with frameChunkReceived() as it arrives
+ * never waits: returns when the TCP buffer is empty or the consumer took less than offered,
+ * loop() calls it again until the frame is done. While the consumer is full nothing more is read,
+ * so the TCP window closes and the server is throttled. At most WEBSOCKETS_STREAM_CHUNK_SIZE bytes are buffered.
+ * @param client WSclient_t *  ptr to the client struct
+ */
+void WebSockets::handleWebsocketStream(WSclient_t * client) {
+    WSMessageHeader_t * header = &client->cWsHeaderDecode;
+
+    if(!_streamBuffer) {
+        _streamBuffer = (uint8_t *)malloc(WEBSOCKETS_STREAM_CHUNK_SIZE);
+        client->rxAllocs++;
+        if(!_streamBuffer) {
+            DEBUG_WEBSOCKETS("[WS][%d][handleWebsocketStream] to less memory for the stream buffer!\n", client->num);
+            client->cStreaming = false;
+            clientDisconnect(client, 1011);
+            return;
+        }
+    }
+
+    while(true) {
+        // hand over what is buffered
+        bool frameRead = (client->cStreamRemaining == 0);
+        while(client->cStreamPos < client->cStreamLen || (frameRead && client->cStreamFramePos == 0)) {
+            size_t len  = client->cStreamLen - client->cStreamPos;
+            size_t used = frameChunkReceived(client, client->cStreamOpcode, client->cStreamOffset, &_streamBuffer[client->cStreamPos], len, header->fin && frameRead);
+            if(len == 0) {
+                // empty frame, only the final flag to deliver
+                break;
+            }
+            if(used > len) {
+                used = len;
+            }
+            client->cStreamPos += used;
+            client->cStreamOffset += used;
+            if(used < len) {
+                // consumer is full, keep the rest and stop reading
+                return;
+            }
+        }
+
+        if(frameRead) {
+            if(header->fin) {
+                client->cStreamOpcode = WSop_continuation;
+            }
+            client->cStreaming = false;
+            // reset input
+            client->cWsRXsize = 0;
+            return;
+        }
+
+        if(!client->tcp || !client->tcp->connected()) {
+            DEBUG_WEBSOCKETS("[WS][%d][handleWebsocketStream] not connected!\n", client->num);
+            client->cStreaming = false;
+            client->cWsRXsize  = 0;
+            clientDisconnect(client, 1002);
+            return;
+        }
+
+        size_t n = client->tcp->available();
+        if(!n) {
+            return;
+        }
+        if(n > client->cStreamRemaining) {
+            n = client->cStreamRemaining;
+        }
+        if(n > WEBSOCKETS_STREAM_CHUNK_SIZE) {
+            n = WEBSOCKETS_STREAM_CHUNK_SIZE;
+        }
+
+        int len = client->tcp->read(_streamBuffer, n);
+        if(len <= 0) {
+            return;
+        }
+
+        if(header->mask) {
+            maskPayload(_streamBuffer, len, client->cStreamMask, client->cStreamFramePos);
+        }
+
+        client->cStreamPos = 0;
+        client->cStreamLen = len;
+        client->cStreamFramePos += len;
+        client->cStreamRemaining -= len;
+    }
+}
+#endif
+
 /**
  * generate the key for Sec-WebSocket-Accept
  * @param clientKey String
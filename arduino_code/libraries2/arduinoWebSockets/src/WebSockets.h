@@ -118,6 +118,26 @@
 // max size of the WS Message Header
 #define WEBSOCKETS_MAX_HEADER_SIZE (14)
 
+// buffer of the streaming receive, bytes not yet taken by the consumer wait here (see WebSocketsClient::onFrameChunk)
+#ifndef WEBSOCKETS_STREAM_CHUNK_SIZE
+#define WEBSOCKETS_STREAM_CHUNK_SIZE (1024)
+#endif
+
+// number of frame buffers reused by send and receive instead of a malloc/free per frame
+// (receive, send, and the pong answered while a received ping is still held)
+#ifndef WEBSOCKETS_FRAME_POOL_SIZE
+#define WEBSOCKETS_FRAME_POOL_SIZE (3)
+#endif
+
+// largest buffer kept in the pool, bigger frames are malloc'd and freed as before
+#ifndef WEBSOCKETS_FRAME_POOL_MAX_SIZE
+#ifdef WEBSOCKETS_USE_BIG_MEM
+#define WEBSOCKETS_FRAME_POOL_MAX_SIZE (4096 + WEBSOCKETS_MAX_HEADER_SIZE)
+#else
+#define WEBSOCKETS_FRAME_POOL_MAX_SIZE (128 + WEBSOCKETS_MAX_HEADER_SIZE)
+#endif
+#endif
+
 #if !defined(WEBSOCKETS_NETWORK_TYPE)
 // select Network type based
 #if defined(ESP8266) || defined(ESP31B)
@@ -285,6 +305,12 @@ typedef struct {
     uint8_t * maskKey;
 } WSMessageHeader_t;
 
+/// one piece of a scatter-gather send (see sendFrame with WSbuffer_t)
+typedef struct {
+    const uint8_t * data;
+    size_t length;
+} WSbuffer_t;
+
 typedef struct {
     void init(uint8_t num,
         uint32_t pingInterval,
@@ -342,6 +368,18 @@ typedef struct {
     uint8_t disconnectTimeoutCount = 0;    // after how many subsequent pong timeouts discconnect will happen, 0 means "do not disconnect"
     uint8_t pongTimeoutCount       = 0;    // current pong timeout count
 
+    uint32_t rxAllocs = 0;    ///< heap allocations made by the receive path (statistics)
+    uint32_t txAllocs = 0;    ///< heap allocations made by the send path (statistics)
+
+    bool cStreaming         = false;                ///< a data frame is being delivered with frameChunkReceived()
+    WSopcode_t cStreamOpcode = WSop_continuation;    ///< opcode of the message the frame belongs to
+    size_t cStreamOffset    = 0;                    ///< position of the next byte in the message
+    size_t cStreamRemaining = 0;                    ///< payload bytes of the frame not yet read from tcp
+    size_t cStreamFramePos  = 0;                    ///< payload bytes of the frame read so far (selects the mask byte)
+    uint16_t cStreamPos     = 0;                    ///< first byte in the stream buffer not taken by the consumer
+    uint16_t cStreamLen     = 0;                    ///< bytes in the stream buffer
+    uint8_t cStreamMask[4];
+
 #if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266_ASYNC)
     String cHttpLine;    ///< HTTP header lines
 #endif
@@ -349,6 +387,14 @@ typedef struct {
 } WSclient_t;
 
 class WebSockets {
+  public:
+    virtual ~WebSockets() {
+        free(_streamBuffer);
+        for(uint8_t i = 0; i < WEBSOCKETS_FRAME_POOL_SIZE; i++) {
+            free(_framePool[i].data);
+        }
+    }
+
   protected:
 #ifdef __AVR__
     typedef void (*WSreadWaitCb)(WSclient_t * client, bool ok);
@@ -363,9 +409,26 @@ class WebSockets {
 
     virtual void messageReceived(WSclient_t * client, WSopcode_t opcode, uint8_t * payload, size_t length, bool fin) = 0;
 
+    // streaming receive of data frames, payload is handed over in pieces as it arrives instead of one malloc'd buffer
+    // frameChunkReceived returns the bytes taken, the rest is offered again on the next loop()
+    virtual bool streamFrame(WSclient_t * client, WSopcode_t opcode) {
+        (void)client, (void)opcode;
+        return false;
+    }
+    virtual size_t frameChunkReceived(WSclient_t * client, WSopcode_t opcode, size_t offset, uint8_t * payload, size_t length, bool fin) {
+        (void)client, (void)opcode, (void)offset, (void)payload, (void)fin;
+        return length;
+    }
+
     uint8_t createHeader(uint8_t * buf, WSopcode_t opcode, size_t length, bool mask, uint8_t maskKey[4], bool fin);
     bool sendFrameHeader(WSclient_t * client, WSopcode_t opcode, size_t length = 0, bool fin = true);
     bool sendFrame(WSclient_t * client, WSopcode_t opcode, uint8_t * payload = NULL, size_t length = 0, bool fin = true, bool headerToPayload = false);
+    bool sendFrame(WSclient_t * client, WSopcode_t opcode, const WSbuffer_t * parts, size_t count, bool fin = true);
+
+    static void maskPayload(uint8_t * data, size_t length, const uint8_t * maskKey, size_t offset = 0);
+
+    uint8_t * frameBufferGet(size_t size, uint32_t * allocs, int8_t * slot);
+    void frameBufferPut(uint8_t * buffer, int8_t slot);
 
     void headerDone(WSclient_t * client);
 
@@ -373,7 +436,10 @@ class WebSockets {
 
     bool handleWebsocketWaitFor(WSclient_t * client, size_t size);
     void handleWebsocketCb(WSclient_t * client);
-    void handleWebsocketPayloadCb(WSclient_t * client, bool ok, uint8_t * payload);
+    void handleWebsocketPayloadCb(WSclient_t * client, bool ok, uint8_t * payload, int8_t slot);
+#if(WEBSOCKETS_NETWORK_TYPE != NETWORK_ESP8266_ASYNC)
+    void handleWebsocketStream(WSclient_t * client);
+#endif
 
     String acceptKey(String & clientKey);
     String base64_encode(uint8_t * data, size_t length);
@@ -384,6 +450,17 @@ class WebSockets {
 
     void enableHeartbeat(WSclient_t * client, uint32_t pingInterval, uint32_t pongTimeout, uint8_t disconnectTimeoutCount);
     void handleHBTimeout(WSclient_t * client);
+
+    uint8_t * _streamBuffer = NULL;    ///< WEBSOCKETS_STREAM_CHUNK_SIZE, allocated once on the first streamed frame
+
+  private:
+    typedef struct {
+        uint8_t * data = NULL;
+        size_t size    = 0;        ///< grows to the largest frame seen, up to WEBSOCKETS_FRAME_POOL_MAX_SIZE
+        bool used      = false;    ///< claimed with an atomic test-and-set, send and receive may run in different tasks
+    } WSframeBuffer_t;
+
+    WSframeBuffer_t _framePool[WEBSOCKETS_FRAME_POOL_SIZE];
 };
 
 #ifndef UNUSED
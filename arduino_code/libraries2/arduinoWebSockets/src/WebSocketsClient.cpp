@@ -27,6 +27,8 @@
 
 WebSocketsClient::WebSocketsClient() {
     _cbEvent             = NULL;
+    _cbFrameChunk        = NULL;
+    _frameChunkBinaryOnly = false;
     _client.num          = 0;
     _client.cIsClient    = true;
     _client.extraHeaders = WEBSOCKETS_STRING("Origin: file://");
@@ -292,6 +294,23 @@ void WebSocketsClient::onEvent(WebSocketClientEvent cbEvent) {
     _cbEvent = cbEvent;
 }
 
+/**
+ * set callback function for streamed messages
+ * once set, text and binary messages (also fragmented ones) no longer reach onEvent, the payload arrives
+ * in pieces of up to WEBSOCKETS_STREAM_CHUNK_SIZE bytes as soon as it is received:
+ *   opcode   WSop_text or WSop_binary (of the whole message)
+ *   offset   position of payload[0] in the message
+ *   isFinal  true on the last piece of the message
+ * the callback returns how many bytes it took, if that is less than length it is called again with the rest
+ * on a later loop() and no more data is read from the socket meanwhile (backpressure to the server)
+ * @param cbChunk WebSocketClientFrameChunk
+ * @param binaryOnly bool   text messages are still reassembled and delivered to onEvent
+ */
+void WebSocketsClient::onFrameChunk(WebSocketClientFrameChunk cbChunk, bool binaryOnly) {
+    _cbFrameChunk         = cbChunk;
+    _frameChunkBinaryOnly = binaryOnly;
+}
+
 /**
  * send text data to client
  * @param num uint8_t client id
@@ -351,6 +370,19 @@ bool WebSocketsClient::sendBIN(const uint8_t * payload, size_t length) {
     return sendBIN((uint8_t *)payload, length);
 }
 
+/**
+ * send binary data gathered from several buffers as one frame
+ * @param parts WSbuffer_t *    e.g. { { header, headerLen }, { samples, samplesLen } }
+ * @param count size_t
+ * @return true if ok
+ */
+bool WebSocketsClient::sendBIN(const WSbuffer_t * parts, size_t count) {
+    if(clientIsConnected(&_client)) {
+        return sendFrame(&_client, WSop_binary, parts, count);
+    }
+    return false;
+}
+
 /**
  * sends a WS ping to Server
  * @param payload uint8_t *
@@ -511,6 +543,8 @@ void WebSocketsClient::clientDisconnect(WSclient_t * client) {
     client->cIsUpgrade   = false;
     client->cIsWebsocket = false;
     client->cSessionId   = "";
+    client->cWsRXsize    = 0;
+    client->cStreaming   = false;
 
     client->status      = WSC_NOT_CONNECTED;
     _lastConnectionFail = millis();
@@ -564,7 +598,7 @@ void WebSocketsClient::handleClientData(void) {
     }
 
     int len = _client.tcp->available();
-    if(len > 0) {
+    if(len > 0 || _client.cStreaming) {
         switch(_client.status) {
             case WSC_HEADER: {
                 String headerLine = _client.tcp->readStringUntil('\n');
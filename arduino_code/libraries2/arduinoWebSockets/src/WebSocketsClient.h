@@ -31,8 +31,10 @@ class WebSocketsClient : protected WebSockets {
   public:
 #ifdef __AVR__
     typedef void (*WebSocketClientEvent)(WStype_t type, uint8_t * payload, size_t length);
+    typedef size_t (*WebSocketClientFrameChunk)(WSopcode_t opcode, size_t offset, uint8_t * payload, size_t length, bool isFinal);
 #else
     typedef std::function<void(WStype_t type, uint8_t * payload, size_t length)> WebSocketClientEvent;
+    typedef std::function<size_t(WSopcode_t opcode, size_t offset, uint8_t * payload, size_t length, bool isFinal)> WebSocketClientFrameChunk;
 #endif
 
     WebSocketsClient(void);
@@ -76,6 +78,7 @@ class WebSocketsClient : protected WebSockets {
 #endif
 
     void onEvent(WebSocketClientEvent cbEvent);
+    void onFrameChunk(WebSocketClientFrameChunk cbChunk, bool binaryOnly = false);
 
     bool sendTXT(uint8_t * payload, size_t length = 0, bool headerToPayload = false);
     bool sendTXT(const uint8_t * payload, size_t length = 0);
@@ -86,6 +89,7 @@ class WebSocketsClient : protected WebSockets {
 
     bool sendBIN(uint8_t * payload, size_t length, bool headerToPayload = false);
     bool sendBIN(const uint8_t * payload, size_t length);
+    bool sendBIN(const WSbuffer_t * parts, size_t count);
 
     bool sendPing(uint8_t * payload = NULL, size_t length = 0);
     bool sendPing(String & payload);
@@ -104,6 +108,13 @@ class WebSocketsClient : protected WebSockets {
 
     bool isConnected(void);
 
+    uint32_t getRxAllocCount(void) {
+        return _client.rxAllocs;
+    }
+    uint32_t getTxAllocCount(void) {
+        return _client.txAllocs;
+    }
+
   protected:
     String _host;
     uint16_t _port;
@@ -127,6 +138,8 @@ class WebSocketsClient : protected WebSockets {
     WSclient_t _client;
 
     WebSocketClientEvent _cbEvent;
+    WebSocketClientFrameChunk _cbFrameChunk;
+    bool _frameChunkBinaryOnly;
 
     unsigned long _lastConnectionFail;
     unsigned long _reconnectInterval;
@@ -134,6 +147,21 @@ class WebSocketsClient : protected WebSockets {
 
     void messageReceived(WSclient_t * client, WSopcode_t opcode, uint8_t * payload, size_t length, bool fin);
 
+    bool streamFrame(WSclient_t * client, WSopcode_t opcode) {
+        if(!_cbFrameChunk) {
+            return false;
+        }
+        if(opcode == WSop_continuation) {
+            // only if the start of the message was streamed
+            return client->cStreamOpcode != WSop_continuation;
+        }
+        return !_frameChunkBinaryOnly || opcode == WSop_binary;
+    }
+    size_t frameChunkReceived(WSclient_t * client, WSopcode_t opcode, size_t offset, uint8_t * payload, size_t length, bool fin) {
+        UNUSED(client);
+        return _cbFrameChunk(opcode, offset, payload, length, fin);
+    }
+
     void clientDisconnect(WSclient_t * client);
     bool clientIsConnected(WSclient_t * client);
 
@@ -0,0 +1,427 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025-至今 小明IO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author 小明IO
+ * @email  1746809408@qq.com
+ * @github https://github.com/wangzongming/esp-ai
+ * @websit https://espai.fun
+ */
+#include "echo_canceller.h"
+#include "../dsp/fft_int.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define AEC_FAR_FLOOR 1.0e4f            // 参考信号均方值，约 -50 dBFS，低于这个认为没有播放
+#define AEC_DELTA (AEC_FFT_LEN * 1000.0f) // 归一化的正则项，约 -60 dBFS 的白噪声
+#define AEC_DT_COHERENCE 0.6f           // 麦克风和回声估计的平均相干性低于这个算双讲
+#define AEC_DT_RATIO 4.0f               // 并且误差比底噪高 6 dB 以上
+#define AEC_COH_LO 4                    // 相干性取 250 Hz ~ 6 kHz 的平均
+#define AEC_COH_HI 96
+#define AEC_DT_HANGOVER 6               // 块，双讲结束后继续冻结自适应
+#define AEC_WARMUP_BLOCKS 125           // 远端播放 1 秒以内滤波器还没收敛，不做双讲检测
+
+// 实数序列（AEC_FFT_LEN 个）的前 AEC_BINS 个频点：块浮点转成 32 位定点做 FFT，再按指数还原
+static void forward(const float *x, float *re_out, float *im_out)
+{
+    int32_t re[AEC_FFT_LEN];
+    int32_t im[AEC_FFT_LEN];
+    float peak = 0.0f;
+    for (int i = 0; i < AEC_FFT_LEN; i++)
+    {
+        float a = fabsf(x[i]);
+        peak = a > peak ? a : peak;
+    }
+    if (peak < 1e-6f)
+    {
+        memset(re_out, 0, AEC_BINS * sizeof(float));
+        memset(im_out, 0, AEC_BINS * sizeof(float));
+        return;
+    }
+    // 峰值归一化到 [2^19, 2^20)，256 点 FFT 的输出在 2^29 以内
+    int e;
+    frexpf(peak, &e);
+    int shift = 20 - e;
+    for (int i = 0; i < AEC_FFT_LEN; i++)
+    {
+        re[i] = (int32_t)lrintf(ldexpf(x[i], shift));
+        im[i] = 0;
+    }
+    fft_int(re, im, AEC_FFT_BITS);
+    float k = ldexpf(1.0f, -shift);
+    for (int i = 0; i < AEC_BINS; i++)
+    {
+        re_out[i] = re[i] * k;
+        im_out[i] = im[i] * k;
+    }
+}
+
+// 共轭对称的频谱（前 AEC_BINS 个点）-> 实数序列
+static void inverse(const float *re_in, const float *im_in, float *out)
+{
+    int32_t re[AEC_FFT_LEN];
+    int32_t im[AEC_FFT_LEN];
+    float peak = 0.0f;
+    for (int i = 0; i < AEC_BINS; i++)
+    {
+        float a = fabsf(re_in[i]);
+        float b = fabsf(im_in[i]);
+        peak = a > peak ? a : peak;
+        peak = b > peak ? b : peak;
+    }
+    if (peak < 1e-6f)
+    {
+        memset(out, 0, AEC_FFT_LEN * sizeof(float));
+        return;
+    }
+    int e;
+    frexpf(peak, &e);
+    int shift = 20 - e;
+    for (int i = 0; i < AEC_BINS; i++)
+    {
+        re[i] = (int32_t)lrintf(ldexpf(re_in[i], shift));
+        im[i] = (int32_t)lrintf(ldexpf(im_in[i], shift));
+    }
+    im[0] = 0;
+    im[AEC_FFT_LEN / 2] = 0;
+    for (int i = 1; i < AEC_FFT_LEN / 2; i++)
+    {
+        re[AEC_FFT_LEN - i] = re[i];
+        im[AEC_FFT_LEN - i] = -im[i];
+    }
+    fft_int(re, im, AEC_FFT_BITS, true);
+    float k = ldexpf(1.0f, -shift) / AEC_FFT_LEN;
+    for (int i = 0; i < AEC_FFT_LEN; i++)
+    {
+        out[i] = re[i] * k;
+    }
+}
+
+static inline int16_t to_pcm(float v)
+{
+    return v >= 32767.0f ? 32767 : v <= -32768.0f ? -32768 : (int16_t)lrintf(v);
+}
+
+bool EchoCanceller::begin(now_us_t now_us)
+{
+    this->now_us = now_us;
+    if (w_re == nullptr)
+    {
+        size_t n = AEC_PARTITIONS * AEC_BINS;
+        float *mem = (float *)malloc(4 * n * sizeof(float));
+        if (mem == nullptr)
+        {
+            return false;
+        }
+        w_re = mem;
+        w_im = mem + n;
+        x_re = mem + 2 * n;
+        x_im = mem + 3 * n;
+    }
+    for (int i = 0; i < AEC_FFT_LEN; i++)
+    {
+        win[i] = sqrtf(0.5f - 0.5f * cosf(2.0f * (float)M_PI * i / AEC_FFT_LEN));
+    }
+    clearStats();
+    reset();
+    return true;
+}
+
+void EchoCanceller::end()
+{
+    free(w_re);
+    w_re = w_im = x_re = x_im = nullptr;
+}
+
+void EchoCanceller::reset()
+{
+    if (w_re != nullptr)
+    {
+        memset(w_re, 0, 4 * AEC_PARTITIONS * AEC_BINS * sizeof(float));
+    }
+    x_head = 0;
+    constrain_next = 0;
+    memset(ref_prev, 0, sizeof(ref_prev));
+    memset(sxx, 0, sizeof(sxx));
+    memset(e_prev, 0, sizeof(e_prev));
+    memset(y_prev, 0, sizeof(y_prev));
+    memset(see, 0, sizeof(see));
+    memset(syy, 0, sizeof(syy));
+    memset(overlap, 0, sizeof(overlap));
+    memset(sdd, 0, sizeof(sdd));
+    memset(sdy_re, 0, sizeof(sdy_re));
+    memset(sdy_im, 0, sizeof(sdy_im));
+    memset(syy_coh, 0, sizeof(syy_coh));
+    coherence = 1.0f;
+    memset(px_hist, 0, sizeof(px_hist));
+    leak = 1.0f;
+    noise = 0.0f;
+    pe_avg = 0.0f;
+    py_avg = 0.0f;
+    warmup = 0;
+    far_active = false;
+    double_talk = false;
+    hangover = 0;
+    barge_count = 0;
+}
+
+void EchoCanceller::clearStats()
+{
+    memset(&st, 0, sizeof(st));
+}
+
+void EchoCanceller::process(const int16_t *mic, const int16_t *ref, int16_t *out)
+{
+    uint32_t t0 = now_us ? now_us() : 0;
+    float buf[AEC_FFT_LEN];
+
+    // 参考信号频谱（重叠保留：上一块 + 这一块）
+    float px = 0.0f;
+    for (int i = 0; i < AEC_BLOCK; i++)
+    {
+        buf[i] = ref_prev[i];
+        buf[AEC_BLOCK + i] = ref[i];
+        px += (float)ref[i] * ref[i];
+    }
+    memcpy(ref_prev, ref, sizeof(ref_prev));
+    x_head = (x_head + AEC_PARTITIONS - 1) % AEC_PARTITIONS;
+    forward(buf, x_re + x_head * AEC_BINS, x_im + x_head * AEC_BINS);
+    memmove(px_hist + 1, px_hist, (AEC_PARTITIONS - 1) * sizeof(float));
+    px_hist[0] = px / AEC_BLOCK;
+    float px_mean = 0.0f;
+    for (int p = 0; p < AEC_PARTITIONS; p++)
+    {
+        px_mean += px_hist[p];
+    }
+    px_mean /= AEC_PARTITIONS;
+    // 归一化用的参考功率：上升快、下降慢，声音突然变大时步长不会过大
+    const float *x0r = x_re + x_head * AEC_BINS;
+    const float *x0i = x_im + x_head * AEC_BINS;
+    for (int k = 0; k < AEC_BINS; k++)
+    {
+        float p2 = x0r[k] * x0r[k] + x0i[k] * x0i[k];
+        sxx[k] += (p2 > sxx[k] ? 0.5f : 0.1f) * (p2 - sxx[k]);
+    }
+
+    // 回声估计 Y = Σ W_p X_p，取后一半
+    float yr[AEC_BINS];
+    float yi[AEC_BINS];
+    memset(yr, 0, sizeof(yr));
+    memset(yi, 0, sizeof(yi));
+    for (int p = 0; p < AEC_PARTITIONS; p++)
+    {
+        const float *wr = w_re + p * AEC_BINS;
+        const float *wi = w_im + p * AEC_BINS;
+        int xp = (x_head + p) % AEC_PARTITIONS;
+        const float *xr = x_re + xp * AEC_BINS;
+        const float *xi = x_im + xp * AEC_BINS;
+        for (int k = 0; k < AEC_BINS; k++)
+        {
+            yr[k] += wr[k] * xr[k] - wi[k] * xi[k];
+            yi[k] += wr[k] * xi[k] + wi[k] * xr[k];
+        }
+    }
+    inverse(yr, yi, buf);
+    float y[AEC_BLOCK];
+    float e[AEC_BLOCK];
+    float pd = 0.0f, pe = 0.0f, py = 0.0f;
+    for (int i = 0; i < AEC_BLOCK; i++)
+    {
+        y[i] = buf[AEC_BLOCK + i];
+        e[i] = mic[i] - y[i];
+        pd += (float)mic[i] * mic[i];
+        pe += e[i] * e[i];
+        py += y[i] * y[i];
+    }
+    pd /= AEC_BLOCK;
+    pe /= AEC_BLOCK;
+    py /= AEC_BLOCK;
+
+    far_active = px_mean > AEC_FAR_FLOOR;
+    suppress(e, y, out);
+
+    // 双讲检测：麦克风和回声估计的相干性。只有回声时接近 1（和滤波器的幅度误差无关），近端说话时明显下降
+    pe_avg += 0.5f * (pe - pe_avg);
+    py_avg += 0.5f * (py - py_avg);
+    if (!far_active)
+    {
+        // 没有播放时误差就是底噪（和近端的声音），下降快、上升慢
+        noise += (pe < noise ? 0.3f : 0.005f) * (pe - noise);
+        double_talk = false;
+        hangover = 0;
+    }
+    else if (warmup < AEC_WARMUP_BLOCKS)
+    {
+        warmup++;
+        double_talk = false;
+    }
+    else
+    {
+        if (coherence < AEC_DT_COHERENCE && pe_avg > AEC_DT_RATIO * noise)
+        {
+            hangover = AEC_DT_HANGOVER;
+        }
+        double_talk = hangover > 0;
+        if (hangover > 0)
+        {
+            hangover--;
+        }
+    }
+
+    if (far_active && !double_talk)
+    {
+        for (int i = 0; i < AEC_BLOCK; i++)
+        {
+            buf[i] = 0.0f;
+            buf[AEC_BLOCK + i] = e[i];
+        }
+        forward(buf, e_re, e_im);
+        adapt(AEC_MU);
+        // 残余回声比例：只有远端时误差 / 回声估计，下降快、上升慢
+        if (py_avg > 1.0f)
+        {
+            float r = pe_avg / py_avg;
+            leak += (r < leak ? 0.2f : 0.02f) * (r - leak);
+            leak = leak < 0.005f ? 0.005f : leak > 1.0f ? 1.0f : leak;
+        }
+    }
+
+    // 打断：远端在播放，近端持续说话
+    if (far_active)
+    {
+        if (double_talk)
+        {
+            barge_count++;
+        }
+        else if (barge_count > 0)
+        {
+            barge_count--;
+        }
+    }
+
+    st.blocks++;
+    if (far_active)
+    {
+        st.far_blocks++;
+        if (double_talk)
+        {
+            st.double_talk++;
+        }
+        else
+        {
+            float po = 0.0f;
+            for (int i = 0; i < AEC_BLOCK; i++)
+            {
+                po += (float)out[i] * out[i];
+            }
+            float erle = 10.0f * log10f((pd + 1.0f) / (po / AEC_BLOCK + 1.0f));
+            st.erle_db += 0.05f * (erle - st.erle_db);
+        }
+    }
+    uint32_t us = now_us ? now_us() - t0 : 0;
+    st.process_us += us;
+    if (us > st.process_us_max)
+    {
+        st.process_us_max = us;
+    }
+}
+
+void EchoCanceller::adapt(float mu)
+{
+    float norm[AEC_BINS];
+    for (int k = 0; k < AEC_BINS; k++)
+    {
+        norm[k] = mu / (AEC_PARTITIONS * sxx[k] + AEC_DELTA);
+    }
+    for (int p = 0; p < AEC_PARTITIONS; p++)
+    {
+        float *wr = w_re + p * AEC_BINS;
+        float *wi = w_im + p * AEC_BINS;
+        int xp = (x_head + p) % AEC_PARTITIONS;
+        const float *xr = x_re + xp * AEC_BINS;
+        const float *xi = x_im + xp * AEC_BINS;
+        for (int k = 0; k < AEC_BINS; k++)
+        {
+            // W += μ / P_x * conj(X) * E
+            wr[k] += norm[k] * (xr[k] * e_re[k] + xi[k] * e_im[k]);
+            wi[k] += norm[k] * (xr[k] * e_im[k] - xi[k] * e_re[k]);
+        }
+    }
+
+    // 梯度约束：每块轮流把一段滤波器的后一半时域系数清零，保证是线性卷积
+    float buf[AEC_FFT_LEN];
+    float *wr = w_re + constrain_next * AEC_BINS;
+    float *wi = w_im + constrain_next * AEC_BINS;
+    inverse(wr, wi, buf);
+    memset(buf + AEC_BLOCK, 0, AEC_BLOCK * sizeof(float));
+    forward(buf, wr, wi);
+    constrain_next = (constrain_next + 1) % AEC_PARTITIONS;
+}
+
+void EchoCanceller::suppress(const float *e, const float *y, int16_t *out)
+{
+    float fe[AEC_FFT_LEN];
+    float fy[AEC_FFT_LEN];
+    for (int i = 0; i < AEC_BLOCK; i++)
+    {
+        fe[i] = e_prev[i] * win[i];
+        fe[AEC_BLOCK + i] = e[i] * win[AEC_BLOCK + i];
+        fy[i] = y_prev[i] * win[i];
+        fy[AEC_BLOCK + i] = y[i] * win[AEC_BLOCK + i];
+    }
+    memcpy(e_prev, e, sizeof(e_prev));
+    memcpy(y_prev, y, sizeof(y_prev));
+
+    float er[AEC_BINS], ei[AEC_BINS], yr[AEC_BINS], yi[AEC_BINS];
+    forward(fe, er, ei);
+    forward(fy, yr, yi);
+    float explained = 0.0f, total = 0.0f;
+    for (int k = 0; k < AEC_BINS; k++)
+    {
+        // 麦克风 D = E + Y
+        float dr = er[k] + yr[k];
+        float di = ei[k] + yi[k];
+        sdd[k] += 0.2f * (dr * dr + di * di - sdd[k]);
+        sdy_re[k] += 0.2f * (dr * yr[k] + di * yi[k] - sdy_re[k]);
+        sdy_im[k] += 0.2f * (di * yr[k] - dr * yi[k] - sdy_im[k]);
+        syy_coh[k] += 0.2f * (yr[k] * yr[k] + yi[k] * yi[k] - syy_coh[k]);
+        if (k >= AEC_COH_LO && k < AEC_COH_HI)
+        {
+            explained += (sdy_re[k] * sdy_re[k] + sdy_im[k] * sdy_im[k]) / (syy_coh[k] + 1.0f);
+            total += sdd[k];
+        }
+        see[k] += 0.4f * (er[k] * er[k] + ei[k] * ei[k] - see[k]);
+        syy[k] += 0.4f * (yr[k] * yr[k] + yi[k] * yi[k] - syy[k]);
+        float g = 1.0f - 2.0f * leak * syy[k] / (see[k] + 1.0f);
+        g = g < AEC_RES_FLOOR ? AEC_RES_FLOOR : g;
+        er[k] *= g;
+        ei[k] *= g;
+    }
+    coherence = explained / (total + 1.0f);
+    inverse(er, ei, fe);
+    for (int i = 0; i < AEC_BLOCK; i++)
+    {
+        out[i] = to_pcm(fe[i] * win[i] + overlap[i]);
+        overlap[i] = fe[AEC_BLOCK + i] * win[AEC_BLOCK + i];
+    }
+}
@@ -0,0 +1,134 @@
+/**
+ * Copyright (c) 2024 小明IO
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Commercial use of this software requires prior written authorization from the Licensor.
+ * 请注意：将 ESP-AI 代码用于商业用途需要事先获得许可方的授权。
+ * 删除与修改版权属于侵权行为，请尊重作者版权，避免产生不必要的纠纷。
+ *
+ * @author 小明IO
+ * @email  1746809408@qq.com
+ * @github https://github.com/wangzongming/esp-ai
+ * @websit https://espai.fun
+ */
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * 回声消除（AEC）：分块频域自适应滤波（PBFDAF，重叠保留，归一化 LMS）+ 残余回声抑制
+ *
+ * 每块 AEC_BLOCK 个采样（16 kHz 时 8 ms），FFT 长度为两块，滤波器分 AEC_PARTITIONS 段，覆盖 64 ms 的回声路径
+ * （扬声器到麦克风的声学路径加上参考信号对齐的误差）。FFT 用 dsp/fft_int 的定点实现（块浮点），
+ * 逐频点的滤波和系数更新用 float（ESP32 有单精度 FPU）。每块约束一段滤波器（梯度约束轮流做），省一半 FFT。
+ *
+ * 双讲检测：麦克风信号里能由回声估计线性解释的能量比例（逐频点相干性按功率加权）。只有回声时接近 1，和滤波器
+ * 幅度上的误差无关，声音的频谱突然变化时不会误判、冻结自适应后再也学不会；近端说话时明显下降，同时误差比底噪
+ * 高才算双讲，冻结自适应。远端开始播放的第一秒滤波器还没收敛，只自适应不检测。
+ * 残余回声抑制：误差信号和回声估计各加 sqrt-Hann 窗做 50% 重叠的频谱，残余回声按 leak * |Y|^2 估计（leak 为
+ * 只有远端时误差和回声估计的功率比，下降快、上升慢），逐频点增益 max(AEC_RES_FLOOR, 1 - 2 * 残余 / 误差)，
+ * 再重叠相加回时域，输出比输入多延时一块。
+ *
+ * 打断（barge-in）：远端在播放时近端持续说话（双讲），计数达到 AEC_BARGE_IN_BLOCKS 时 bargeIn() 为 true。
+ *
+ * 不依赖 FreeRTOS，设备和 test/host/aec_test 共用；process() 不分配内存。
+ */
+
+#define AEC_BLOCK 128
+#define AEC_FFT_BITS 8
+#define AEC_FFT_LEN (1 << AEC_FFT_BITS)
+#define AEC_BINS (AEC_FFT_LEN / 2 + 1)
+#define AEC_PARTITIONS 8
+#define AEC_MU 0.8f
+#define AEC_RES_FLOOR 0.03f       // 残余回声抑制的最小增益（-30 dB）
+#define AEC_BARGE_IN_BLOCKS 25    // 200 ms
+
+struct aec_stats_t
+{
+    uint32_t blocks;
+    uint32_t far_blocks;   // 远端在播放的块
+    uint32_t double_talk;  // 检测到双讲的块
+    float erle_db;         // 只有远端时的回声衰减（平滑），包括残余回声抑制
+    uint64_t process_us;   // 累计
+    uint32_t process_us_max;
+};
+
+class EchoCanceller
+{
+public:
+    typedef uint32_t (*now_us_t)();
+
+    // 分配约 17 KB，失败返回 false；now_us 为微秒时钟，用来统计耗时，可以为空
+    bool begin(now_us_t now_us = nullptr);
+    void end();
+    // 清空滤波器和状态（回声路径变了，比如换了音量档位以外的设备）
+    void reset();
+    bool isReady() const { return w_re != nullptr; }
+
+    // 处理一块：mic、ref 各 AEC_BLOCK 个采样，ref 已和 mic 对齐；out 可以就是 mic
+    void process(const int16_t *mic, const int16_t *ref, int16_t *out);
+
+    bool farEnd() const { return far_active; }
+    bool doubleTalk() const { return double_talk; }
+    bool bargeIn() const { return barge_count >= AEC_BARGE_IN_BLOCKS; }
+    // 打断触发后调用，重新计数
+    void clearBargeIn() { barge_count = 0; }
+
+    const aec_stats_t &stats() const { return st; }
+    void clearStats();
+
+private:
+    void adapt(float mu);
+    void suppress(const float *e, const float *y, int16_t *out);
+
+    now_us_t now_us = nullptr;
+    float *w_re = nullptr; // [AEC_PARTITIONS][AEC_BINS] 滤波器
+    float *w_im = nullptr;
+    float *x_re = nullptr; // [AEC_PARTITIONS][AEC_BINS] 最近几块参考信号的频谱，x_head 为最新
+    float *x_im = nullptr;
+    int x_head = 0;
+    int constrain_next = 0;
+
+    int16_t ref_prev[AEC_BLOCK];
+    float sxx[AEC_BINS];  // 参考信号功率（平滑）
+    float e_re[AEC_BINS]; // 本块误差的频谱
+    float e_im[AEC_BINS];
+
+    // 残余回声抑制
+    float win[AEC_FFT_LEN];
+    float e_prev[AEC_BLOCK];
+    float y_prev[AEC_BLOCK];
+    float see[AEC_BINS];
+    float syy[AEC_BINS];
+    float overlap[AEC_BLOCK];
+    float leak = 1.0f;
+
+    // 双讲检测
+    float sdd[AEC_BINS];     // 麦克风功率、麦克风和回声估计的互谱、回声估计功率（平滑，算相干性）
+    float sdy_re[AEC_BINS];
+    float sdy_im[AEC_BINS];
+    float syy_coh[AEC_BINS];
+    float coherence = 1.0f;
+    float px_hist[AEC_PARTITIONS]; // 最近几块参考信号的功率
+    float pe_avg = 0.0f;           // 误差、回声估计的功率（平滑）
+    float py_avg = 0.0f;
+    float noise = 0.0f;            // 没有播放时的误差功率
+    int warmup = 0;                // 已经自适应的远端块数，到 AEC_WARMUP_BLOCKS 为止
+    bool far_active = false;
+    bool double_talk = false;
+    int hangover = 0;
+    int barge_count = 0;
+
+    aec_stats_t st;
+};
@@ -0,0 +1,159 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025-至今 小明IO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author 小明IO
+ * @email  1746809408@qq.com
+ * @github https://github.com/wangzongming/esp-ai
+ * @websit https://espai.fun
+ */
+#include "echo_reference.h"
+#include <stdlib.h>
+#include <string.h>
+
+bool EchoReference::begin(uint32_t sample_rate, uint32_t delay)
+{
+    uint32_t len = 1024;
+    while (len < delay + ECHO_REF_TOLERANCE + ECHO_REF_WRITE_MAX)
+    {
+        len <<= 1;
+    }
+    if (ring == nullptr || ring_len != len)
+    {
+        free(ring);
+        ring = (int16_t *)malloc(len * sizeof(int16_t));
+        ring_len = ring ? len : 0;
+        if (ring == nullptr)
+        {
+            return false;
+        }
+    }
+    rate = sample_rate;
+    this->delay = delay;
+    reset();
+    return true;
+}
+
+void EchoReference::end()
+{
+    free(ring);
+    ring = nullptr;
+    ring_len = 0;
+}
+
+void EchoReference::reset()
+{
+    if (ring != nullptr)
+    {
+        memset(ring, 0, ring_len * sizeof(int16_t));
+    }
+    seq.store(0);
+    written = 0;
+    written_us = 0;
+    synced = false;
+    off_reads = 0;
+    read_pos = 0;
+    resyncs = 0;
+}
+
+void EchoReference::write(const int16_t *pcm, size_t n, uint32_t now_us)
+{
+    if (ring == nullptr)
+    {
+        return;
+    }
+    uint32_t pos = written;
+    while (n > 0)
+    {
+        uint32_t at = pos & (ring_len - 1);
+        size_t k = ring_len - at;
+        if (k > n)
+        {
+            k = n;
+        }
+        memcpy(ring + at, pcm, k * sizeof(int16_t));
+        pcm += k;
+        n -= k;
+        pos += k;
+    }
+    seq.fetch_add(1, std::memory_order_acq_rel);
+    written = pos;
+    written_us = now_us;
+    seq.fetch_add(1, std::memory_order_release);
+}
+
+bool EchoReference::read(int16_t *out, size_t n, uint32_t now_us)
+{
+    if (ring == nullptr)
+    {
+        memset(out, 0, n * sizeof(int16_t));
+        return false;
+    }
+    uint32_t w, w_us, s;
+    do
+    {
+        s = seq.load(std::memory_order_acquire);
+        w = written;
+        w_us = written_us;
+    } while ((s & 1) || seq.load(std::memory_order_acquire) != s);
+
+    // 这块最后一个采样对应的播放位置：最后写入的采样 + 之后流逝的采样 - 固定延时
+    uint32_t elapsed = (uint32_t)(((uint64_t)(now_us - w_us) * rate) / 1000000);
+    uint32_t last = w + elapsed - delay;
+    uint32_t start = last - (uint32_t)n;
+    int32_t drift = (int32_t)(start - read_pos);
+    if (drift > 2 * ECHO_REF_TOLERANCE || drift < -2 * ECHO_REF_TOLERANCE)
+    {
+        off_reads++;
+    }
+    else
+    {
+        off_reads = 0;
+    }
+    if (!synced || off_reads >= ECHO_REF_RESYNC_READS)
+    {
+        if (synced)
+        {
+            resyncs++;
+        }
+        synced = true;
+        off_reads = 0;
+        read_pos = start;
+    }
+
+    bool active = false;
+    for (size_t i = 0; i < n; i++)
+    {
+        uint32_t pos = read_pos + ECHO_REF_TOLERANCE + (uint32_t)i;
+        // 还没写入（播完了）或者太旧（下一次 write 可能正在覆盖）的位置按静音处理
+        int32_t ahead = (int32_t)(w - pos);
+        if (ahead <= 0 || ahead > (int32_t)(ring_len - ECHO_REF_WRITE_MAX))
+        {
+            out[i] = 0;
+            continue;
+        }
+        out[i] = ring[pos & (ring_len - 1)];
+        active |= out[i] != 0;
+    }
+    read_pos += (uint32_t)n;
+    return active;
+}
@@ -0,0 +1,80 @@
+/**
+ * Copyright (c) 2024 小明IO
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Commercial use of this software requires prior written authorization from the Licensor.
+ * 请注意：将 ESP-AI 代码用于商业用途需要事先获得许可方的授权。
+ * 删除与修改版权属于侵权行为，请尊重作者版权，避免产生不必要的纠纷。
+ *
+ * @author 小明IO
+ * @email  1746809408@qq.com
+ * @github https://github.com/wangzongming/esp-ai
+ * @websit https://espai.fun
+ */
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+/**
+ * 回声消除的参考信号：扬声器实际播放的 PCM，按时间和麦克风采集对齐
+ *
+ * 扬声器任务在 I2S write 返回后调用 write()：此时最后一个采样刚进入 DMA，再过 delay 个采样（DMA 深度加上
+ * 麦克风 DMA 等固定延时）才被采集到。DMA 一直有数据时 write 会阻塞，返回时刻和播放位置的关系是稳定的；
+ * write 间隔超过 DMA 深度说明播完了，之后的位置按静音处理。
+ *
+ * 麦克风任务每读到一块数据调用 read()，按读取时刻算出这块对应的播放位置。两边任务被唤醒的时刻各有最多
+ * ECHO_REF_TOLERANCE 个采样的抖动，估计的位置前后偏差最多两倍；连续读取时位置按采样数递增，只有连续
+ * ECHO_REF_RESYNC_READS 次偏离超过两倍（播放重新开始、任务被长时间阻塞）才重新对齐，抖动不会让参考信号前后跳动。
+ * 取出的参考信号再提前 ECHO_REF_TOLERANCE 个采样，偏差只会让回声路径变长（由自适应滤波器的长度吸收），
+ * 不会变成非因果。
+ *
+ * 一个写入者、一个读取者，不用锁：采样位置和时刻用序号保护，环形缓冲里读取的都是已经写完的位置。
+ */
+
+#define ECHO_REF_WRITE_MAX 2048 // 采样，一次 write 的上限，环形缓冲按 delay + ECHO_REF_WRITE_MAX 向上取 2 的幂
+#define ECHO_REF_TOLERANCE 48  // 采样，3 ms
+#define ECHO_REF_RESYNC_READS 2
+
+class EchoReference
+{
+public:
+    // delay：扬声器写入到麦克风采集的固定延时（采样）；分配环形缓冲，失败返回 false
+    bool begin(uint32_t sample_rate, uint32_t delay);
+    void end();
+    void reset();
+    bool isReady() const { return ring != nullptr; }
+
+    // 扬声器写入 n 个采样后调用，now_us 为 write 返回的时刻
+    void write(const int16_t *pcm, size_t n, uint32_t now_us);
+    // 取 n 个和麦克风对齐的参考采样，now_us 为这块麦克风数据读到的时刻；返回这块里是否有播放的声音
+    bool read(int16_t *out, size_t n, uint32_t now_us);
+
+    // 重新对齐的次数
+    uint32_t resyncs = 0;
+
+private:
+    int16_t *ring = nullptr;
+    uint32_t ring_len = 0; // 2 的幂
+    uint32_t rate = 16000;
+    uint32_t delay = 0;
+
+    std::atomic<uint32_t> seq{0}; // 奇数表示正在更新 written / written_us
+    uint32_t written = 0;         // 累计写入的采样数
+    uint32_t written_us = 0;
+
+    bool synced = false;
+    int off_reads = 0;     // 连续偏离的次数
+    uint32_t read_pos = 0; // 下一次读取的起点（播放位置）
+};
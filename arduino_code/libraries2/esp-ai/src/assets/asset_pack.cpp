@@ -0,0 +1,208 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025-至今 小明IO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author 小明IO
+ * @email  1746809408@qq.com
+ * @github https://github.com/wangzongming/esp-ai
+ * @websit https://espai.fun
+ */
+#include "asset_pack.h"
+#include <string.h>
+
+#if defined(ESP_PLATFORM)
+#include "esp_partition.h"
+#include "esp_spi_flash.h"
+#endif
+
+static uint32_t rd16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+static uint32_t rd32(const uint8_t *p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); }
+
+bool AssetPack::begin(const char *partition_label)
+{
+    end();
+#if defined(ESP_PLATFORM)
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, partition_label);
+    if (part == nullptr)
+    {
+        return false;
+    }
+
+    // 先映射头部读出资源包大小，再映射整个资源包
+    const void *ptr = nullptr;
+    spi_flash_mmap_handle_t handle;
+    if (esp_partition_mmap(part, 0, ASSET_PACK_HEAD_SIZE, SPI_FLASH_MMAP_DATA, &ptr, &handle) != ESP_OK)
+    {
+        return false;
+    }
+    uint32_t size = memcmp(ptr, ASSET_PACK_MAGIC, 4) == 0 ? rd32((const uint8_t *)ptr + 16) : 0;
+    spi_flash_munmap(handle);
+    if (size < ASSET_PACK_HEAD_SIZE || size > part->size)
+    {
+        return false;
+    }
+
+    if (esp_partition_mmap(part, 0, size, SPI_FLASH_MMAP_DATA, &ptr, &handle) != ESP_OK)
+    {
+        return false;
+    }
+    if (!open((const uint8_t *)ptr, size))
+    {
+        spi_flash_munmap(handle);
+        return false;
+    }
+    map_handle = handle;
+    mapped = true;
+    return true;
+#else
+    (void)partition_label;
+    return false;
+#endif
+}
+
+void AssetPack::end()
+{
+#if defined(ESP_PLATFORM)
+    if (mapped)
+    {
+        spi_flash_munmap(map_handle);
+    }
+#endif
+    mapped = false;
+    base = nullptr;
+    pack_size = 0;
+    entries = 0;
+    language[0] = '\0';
+}
+
+bool AssetPack::open(const uint8_t *data, size_t size)
+{
+    end();
+    if (data == nullptr || size < ASSET_PACK_HEAD_SIZE || memcmp(data, ASSET_PACK_MAGIC, 4) != 0 ||
+        rd16(data + 4) != ASSET_PACK_VERSION || rd32(data + 16) != size)
+    {
+        return false;
+    }
+    uint16_t n = rd16(data + 6);
+    size_t index_size = (size_t)n * ASSET_PACK_ENTRY_SIZE;
+    if (ASSET_PACK_HEAD_SIZE + index_size > size ||
+        crc32(0, data + ASSET_PACK_HEAD_SIZE, index_size) != rd32(data + 20))
+    {
+        return false;
+    }
+
+    // 索引通过了 CRC，这里只防止生成工具的错误
+    for (uint16_t i = 0; i < n; i++)
+    {
+        const uint8_t *e = data + ASSET_PACK_HEAD_SIZE + (size_t)i * ASSET_PACK_ENTRY_SIZE;
+        uint32_t offset = rd32(e + 32);
+        uint32_t len = rd32(e + 36);
+        if (e[ASSET_PACK_NAME_MAX - 1] != '\0' || offset > size || len > size - offset)
+        {
+            return false;
+        }
+        if (i > 0 && strncmp((const char *)e - ASSET_PACK_ENTRY_SIZE, (const char *)e, ASSET_PACK_NAME_MAX) >= 0)
+        {
+            return false;
+        }
+    }
+
+    base = data;
+    pack_size = size;
+    entries = n;
+    memcpy(language, data + 8, 8);
+    language[8] = '\0';
+    return true;
+}
+
+bool AssetPack::find(const char *name, const uint8_t **data, size_t *len, asset_codec_t *codec)
+{
+    if (base == nullptr || name == nullptr)
+    {
+        return false;
+    }
+    // 索引按名字排序，二分查找
+    int lo = 0, hi = (int)entries - 1;
+    while (lo <= hi)
+    {
+        int mid = (lo + hi) / 2;
+        const uint8_t *e = entry(mid);
+        int cmp = strncmp(name, (const char *)e, ASSET_PACK_NAME_MAX);
+        if (cmp == 0)
+        {
+            *data = base + rd32(e + 32);
+            *len = rd32(e + 36);
+            if (codec != nullptr)
+            {
+                *codec = (asset_codec_t)e[40];
+            }
+            return true;
+        }
+        if (cmp < 0)
+        {
+            hi = mid - 1;
+        }
+        else
+        {
+            lo = mid + 1;
+        }
+    }
+    return false;
+}
+
+bool AssetPack::verify()
+{
+    if (base == nullptr)
+    {
+        return false;
+    }
+    for (uint16_t i = 0; i < entries; i++)
+    {
+        const uint8_t *e = entry(i);
+        if (crc32(0, base + rd32(e + 32), rd32(e + 36)) != rd32(e + 44))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+const char *AssetPack::name(uint16_t i)
+{
+    return (base != nullptr && i < entries) ? (const char *)entry(i) : nullptr;
+}
+
+uint32_t AssetPack::crc32(uint32_t crc, const uint8_t *data, size_t len)
+{
+    // 与 zlib.crc32 相同（多项式 0xEDB88320），生成工具用 Python 计算
+    static const uint32_t table[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C};
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++)
+    {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ table[crc & 0x0F];
+        crc = (crc >> 4) ^ table[crc & 0x0F];
+    }
+    return ~crc;
+}
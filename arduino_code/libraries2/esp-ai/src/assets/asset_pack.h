@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2024 小明IO
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Commercial use of this software requires prior written authorization from the Licensor.
+ * 请注意：将 ESP-AI 代码用于商业用途需要事先获得许可方的授权。
+ * 删除与修改版权属于侵权行为，请尊重作者版权，避免产生不必要的纠纷。
+ *
+ * @author 小明IO
+ * @email  1746809408@qq.com
+ * @github https://github.com/wangzongming/esp-ai
+ * @websit https://espai.fun
+ */
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * 提示音资源包：一个分区里的带索引的数据块，用 esp_partition_mmap 映射后直接从 flash 播放，不拷贝到内存
+ *
+ * 由 src/audio/make_pack.py 从 MP3/Opus 文件生成，单独烧录到 "prompts" 分区（分区表见 esp-ai/partitions/）。
+ * 换语言只需要重新烧录这个分区，不用重新编译、烧录固件。
+ * 分区里没有资源包、或者包里没有某个提示音时，play_prompt() 使用编译进固件的数组（ESP_AI_PROMPTS_IN_APP）。
+ *
+ * 格式（小端）：
+ *   头部 32 字节
+ *     [0..3]    "EAPK"
+ *     [4..5]    uint16 版本，ASSET_PACK_VERSION
+ *     [6..7]    uint16 条目数
+ *     [8..15]   语言，比如 "zh"，不足补 0
+ *     [16..19]  uint32 整个资源包的字节数
+ *     [20..23]  uint32 索引的 CRC32
+ *     [24..31]  保留
+ *   索引，每条 48 字节，按名字排序
+ *     [0..31]   名字，比如 "san_ci"，不足补 0
+ *     [32..35]  uint32 数据偏移（相对资源包开头，4 字节对齐）
+ *     [36..39]  uint32 数据长度
+ *     [40]      编码，asset_codec_t
+ *     [41..43]  保留
+ *     [44..47]  uint32 数据的 CRC32
+ *   数据
+ */
+
+#define ASSET_PACK_MAGIC "EAPK"
+#define ASSET_PACK_VERSION 1
+#define ASSET_PACK_HEAD_SIZE 32
+#define ASSET_PACK_ENTRY_SIZE 48
+#define ASSET_PACK_NAME_MAX 32
+#define ASSET_PACK_PARTITION "prompts"
+
+typedef enum
+{
+    ASSET_CODEC_MP3 = 0,
+    ASSET_CODEC_OPUS = 1,
+} asset_codec_t;
+
+class AssetPack
+{
+public:
+    ~AssetPack() { end(); }
+
+    // 映射分区，校验头部和索引；失败时返回 false，find 一律找不到
+    bool begin(const char *partition_label = ASSET_PACK_PARTITION);
+    void end();
+    // 直接使用内存里的资源包（主机测试、或者资源包在别的地方）
+    bool open(const uint8_t *data, size_t size);
+
+    // 找到时 data 指向映射后的 flash
+    bool find(const char *name, const uint8_t **data, size_t *len, asset_codec_t *codec = nullptr);
+    // 校验所有数据的 CRC32，比较慢，只在需要时调用
+    bool verify();
+
+    bool isOpen() { return base != nullptr; }
+    uint16_t count() { return entries; }
+    const char *lang() { return language; }
+    size_t size() { return pack_size; }
+    // 第 i 条的名字，用于列出资源包内容
+    const char *name(uint16_t i);
+
+    static uint32_t crc32(uint32_t crc, const uint8_t *data, size_t len);
+
+private:
+    const uint8_t *entry(uint16_t i) { return base + ASSET_PACK_HEAD_SIZE + (size_t)i * ASSET_PACK_ENTRY_SIZE; }
+
+    const uint8_t *base = nullptr;
+    size_t pack_size = 0;
+    uint16_t entries = 0;
+    char language[9] = {0};
+    uint32_t map_handle = 0;
+    bool mapped = false;
+};
@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+# 生成提示音资源包（格式见 src/assets/asset_pack.h），烧录到 "prompts" 分区后固件优先从这里播放提示音
+#
+#   python3 make_pack.py zh/pack.txt -o prompts_zh.bin
+#   python3 make_pack.py --list prompts_zh.bin
+#   parttool.py --port /dev/ttyUSB0 write_partition --partition-name prompts --input prompts_zh.bin
+#
+# 清单每行一条 "名字 = 源文件"，路径相对清单所在目录；"lang = zh" 设置语言；# 开头为注释。
+# 源文件可以是 mp3、opus/ogg，或者 to-h.sh（xxd -i）生成的 .h。
+
+import argparse
+import os
+import re
+import struct
+import sys
+import zlib
+
+MAGIC = b"EAPK"
+VERSION = 1
+HEAD_SIZE = 32
+ENTRY_SIZE = 48
+NAME_MAX = 32
+CODECS = {".mp3": 0, ".h": 0, ".opus": 1, ".ogg": 1}
+
+
+def read_source(path):
+    if path.endswith(".h"):
+        text = open(path, encoding="utf-8").read()
+        body = text.split("{", 1)[1].split("}", 1)[0]
+        return bytes(int(x, 16) for x in re.findall(r"0x([0-9a-fA-F]{2})", body))
+    with open(path, "rb") as f:
+        return f.read()
+
+
+def read_manifest(path):
+    lang, items = "", []
+    base = os.path.dirname(os.path.abspath(path))
+    for no, line in enumerate(open(path, encoding="utf-8"), 1):
+        line = line.strip()
+        if not line or line.startswith("#"):
+            continue
+        if "=" not in line:
+            sys.exit("%s:%d: expected 'name = file'" % (path, no))
+        key, value = (s.strip() for s in line.split("=", 1))
+        if key == "lang":
+            lang = value
+            continue
+        if not re.fullmatch(r"[A-Za-z0-9_]+", key) or len(key) >= NAME_MAX:
+            sys.exit("%s:%d: bad name '%s'" % (path, no, key))
+        ext = os.path.splitext(value)[1].lower()
+        if ext not in CODECS:
+            sys.exit("%s:%d: unsupported source '%s'" % (path, no, value))
+        items.append((key, os.path.join(base, value), CODECS[ext]))
+    if len(lang.encode()) > 8:
+        sys.exit("%s: lang longer than 8 bytes" % path)
+    names = [n for n, _, _ in items]
+    if len(set(names)) != len(names):
+        sys.exit("%s: duplicate names" % path)
+    return lang, sorted(items)
+
+
+def build(lang, items):
+    index, data = b"", b""
+    offset = HEAD_SIZE + ENTRY_SIZE * len(items)
+    for name, path, codec in items:
+        blob = read_source(path)
+        index += struct.pack("<32sIIB3xI", name.encode(), offset + len(data), len(blob), codec, zlib.crc32(blob))
+        data += blob + b"\0" * (-len(blob) % 4)
+    size = HEAD_SIZE + len(index) + len(data)
+    head = struct.pack("<4sHH8sII8x", MAGIC, VERSION, len(items), lang.encode(), size, zlib.crc32(index))
+    return head + index + data
+
+
+def list_pack(path):
+    pack = open(path, "rb").read()
+    magic, version, count, lang, size, crc = struct.unpack_from("<4sHH8sII", pack)
+    if magic != MAGIC or version != VERSION or size != len(pack):
+        sys.exit("%s: not a version %d asset pack" % (path, VERSION))
+    index = pack[HEAD_SIZE:HEAD_SIZE + count * ENTRY_SIZE]
+    ok = zlib.crc32(index) == crc
+    print("%s: %s, %d prompts, %d bytes, index %s" % (path, lang.rstrip(b"\0").decode(), count, size, "ok" if ok else "CRC ERROR"))
+    for i in range(count):
+        name, off, length, codec, dcrc = struct.unpack_from("<32sIIB3xI", index, i * ENTRY_SIZE)
+        good = zlib.crc32(pack[off:off + length]) == dcrc
+        print("  %-30s %7d bytes at %7d  %-4s %s" % (name.rstrip(b"\0").decode(), length, off, ("mp3", "opus")[codec], "" if good else "CRC ERROR"))
+        ok &= good
+    return ok
+
+
+def main():
+    ap = argparse.ArgumentParser(description="build or list an esp-ai prompt asset pack")
+    ap.add_argument("input", help="manifest, or the pack with --list")
+    ap.add_argument("-o", "--output", help="pack to write")
+    ap.add_argument("--list", action="store_true", help="print the contents of a pack and check the CRCs")
+    args = ap.parse_args()
+
+    if args.list:
+        sys.exit(0 if list_pack(args.input) else 1)
+    if not args.output:
+        ap.error("-o is required")
+    lang, items = read_manifest(args.input)
+    pack = build(lang, items)
+    with open(args.output, "wb") as f:
+        f.write(pack)
+    print("%s: %d prompts, %d bytes (%d KB partition at least)" % (args.output, len(items), len(pack), (len(pack) + 4095) // 4096 * 4))
+
+
+if __name__ == "__main__":
+    main()
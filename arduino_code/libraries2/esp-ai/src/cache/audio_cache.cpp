@@ -0,0 +1,611 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025-至今 小明IO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author 小明IO
+ * @email  1746809408@qq.com
+ * @github https://github.com/wangzongming/esp-ai
+ * @websit https://espai.fun
+ */
+#include "audio_cache.h"
+#include <LittleFS.h>
+#include <FFat.h>
+#include <vector>
+#include "esp_heap_caps.h"
+#include "mbedtls/version.h"
+
+// mbedtls 3 去掉了 _ret 后缀
+#if MBEDTLS_VERSION_NUMBER >= 0x03000000
+#define cache_sha_starts(ctx) mbedtls_sha256_starts(ctx, 0)
+#define cache_sha_update(ctx, d, n) mbedtls_sha256_update(ctx, d, n)
+#define cache_sha_finish(ctx, out) mbedtls_sha256_finish(ctx, out)
+#else
+#define cache_sha_starts(ctx) mbedtls_sha256_starts_ret(ctx, 0)
+#define cache_sha_update(ctx, d, n) mbedtls_sha256_update_ret(ctx, d, n)
+#define cache_sha_finish(ctx, out) mbedtls_sha256_finish_ret(ctx, out)
+#endif
+
+static fs::FS *cache_fs = nullptr;
+
+// 优先放 PSRAM，没有 PSRAM 的板子用内部 RAM
+static uint8_t *cache_alloc(size_t size)
+{
+    return (uint8_t *)heap_caps_malloc_prefer(size, 2, MALLOC_CAP_SPIRAM, MALLOC_CAP_DEFAULT);
+}
+
+static uint8_t *cache_realloc(uint8_t *ptr, size_t size)
+{
+    return (uint8_t *)heap_caps_realloc_prefer(ptr, size, 2, MALLOC_CAP_SPIRAM, MALLOC_CAP_DEFAULT);
+}
+
+static void sha_hex(mbedtls_sha256_context *ctx, char out[65])
+{
+    uint8_t digest[32];
+    cache_sha_finish(ctx, digest);
+    for (int i = 0; i < 32; i++)
+    {
+        sprintf(out + 2 * i, "%02x", digest[i]);
+    }
+}
+
+static CachedAudioBlob *blob_new(uint8_t *data, size_t len, size_t cap, const char *hash)
+{
+    CachedAudioBlob *b = (CachedAudioBlob *)malloc(sizeof(CachedAudioBlob));
+    if (b == nullptr)
+    {
+        return nullptr;
+    }
+    b->data = data;
+    b->len = len;
+    b->cap = cap;
+    b->refs = 1;
+    strcpy(b->hash, hash);
+    return b;
+}
+
+static void blob_free(CachedAudioBlob *b)
+{
+    if (b != nullptr)
+    {
+        free(b->data);
+        free(b);
+    }
+}
+
+// 64 位十六进制，转成小写
+static bool normalize_hash(const char *in, char out[65])
+{
+    if (in == nullptr || strlen(in) != 64)
+    {
+        return false;
+    }
+    for (int i = 0; i < 64; i++)
+    {
+        if (!isxdigit((unsigned char)in[i]))
+        {
+            return false;
+        }
+        out[i] = tolower((unsigned char)in[i]);
+    }
+    out[64] = '\0';
+    return true;
+}
+
+CachedAudio::CachedAudio(const char *key) : key(key)
+{
+    lock = xSemaphoreCreateMutex();
+}
+
+CachedAudio::~CachedAudio()
+{
+    // 等保存任务写完
+    for (;;)
+    {
+        xSemaphoreTake(lock, portMAX_DELAY);
+        bool busy = saving;
+        xSemaphoreGive(lock);
+        if (!busy)
+        {
+            break;
+        }
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    abort();
+    release();
+    vSemaphoreDelete(lock);
+}
+
+bool CachedAudio::mount()
+{
+    if (cache_fs != nullptr)
+    {
+        return true;
+    }
+    if (LittleFS.begin(false))
+    {
+        cache_fs = &LittleFS;
+    }
+    else if (FFat.begin(false))
+    {
+        cache_fs = &FFat;
+    }
+    else
+    {
+        return false;
+    }
+    if (!cache_fs->exists(CACHE_AUDIO_DIR))
+    {
+        cache_fs->mkdir(CACHE_AUDIO_DIR);
+    }
+    return true;
+}
+
+String CachedAudio::path(const char *hash)
+{
+    // 文件名只取 hash 前 16 位，LittleFS 的名字长度有限
+    return String(CACHE_AUDIO_DIR) + "/" + key + "-" + String(hash).substring(0, 16) + ".mp3";
+}
+
+CachedAudioBlob *CachedAudio::pin()
+{
+    xSemaphoreTake(lock, portMAX_DELAY);
+    CachedAudioBlob *b = cur;
+    if (b != nullptr && b->len > 0)
+    {
+        b->refs++;
+    }
+    else
+    {
+        b = nullptr;
+    }
+    xSemaphoreGive(lock);
+    return b;
+}
+
+void CachedAudio::unpin(CachedAudioBlob *b)
+{
+    if (b == nullptr)
+    {
+        return;
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    bool last = --b->refs == 0;
+    xSemaphoreGive(lock);
+    if (last)
+    {
+        blob_free(b);
+    }
+}
+
+size_t CachedAudio::size()
+{
+    xSemaphoreTake(lock, portMAX_DELAY);
+    size_t n = cur ? cur->len : 0;
+    xSemaphoreGive(lock);
+    return n;
+}
+
+// 换上新的一块（nullptr = 清空），旧块没人 pin 住时释放
+void CachedAudio::replace(CachedAudioBlob *b)
+{
+    xSemaphoreTake(lock, portMAX_DELAY);
+    CachedAudioBlob *old = cur;
+    cur = b;
+    bool last = old != nullptr && --old->refs == 0;
+    xSemaphoreGive(lock);
+    if (last)
+    {
+        blob_free(old);
+    }
+}
+
+bool CachedAudio::current(char out_hash[65], size_t *out_len)
+{
+    xSemaphoreTake(lock, portMAX_DELAY);
+    bool has = cur != nullptr;
+    strcpy(out_hash, has ? cur->hash : "");
+    *out_len = has ? cur->len : 0;
+    xSemaphoreGive(lock);
+    return has;
+}
+
+bool CachedAudio::offer(const char *hash, size_t size)
+{
+    abort();
+    char h[65];
+    if (!normalize_hash(hash, h) || size == 0 || size > CACHE_AUDIO_MAX_SIZE)
+    {
+        Serial.printf("[Error] -> 缓存 %s 的 hash 或大小不正确：%u\n", key, (unsigned)size);
+        release();
+        return false;
+    }
+
+    // 重连时（或者开机 preload 后）内存里已经是这一份
+    char cur_hash[65];
+    size_t len;
+    current(cur_hash, &len);
+    if (len == size && strcmp(cur_hash, h) == 0)
+    {
+        return true;
+    }
+    if (load(h, size))
+    {
+        return true;
+    }
+
+    pend = cache_alloc(size);
+    if (pend == nullptr)
+    {
+        Serial.printf("[Error] -> 缓存 %s 申请 %u 字节失败\n", key, (unsigned)size);
+        release();
+        return false;
+    }
+    pend_size = size;
+    pend_len = 0;
+    strcpy(pend_hash, h);
+    mbedtls_sha256_init(&sha);
+    cache_sha_starts(&sha);
+    receiving = true;
+    return false;
+}
+
+void CachedAudio::append(const uint8_t *data, size_t n)
+{
+    if (n == 0)
+    {
+        return;
+    }
+    if (receiving)
+    {
+        size_t room = pend_size - pend_len;
+        if (n > room)
+        {
+            Serial.printf("[Warn] -> 缓存 %s 收到的数据多于 %u 字节\n", key, (unsigned)pend_size);
+            n = room;
+        }
+        memcpy(pend + pend_len, data, n);
+        cache_sha_update(&sha, data, n);
+        pend_len += n;
+        if (pend_len == pend_size)
+        {
+            commit();
+        }
+        return;
+    }
+
+    // 旧服务端：没有 offer，直接追加；带 hash 的数据被整个替换
+    xSemaphoreTake(lock, portMAX_DELAY);
+    CachedAudioBlob *b = cur;
+    size_t keep = (b != nullptr && b->hash[0] == '\0') ? b->len : 0;
+    if (keep > 0 && b->refs == 1 && keep + n <= b->cap)
+    {
+        memcpy(b->data + keep, data, n);
+        b->len += n;
+        xSemaphoreGive(lock);
+        return;
+    }
+    size_t want = keep > 0 ? b->cap * 2 : 16 * 1024;
+    while (want < keep + n)
+    {
+        want *= 2;
+    }
+    if (keep > 0 && b->refs == 1)
+    {
+        // 没人在播放，原地扩容
+        uint8_t *p = cache_realloc(b->data, want);
+        if (p != nullptr)
+        {
+            b->data = p;
+            b->cap = want;
+            memcpy(b->data + keep, data, n);
+            b->len += n;
+        }
+        xSemaphoreGive(lock);
+        if (p == nullptr)
+        {
+            Serial.printf("[Error] -> 缓存 %s 扩容到 %u 字节失败\n", key, (unsigned)want);
+        }
+        return;
+    }
+    if (keep > 0)
+    {
+        b->refs++; // 复制期间 clear 也不能释放它
+    }
+    xSemaphoreGive(lock);
+
+    // 正在播放（或者是新的一段）：复制一份再追加，播放中的那块 unpin 时释放
+    uint8_t *p = cache_alloc(want);
+    CachedAudioBlob *nb = p ? blob_new(p, keep + n, want, "") : nullptr;
+    if (nb == nullptr)
+    {
+        free(p);
+        Serial.printf("[Error] -> 缓存 %s 扩容到 %u 字节失败\n", key, (unsigned)want);
+    }
+    else
+    {
+        if (keep > 0)
+        {
+            memcpy(p, b->data, keep);
+        }
+        memcpy(p + keep, data, n);
+        replace(nb);
+    }
+    if (keep > 0)
+    {
+        unpin(b);
+    }
+}
+
+void CachedAudio::commit()
+{
+    char h[65];
+    sha_hex(&sha, h);
+    mbedtls_sha256_free(&sha);
+    receiving = false;
+    CachedAudioBlob *b = strcmp(h, pend_hash) == 0 ? blob_new(pend, pend_size, pend_size, pend_hash) : nullptr;
+    if (b == nullptr)
+    {
+        Serial.printf("[Error] -> 缓存 %s 校验失败，丢弃\n", key);
+        free(pend);
+        pend = nullptr;
+        return;
+    }
+
+    // 一次提交：整段换上，旧数据没在播放时释放
+    pend = nullptr;
+    replace(b);
+    request_save();
+}
+
+// 写文件最长要几百毫秒，交给保存任务，WS 任务不等待
+void CachedAudio::request_save()
+{
+    if (cache_fs == nullptr)
+    {
+        return;
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    save_pending = true;
+    bool start = !saving;
+    saving = true;
+    xSemaphoreGive(lock);
+    if (start && xTaskCreate(CachedAudio::save_task, "cache_save", 1024 * 4, this, 1, NULL) != pdPASS)
+    {
+        Serial.printf("[Warn] -> 缓存 %s 创建保存任务失败\n", key);
+        xSemaphoreTake(lock, portMAX_DELAY);
+        saving = save_pending = false;
+        xSemaphoreGive(lock);
+    }
+}
+
+void CachedAudio::save_task(void *arg)
+{
+    CachedAudio *self = (CachedAudio *)arg;
+    for (;;)
+    {
+        // 保存期间又提交了新数据时再写一次最新的
+        xSemaphoreTake(self->lock, portMAX_DELAY);
+        if (!self->save_pending)
+        {
+            self->saving = false;
+            xSemaphoreGive(self->lock);
+            break;
+        }
+        self->save_pending = false;
+        CachedAudioBlob *b = self->cur;
+        if (b != nullptr)
+        {
+            b->refs++;
+        }
+        xSemaphoreGive(self->lock);
+        if (b == nullptr || b->hash[0] == '\0')
+        {
+            self->unpin(b);
+            continue;
+        }
+
+        self->save(b);
+
+        // 写的时候被 clear 或者换掉了：clear 先换下数据再删文件，这里后检查，不会留下已清除的文件
+        char h[65];
+        size_t n;
+        self->current(h, &n);
+        if (strcmp(h, b->hash) != 0)
+        {
+            cache_fs->remove(self->path(b->hash));
+        }
+        self->unpin(b);
+    }
+    vTaskDelete(NULL);
+}
+
+void CachedAudio::save(CachedAudioBlob *b)
+{
+    // 同一个 key 的旧文件删掉，只保留当前这一份
+    String prefix = String(key) + "-";
+    String p = path(b->hash);
+    File dir = cache_fs->open(CACHE_AUDIO_DIR);
+    std::vector<String> stale;
+    if (dir && dir.isDirectory())
+    {
+        for (File f = dir.openNextFile(); f; f = dir.openNextFile())
+        {
+            if (String(f.name()).startsWith(prefix) && p != f.path())
+            {
+                stale.push_back(f.path());
+            }
+        }
+    }
+    dir.close();
+    for (const String &s : stale)
+    {
+        cache_fs->remove(s);
+    }
+
+    File f = cache_fs->open(p, FILE_WRITE);
+    if (!f || f.write(b->data, b->len) != b->len)
+    {
+        Serial.printf("[Warn] -> 缓存 %s 写入文件失败\n", key);
+        f.close();
+        cache_fs->remove(p);
+        return;
+    }
+    f.close();
+}
+
+// 读出整个文件并计算 SHA-256；size 为 0 时不限定大小
+uint8_t *CachedAudio::read_file(const String &p, size_t size, size_t *out_len, char out_hash[65])
+{
+    File f = cache_fs->open(p, FILE_READ);
+    if (!f)
+    {
+        return nullptr;
+    }
+    size_t n = f.size();
+    bool fits = size ? n == size : n > 0 && n <= CACHE_AUDIO_MAX_SIZE;
+    uint8_t *data = fits ? cache_alloc(n) : nullptr;
+    bool ok = data != nullptr && f.read(data, n) == n;
+    f.close();
+    if (!ok)
+    {
+        free(data);
+        return nullptr;
+    }
+
+    mbedtls_sha256_context ctx;
+    mbedtls_sha256_init(&ctx);
+    cache_sha_starts(&ctx);
+    cache_sha_update(&ctx, data, n);
+    sha_hex(&ctx, out_hash);
+    mbedtls_sha256_free(&ctx);
+    *out_len = n;
+    return data;
+}
+
+bool CachedAudio::load(const char *hash, size_t size)
+{
+    if (cache_fs == nullptr)
+    {
+        return false;
+    }
+    String p = path(hash);
+    if (!cache_fs->exists(p))
+    {
+        return false;
+    }
+    char h[65];
+    size_t n = 0;
+    uint8_t *data = read_file(p, size, &n, h);
+
+    // 文件损坏或者前 16 位 hash 碰撞时当作未命中
+    CachedAudioBlob *b = (data != nullptr && strcmp(h, hash) == 0) ? blob_new(data, n, n, hash) : nullptr;
+    if (b == nullptr)
+    {
+        free(data);
+        cache_fs->remove(p);
+        return false;
+    }
+    replace(b);
+    return true;
+}
+
+bool CachedAudio::preload()
+{
+    if (cache_fs == nullptr)
+    {
+        return false;
+    }
+    String prefix = String(key) + "-";
+    File dir = cache_fs->open(CACHE_AUDIO_DIR);
+    std::vector<String> files;
+    if (dir && dir.isDirectory())
+    {
+        for (File f = dir.openNextFile(); f; f = dir.openNextFile())
+        {
+            if (String(f.name()).startsWith(prefix))
+            {
+                files.push_back(f.path());
+            }
+        }
+    }
+    dir.close();
+
+    // 文件名里只有 hash 前 16 位，完整的 hash 由内容算出来，和文件名对不上的是损坏的文件
+    bool ok = false;
+    for (const String &p : files)
+    {
+        char h[65];
+        size_t n = 0;
+        uint8_t *data = ok ? nullptr : read_file(p, 0, &n, h);
+        CachedAudioBlob *b = (data != nullptr && path(h) == p) ? blob_new(data, n, n, h) : nullptr;
+        if (b == nullptr)
+        {
+            free(data);
+            cache_fs->remove(p);
+            continue;
+        }
+        replace(b);
+        ok = true;
+    }
+    return ok;
+}
+
+void CachedAudio::disconnected()
+{
+    abort();
+    char h[65];
+    size_t n;
+    if (current(h, &n) && h[0] == '\0')
+    {
+        release();
+    }
+}
+
+void CachedAudio::clear()
+{
+    abort();
+    char h[65];
+    size_t n;
+    bool has = current(h, &n);
+    // 先换下数据再删文件，和保存任务的检查配合
+    release();
+    if (cache_fs != nullptr && has && h[0] != '\0')
+    {
+        cache_fs->remove(path(h));
+    }
+}
+
+void CachedAudio::abort()
+{
+    if (receiving)
+    {
+        mbedtls_sha256_free(&sha);
+        receiving = false;
+    }
+    free(pend);
+    pend = nullptr;
+}
+
+void CachedAudio::release()
+{
+    replace(nullptr);
+}
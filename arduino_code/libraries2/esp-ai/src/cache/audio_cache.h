@@ -0,0 +1,116 @@
+/**
+ * Copyright (c) 2024 小明IO
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Commercial use of this software requires prior written authorization from the Licensor.
+ * 请注意：将 ESP-AI 代码用于商业用途需要事先获得许可方的授权。
+ * 删除与修改版权属于侵权行为，请尊重作者版权，避免产生不必要的纠纷。
+ *
+ * @author 小明IO
+ * @email  1746809408@qq.com
+ * @github https://github.com/wangzongming/esp-ai
+ * @websit https://espai.fun
+ */
+#pragma once
+#include <Arduino.h>
+#include <FS.h>
+#include "mbedtls/sha256.h"
+
+/**
+ * 服务端下发的提示音 / 问候语缓存，按内容的 SHA-256 寻址
+ *
+ * 连接参数带 audio_cache=sha256。支持的服务端在发送缓存音频前先发
+ *   {"type":"cache_offer","key":"tone","hash":"<64 位十六进制 SHA-256>","size":12345}
+ * 设备回复
+ *   {"type":"cache_reply","key":"tone","hit":true}
+ * 命中（内存里已有，或者文件系统里有同样 hash 的文件）时服务端不再发送；未命中时按 size 在 PSRAM 预分配一段，
+ * 随后的二进制帧直接写进去，收满并校验 hash 后一次提交。写文件由单独的低优先级任务完成，不占用 WS 任务；
+ * 开机时 preload 读回保存的那一份，首次唤醒不用等网络。
+ *
+ * 数据块带引用计数：播放前 pin 住当前这一块，播放期间服务端换了新数据或者 clear，旧块在 unpin 时才释放。
+ *
+ * 没收到 cache_offer 的数据（旧服务端）按原来的方式追加，断开连接时清空。
+ * 文件保存在 LittleFS（spiffs 分区）或 FFat 的 CACHE_AUDIO_DIR 下，都没有时只缓存在内存里。
+ */
+
+#define CACHE_AUDIO_DIR "/esp_ai_cache"
+#define CACHE_AUDIO_MAX_SIZE (512 * 1024)
+
+// 一块缓存数据，refs 由 CachedAudio 的锁保护
+struct CachedAudioBlob
+{
+    uint8_t *data;
+    size_t len;
+    size_t cap;
+    int refs;
+    char hash[65]; // 空 = 旧服务端追加的数据
+};
+
+class CachedAudio
+{
+public:
+    CachedAudio(const char *key);
+    ~CachedAudio();
+
+    // 挂载文件系统，开机时调用一次；失败时只缓存在内存里
+    static bool mount();
+    // 读回文件系统里保存的一份，mount 之后调用
+    bool preload();
+
+    // 服务端 cache_offer，返回 true 表示命中
+    bool offer(const char *hash, size_t size);
+    // 二进制帧的数据
+    void append(const uint8_t *data, size_t len);
+    // 断开连接：放弃没收完的数据，旧服务端的数据也清掉（重连后会重发）
+    void disconnected();
+    // 清空，并删除文件（clear_cache / reCache）
+    void clear();
+
+    // 取当前数据，没有时返回 nullptr；用完必须 unpin，在此之前数据不会被释放
+    CachedAudioBlob *pin();
+    void unpin(CachedAudioBlob *blob);
+
+    size_t size();
+    bool empty() { return size() == 0; }
+    const char *name() { return key; }
+
+private:
+    static void save_task(void *arg);
+    bool load(const char *hash, size_t size);
+    uint8_t *read_file(const String &p, size_t size, size_t *out_len, char out_hash[65]);
+    void commit();
+    void request_save();
+    void save(CachedAudioBlob *blob);
+    void abort();
+    void release();
+    void replace(CachedAudioBlob *blob);
+    bool current(char out_hash[65], size_t *out_len);
+    String path(const char *hash);
+
+    const char *key;
+    SemaphoreHandle_t lock;
+    CachedAudioBlob *cur = nullptr; // 当前数据
+
+    // 保存任务
+    bool saving = false;
+    bool save_pending = false;
+
+    // offer 未命中后正在接收的一段，只在 WS 任务里访问
+    bool receiving = false;
+    uint8_t *pend = nullptr;
+    size_t pend_size = 0;
+    size_t pend_len = 0;
+    char pend_hash[65] = {0};
+    mbedtls_sha256_context sha;
+};
@@ -0,0 +1,74 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025-至今 小明IO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author 小明IO
+ * @email  1746809408@qq.com
+ * @github https://github.com/wangzongming/esp-ai
+ * @websit https://espai.fun
+ */
+#include "fft_int.h"
+#include "fft_tables.h"
+
+void fft_int(int32_t *re, int32_t *im, int bits, bool inverse)
+{
+    const uint32_t n = 1u << bits;
+    for (uint32_t i = 1, j = 0; i < n; i++)
+    {
+        uint32_t bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+        {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j)
+        {
+            int32_t t = re[i];
+            re[i] = re[j];
+            re[j] = t;
+            t = im[i];
+            im[i] = im[j];
+            im[j] = t;
+        }
+    }
+    for (uint32_t len = 2; len <= n; len <<= 1)
+    {
+        uint32_t half = len >> 1;
+        uint32_t step = (1u << FFT_INT_MAX_BITS) / len;
+        for (uint32_t i = 0; i < n; i += len)
+        {
+            for (uint32_t j = 0; j < half; j++)
+            {
+                int64_t wr = fft_int_cos[j * step];
+                int64_t wi = inverse ? -fft_int_sin[j * step] : fft_int_sin[j * step];
+                uint32_t a = i + j;
+                uint32_t b = a + half;
+                int32_t tr = (int32_t)((re[b] * wr - im[b] * wi + (1 << 14)) >> 15);
+                int32_t ti = (int32_t)((re[b] * wi + im[b] * wr + (1 << 14)) >> 15);
+                re[b] = re[a] - tr;
+                im[b] = im[a] - ti;
+                re[a] += tr;
+                im[a] += ti;
+            }
+        }
+    }
+}
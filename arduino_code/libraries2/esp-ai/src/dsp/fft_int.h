@@ -0,0 +1,38 @@
+/**
+ * Copyright (c) 2024 小明IO
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Commercial use of this software requires prior written authorization from the Licensor.
+ * 请注意：将 ESP-AI 代码用于商业用途需要事先获得许可方的授权。
+ * 删除与修改版权属于侵权行为，请尊重作者版权，避免产生不必要的纠纷。
+ *
+ * @author 小明IO
+ * @email  1746809408@qq.com
+ * @github https://github.com/wangzongming/esp-ai
+ * @websit https://espai.fun
+ */
+#pragma once
+#include <stdint.h>
+
+/**
+ * 定点 FFT（基 2，原位），语音唤醒的 MFCC 前端和回声消除共用
+ *
+ * 32 位数据、Q15 旋转因子、64 位乘法，旋转后四舍五入，各级不缩放：输出是 DFT（逆变换是 N * IDFT），
+ * 输出的绝对值不超过 √2 * N * 输入的最大绝对值，调用方按这个留头寸（比如 512 点时输入小于 2^22）。
+ * 旋转因子表按 FFT_INT_MAX_BITS 生成，小的长度隔点取。
+ */
+
+#define FFT_INT_MAX_BITS 9
+
+void fft_int(int32_t *re, int32_t *im, int bits, bool inverse = false);
@@ -0,0 +1,38 @@
+#!/usr/bin/env python3
+# 生成定点 FFT 的旋转因子表（fft_tables.h），长度和 fft_int.h 的 FFT_INT_MAX_BITS 一致，修改后重新生成：
+#
+#   python3 make_tables.py > fft_tables.h
+
+import math
+import os
+import re
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+
+def q15(v):
+    return max(-32768, min(32767, int(round(v * 32768))))
+
+
+def fmt(name, values, per_line=16):
+    lines = ["static const int16_t %s[%d] = {" % (name, len(values))]
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    text = open(os.path.join(HERE, "fft_int.h"), encoding="utf-8").read()
+    n = 1 << int(re.search(r"#define FFT_INT_MAX_BITS (\d+)", text).group(1))
+    print("// 由 make_tables.py 生成，不要手工修改")
+    print("#pragma once")
+    print("#include <stdint.h>")
+    print("")
+    print("// 旋转因子 cos(2πk/N)、-sin(2πk/N)，Q15，N = 2^FFT_INT_MAX_BITS")
+    print(fmt("fft_int_cos", [q15(math.cos(2 * math.pi * k / n)) for k in range(n // 2)]))
+    print(fmt("fft_int_sin", [q15(-math.sin(2 * math.pi * k / n)) for k in range(n // 2)]))
+
+
+if __name__ == "__main__":
+    main()
@@ -57,6 +57,13 @@ public:
     // 设置音量 0-1
     void setVolume(float volume);
 
+    /**
+     * 设置语音唤醒模型，wake_up_scheme 为 "kws" 时使用，需要在 begin 之前调用
+     *
+     * 使用案例见 kws/kws_tflite.h
+     */
+    void setWakeUpModel(KwsModel *model);
+
     /**
      * 手动设置 wifi账号/wifi密码/api_key/本地缓存数据，设置后会重新连接wifi
      * 设置成功会返回 true，失败返回 false
@@ -261,7 +268,9 @@ private:
     ESP_AI_volume_config volume_config;
     ESP_AI_reset_btn_config reset_btn_config;
     ESP_AI_lights_config lights_config;
+    ESP_AI_aec_config aec_config;
     bool debug;
+    KwsModel *kws_model = nullptr;
 
     void (*onReadyCb)() = nullptr;
     void (*onEventCb)(String command_id, String data) = nullptr;
@@ -279,6 +288,8 @@ private:
     void speaker_i2s_setup();
     void adjustVolume(int16_t *buffer, size_t length, float volume);
     void webSocketEvent(WStype_t type, uint8_t *payload, size_t length);
+    size_t webSocketBinChunk(WSopcode_t opcode, size_t offset, uint8_t *payload, size_t length, bool isFinal);
+    bool binBacklogDrain();
     int mic_i2s_init(uint32_t sampling_rate);
     void open_ap();
 
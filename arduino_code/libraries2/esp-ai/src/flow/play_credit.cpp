@@ -0,0 +1,137 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025-至今 小明IO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author 小明IO
+ * @email  1746809408@qq.com
+ * @github https://github.com/wangzongming/esp-ai
+ * @websit https://espai.fun
+ */
+#include "play_credit.h"
+
+void PlayCredit::begin(uint32_t window, sink_t sink)
+{
+    this->sink = sink;
+    win = window;
+    step = (uint64_t)window * PLAY_CREDIT_STEP_PERCENT / 100;
+    high = (uint64_t)window * PLAY_CREDIT_HIGH_PERCENT / 100;
+    low = (uint64_t)window * PLAY_CREDIT_LOW_PERCENT / 100;
+    if (step == 0)
+    {
+        step = 1;
+    }
+}
+
+void PlayCredit::setEnabled(bool enable)
+{
+    // 和 received 在同一个任务里调用，rx_base 之后收到的字节才属于服务端的计数
+    rx_base = rx_bytes.load();
+    enabled = enable;
+    restart = true;
+}
+
+void PlayCredit::received(size_t bytes)
+{
+    rx_bytes.fetch_add((uint32_t)bytes);
+}
+
+bool PlayCredit::update(size_t buffered)
+{
+    if (restart.exchange(false))
+    {
+        cur_consumed = 0;
+        reported = 0;
+        pending = true;
+        armed = false;
+    }
+    if (!enabled || !sink)
+    {
+        return false;
+    }
+
+    // 缓冲里可能还有启用前收到的数据或内置提示音，算出来的值变小时保持不变
+    uint32_t c = (rx_bytes.load() - rx_base.load()) - (uint32_t)buffered;
+    if ((int32_t)(c - cur_consumed) > 0)
+    {
+        cur_consumed = c;
+    }
+
+    uint32_t fresh = cur_consumed - reported;
+    bool fire = pending || fresh >= step;
+    if (buffered >= high)
+    {
+        armed = true;
+    }
+    else if (buffered <= low && armed && fresh > 0)
+    {
+        armed = false;
+        fire = true;
+    }
+    if (buffered == 0 && fresh > 0)
+    {
+        fire = true;
+    }
+    return fire && send();
+}
+
+bool PlayCredit::send()
+{
+    uint8_t msg[PLAY_CREDIT_MSG_LEN];
+    encode(msg, cur_consumed, win);
+    if (!sink(msg, sizeof(msg)))
+    {
+        return false;
+    }
+    reported = cur_consumed;
+    pending = false;
+    credits_sent++;
+    return true;
+}
+
+size_t PlayCredit::encode(uint8_t *out, uint32_t consumed, uint32_t window)
+{
+    out[0] = 'C';
+    out[1] = 'R';
+    for (int i = 0; i < 4; i++)
+    {
+        out[2 + i] = (uint8_t)(consumed >> (8 * i));
+        out[6 + i] = (uint8_t)(window >> (8 * i));
+    }
+    return PLAY_CREDIT_MSG_LEN;
+}
+
+bool PlayCredit::decode(const uint8_t *msg, size_t len, uint32_t *consumed, uint32_t *window)
+{
+    if (len != PLAY_CREDIT_MSG_LEN || msg[0] != 'C' || msg[1] != 'R')
+    {
+        return false;
+    }
+    uint32_t c = 0, w = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        c |= (uint32_t)msg[2 + i] << (8 * i);
+        w |= (uint32_t)msg[6 + i] << (8 * i);
+    }
+    *consumed = c;
+    *window = w;
+    return true;
+}
@@ -0,0 +1,102 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025-至今 小明IO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author 小明IO
+ * @email  1746809408@qq.com
+ * @github https://github.com/wangzongming/esp-ai
+ * @websit https://espai.fun
+ */
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+#include <functional>
+
+/**
+ * TTS 播放的额度流控（替代每秒一次的 client_available_audio）
+ *
+ * 连接参数带 flow=credit，服务端回复 {"type":"flow_control","mode":"credit"} 后启用，否则仍按原来的方式每秒上报。
+ * 设备统计收到的 TTS 二进制帧字节数（含 6 字节帧头，被丢弃或缓存的帧也算），减去播放缓冲里还没播放的字节，
+ * 得到"已消费"字节数 consumed。服务端必须保证：已发送字节数 <= consumed + window。
+ * consumed 是累计值，在途的数据不会被重复计算，丢一条额度消息也只是让服务端晚一点发送。
+ *
+ * 上报时机（播放任务每读一次缓冲调用一次 update）：
+ *   - 连接后的第一次 update：consumed = 0
+ *   - 上次上报后又腾出 PLAY_CREDIT_STEP_PERCENT 的缓冲
+ *   - 缓冲从高水位（PLAY_CREDIT_HIGH_PERCENT）以上降到低水位（PLAY_CREDIT_LOW_PERCENT）以下
+ *   - 缓冲播空，且还有没上报的消费
+ * 空闲时不发任何消息。
+ *
+ * 二进制帧格式（小端，固定 10 字节，服务端按长度和前两个字节区分于麦克风数据）：
+ *   [0..1]   'C' 'R'
+ *   [2..5]   uint32 consumed，连接建立后从 0 开始，允许回绕
+ *   [6..9]   uint32 window，播放缓冲大小
+ */
+
+#define PLAY_CREDIT_MSG_LEN 10
+#define PLAY_CREDIT_STEP_PERCENT 50
+#define PLAY_CREDIT_HIGH_PERCENT 50
+#define PLAY_CREDIT_LOW_PERCENT 25
+
+class PlayCredit
+{
+public:
+    // 返回 false 表示没发出去（比如拿不到 ws 锁），下次 update 重试
+    typedef std::function<bool(const uint8_t *msg, size_t len)> sink_t;
+
+    void begin(uint32_t window, sink_t sink);
+    // 启用 / 关闭，任意任务调用，下次 update 生效，计数从 0 开始
+    void setEnabled(bool enable);
+    bool isEnabled() { return enabled; }
+    // WS 任务：收下的二进制帧字节数
+    void received(size_t bytes);
+    // 播放任务：buffered 为播放缓冲中的字节数；返回是否发送了额度
+    bool update(size_t buffered);
+
+    uint32_t consumed() { return cur_consumed; }
+    uint32_t window() { return win; }
+
+    uint32_t credits_sent = 0; // 发送的额度消息数
+
+    static size_t encode(uint8_t *out, uint32_t consumed, uint32_t window);
+    static bool decode(const uint8_t *msg, size_t len, uint32_t *consumed, uint32_t *window);
+
+private:
+    bool send();
+
+    sink_t sink;
+    uint32_t win = 0;
+    uint32_t step = 0;
+    uint32_t high = 0;
+    uint32_t low = 0;
+
+    std::atomic<bool> enabled{false};
+    std::atomic<bool> restart{false}; // setEnabled 请求，由 update 执行
+    std::atomic<uint32_t> rx_bytes{0};
+    std::atomic<uint32_t> rx_base{0}; // 启用时的 rx_bytes
+
+    bool pending = false; // 连接后的初始额度还没发出
+    bool armed = false;   // 缓冲到过高水位，降到低水位时上报
+    uint32_t cur_consumed = 0;
+    uint32_t reported = 0;
+};
@@ -93,9 +93,14 @@ SemaphoreHandle_t esp_ai_ws_mutex;
 bool spk_ing = false;
 SemaphoreHandle_t audio_mutex = xSemaphoreCreateMutex();
 I2SStream esp_ai_spk_i2s;
-BufferRTOS<uint8_t> esp_ai_audio_buffer(AUDIO_BUFFER_SIZE, AUDIO_CHUNK_SIZE);
+// 触发级别为 1：播放任务阻塞在空缓冲上时，写入任何数据都会唤醒它，不足一块的句尾不用等到超时
+BufferRTOS<uint8_t> esp_ai_audio_buffer(AUDIO_BUFFER_SIZE, 1);
 QueueStream<uint8_t> esp_ai_spk_queue(esp_ai_audio_buffer);
-VolumeStream esp_ai_volume(esp_ai_spk_i2s);
+EchoReference esp_ai_echo_ref;
+EchoCanceller esp_ai_aec;
+volatile bool esp_ai_barge_in = false;
+EchoRefTap esp_ai_echo_tap(esp_ai_spk_i2s);
+VolumeStream esp_ai_volume(esp_ai_echo_tap);
 EncodedAudioStream esp_ai_dec(&esp_ai_volume, new MP3DecoderHelix());
 StreamCopy esp_ai_copier(esp_ai_dec, esp_ai_spk_queue);
 BufferPrint esp_ai_spk_buffer_print(esp_ai_audio_buffer);
@@ -104,6 +109,11 @@ WebsocketStream ws_stream;
 I2SStream esp_ai_i2s_input;
 VolumeStream esp_ai_mic_volume(esp_ai_i2s_input);
 StreamCopy mic_to_ws_copier(ws_stream, esp_ai_mic_volume, 1024);
+MicUplink esp_ai_mic_uplink;
+volatile uint8_t esp_ai_uplink_codec = UPLINK_UNKNOWN;
+PlayCredit esp_ai_play_credit;
+AssetPack esp_ai_prompt_pack;
+WakeWord esp_ai_wake_word;
 
 WebServer esp_ai_server(80);
 DNSServer esp_ai_dns_server;
@@ -148,8 +158,8 @@ int16_t *esp_ai_asr_sample_buffer = NULL;
 int16_t *mic_sample_buffer = NULL;
 
 // 音频缓存
-std::vector<uint8_t> esp_ai_cache_audio_du;
-std::vector<uint8_t> esp_ai_cache_audio_greetings;
+CachedAudio esp_ai_cache_audio_du("tone");
+CachedAudio esp_ai_cache_audio_greetings("greetings");
 
 long last_silence_time = 0;
 long last_not_silence_time = 0;
@@ -452,6 +462,25 @@ void mp3_player_write(const unsigned char *data, size_t len)
     }
 }
 
+size_t mp3_player_try_write(const unsigned char *data, size_t len)
+{
+    // 未在播放时和 mp3_player_write 一样丢弃，不能让发送端一直等待
+    if (!spk_ing)
+    {
+        return len;
+    }
+    int room = esp_ai_audio_buffer.availableForWrite();
+    if (room <= 0 || len == 0)
+    {
+        return 0;
+    }
+    if (len > (size_t)room)
+    {
+        len = room;
+    }
+    return esp_ai_spk_buffer_print.write(data, len);
+}
+
 void mp3_player_stop()
 {
     spk_ing = false;
@@ -492,6 +521,26 @@ void play_builtin_audio(const unsigned char *data, size_t len)
     spk_ing = false;
 }
 
+void play_prompt(const char *name, const unsigned char *data, size_t len)
+{
+    // 资源包里的数据映射在 flash 上，直接交给播放器，不拷贝
+    const uint8_t *pack_data;
+    size_t pack_len;
+    asset_codec_t codec;
+    if (esp_ai_prompt_pack.find(name, &pack_data, &pack_len, &codec) && codec == ASSET_CODEC_MP3)
+    {
+        data = pack_data;
+        len = pack_len;
+    }
+    if (data == nullptr || len == 0)
+    {
+        Serial.print("[Warn] -> 没有提示音：");
+        Serial.println(name);
+        return;
+    }
+    play_builtin_audio(data, len);
+}
+
 BLEServer *esp_ai_ble_server;
 BLECharacteristic *esp_ai_ble_characteristic;
 BLEService *esp_ai_ble_service;
@@ -75,6 +75,13 @@
 #include <HTTPClient.h>
 #include "nvs_flash.h"
 
+// 编译进固件的提示音，分区里的资源包缺少某个提示音时使用；
+// 已烧录资源包的设备可以定义为 0，固件减小约 200KB（见 assets/asset_pack.h）
+#ifndef ESP_AI_PROMPTS_IN_APP
+#define ESP_AI_PROMPTS_IN_APP 1
+#endif
+
+#if ESP_AI_PROMPTS_IN_APP
 #include "audio/zh/lian_jie_shi_bai.h"
 #include "audio/zh/lian_jie_zhong.h"
 #include "audio/zh/pei_wang_cheng_gong.h"
@@ -87,6 +94,17 @@
 #include "audio/zh/e_du_ka_bu_cun_zai.h"
 #include "audio/zh/mei_dian_le.h"
 #include "audio/zh/hui_fu_chu_chang.h"
+#endif
+
+#include "uplink/mic_uplink.h"
+#include "flow/play_credit.h"
+#include "assets/asset_pack.h"
+#include "cache/audio_cache.h"
+#include "msg/json_scan.h"
+#include "msg/ws_msg.h"
+#include "kws/wake_word.h"
+#include "aec/echo_reference.h"
+#include "aec/echo_canceller.h"
 // #include "audio/zh/jian_quan_shi_bai.h"
 // #include "audio/zh/pei_wang_xin_xi_yi_qing_chu.h"
 // #include "audio/zh/qing_lian_jie_fu_wu.h"
@@ -160,6 +178,7 @@ struct ESP_AI_i2s_config_speaker
  *     pin_high_listen：引脚高电平聆听(按下对话)
  *      pin_low_listen：引脚低电平聆听(按下对话)
  *       serial：串口字符唤醒
+ *          kws：设备上的语音唤醒，需要先调用 esp_ai.setWakeUpModel() 设置模型（见 kws/kws_tflite.h），threshold 为得分阈值
  *       custom：自定义，自行调用 esp_ai.wakeUp() 唤醒
  */
 // #define ESP_AI_WAKEUP_SCHEME "edge_impulse"
@@ -230,6 +249,15 @@ struct ESP_AI_lights_config
     int pin;
 };
 
+// 回声消除配置：播放时麦克风照常收音，用户说话可以打断播放（扬声器、麦克风都需要是 16 kHz）
+struct ESP_AI_aec_config
+{
+    // 是否启用，默认 false
+    bool enable;
+    // 扬声器 DMA 之外的延时（功放、麦克风的模数转换等），毫秒，一般为 0
+    int delay_ms;
+};
+
 struct ESP_AI_CONFIG
 {
     // debug 模式，输出更多信息
@@ -250,6 +278,8 @@ struct ESP_AI_CONFIG
     ESP_AI_reset_btn_config reset_btn_config;
     // 灯光配置
     ESP_AI_lights_config lights_config;
+    // 回声消除配置
+    ESP_AI_aec_config aec_config;
 };
 
 extern String esp_ai_net_status;
@@ -297,6 +327,44 @@ private:
 constexpr size_t AUDIO_BUFFER_SIZE = 1024 * 20; // 缓冲区中的总字节数
 constexpr size_t AUDIO_CHUNK_SIZE = 1024;       // 理想的读/写块大小
 extern I2SStream esp_ai_spk_i2s;
+// 回声消除的参考信号（扬声器实际播放的 PCM）和回声消除器，aec_config.enable 时启用
+extern EchoReference esp_ai_echo_ref;
+extern EchoCanceller esp_ai_aec;
+// 播放中检测到用户说话（打断），由唤醒任务处理
+extern volatile bool esp_ai_barge_in;
+
+// 音量调节之后的扬声器输出：原样写入 esp_ai_spk_i2s，write 返回后把播放的 PCM 记到回声消除的参考信号里
+class EchoRefTap : public AudioStream
+{
+public:
+    EchoRefTap(AudioStream &out) : _out(out) {}
+
+    virtual void setAudioInfo(AudioInfo info) override
+    {
+        AudioStream::setAudioInfo(info);
+        _out.setAudioInfo(info);
+    }
+
+    virtual int availableForWrite() override
+    {
+        return _out.availableForWrite();
+    }
+
+    virtual size_t write(const uint8_t *buffer, size_t size) override
+    {
+        size_t result = _out.write(buffer, size);
+        AudioInfo out_info = _out.audioInfo();
+        if (esp_ai_echo_ref.isReady() && out_info.sample_rate == 16000 && out_info.channels == 1 && out_info.bits_per_sample == 16)
+        {
+            esp_ai_echo_ref.write((const int16_t *)buffer, result / sizeof(int16_t), micros());
+        }
+        return result;
+    }
+
+private:
+    AudioStream &_out;
+};
+extern EchoRefTap esp_ai_echo_tap;
 extern EncodedAudioStream esp_ai_dec;
 extern MP3DecoderHelix esp_ai_dec_mp3;
 extern VolumeStream esp_ai_volume;
@@ -366,6 +434,16 @@ extern WebsocketStream ws_stream;
 extern I2SStream esp_ai_i2s_input;
 extern VolumeStream esp_ai_mic_volume;
 extern StreamCopy mic_to_ws_copier;
+// 麦克风上行（编码 + VAD），服务端通过 mic_format 选定编码后启用
+extern MicUplink esp_ai_mic_uplink;
+// 服务端选定的上行编码，UPLINK_UNKNOWN 表示按原方式上传原始 PCM
+extern volatile uint8_t esp_ai_uplink_codec;
+// TTS 播放额度流控，服务端通过 flow_control 启用
+extern PlayCredit esp_ai_play_credit;
+// "prompts" 分区里的提示音资源包
+extern AssetPack esp_ai_prompt_pack;
+// 设备上的语音唤醒（wake_up_scheme 为 kws）
+extern WakeWord esp_ai_wake_word;
 
 #define ESP_AI_ASR_SAMPLE_BUFFER_SIZE 16000
 extern int16_t *esp_ai_asr_sample_buffer;
@@ -388,9 +466,9 @@ extern bool esp_ai_played_connected;
 // Start sending audio to the service
 extern bool esp_ai_start_send_audio;
 
-// 音频缓存
-extern std::vector<uint8_t> esp_ai_cache_audio_du;
-extern std::vector<uint8_t> esp_ai_cache_audio_greetings; 
+// 音频缓存（服务端下发的提示音、问候语）
+extern CachedAudio esp_ai_cache_audio_du;
+extern CachedAudio esp_ai_cache_audio_greetings;
 
 extern long last_silence_time;
 extern long last_not_silence_time;
@@ -483,12 +561,21 @@ void print_task_info(void);
 bool mp3_player_is_playing();
 // 播放音频
 void mp3_player_write(const unsigned char *data, size_t len);
+// 播放音频，不等待：只写入队列放得下的部分，返回写入的字节数
+size_t mp3_player_try_write(const unsigned char *data, size_t len);
 // 立即停止播放
 void mp3_player_stop();
 // 死等待播放完成
 void wait_mp3_player_done();
 // 播放内置音频
 void play_builtin_audio(const unsigned char *data, size_t len);
+// 播放提示音：先找分区里的资源包，找不到时播放 data（编译进固件的数组，可以为空）
+void play_prompt(const char *name, const unsigned char *data, size_t len);
+#if ESP_AI_PROMPTS_IN_APP
+#define PLAY_PROMPT(name) play_prompt(#name, name, name##_len)
+#else
+#define PLAY_PROMPT(name) play_prompt(#name, nullptr, 0)
+#endif
 
 extern std::vector<int> digital_read_pins;
 extern std::vector<int> analog_read_pins;
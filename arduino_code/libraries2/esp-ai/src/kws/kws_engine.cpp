@@ -0,0 +1,164 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025-至今 小明IO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author 小明IO
+ * @email  1746809408@qq.com
+ * @github https://github.com/wangzongming/esp-ai
+ * @websit https://espai.fun
+ */
+#include "kws_engine.h"
+#include <string.h>
+
+bool KwsEngine::begin(KwsModel *model, float threshold, now_us_t now_us)
+{
+    this->model = model;
+    this->now_us = now_us;
+    if (model == nullptr || !model->begin())
+    {
+        this->model = nullptr;
+        return false;
+    }
+    labels = model->labels();
+    if (labels <= 0 || labels > KWS_MAX_LABELS)
+    {
+        this->model = nullptr;
+        return false;
+    }
+    for (int i = 0; i < labels; i++)
+    {
+        is_keyword[i] = model->keyword(i);
+    }
+    in_scale = model->inputScale();
+    in_zero_point = model->inputZeroPoint();
+    if (threshold < 0.0f)
+    {
+        threshold = 0.0f;
+    }
+    this->threshold = threshold >= 1.0f ? 255 : (uint8_t)(threshold * 255.0f + 0.5f);
+    clearStats();
+    reset();
+    return true;
+}
+
+void KwsEngine::reset()
+{
+    mfcc.reset();
+    history_len = 0;
+    history_pos = 0;
+    memset(smoothed, 0, sizeof(smoothed));
+    quiet_until = 0;
+}
+
+void KwsEngine::clearStats()
+{
+    memset(&st, 0, sizeof(st));
+}
+
+int KwsEngine::process(const int16_t *pcm, size_t samples)
+{
+    int found = -1;
+    while (samples > 0)
+    {
+        // 按帧边界切开，每一帧都有机会推理，结果和调用方怎么切分数据无关
+        size_t n = mfcc.until_frame();
+        if (n > samples)
+        {
+            n = samples;
+        }
+        uint32_t t0 = now_us ? now_us() : 0;
+        int frames = mfcc.write(pcm, n);
+        if (frames > 0)
+        {
+            uint32_t us = now_us ? now_us() - t0 : 0;
+            st.frames++;
+            st.frontend_us += us;
+            if (us > st.frontend_us_max)
+            {
+                st.frontend_us_max = us;
+            }
+            int label = on_frame();
+            if (found < 0)
+            {
+                found = label;
+            }
+        }
+        pcm += n;
+        samples -= n;
+    }
+    return found;
+}
+
+int KwsEngine::on_frame()
+{
+    uint32_t frame = mfcc.frames();
+    if (model == nullptr || frame < KWS_WINDOW_FRAMES || frame % KWS_INVOKE_STRIDE != 0)
+    {
+        return -1;
+    }
+
+    mfcc.window(input, in_scale, in_zero_point);
+    uint8_t *scores = history[history_pos];
+    uint32_t t0 = now_us ? now_us() : 0;
+    bool ok = model->invoke(input, scores);
+    uint32_t us = now_us ? now_us() - t0 : 0;
+    st.invokes++;
+    st.invoke_us += us;
+    if (us > st.invoke_us_max)
+    {
+        st.invoke_us_max = us;
+    }
+    if (!ok)
+    {
+        return -1;
+    }
+    history_pos = (history_pos + 1) % KWS_SMOOTH;
+    if (history_len < KWS_SMOOTH)
+    {
+        history_len++;
+    }
+
+    int best = -1;
+    for (int i = 0; i < labels; i++)
+    {
+        uint32_t sum = 0;
+        for (int h = 0; h < history_len; h++)
+        {
+            sum += history[h][i];
+        }
+        smoothed[i] = (uint8_t)((sum + history_len / 2) / history_len);
+        if (is_keyword[i] && smoothed[i] >= threshold && (best < 0 || smoothed[i] > smoothed[best]))
+        {
+            best = i;
+        }
+    }
+    // 平均要满 KWS_SMOOTH 次，单次的尖峰不触发
+    if (best < 0 || history_len < KWS_SMOOTH || frame < quiet_until)
+    {
+        return -1;
+    }
+    st.detections++;
+    quiet_until = frame + KWS_REFRACTORY_FRAMES;
+    history_len = 0;
+    history_pos = 0;
+    return best;
+}
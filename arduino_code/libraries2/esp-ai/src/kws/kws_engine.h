@@ -0,0 +1,97 @@
+/**
+ * Copyright (c) 2024 小明IO
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Commercial use of this software requires prior written authorization from the Licensor.
+ * 请注意：将 ESP-AI 代码用于商业用途需要事先获得许可方的授权。
+ * 删除与修改版权属于侵权行为，请尊重作者版权，避免产生不必要的纠纷。
+ *
+ * @author 小明IO
+ * @email  1746809408@qq.com
+ * @github https://github.com/wangzongming/esp-ai
+ * @websit https://espai.fun
+ */
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include "kws_mfcc.h"
+#include "kws_model.h"
+
+/**
+ * 唤醒词检测：MFCC 前端 + 模型 + 判决，不依赖 FreeRTOS，设备（WakeWord）和 test/host/kws_test 共用
+ *
+ * 每 KWS_INVOKE_STRIDE 帧（100 ms）用最近 1 秒的特征推理一次，最近 KWS_SMOOTH 次得分取平均，
+ * 平均分达到阈值的唤醒词算检测到；之后 KWS_REFRACTORY_FRAMES 帧内不再触发，得分历史清空。
+ * 窗口填满（复位后 1 秒）之前不推理。
+ *
+ * 预算（ESP32 240 MHz，一个核）：
+ *   前端    每 20 ms 一帧，目标 < 1 ms（5%）
+ *   模型    每 100 ms 一次，目标 < 50 ms（50%），超过 100 ms 时采集会溢出
+ *   延时    唤醒词说完到检测到：推理间隔 + 推理耗时 + 平滑（KWS_SMOOTH - 1 个间隔），目标 < 400 ms
+ * stats() 记录实际的耗时，开启 debug 时 WakeWord 定期打印。
+ */
+
+#define KWS_INVOKE_STRIDE 5       // 帧，100 ms
+#define KWS_SMOOTH 3              // 平均的推理次数
+#define KWS_REFRACTORY_FRAMES 75  // 1.5 秒
+
+struct kws_stats_t
+{
+    uint32_t frames;
+    uint32_t invokes;
+    uint32_t detections;
+    uint64_t frontend_us; // 累计
+    uint32_t frontend_us_max;
+    uint64_t invoke_us;   // 累计
+    uint32_t invoke_us_max;
+};
+
+class KwsEngine
+{
+public:
+    typedef uint32_t (*now_us_t)();
+
+    // threshold 0..1；now_us 为微秒时钟，用来统计耗时，可以为空
+    bool begin(KwsModel *model, float threshold, now_us_t now_us = nullptr);
+    // 清空前端和得分历史（比如会话结束后重新开始监听）
+    void reset();
+    // 送入 16 kHz PCM，检测到唤醒词时返回标签，否则返回 -1；一次送入多个唤醒词时只报告第一个
+    int process(const int16_t *pcm, size_t samples);
+
+    // 最近一次推理的平滑得分
+    uint8_t score(int label) const { return label >= 0 && label < KWS_MAX_LABELS ? smoothed[label] : 0; }
+    const kws_stats_t &stats() const { return st; }
+    void clearStats();
+    const KwsMfcc &frontend() const { return mfcc; }
+
+private:
+    int on_frame();
+
+    KwsMfcc mfcc;
+    KwsModel *model = nullptr;
+    now_us_t now_us = nullptr;
+    int labels = 0;
+    uint8_t threshold = 230;
+    float in_scale = 1.0f;
+    int in_zero_point = 0;
+    bool is_keyword[KWS_MAX_LABELS];
+
+    int8_t input[KWS_WINDOW_FRAMES * KWS_MFCC_COEFFS];
+    uint8_t history[KWS_SMOOTH][KWS_MAX_LABELS];
+    uint8_t history_len = 0;
+    uint8_t history_pos = 0;
+    uint8_t smoothed[KWS_MAX_LABELS];
+    uint32_t quiet_until = 0; // 帧号，之前不触发
+    kws_stats_t st;
+};
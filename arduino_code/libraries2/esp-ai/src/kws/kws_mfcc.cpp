@@ -0,0 +1,231 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025-至今 小明IO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author 小明IO
+ * @email  1746809408@qq.com
+ * @github https://github.com/wangzongming/esp-ai
+ * @websit https://espai.fun
+ */
+#include "kws_mfcc.h"
+#include "kws_tables.h"
+#include "../dsp/fft_int.h"
+#include <string.h>
+#include <math.h>
+
+#define PRE_EMPHASIS_Q15 31785 // 0.97
+
+static inline int16_t sat16(int32_t v)
+{
+    return v > 32767 ? 32767 : v < -32768 ? -32768 : (int16_t)v;
+}
+
+// log2(v)，Q16；v > 0
+static int32_t log2_q16(uint64_t v)
+{
+    int e = 63 - __builtin_clzll(v);
+    // 尾数取 21 位：[2^20, 2^21)
+    uint32_t m = e >= 20 ? (uint32_t)(v >> (e - 20)) : (uint32_t)(v << (20 - e));
+    uint32_t frac = m - (1u << 20);
+    uint32_t idx = frac >> 15;
+    uint32_t rem = frac & 0x7FFF;
+    uint32_t lo = kws_log2[idx];
+    uint32_t hi = kws_log2[idx + 1];
+    return (int32_t)(e << 16) + (int32_t)(lo + (((hi - lo) * rem) >> 15));
+}
+
+void KwsMfcc::compute(const int16_t *frame, int16_t *mfcc, int32_t *log_mel)
+{
+    int32_t re[KWS_FFT_LEN];
+    int32_t im[KWS_FFT_LEN];
+
+    // 加窗（Q15 乘积不舍入），找峰值
+    int32_t peak = 0;
+    for (int i = 0; i < KWS_FRAME_LEN; i++)
+    {
+        int32_t v = frame[i] * kws_hann[i];
+        re[i] = v;
+        int32_t a = v < 0 ? -v : v;
+        if (a > peak)
+        {
+            peak = a;
+        }
+    }
+    memset(re + KWS_FRAME_LEN, 0, (KWS_FFT_LEN - KWS_FRAME_LEN) * sizeof(int32_t));
+    memset(im, 0, sizeof(im));
+
+    // 块浮点：峰值归一化到 [2^13, 2^14)，小信号也有足够的有效位；shift 是相对加窗后采样的放大倍数（log2）
+    int shift = 0;
+    if (peak > 0)
+    {
+        int r = (32 - __builtin_clz((uint32_t)peak)) - 14;
+        shift = 15 - r;
+        for (int i = 0; i < KWS_FRAME_LEN; i++)
+        {
+            re[i] = r > 0 ? (re[i] + (1 << (r - 1))) >> r : re[i] << -r;
+        }
+    }
+    fft_int(re, im, KWS_FFT_BITS);
+
+    // 功率谱 -> mel
+    uint64_t mel[KWS_MEL_BANDS + 1];
+    memset(mel, 0, sizeof(mel));
+    for (int k = 0; k < KWS_MEL_BINS; k++)
+    {
+        int32_t r = re[KWS_MEL_FIRST_BIN + k];
+        int32_t i = im[KWS_MEL_FIRST_BIN + k];
+        // |X|^2 之和不超过 N * 480 * 2^28（Parseval），乘上 Q15 权重也在 64 位以内
+        uint64_t p = (uint64_t)((int64_t)r * r + (int64_t)i * i);
+        int band = kws_mel_band[k];
+        uint32_t w = kws_mel_weight[k];
+        mel[band] += p * w; // band == KWS_MEL_BANDS 时落在多出来的一项里，不用
+        if (band > 0)
+        {
+            mel[band - 1] += p * (32768 - w);
+        }
+    }
+
+    // log2：真实功率 = mel * 2^-15（权重）* 2^(-2 * shift)
+    int32_t scale = (-15 - 2 * shift) * 65536;
+    int32_t floor_q16 = KWS_LOG_FLOOR << 16;
+    int32_t lm[KWS_MEL_BANDS];
+    for (int b = 0; b < KWS_MEL_BANDS; b++)
+    {
+        int32_t v = mel[b] ? log2_q16(mel[b]) + scale : floor_q16;
+        lm[b] = v < floor_q16 ? floor_q16 : v;
+        if (log_mel != nullptr)
+        {
+            log_mel[b] = lm[b];
+        }
+    }
+
+    // DCT：Q16 * Q15 -> Q31 -> Q(KWS_MFCC_FRAC_BITS)
+    const int out_shift = 31 - KWS_MFCC_FRAC_BITS;
+    for (int k = 0; k < KWS_MFCC_COEFFS; k++)
+    {
+        const int16_t *row = kws_dct + k * KWS_MEL_BANDS;
+        int64_t acc = 0;
+        for (int b = 0; b < KWS_MEL_BANDS; b++)
+        {
+            acc += (int64_t)lm[b] * row[b];
+        }
+        acc += (int64_t)1 << (out_shift - 1);
+        int64_t v = acc >> out_shift;
+        mfcc[k] = v > 32767 ? 32767 : v < -32768 ? -32768 : (int16_t)v;
+    }
+}
+
+KwsMfcc::KwsMfcc()
+{
+    int16_t zeros[KWS_FRAME_LEN];
+    memset(zeros, 0, sizeof(zeros));
+    compute(zeros, silence);
+    reset();
+}
+
+void KwsMfcc::reset()
+{
+    fill = 0;
+    prev = 0;
+    head = 0;
+    frame_count = 0;
+}
+
+int KwsMfcc::write(const int16_t *pcm, size_t count)
+{
+    int frames = 0;
+    while (count > 0)
+    {
+        size_t n = KWS_FRAME_LEN - fill;
+        if (n > count)
+        {
+            n = count;
+        }
+        // 预加重：y = x - 0.97 * x[-1]
+        int16_t *out = samples + fill;
+        int32_t p = prev;
+        for (size_t i = 0; i < n; i++)
+        {
+            int32_t x = pcm[i];
+            out[i] = sat16(x - ((p * PRE_EMPHASIS_Q15 + (1 << 14)) >> 15));
+            p = x;
+        }
+        prev = (int16_t)p;
+        fill += n;
+        pcm += n;
+        count -= n;
+        if (fill == KWS_FRAME_LEN)
+        {
+            push_frame();
+            frames++;
+            // 保留和下一帧重叠的部分
+            memmove(samples, samples + KWS_HOP, (KWS_FRAME_LEN - KWS_HOP) * sizeof(int16_t));
+            fill = KWS_FRAME_LEN - KWS_HOP;
+        }
+    }
+    return frames;
+}
+
+void KwsMfcc::push_frame()
+{
+    compute(samples, ring[head]);
+    head = head + 1 == KWS_WINDOW_FRAMES ? 0 : head + 1;
+    frame_count++;
+}
+
+const int16_t *KwsMfcc::last() const
+{
+    if (frame_count == 0)
+    {
+        return silence;
+    }
+    return ring[head == 0 ? KWS_WINDOW_FRAMES - 1 : head - 1];
+}
+
+void KwsMfcc::window(int16_t *out) const
+{
+    uint32_t have = frame_count < KWS_WINDOW_FRAMES ? frame_count : KWS_WINDOW_FRAMES;
+    uint32_t pad = KWS_WINDOW_FRAMES - have;
+    for (uint32_t i = 0; i < pad; i++)
+    {
+        memcpy(out + i * KWS_MFCC_COEFFS, silence, sizeof(silence));
+    }
+    // 环形缓冲里最旧的一帧：未写满时在 0，写满后在 head
+    uint32_t idx = have == KWS_WINDOW_FRAMES ? head : 0;
+    for (uint32_t i = pad; i < KWS_WINDOW_FRAMES; i++)
+    {
+        memcpy(out + i * KWS_MFCC_COEFFS, ring[idx], sizeof(ring[idx]));
+        idx = idx + 1 == KWS_WINDOW_FRAMES ? 0 : idx + 1;
+    }
+}
+
+void KwsMfcc::window(int8_t *out, float scale, int zero_point) const
+{
+    int16_t tmp[KWS_WINDOW_FRAMES * KWS_MFCC_COEFFS];
+    window(tmp);
+    float k = 1.0f / ((1 << KWS_MFCC_FRAC_BITS) * scale);
+    for (int i = 0; i < KWS_WINDOW_FRAMES * KWS_MFCC_COEFFS; i++)
+    {
+        int32_t q = (int32_t)lrintf(tmp[i] * k) + zero_point;
+        out[i] = q > 127 ? 127 : q < -128 ? -128 : (int8_t)q;
+    }
+}
@@ -0,0 +1,89 @@
+/**
+ * Copyright (c) 2024 小明IO
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Commercial use of this software requires prior written authorization from the Licensor.
+ * 请注意：将 ESP-AI 代码用于商业用途需要事先获得许可方的授权。
+ * 删除与修改版权属于侵权行为，请尊重作者版权，避免产生不必要的纠纷。
+ *
+ * @author 小明IO
+ * @email  1746809408@qq.com
+ * @github https://github.com/wangzongming/esp-ai
+ * @websit https://espai.fun
+ */
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * 语音唤醒（KWS）的 MFCC 前端，全定点
+ *
+ * 16 kHz 单声道，每 20 ms（KWS_HOP 个采样）算一帧 30 ms（KWS_FRAME_LEN）的特征：
+ *   预加重 0.97 -> Hann 窗 -> 块浮点归一化 -> 512 点 FFT（32 位数据、64 位乘法）-> 功率谱
+ *   -> 40 个 mel 三角滤波器（20..4000 Hz）-> log2 -> DCT-II（正交归一）取前 10 个系数
+ * 系数单位是 log2(功率)，Q6 定点（1 = 3.01 dB），存在 KWS_WINDOW_FRAMES 帧的环形缓冲里。
+ *
+ * 增量计算：write() 可以按任意长度送数据，凑满一个 hop 就算一帧，旧的帧不重算；
+ * 模型需要的 1 秒窗口由 window() 从环形缓冲按时间顺序展开。同样的输入无论怎么切分，结果逐位相同。
+ *
+ * 训练模型时必须用同样的特征，test/host/kws_test --dump 可以把 WAV 文件转成特征。
+ */
+
+#define KWS_SAMPLE_RATE 16000
+#define KWS_FRAME_LEN 480 // 30 ms
+#define KWS_HOP 320       // 20 ms
+#define KWS_FFT_BITS 9
+#define KWS_FFT_LEN (1 << KWS_FFT_BITS)
+#define KWS_MEL_BANDS 40
+#define KWS_MEL_LOW_HZ 20
+#define KWS_MEL_HIGH_HZ 4000
+#define KWS_MFCC_COEFFS 10
+#define KWS_MFCC_FRAC_BITS 6
+#define KWS_WINDOW_FRAMES 49 // 1 秒
+#define KWS_LOG_FLOOR 0      // log2(功率) 的下限，静音时的值
+
+class KwsMfcc
+{
+public:
+    KwsMfcc();
+    void reset();
+
+    // 送入 PCM，返回新算出的帧数
+    int write(const int16_t *pcm, size_t samples);
+
+    // 再送多少个采样会得到下一帧
+    size_t until_frame() const { return KWS_FRAME_LEN - fill; }
+    // 已算出的帧数（从 reset 起）
+    uint32_t frames() const { return frame_count; }
+    // 最新一帧的系数
+    const int16_t *last() const;
+    // 最近 KWS_WINDOW_FRAMES 帧，旧的在前，不足时前面补 KWS_LOG_FLOOR 对应的静音帧
+    void window(int16_t *out) const;
+    // 同上，量化成 int8：q = round(c / 2^KWS_MFCC_FRAC_BITS / scale) + zero_point
+    void window(int8_t *out, float scale, int zero_point) const;
+
+    // 单帧计算（frame 为 KWS_FRAME_LEN 个已预加重的采样），供测试和特征导出使用
+    static void compute(const int16_t *frame, int16_t *mfcc, int32_t *log_mel = nullptr);
+
+private:
+    void push_frame();
+
+    int16_t samples[KWS_FRAME_LEN]; // 预加重后的最近 KWS_FRAME_LEN 个采样
+    size_t fill = 0;                // samples 里已有的采样数
+    int16_t prev = 0;               // 预加重的上一个输入采样
+    int16_t ring[KWS_WINDOW_FRAMES][KWS_MFCC_COEFFS];
+    uint8_t head = 0; // 下一帧写入的位置
+    uint32_t frame_count = 0;
+    int16_t silence[KWS_MFCC_COEFFS];
+};
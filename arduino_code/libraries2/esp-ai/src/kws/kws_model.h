@@ -0,0 +1,59 @@
+/**
+ * Copyright (c) 2024 小明IO
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Commercial use of this software requires prior written authorization from the Licensor.
+ * 请注意：将 ESP-AI 代码用于商业用途需要事先获得许可方的授权。
+ * 删除与修改版权属于侵权行为，请尊重作者版权，避免产生不必要的纠纷。
+ *
+ * @author 小明IO
+ * @email  1746809408@qq.com
+ * @github https://github.com/wangzongming/esp-ai
+ * @websit https://espai.fun
+ */
+#pragma once
+#include <stdint.h>
+#include "kws_mfcc.h"
+
+#define KWS_MAX_LABELS 8
+
+/**
+ * 唤醒词模型接口
+ *
+ * 输入是 KwsMfcc 的 1 秒窗口（KWS_WINDOW_FRAMES 帧 x KWS_MFCC_COEFFS 个系数，旧帧在前），按模型的输入量化参数转成 int8；
+ * 输出是每个标签 0..255 的得分。TFLite Micro 模型见 kws_tflite.h，也可以自己实现（模板匹配、别的推理框架）。
+ * invoke() 在唤醒词任务里调用，不会和 begin() 并发。
+ */
+class KwsModel
+{
+public:
+    virtual ~KwsModel() {}
+
+    // 分配张量等，失败返回 false
+    virtual bool begin() = 0;
+    virtual int labels() = 0;
+    virtual const char *label(int i) = 0;
+    // 输入量化：int8 = round(系数 / scale) + zero_point，系数单位为 log2(功率)
+    virtual float inputScale() = 0;
+    virtual int inputZeroPoint() = 0;
+    // features: KWS_WINDOW_FRAMES * KWS_MFCC_COEFFS 个 int8；scores: labels() 个得分
+    virtual bool invoke(const int8_t *features, uint8_t *scores) = 0;
+
+    // 标签是否是唤醒词，默认不以 '_' 开头的都是（_silence_、_unknown_ 不是）
+    virtual bool keyword(int i)
+    {
+        const char *name = label(i);
+        return name != nullptr && name[0] != '_';
+    }
+};
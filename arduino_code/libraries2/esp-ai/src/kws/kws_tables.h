@@ -0,0 +1,92 @@
+// 由 make_tables.py 生成，不要手工修改
+#pragma once
+#include <stdint.h>
+
+// Hann 窗，Q15
+static const int16_t kws_hann[480] = {
+    0, 1, 6, 13, 22, 35, 51, 69, 90, 114, 140, 170, 202, 237, 274, 315,
+    358, 404, 453, 504, 558, 615, 675, 737, 802, 869, 940, 1013, 1088, 1166, 1247, 1331,
+    1416, 1505, 1596, 1690, 1786, 1884, 1985, 2089, 2195, 2303, 2414, 2528, 2643, 2761, 2882, 3004,
+    3129, 3256, 3386, 3517, 3651, 3787, 3926, 4066, 4208, 4353, 4499, 4648, 4799, 4951, 5106, 5263,
+    5421, 5581, 5743, 5907, 6073, 6241, 6410, 6581, 6754, 6928, 7104, 7282, 7461, 7641, 7823, 8007,
+    8192, 8378, 8566, 8755, 8946, 9138, 9331, 9525, 9720, 9917, 10114, 10313, 10512, 10713, 10915, 11118,
+    11321, 11525, 11731, 11937, 12144, 12351, 12559, 12768, 12978, 13188, 13398, 13609, 13821, 14033, 14245, 14458,
+    14671, 14885, 15099, 15312, 15527, 15741, 15955, 16170, 16384, 16598, 16813, 17027, 17241, 17456, 17669, 17883,
+    18097, 18310, 18523, 18735, 18947, 19159, 19370, 19580, 19790, 20000, 20209, 20417, 20624, 20831, 21037, 21243,
+    21447, 21650, 21853, 22055, 22256, 22455, 22654, 22851, 23048, 23243, 23437, 23630, 23822, 24013, 24202, 24390,
+    24576, 24761, 24945, 25127, 25307, 25486, 25664, 25840, 26014, 26187, 26358, 26527, 26695, 26861, 27025, 27187,
+    27347, 27505, 27662, 27817, 27969, 28120, 28269, 28415, 28560, 28702, 28842, 28981, 29117, 29251, 29382, 29512,
+    29639, 29764, 29886, 30007, 30125, 30240, 30354, 30465, 30573, 30679, 30783, 30884, 30982, 31078, 31172, 31263,
+    31352, 31437, 31521, 31602, 31680, 31755, 31828, 31899, 31966, 32031, 32093, 32153, 32210, 32264, 32315, 32364,
+    32410, 32453, 32494, 32531, 32566, 32598, 32628, 32654, 32678, 32699, 32717, 32733, 32746, 32755, 32762, 32767,
+    32767, 32767, 32762, 32755, 32746, 32733, 32717, 32699, 32678, 32654, 32628, 32598, 32566, 32531, 32494, 32453,
+    32410, 32364, 32315, 32264, 32210, 32153, 32093, 32031, 31966, 31899, 31828, 31755, 31680, 31602, 31521, 31437,
+    31352, 31263, 31172, 31078, 30982, 30884, 30783, 30679, 30573, 30465, 30354, 30240, 30125, 30007, 29886, 29764,
+    29639, 29512, 29382, 29251, 29117, 28981, 28842, 28702, 28560, 28415, 28269, 28120, 27969, 27817, 27662, 27505,
+    27347, 27187, 27025, 26861, 26695, 26527, 26358, 26187, 26014, 25840, 25664, 25486, 25307, 25127, 24945, 24761,
+    24576, 24390, 24202, 24013, 23822, 23630, 23437, 23243, 23048, 22851, 22654, 22455, 22256, 22055, 21853, 21650,
+    21447, 21243, 21037, 20831, 20624, 20417, 20209, 20000, 19790, 19580, 19370, 19159, 18947, 18735, 18523, 18310,
+    18097, 17883, 17669, 17456, 17241, 17027, 16813, 16598, 16384, 16170, 15955, 15741, 15527, 15312, 15099, 14885,
+    14671, 14458, 14245, 14033, 13821, 13609, 13398, 13188, 12978, 12768, 12559, 12351, 12144, 11937, 11731, 11525,
+    11321, 11118, 10915, 10713, 10512, 10313, 10114, 9917, 9720, 9525, 9331, 9138, 8946, 8755, 8566, 8378,
+    8192, 8007, 7823, 7641, 7461, 7282, 7104, 6928, 6754, 6581, 6410, 6241, 6073, 5907, 5743, 5581,
+    5421, 5263, 5106, 4951, 4799, 4648, 4499, 4353, 4208, 4066, 3926, 3787, 3651, 3517, 3386, 3256,
+    3129, 3004, 2882, 2761, 2643, 2528, 2414, 2303, 2195, 2089, 1985, 1884, 1786, 1690, 1596, 1505,
+    1416, 1331, 1247, 1166, 1088, 1013, 940, 869, 802, 737, 675, 615, 558, 504, 453, 404,
+    358, 315, 274, 237, 202, 170, 140, 114, 90, 69, 51, 35, 22, 13, 6, 1,
+};
+
+// mel 滤波器：频点 KWS_MEL_FIRST_BIN 起，上升沿所在的滤波器和权重（Q15，32768 = 1）
+#define KWS_MEL_FIRST_BIN 1
+#define KWS_MEL_BINS 127
+static const int8_t kws_mel_band[127] = {
+    0, 1, 2, 2, 3, 4, 5, 6, 6, 7, 8, 8, 9, 9, 10, 11,
+    11, 12, 12, 13, 13, 14, 14, 15, 15, 16, 16, 17, 17, 17, 18, 18,
+    19, 19, 19, 20, 20, 21, 21, 21, 22, 22, 22, 23, 23, 23, 24, 24,
+    24, 25, 25, 25, 25, 26, 26, 26, 27, 27, 27, 27, 28, 28, 28, 28,
+    29, 29, 29, 29, 30, 30, 30, 30, 31, 31, 31, 31, 31, 32, 32, 32,
+    32, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 35, 35, 35, 35, 35,
+    35, 36, 36, 36, 36, 36, 37, 37, 37, 37, 37, 37, 38, 38, 38, 38,
+    38, 38, 39, 39, 39, 39, 39, 39, 39, 40, 40, 40, 40, 40, 40,
+};
+static const uint16_t kws_mel_weight[127] = {
+    11103, 8302, 4298, 31951, 25808, 18710, 10723, 1908, 25085, 14768, 3768, 24894, 12647, 32596, 19236, 5364,
+    23774, 8955, 26465, 10789, 27483, 11028, 26978, 9812, 25082, 7265, 21910, 3493, 17563, 31361, 12131, 25417,
+    5694, 18505, 31091, 10691, 22850, 2037, 13797, 25366, 3983, 15190, 26225, 4324, 15028, 25575, 3201, 13446,
+    23547, 739, 10562, 20253, 29814, 6481, 15793, 24986, 1295, 10258, 19110, 27854, 3724, 12260, 20694, 29031,
+    4504, 12651, 20707, 28672, 3783, 11575, 19284, 26910, 1688, 9156, 16546, 23861, 31102, 5502, 12600, 19627,
+    26587, 711, 7538, 14300, 20999, 27636, 1444, 7960, 14418, 20817, 27160, 680, 6912, 13091, 19217, 25291,
+    31314, 4519, 10442, 16316, 22143, 27923, 889, 6577, 12220, 17819, 23375, 28888, 1590, 7020, 12408, 17756,
+    23065, 28334, 797, 5990, 11146, 16265, 21347, 26394, 31405, 3614, 8556, 13464, 18339, 23181, 27991,
+};
+
+// DCT-II（正交归一），KWS_MFCC_COEFFS 行 x KWS_MEL_BANDS 列，Q15
+static const int16_t kws_dct[400] = {
+    5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181,
+    5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181, 5181,
+    7321, 7276, 7186, 7052, 6874, 6654, 6393, 6092, 5754, 5380, 4974, 4536, 4071, 3580, 3068, 2536, 1989, 1429, 861, 288,
+    -288, -861, -1429, -1989, -2536, -3068, -3580, -4071, -4536, -4974, -5380, -5754, -6092, -6393, -6654, -6874, -7052, -7186, -7276, -7321,
+    7305, 7125, 6769, 6247, 5572, 4759, 3828, 2804, 1710, 575, -575, -1710, -2804, -3828, -4759, -5572, -6247, -6769, -7125, -7305,
+    -7305, -7125, -6769, -6247, -5572, -4759, -3828, -2804, -1710, -575, 575, 1710, 2804, 3828, 4759, 5572, 6247, 6769, 7125, 7305,
+    7276, 6874, 6092, 4974, 3580, 1989, 288, -1429, -3068, -4536, -5754, -6654, -7186, -7321, -7052, -6393, -5380, -4071, -2536, -861,
+    861, 2536, 4071, 5380, 6393, 7052, 7321, 7186, 6654, 5754, 4536, 3068, 1429, -288, -1989, -3580, -4974, -6092, -6874, -7276,
+    7237, 6529, 5181, 3326, 1146, -1146, -3326, -5181, -6529, -7237, -7237, -6529, -5181, -3326, -1146, 1146, 3326, 5181, 6529, 7237,
+    7237, 6529, 5181, 3326, 1146, -1146, -3326, -5181, -6529, -7237, -7237, -6529, -5181, -3326, -1146, 1146, 3326, 5181, 6529, 7237,
+    7186, 6092, 4071, 1429, -1429, -4071, -6092, -7186, -7186, -6092, -4071, -1429, 1429, 4071, 6092, 7186, 7186, 6092, 4071, 1429,
+    -1429, -4071, -6092, -7186, -7186, -6092, -4071, -1429, 1429, 4071, 6092, 7186, 7186, 6092, 4071, 1429, -1429, -4071, -6092, -7186,
+    7125, 5572, 2804, -575, -3828, -6247, -7305, -6769, -4759, -1710, 1710, 4759, 6769, 7305, 6247, 3828, 575, -2804, -5572, -7125,
+    -7125, -5572, -2804, 575, 3828, 6247, 7305, 6769, 4759, 1710, -1710, -4759, -6769, -7305, -6247, -3828, -575, 2804, 5572, 7125,
+    7052, 4974, 1429, -2536, -5754, -7276, -6654, -4071, -288, 3580, 6393, 7321, 6092, 3068, -861, -4536, -6874, -7186, -5380, -1989,
+    1989, 5380, 7186, 6874, 4536, 861, -3068, -6092, -7321, -6393, -3580, 288, 4071, 6654, 7276, 5754, 2536, -1429, -4974, -7052,
+    6969, 4307, 0, -4307, -6969, -6969, -4307, 0, 4307, 6969, 6969, 4307, 0, -4307, -6969, -6969, -4307, 0, 4307, 6969,
+    6969, 4307, 0, -4307, -6969, -6969, -4307, 0, 4307, 6969, 6969, 4307, 0, -4307, -6969, -6969, -4307, 0, 4307, 6969,
+    6874, 3580, -1429, -5754, -7321, -5380, -861, 4071, 7052, 6654, 3068, -1989, -6092, -7276, -4974, -288, 4536, 7186, 6393, 2536,
+    -2536, -6393, -7186, -4536, 288, 4974, 7276, 6092, 1989, -3068, -6654, -7052, -4071, 861, 5380, 7321, 5754, 1429, -3580, -6874,
+};
+
+// log2(1 + i/32)，Q16
+static const uint32_t kws_log2[33] = {
+    0, 2909, 5732, 8473, 11136, 13727, 16248, 18704, 21098, 23433, 25711,
+    27936, 30109, 32234, 34312, 36346, 38336, 40286, 42196, 44068, 45904, 47705,
+    49472, 51207, 52911, 54584, 56229, 57845, 59434, 60997, 62534, 64047, 65536,
+};
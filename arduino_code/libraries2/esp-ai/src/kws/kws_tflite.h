@@ -0,0 +1,141 @@
+/**
+ * Copyright (c) 2024 小明IO
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Commercial use of this software requires prior written authorization from the Licensor.
+ * 请注意：将 ESP-AI 代码用于商业用途需要事先获得许可方的授权。
+ * 删除与修改版权属于侵权行为，请尊重作者版权，避免产生不必要的纠纷。
+ *
+ * @author 小明IO
+ * @email  1746809408@qq.com
+ * @github https://github.com/wangzongming/esp-ai
+ * @websit https://espai.fun
+ */
+#pragma once
+/**
+ * TensorFlow Lite Micro 唤醒词模型
+ *
+ * 只有 include 本文件时才需要 TFLM 库（和 arduino-audio-tools 的 TfLiteAudioStream 用同一个 TensorFlowLite 库），
+ * 不用语音唤醒的工程不受影响。模型输入为 int8 [1, KWS_WINDOW_FRAMES, KWS_MFCC_COEFFS, 1]（或同样大小的任意形状），
+ * 输出为 int8 的各标签概率，算子：DepthwiseConv2D、Conv2D、FullyConnected、Softmax、Reshape、AveragePool2D、MaxPool2D。
+ * 训练数据的特征必须用 KwsMfcc 计算（test/host/kws_test --dump）。
+ *
+ *   #include "kws/kws_tflite.h"
+ *   #include "model_data.h"
+ *   static const char *labels[] = {"_silence_", "_unknown_", "xiao_ming"};
+ *   KwsTfLiteModel kws_model(g_model, labels, 3, 30 * 1024);
+ *   ...
+ *   esp_ai.setWakeUpModel(&kws_model);
+ *   esp_ai.begin(config); // wake_up_scheme 为 "kws"
+ */
+#include <TensorFlowLite.h>
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "esp_heap_caps.h"
+#include "kws_model.h"
+
+class KwsTfLiteModel : public KwsModel
+{
+public:
+    KwsTfLiteModel(const unsigned char *model_data, const char *const *labels, int label_count, size_t arena_size)
+        : model_data(model_data), names(labels), count(label_count), arena_size(arena_size) {}
+
+    bool begin() override
+    {
+        if (interpreter != nullptr)
+        {
+            return true;
+        }
+        const tflite::Model *model = tflite::GetModel(model_data);
+        if (model->version() != TFLITE_SCHEMA_VERSION)
+        {
+            Serial.printf("[Error] -> 唤醒词模型版本 %lu，需要 %d\n", (unsigned long)model->version(), TFLITE_SCHEMA_VERSION);
+            return false;
+        }
+        resolver.AddDepthwiseConv2D();
+        resolver.AddConv2D();
+        resolver.AddFullyConnected();
+        resolver.AddSoftmax();
+        resolver.AddReshape();
+        resolver.AddAveragePool2D();
+        resolver.AddMaxPool2D();
+
+        arena = (uint8_t *)heap_caps_malloc(arena_size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (arena == nullptr)
+        {
+            Serial.printf("[Error] -> 唤醒词模型内存不足（%u 字节）\n", (unsigned)arena_size);
+            return false;
+        }
+        interpreter = new tflite::MicroInterpreter(model, resolver, arena, arena_size);
+        if (interpreter->AllocateTensors() != kTfLiteOk)
+        {
+            Serial.println(F("[Error] -> 唤醒词模型 AllocateTensors 失败，请加大 arena_size"));
+            end();
+            return false;
+        }
+        input = interpreter->input(0);
+        output = interpreter->output(0);
+        if (input->type != kTfLiteInt8 || input->bytes != KWS_WINDOW_FRAMES * KWS_MFCC_COEFFS ||
+            output->type != kTfLiteInt8 || output->bytes != (size_t)count)
+        {
+            Serial.println(F("[Error] -> 唤醒词模型的输入或输出和特征、标签数不符"));
+            end();
+            return false;
+        }
+        return true;
+    }
+
+    void end()
+    {
+        delete interpreter;
+        interpreter = nullptr;
+        heap_caps_free(arena);
+        arena = nullptr;
+    }
+
+    int labels() override { return count; }
+    const char *label(int i) override { return i >= 0 && i < count ? names[i] : nullptr; }
+    float inputScale() override { return input->params.scale; }
+    int inputZeroPoint() override { return input->params.zero_point; }
+
+    bool invoke(const int8_t *features, uint8_t *scores) override
+    {
+        memcpy(input->data.int8, features, KWS_WINDOW_FRAMES * KWS_MFCC_COEFFS);
+        if (interpreter->Invoke() != kTfLiteOk)
+        {
+            return false;
+        }
+        // 输出概率反量化后映射到 0..255
+        float scale = output->params.scale * 255.0f;
+        int zero_point = output->params.zero_point;
+        for (int i = 0; i < count; i++)
+        {
+            float v = (output->data.int8[i] - zero_point) * scale;
+            scores[i] = v <= 0.0f ? 0 : v >= 255.0f ? 255 : (uint8_t)(v + 0.5f);
+        }
+        return true;
+    }
+
+private:
+    const unsigned char *model_data;
+    const char *const *names;
+    int count;
+    size_t arena_size;
+    uint8_t *arena = nullptr;
+    tflite::MicroMutableOpResolver<7> resolver;
+    tflite::MicroInterpreter *interpreter = nullptr;
+    TfLiteTensor *input = nullptr;
+    TfLiteTensor *output = nullptr;
+};
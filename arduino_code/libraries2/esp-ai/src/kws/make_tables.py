@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+# 生成 KWS MFCC 前端的常量表（kws_tables.h），参数和 kws_mfcc.h 的宏一致，修改参数后重新生成：
+#
+#   python3 make_tables.py > kws_tables.h
+#
+# 表都是整数常量，设备和 test/host 用同一份，保证特征逐位相同。
+
+import math
+import re
+import os
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+
+def macros():
+    text = open(os.path.join(HERE, "kws_mfcc.h"), encoding="utf-8").read()
+    return {m.group(1): int(m.group(2)) for m in re.finditer(r"#define (KWS_\w+) (-?\d+)\b", text)}
+
+
+def q15(v):
+    return max(-32768, min(32767, int(round(v * 32768))))
+
+
+def mel(f):
+    return 2595.0 * math.log10(1.0 + f / 700.0)
+
+
+def fmt(name, ctype, values, per_line=16):
+    lines = ["static const %s %s[%d] = {" % (ctype, name, len(values))]
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    m = macros()
+    rate, frame, fft_bits = m["KWS_SAMPLE_RATE"], m["KWS_FRAME_LEN"], m["KWS_FFT_BITS"]
+    bands, low, high, coeffs = m["KWS_MEL_BANDS"], m["KWS_MEL_LOW_HZ"], m["KWS_MEL_HIGH_HZ"], m["KWS_MFCC_COEFFS"]
+    n = 1 << fft_bits
+
+    hann = [min(32767, q15(0.5 - 0.5 * math.cos(2 * math.pi * i / frame))) for i in range(frame)]
+
+    # 每个频点最多落在两个相邻滤波器上：上升沿属于 band[k]，权重 w；下降沿属于 band[k] - 1，权重 32768 - w
+    edges = [mel(low) + (mel(high) - mel(low)) * i / (bands + 1) for i in range(bands + 2)]
+    band, weight = [], []
+    first = last = None
+    for k in range(n // 2 + 1):
+        f = mel(k * rate / n)
+        j = -1
+        for i in range(bands + 1):
+            if edges[i] <= f < edges[i + 1]:
+                j = i
+                break
+        if j < 0:
+            band.append(-1)
+            weight.append(0)
+            continue
+        first = k if first is None else first
+        last = k
+        band.append(j)
+        weight.append(int(round((f - edges[j]) / (edges[j + 1] - edges[j]) * 32768)))
+    band = band[first:last + 1]
+    weight = [min(32768, w) for w in weight[first:last + 1]]
+
+    dct = []
+    for k in range(coeffs):
+        s = math.sqrt((1.0 if k == 0 else 2.0) / bands)
+        dct += [q15(s * math.cos(math.pi * k * (b + 0.5) / bands)) for b in range(bands)]
+
+    log2_t = [int(round(math.log2(1 + i / 32.0) * 65536)) for i in range(33)]
+
+    print("// 由 make_tables.py 生成，不要手工修改")
+    print("#pragma once")
+    print("#include <stdint.h>")
+    print("")
+    print("// Hann 窗，Q15")
+    print(fmt("kws_hann", "int16_t", hann))
+    print("")
+    print("// mel 滤波器：频点 KWS_MEL_FIRST_BIN 起，上升沿所在的滤波器和权重（Q15，32768 = 1）")
+    print("#define KWS_MEL_FIRST_BIN %d" % first)
+    print("#define KWS_MEL_BINS %d" % len(band))
+    print(fmt("kws_mel_band", "int8_t", band))
+    print(fmt("kws_mel_weight", "uint16_t", weight))
+    print("")
+    print("// DCT-II（正交归一），KWS_MFCC_COEFFS 行 x KWS_MEL_BANDS 列，Q15")
+    print(fmt("kws_dct", "int16_t", dct, bands // 2 if bands % 2 == 0 else 10))
+    print("")
+    print("// log2(1 + i/32)，Q16")
+    print(fmt("kws_log2", "uint32_t", log2_t, 11))
+
+
+if __name__ == "__main__":
+    main()
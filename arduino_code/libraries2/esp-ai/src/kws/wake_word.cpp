@@ -0,0 +1,230 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025-至今 小明IO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author 小明IO
+ * @email  1746809408@qq.com
+ * @github https://github.com/wangzongming/esp-ai
+ * @websit https://espai.fun
+ */
+#include "wake_word.h"
+#include "esp_timer.h"
+
+#define KWS_WAKE_REPORT_MS 30000
+
+static uint32_t wake_word_now_us()
+{
+    return (uint32_t)esp_timer_get_time();
+}
+
+bool WakeWord::begin(KwsModel *model, float threshold, bool debug)
+{
+    end();
+    if (handle_lock == nullptr)
+    {
+        handle_lock = xSemaphoreCreateMutex();
+    }
+    this->model = model;
+    this->debug = debug;
+    if (!engine.begin(model, threshold, wake_word_now_us))
+    {
+        return false;
+    }
+    state[0] = BUF_FREE;
+    state[1] = BUF_FREE;
+    write_idx = 0;
+    fill = 0;
+    gap = true;
+
+#if CONFIG_FREERTOS_UNICORE
+    BaseType_t core = tskNO_AFFINITY;
+#else
+    BaseType_t core = 0; // Arduino 的 loop 和 WiFi 回调在核 1
+#endif
+    TaskHandle_t handle = nullptr;
+    if (xTaskCreatePinnedToCore(WakeWord::task_wrapper, "wake_word", KWS_WAKE_STACK, this, 2, &handle, core) != pdPASS)
+    {
+        return false;
+    }
+    task_handle = handle;
+    if (debug)
+    {
+        Serial.printf("[Info] -> 语音唤醒已启动，标签：");
+        for (int i = 0; i < model->labels(); i++)
+        {
+            Serial.printf(i ? ", %s" : "%s", model->label(i));
+        }
+        Serial.printf("，阈值 %.2f\n", threshold);
+    }
+    return true;
+}
+
+void WakeWord::end()
+{
+    if (handle_lock == nullptr)
+    {
+        return;
+    }
+    xSemaphoreTake(handle_lock, portMAX_DELAY);
+    TaskHandle_t handle = task_handle;
+    task_handle = nullptr;
+    if (handle != nullptr)
+    {
+        vTaskDelete(handle);
+    }
+    xSemaphoreGive(handle_lock);
+}
+
+void WakeWord::suspend()
+{
+    TaskHandle_t handle = task_handle;
+    if (handle != nullptr)
+    {
+        vTaskSuspend(handle);
+    }
+}
+
+void WakeWord::resume()
+{
+    TaskHandle_t handle = task_handle;
+    if (handle != nullptr)
+    {
+        vTaskResume(handle);
+    }
+}
+
+void WakeWord::feed(const int16_t *pcm, size_t samples)
+{
+    if (task_handle == nullptr)
+    {
+        return;
+    }
+    uint32_t now = millis();
+    if (now - last_feed_ms > KWS_WAKE_GAP_MS)
+    {
+        gap = true;
+        fill = 0;
+    }
+    last_feed_ms = now;
+
+    while (samples > 0)
+    {
+        if (fill == 0)
+        {
+            // 这块缓冲还没处理完：丢掉一整块，保持和处理任务的交替顺序
+            dropping = state[write_idx].load(std::memory_order_acquire) != BUF_FREE;
+            if (dropping)
+            {
+                overruns++;
+                gap = true;
+            }
+        }
+        size_t n = KWS_WAKE_BUF - fill;
+        if (n > samples)
+        {
+            n = samples;
+        }
+        if (!dropping)
+        {
+            memcpy(buf[write_idx] + fill, pcm, n * sizeof(int16_t));
+        }
+        fill += n;
+        pcm += n;
+        samples -= n;
+        if (fill == KWS_WAKE_BUF)
+        {
+            fill = 0;
+            if (!dropping)
+            {
+                reset_before[write_idx] = gap;
+                gap = false;
+                full_at_us[write_idx] = wake_word_now_us();
+                state[write_idx].store(BUF_FULL, std::memory_order_release);
+                // end() 正在删除任务时不通知；任务没删掉的话 1 秒超时后也会处理
+                if (xSemaphoreTake(handle_lock, 0) == pdTRUE)
+                {
+                    if (task_handle != nullptr)
+                    {
+                        xTaskNotifyGive(task_handle);
+                    }
+                    xSemaphoreGive(handle_lock);
+                }
+                write_idx ^= 1;
+            }
+        }
+    }
+}
+
+void WakeWord::task_wrapper(void *arg)
+{
+    static_cast<WakeWord *>(arg)->task();
+}
+
+void WakeWord::task()
+{
+    uint8_t read_idx = 0;
+    uint32_t last_report = millis();
+    while (true)
+    {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(1000));
+        while (state[read_idx].load(std::memory_order_acquire) == BUF_FULL)
+        {
+            if (reset_before[read_idx])
+            {
+                engine.reset();
+            }
+            int label = engine.process(buf[read_idx], KWS_WAKE_BUF);
+            uint32_t lag = wake_word_now_us() - full_at_us[read_idx];
+            if (lag > lag_us_max)
+            {
+                lag_us_max = lag;
+            }
+            state[read_idx].store(BUF_FREE, std::memory_order_release);
+            read_idx ^= 1;
+
+            if (label >= 0)
+            {
+                if (debug)
+                {
+                    Serial.printf("\n[Info] √ 唤醒成功 => %s 得分: %.2f\n", model->label(label), engine.score(label) / 255.0f);
+                }
+                detected.store(label);
+            }
+        }
+
+        if (debug && millis() - last_report >= KWS_WAKE_REPORT_MS)
+        {
+            last_report = millis();
+            const kws_stats_t &st = engine.stats();
+            if (st.frames > 0)
+            {
+                Serial.printf("[Info] -> 语音唤醒：前端 %lu us/帧（最大 %lu），推理 %lu us/次（最大 %lu），处理延时最大 %lu us，丢弃 %lu 块\n",
+                              (unsigned long)(st.frontend_us / st.frames), (unsigned long)st.frontend_us_max,
+                              (unsigned long)(st.invokes ? st.invoke_us / st.invokes : 0), (unsigned long)st.invoke_us_max,
+                              (unsigned long)lag_us_max, (unsigned long)overruns);
+            }
+            engine.clearStats();
+            lag_us_max = 0;
+        }
+    }
+    vTaskDelete(NULL);
+}
@@ -0,0 +1,98 @@
+/**
+ * Copyright (c) 2024 小明IO
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Commercial use of this software requires prior written authorization from the Licensor.
+ * 请注意：将 ESP-AI 代码用于商业用途需要事先获得许可方的授权。
+ * 删除与修改版权属于侵权行为，请尊重作者版权，避免产生不必要的纠纷。
+ *
+ * @author 小明IO
+ * @email  1746809408@qq.com
+ * @github https://github.com/wangzongming/esp-ai
+ * @websit https://espai.fun
+ */
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "kws_engine.h"
+
+/**
+ * 设备上的语音唤醒：采集和推理分开
+ *
+ * send_audio 任务空闲（没有会话、没有播放）时从 I2S 读麦克风，调用 feed() 把 16 kHz PCM 写进双缓冲，不做计算；
+ * 缓冲写满后通知唤醒词任务（核 0），任务按顺序用 KwsEngine 处理。推理慢于采集时，写满的缓冲还没处理完，
+ * 新数据被丢弃并计入 overruns，不会阻塞采集。两次 feed() 间隔超过 KWS_WAKE_GAP_MS（会话期间不送数据）
+ * 时，下一块数据前先复位前端，旧的特征不会和新的拼在一起。
+ *
+ * 检测结果由 on_wakeup 任务通过 take() 取走后调用 wakeUp()，唤醒流程（播放提示音等）不在推理任务里执行。
+ *
+ * 任务句柄只在这里保存，ESP_AI 删除、挂起任务时调用 end() / suspend()；end() 和 feed() 的通知互斥，
+ * 不会通知已经删除的任务。
+ */
+
+#define KWS_WAKE_BUF (KWS_HOP * 4) // 80 ms
+#define KWS_WAKE_GAP_MS 200
+#define KWS_WAKE_STACK (1024 * 8)  // FFT 的 4 KB 缓冲在栈上
+
+class WakeWord
+{
+public:
+    // 创建唤醒词任务，任务句柄由本类持有
+    bool begin(KwsModel *model, float threshold, bool debug);
+    // 删除唤醒词任务，之后 feed() 不再通知（ESP_AI::delAllTask）
+    void end();
+    // 挂起、恢复唤醒词任务（ESP_AI::suspendAllTask / resumeAllTask）
+    void suspend();
+    void resume();
+    bool isActive() const { return task_handle != nullptr; }
+
+    // 送入 16 kHz 单声道 PCM，只拷贝数据，不阻塞
+    void feed(const int16_t *pcm, size_t samples);
+    // 取走检测到的唤醒词标签，没有时返回 -1
+    int take() { return detected.exchange(-1); }
+
+    uint32_t overruns = 0; // 因推理跟不上丢弃的缓冲数
+
+private:
+    enum : uint8_t
+    {
+        BUF_FREE,
+        BUF_FULL
+    };
+
+    static void task_wrapper(void *arg);
+    void task();
+
+    KwsEngine engine;
+    KwsModel *model = nullptr;
+    bool debug = false;
+    TaskHandle_t volatile task_handle = nullptr;
+    SemaphoreHandle_t handle_lock = nullptr; // 删除任务和 feed() 的通知互斥
+
+    int16_t buf[2][KWS_WAKE_BUF];
+    std::atomic<uint8_t> state[2];
+    bool reset_before[2];    // 处理这块数据前先复位
+    uint32_t full_at_us[2];  // 写满的时间，统计处理延时
+    uint8_t write_idx = 0;
+    size_t fill = 0;
+    bool dropping = false;   // 当前缓冲在丢数据（对方还没处理完）
+    bool gap = true;         // 距上次 feed 太久
+    uint32_t last_feed_ms = 0;
+
+    std::atomic<int> detected{-1};
+    uint32_t lag_us_max = 0;
+};
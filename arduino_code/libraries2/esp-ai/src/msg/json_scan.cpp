@@ -0,0 +1,731 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025-至今 小明IO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author 小明IO
+ * @email  1746809408@qq.com
+ * @github https://github.com/wangzongming/esp-ai
+ * @websit https://espai.fun
+ */
+#include "json_scan.h"
+#include <string.h>
+#include <stdlib.h>
+#include <limits.h>
+
+static inline bool is_ws(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static inline bool is_digit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+static inline int hex_value(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+bool JsonView::equals(const char *str) const
+{
+    size_t k = strlen(str);
+    return !esc && len == k && memcmp(p, str, k) == 0;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  JsonTokenizer
+//----------------------------------------------------------------------------------------------------------------------
+void JsonTokenizer::begin(const char *json, size_t len)
+{
+    s = json;
+    n = len;
+    at = 0;
+    state = ST_VALUE;
+    level = 0;
+    is_array = 0;
+}
+
+JsonToken JsonTokenizer::next()
+{
+    JsonToken tok;
+    tok.type = JSON_TOK_ERROR;
+    tok.view.p = s;
+    tok.view.len = 0;
+    tok.view.esc = false;
+    for (;;)
+    {
+        if (state == ST_ERROR)
+        {
+            return tok;
+        }
+        while (at < n && is_ws(s[at]))
+        {
+            at++;
+        }
+        tok.view.p = s + at;
+        if (at >= n)
+        {
+            if (state == ST_DONE)
+            {
+                tok.type = JSON_TOK_END;
+                return tok;
+            }
+            return error(tok);
+        }
+
+        char c = s[at];
+        switch (state)
+        {
+        case ST_DONE:
+            // 结尾多余的内容
+            return error(tok);
+        case ST_COLON:
+            if (c != ':')
+            {
+                return error(tok);
+            }
+            at++;
+            state = ST_VALUE;
+            continue;
+        case ST_COMMA_OR_END:
+            if (c == ',')
+            {
+                at++;
+                state = (is_array >> (level - 1)) & 1 ? ST_VALUE : ST_KEY;
+                continue;
+            }
+            return close(c, tok);
+        case ST_KEY_OR_END:
+            if (c == '}')
+            {
+                return close(c, tok);
+            }
+            // fall through
+        case ST_KEY:
+            if (c != '"' || !string(tok.view))
+            {
+                return error(tok);
+            }
+            tok.type = JSON_TOK_KEY;
+            state = ST_COLON;
+            return tok;
+        case ST_VALUE_OR_END:
+            if (c == ']')
+            {
+                return close(c, tok);
+            }
+            return value(tok);
+        default:
+            return value(tok);
+        }
+    }
+}
+
+JsonToken JsonTokenizer::value(JsonToken &tok)
+{
+    char c = s[at];
+    switch (c)
+    {
+    case '{':
+    case '[':
+        if (level >= JSON_SCAN_MAX_DEPTH)
+        {
+            return error(tok);
+        }
+        if (c == '[')
+        {
+            is_array |= 1u << level;
+            state = ST_VALUE_OR_END;
+            tok.type = JSON_TOK_ARR_BEGIN;
+        }
+        else
+        {
+            is_array &= ~(1u << level);
+            state = ST_KEY_OR_END;
+            tok.type = JSON_TOK_OBJ_BEGIN;
+        }
+        level++;
+        at++;
+        tok.view.len = 1;
+        return tok;
+    case '"':
+        if (!string(tok.view))
+        {
+            return error(tok);
+        }
+        tok.type = JSON_TOK_STRING;
+        break;
+    case 't':
+        if (!literal("true", 4))
+        {
+            return error(tok);
+        }
+        tok.type = JSON_TOK_TRUE;
+        tok.view.len = 4;
+        break;
+    case 'f':
+        if (!literal("false", 5))
+        {
+            return error(tok);
+        }
+        tok.type = JSON_TOK_FALSE;
+        tok.view.len = 5;
+        break;
+    case 'n':
+        if (!literal("null", 4))
+        {
+            return error(tok);
+        }
+        tok.type = JSON_TOK_NULL;
+        tok.view.len = 4;
+        break;
+    default:
+        if (c != '-' && !is_digit(c))
+        {
+            return error(tok);
+        }
+        if (!number(tok.view))
+        {
+            return error(tok);
+        }
+        tok.type = JSON_TOK_NUMBER;
+        break;
+    }
+    after_value();
+    return tok;
+}
+
+JsonToken JsonTokenizer::close(char c, JsonToken &tok)
+{
+    if (level == 0)
+    {
+        return error(tok);
+    }
+    bool arr = (is_array >> (level - 1)) & 1;
+    if (c != (arr ? ']' : '}'))
+    {
+        return error(tok);
+    }
+    level--;
+    at++;
+    tok.type = arr ? JSON_TOK_ARR_END : JSON_TOK_OBJ_END;
+    tok.view.len = 1;
+    after_value();
+    return tok;
+}
+
+void JsonTokenizer::after_value()
+{
+    state = level == 0 ? ST_DONE : ST_COMMA_OR_END;
+}
+
+bool JsonTokenizer::string(JsonView &view)
+{
+    // at 指向左引号
+    bool esc = false;
+    size_t i = at + 1;
+    while (i < n)
+    {
+        unsigned char c = (unsigned char)s[i];
+        if (c == '"')
+        {
+            view.p = s + at + 1;
+            view.len = i - at - 1;
+            view.esc = esc;
+            at = i + 1;
+            return true;
+        }
+        if (c < 0x20)
+        {
+            return false;
+        }
+        if (c != '\\')
+        {
+            i++;
+            continue;
+        }
+        esc = true;
+        if (i + 1 >= n)
+        {
+            return false;
+        }
+        switch (s[i + 1])
+        {
+        case '"':
+        case '\\':
+        case '/':
+        case 'b':
+        case 'f':
+        case 'n':
+        case 'r':
+        case 't':
+            i += 2;
+            break;
+        case 'u':
+            if (i + 5 >= n)
+            {
+                return false;
+            }
+            for (size_t k = 2; k < 6; k++)
+            {
+                if (hex_value(s[i + k]) < 0)
+                {
+                    return false;
+                }
+            }
+            i += 6;
+            break;
+        default:
+            return false;
+        }
+    }
+    return false;
+}
+
+bool JsonTokenizer::number(JsonView &view)
+{
+    size_t i = at;
+    if (s[i] == '-')
+    {
+        i++;
+    }
+    if (i >= n || !is_digit(s[i]))
+    {
+        return false;
+    }
+    if (s[i] == '0')
+    {
+        i++;
+    }
+    else
+    {
+        while (i < n && is_digit(s[i]))
+            i++;
+    }
+    if (i < n && s[i] == '.')
+    {
+        i++;
+        if (i >= n || !is_digit(s[i]))
+        {
+            return false;
+        }
+        while (i < n && is_digit(s[i]))
+            i++;
+    }
+    if (i < n && (s[i] == 'e' || s[i] == 'E'))
+    {
+        i++;
+        if (i < n && (s[i] == '+' || s[i] == '-'))
+        {
+            i++;
+        }
+        if (i >= n || !is_digit(s[i]))
+        {
+            return false;
+        }
+        while (i < n && is_digit(s[i]))
+            i++;
+    }
+    view.p = s + at;
+    view.len = i - at;
+    view.esc = false;
+    at = i;
+    return true;
+}
+
+bool JsonTokenizer::literal(const char *word, size_t k)
+{
+    if (n - at < k || memcmp(s + at, word, k) != 0)
+    {
+        return false;
+    }
+    at += k;
+    return true;
+}
+
+JsonToken JsonTokenizer::error(JsonToken &tok)
+{
+    state = ST_ERROR;
+    tok.type = JSON_TOK_ERROR;
+    tok.view.p = s + at;
+    tok.view.len = 0;
+    return tok;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  JsonScan
+//----------------------------------------------------------------------------------------------------------------------
+bool JsonScan::parse(const char *json, size_t len)
+{
+    n = 0;
+    JsonTokenizer tz;
+    tz.begin(json, len);
+    JsonToken tok = tz.next();
+    if (tok.type != JSON_TOK_OBJ_BEGIN)
+    {
+        return false;
+    }
+
+    JsonView key = {nullptr, 0, false};
+    for (;;)
+    {
+        tok = tz.next();
+        uint8_t kind = JSON_NONE;
+        JsonView val = tok.view;
+        switch (tok.type)
+        {
+        case JSON_TOK_END:
+            return true;
+        case JSON_TOK_OBJ_END:
+            // 顶层对象结束，下一个 token 是 END
+            continue;
+        case JSON_TOK_KEY:
+            key = tok.view;
+            continue;
+        case JSON_TOK_OBJ_BEGIN:
+        case JSON_TOK_ARR_BEGIN:
+        {
+            // 嵌套的对象 / 数组只校验，记整段原文
+            kind = tok.type == JSON_TOK_OBJ_BEGIN ? JSON_OBJECT : JSON_ARRAY;
+            uint8_t depth = tz.depth();
+            while (tz.depth() >= depth)
+            {
+                if (tz.next().type == JSON_TOK_ERROR)
+                {
+                    n = 0;
+                    return false;
+                }
+            }
+            val.len = tz.pos() - (val.p - json);
+            break;
+        }
+        case JSON_TOK_STRING:
+            kind = JSON_STRING;
+            break;
+        case JSON_TOK_NUMBER:
+            kind = JSON_NUMBER;
+            break;
+        case JSON_TOK_TRUE:
+            kind = JSON_TRUE;
+            break;
+        case JSON_TOK_FALSE:
+            kind = JSON_FALSE;
+            break;
+        case JSON_TOK_NULL:
+            kind = JSON_NULL;
+            break;
+        default:
+            n = 0;
+            return false;
+        }
+        if (n < JSON_SCAN_MAX_FIELDS)
+        {
+            fields[n].key = key;
+            fields[n].val = val;
+            fields[n].kind = kind;
+            n++;
+        }
+    }
+}
+
+const JsonField *JsonScan::find(const char *key) const
+{
+    size_t k = strlen(key);
+    for (uint8_t i = 0; i < n; i++)
+    {
+        const JsonView &v = fields[i].key;
+        if (v.len == k && !v.esc && memcmp(v.p, key, k) == 0)
+        {
+            return &fields[i];
+        }
+    }
+    return nullptr;
+}
+
+json_kind_t JsonScan::kind(const char *key) const
+{
+    const JsonField *f = find(key);
+    return f ? (json_kind_t)f->kind : JSON_NONE;
+}
+
+JsonView JsonScan::raw(const char *key) const
+{
+    const JsonField *f = find(key);
+    if (f && f->kind == JSON_STRING)
+    {
+        return f->val;
+    }
+    JsonView empty = {"", 0, false};
+    return empty;
+}
+
+size_t JsonScan::str(const char *key, char *buf, size_t cap) const
+{
+    const JsonField *f = find(key);
+    if (f && f->kind == JSON_STRING)
+    {
+        return unescape(f->val, buf, cap);
+    }
+    if (cap > 0)
+    {
+        buf[0] = '\0';
+    }
+    return 0;
+}
+
+bool JsonScan::is(const char *key, const char *s) const
+{
+    const JsonField *f = find(key);
+    if (!f || f->kind != JSON_STRING)
+    {
+        return false;
+    }
+    if (!f->val.esc)
+    {
+        return f->val.equals(s);
+    }
+    // 展开后只会变短，原文放得下就不会截断；带转义的长字符串不比较
+    char tmp[64];
+    if (f->val.len >= sizeof(tmp))
+    {
+        return false;
+    }
+    size_t k = strlen(s);
+    return unescape(f->val, tmp, sizeof(tmp)) == k && memcmp(tmp, s, k) == 0;
+}
+
+long JsonScan::num(const char *key, long def) const
+{
+    const JsonField *f = find(key);
+    if (!f || f->kind != JSON_NUMBER)
+    {
+        return def;
+    }
+    const char *p = f->val.p;
+    size_t len = f->val.len;
+    bool neg = *p == '-';
+    size_t i = neg ? 1 : 0;
+    // 按绝对值累加，超过 long 的范围时停在边界
+    unsigned long long limit = neg ? (unsigned long long)LONG_MAX + 1 : (unsigned long long)LONG_MAX;
+    unsigned long long v = 0;
+    for (; i < len && is_digit(p[i]); i++)
+    {
+        unsigned d = p[i] - '0';
+        v = v > (limit - d) / 10 ? limit : v * 10 + d;
+    }
+    if (i < len)
+    {
+        // 小数或指数，少见，交给 strtod
+        char tmp[40];
+        if (len >= sizeof(tmp))
+        {
+            len = sizeof(tmp) - 1;
+        }
+        memcpy(tmp, p, len);
+        tmp[len] = '\0';
+        double d = strtod(tmp, nullptr);
+        if (d >= (double)LONG_MAX)
+            return LONG_MAX;
+        if (d <= (double)LONG_MIN)
+            return LONG_MIN;
+        return (long)d;
+    }
+    if (v >= limit)
+    {
+        return neg ? LONG_MIN : LONG_MAX;
+    }
+    return neg ? -(long)v : (long)v;
+}
+
+bool JsonScan::boolean(const char *key, bool def) const
+{
+    const JsonField *f = find(key);
+    if (f && f->kind == JSON_TRUE)
+    {
+        return true;
+    }
+    if (f && f->kind == JSON_FALSE)
+    {
+        return false;
+    }
+    return def;
+}
+
+static size_t utf8_encode(uint32_t cp, char *out)
+{
+    if (cp < 0x80)
+    {
+        out[0] = (char)cp;
+        return 1;
+    }
+    if (cp < 0x800)
+    {
+        out[0] = (char)(0xC0 | (cp >> 6));
+        out[1] = (char)(0x80 | (cp & 0x3F));
+        return 2;
+    }
+    if (cp < 0x10000)
+    {
+        out[0] = (char)(0xE0 | (cp >> 12));
+        out[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        out[2] = (char)(0x80 | (cp & 0x3F));
+        return 3;
+    }
+    out[0] = (char)(0xF0 | (cp >> 18));
+    out[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+    out[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+    out[3] = (char)(0x80 | (cp & 0x3F));
+    return 4;
+}
+
+static uint32_t hex4(const char *p)
+{
+    return (uint32_t)(hex_value(p[0]) << 12 | hex_value(p[1]) << 8 | hex_value(p[2]) << 4 | hex_value(p[3]));
+}
+
+size_t JsonScan::unescape(const JsonView &view, char *out, size_t cap)
+{
+    if (cap == 0)
+    {
+        return 0;
+    }
+    const char *p = view.p;
+    size_t len = view.len;
+    size_t limit = cap - 1;
+    size_t o = 0;
+    size_t i = 0;
+
+    if (!view.esc)
+    {
+        // 没有转义：整段复制，截断时退回到 UTF-8 字符开头
+        size_t k = len;
+        if (k > limit)
+        {
+            k = limit;
+            while (k > 0 && ((unsigned char)p[k] & 0xC0) == 0x80)
+            {
+                k--;
+            }
+        }
+        memcpy(out, p, k);
+        out[k] = '\0';
+        return k;
+    }
+
+    while (i < len)
+    {
+        char ch[4];
+        size_t k;
+        unsigned char c = (unsigned char)p[i];
+        if (c != '\\')
+        {
+            k = c < 0x80 ? 1 : c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : c >= 0xC0 ? 2 : 1;
+            if (i + k > len)
+            {
+                k = len - i;
+            }
+            if (o + k > limit)
+            {
+                break;
+            }
+            memcpy(out + o, p + i, k);
+            o += k;
+            i += k;
+            continue;
+        }
+        if (i + 1 >= len)
+        {
+            break;
+        }
+        char e = p[i + 1];
+        i += 2;
+        switch (e)
+        {
+        case 'b':
+            ch[0] = '\b';
+            k = 1;
+            break;
+        case 'f':
+            ch[0] = '\f';
+            k = 1;
+            break;
+        case 'n':
+            ch[0] = '\n';
+            k = 1;
+            break;
+        case 'r':
+            ch[0] = '\r';
+            k = 1;
+            break;
+        case 't':
+            ch[0] = '\t';
+            k = 1;
+            break;
+        case 'u':
+        {
+            if (i + 4 > len)
+            {
+                i = len;
+                k = 0;
+                break;
+            }
+            uint32_t cp = hex4(p + i);
+            i += 4;
+            if (cp >= 0xD800 && cp <= 0xDBFF && i + 6 <= len && p[i] == '\\' && p[i + 1] == 'u')
+            {
+                uint32_t lo = hex4(p + i + 2);
+                if (lo >= 0xDC00 && lo <= 0xDFFF)
+                {
+                    cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+                    i += 6;
+                }
+            }
+            if (cp >= 0xD800 && cp <= 0xDFFF)
+            {
+                cp = 0xFFFD; // 落单的代理项
+            }
+            k = utf8_encode(cp, ch);
+            break;
+        }
+        default:
+            // '"' '\\' '/'
+            ch[0] = e;
+            k = 1;
+            break;
+        }
+        if (o + k > limit)
+        {
+            break;
+        }
+        memcpy(out + o, ch, k);
+        o += k;
+    }
+    out[o] = '\0';
+    return o;
+}
@@ -0,0 +1,164 @@
+/**
+ * Copyright (c) 2024 小明IO
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Commercial use of this software requires prior written authorization from the Licensor.
+ * 请注意：将 ESP-AI 代码用于商业用途需要事先获得许可方的授权。
+ * 删除与修改版权属于侵权行为，请尊重作者版权，避免产生不必要的纠纷。
+ *
+ * @author 小明IO
+ * @email  1746809408@qq.com
+ * @github https://github.com/wangzongming/esp-ai
+ * @websit https://espai.fun
+ */
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * 服务端文本消息的 JSON 解析（不申请堆内存）
+ *
+ * JsonTokenizer 是 SAX 式的分词器：在原始 payload 上逐个产出 token（对象/数组的开始结束、键、字符串、数字、字面量），
+ * 同时校验语法，字符串只给出在 payload 中的位置（不含引号，转义未展开）。
+ * JsonScan 用它走一遍整条消息，把顶层字段（键 + 值的位置）记在定长数组里，嵌套的对象/数组记整段原文，
+ * 取值时才把字符串展开到调用方提供的缓冲区。
+ *
+ * payload 在解析后必须保持不变，JsonScan 里只保存指针。
+ * 顶层字段超过 JSON_SCAN_MAX_FIELDS 个时，多出的字段照常校验，但查不到。
+ * 键含转义字符时按原文比较（服务端不会这样发）。
+ */
+
+#define JSON_SCAN_MAX_FIELDS 24
+#define JSON_SCAN_MAX_DEPTH 32
+
+typedef enum
+{
+    JSON_TOK_ERROR = 0,
+    JSON_TOK_END,       // 整条 JSON 结束
+    JSON_TOK_OBJ_BEGIN,
+    JSON_TOK_OBJ_END,
+    JSON_TOK_ARR_BEGIN,
+    JSON_TOK_ARR_END,
+    JSON_TOK_KEY,
+    JSON_TOK_STRING,
+    JSON_TOK_NUMBER,
+    JSON_TOK_TRUE,
+    JSON_TOK_FALSE,
+    JSON_TOK_NULL,
+} json_tok_t;
+
+typedef enum
+{
+    JSON_NONE = 0, // 字段不存在
+    JSON_STRING,
+    JSON_NUMBER,
+    JSON_TRUE,
+    JSON_FALSE,
+    JSON_NULL,
+    JSON_OBJECT,
+    JSON_ARRAY,
+} json_kind_t;
+
+// payload 中的一段，字符串不含引号
+struct JsonView
+{
+    const char *p;
+    size_t len;
+    bool esc; // 含转义字符，需要 JsonScan::unescape 展开
+
+    // 原文比较，esc 为 true 时不相等
+    bool equals(const char *s) const;
+};
+
+struct JsonToken
+{
+    json_tok_t type;
+    JsonView view; // KEY / STRING / NUMBER / 字面量的原文，其他 token 只有 p
+};
+
+class JsonTokenizer
+{
+public:
+    void begin(const char *json, size_t len);
+    JsonToken next();
+    // 当前嵌套深度，顶层对象内为 1
+    uint8_t depth() { return level; }
+    size_t pos() { return at; }
+
+private:
+    enum
+    {
+        ST_VALUE,         // 期待一个值
+        ST_KEY_OR_END,    // '{' 之后
+        ST_KEY,           // 对象里 ',' 之后
+        ST_COLON,         // 键之后
+        ST_VALUE_OR_END,  // '[' 之后
+        ST_COMMA_OR_END,  // 值之后
+        ST_DONE,
+        ST_ERROR,
+    };
+
+    JsonToken value(JsonToken &tok);
+    JsonToken close(char c, JsonToken &tok);
+    bool string(JsonView &view);
+    bool number(JsonView &view);
+    bool literal(const char *word, size_t n);
+    void after_value();
+    JsonToken error(JsonToken &tok);
+
+    const char *s = nullptr;
+    size_t n = 0;
+    size_t at = 0;
+    uint8_t state = ST_ERROR;
+    uint8_t level = 0;
+    uint32_t is_array = 0; // 每层一位：1 数组，0 对象
+};
+
+struct JsonField
+{
+    JsonView key;
+    JsonView val; // 字符串不含引号，对象 / 数组含括号
+    uint8_t kind; // json_kind_t
+};
+
+class JsonScan
+{
+public:
+    // 解析一条消息，顶层必须是对象；语法错误返回 false
+    bool parse(const char *json, size_t len);
+
+    uint8_t count() const { return n; }
+    const JsonField &field(uint8_t i) const { return fields[i]; }
+    const JsonField *find(const char *key) const;
+    bool has(const char *key) const { return find(key) != nullptr; }
+    json_kind_t kind(const char *key) const;
+
+    // 字符串值的原文（未展开转义），不是字符串时返回空
+    JsonView raw(const char *key) const;
+    // 字符串值展开到 buf（总以 '\0' 结尾），返回长度；不存在或不是字符串时为 ""，放不下时在完整的 UTF-8 字符处截断
+    size_t str(const char *key, char *buf, size_t cap) const;
+    // 字符串值是否等于 s（展开转义后比较）
+    bool is(const char *key, const char *s) const;
+    // 数字值，小数向零取整，超出 long 时取边界值；不存在或不是数字时返回 def
+    long num(const char *key, long def = 0) const;
+    // true / false 字面量，其他情况返回 def
+    bool boolean(const char *key, bool def = false) const;
+
+    // 展开转义，out 至少 view.len + 1 字节时一定放得下
+    static size_t unescape(const JsonView &view, char *out, size_t cap);
+
+private:
+    JsonField fields[JSON_SCAN_MAX_FIELDS];
+    uint8_t n = 0;
+};
@@ -0,0 +1,113 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025-至今 小明IO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author 小明IO
+ * @email  1746809408@qq.com
+ * @github https://github.com/wangzongming/esp-ai
+ * @websit https://espai.fun
+ */
+#include "ws_msg.h"
+#include <string.h>
+
+static const char *const names[WS_MSG_COUNT] = {
+    "",
+    "stc_time",
+    "net_delay",
+    "instruct",
+    "play_audio",
+    "mic_format",
+    "flow_control",
+    "session_start",
+    "session_stop",
+    "auth_fail",
+    "error",
+    "session_status",
+    "set_wifi_config",
+    "restart",
+    "clear_cache",
+    "cache_offer",
+    "set_local_data",
+    "log",
+    "sever-close",
+    "hardware-fns",
+    "emotion",
+};
+
+// 下标为 ws_msg_hash(name)
+static const struct
+{
+    uint8_t len;
+    uint8_t type;
+} slots[1 << WS_MSG_HASH_BITS] = {
+    {0, WS_MSG_UNKNOWN},
+    {8, WS_MSG_INSTRUCT},
+    {12, WS_MSG_HARDWARE_FNS},
+    {7, WS_MSG_EMOTION},
+    {0, WS_MSG_UNKNOWN},
+    {13, WS_MSG_SESSION_START},
+    {9, WS_MSG_NET_DELAY},
+    {0, WS_MSG_UNKNOWN},
+    {11, WS_MSG_SEVER_CLOSE},
+    {9, WS_MSG_AUTH_FAIL},
+    {0, WS_MSG_UNKNOWN},
+    {14, WS_MSG_SET_LOCAL_DATA},
+    {10, WS_MSG_MIC_FORMAT},
+    {0, WS_MSG_UNKNOWN},
+    {12, WS_MSG_SESSION_STOP},
+    {12, WS_MSG_FLOW_CONTROL},
+    {0, WS_MSG_UNKNOWN},
+    {10, WS_MSG_PLAY_AUDIO},
+    {11, WS_MSG_CLEAR_CACHE},
+    {0, WS_MSG_UNKNOWN},
+    {15, WS_MSG_SET_WIFI_CONFIG},
+    {0, WS_MSG_UNKNOWN},
+    {0, WS_MSG_UNKNOWN},
+    {0, WS_MSG_UNKNOWN},
+    {7, WS_MSG_RESTART},
+    {0, WS_MSG_UNKNOWN},
+    {8, WS_MSG_STC_TIME},
+    {14, WS_MSG_SESSION_STATUS},
+    {3, WS_MSG_LOG},
+    {11, WS_MSG_CACHE_OFFER},
+    {0, WS_MSG_UNKNOWN},
+    {5, WS_MSG_ERROR},
+};
+
+ws_msg_t ws_msg_type(const char *s, size_t len)
+{
+    if (len == 0 || len > 255)
+    {
+        return WS_MSG_UNKNOWN;
+    }
+    uint8_t i = ws_msg_hash(s, len);
+    if (slots[i].len != len || memcmp(names[slots[i].type], s, len) != 0)
+    {
+        return WS_MSG_UNKNOWN;
+    }
+    return (ws_msg_t)slots[i].type;
+}
+
+const char *ws_msg_name(ws_msg_t type)
+{
+    return type < WS_MSG_COUNT ? names[type] : "";
+}
@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2024 小明IO
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Commercial use of this software requires prior written authorization from the Licensor.
+ * 请注意：将 ESP-AI 代码用于商业用途需要事先获得许可方的授权。
+ * 删除与修改版权属于侵权行为，请尊重作者版权，避免产生不必要的纠纷。
+ *
+ * @author 小明IO
+ * @email  1746809408@qq.com
+ * @github https://github.com/wangzongming/esp-ai
+ * @websit https://espai.fun
+ */
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * 服务端文本消息的 type 字段 -> 消息类型
+ *
+ * 完美哈希：FNV-1a（种子 WS_MSG_HASH_SEED）取高 5 位，20 个类型各占 32 个槽中的一个，
+ * 查表后再比较一次长度和内容，未知类型返回 WS_MSG_UNKNOWN。
+ * 增加类型时要把名字加进 ws_msg.cpp 的槽表，并重新找种子（test/host/ws_msg_test 会检查并给出新的种子）。
+ */
+
+#define WS_MSG_HASH_SEED 0xbc4u
+#define WS_MSG_HASH_BITS 5
+
+typedef enum
+{
+    WS_MSG_UNKNOWN = 0,
+    WS_MSG_STC_TIME,
+    WS_MSG_NET_DELAY,
+    WS_MSG_INSTRUCT,
+    WS_MSG_PLAY_AUDIO,
+    WS_MSG_MIC_FORMAT,
+    WS_MSG_FLOW_CONTROL,
+    WS_MSG_SESSION_START,
+    WS_MSG_SESSION_STOP,
+    WS_MSG_AUTH_FAIL,
+    WS_MSG_ERROR,
+    WS_MSG_SESSION_STATUS,
+    WS_MSG_SET_WIFI_CONFIG,
+    WS_MSG_RESTART,
+    WS_MSG_CLEAR_CACHE,
+    WS_MSG_CACHE_OFFER,
+    WS_MSG_SET_LOCAL_DATA,
+    WS_MSG_LOG,
+    WS_MSG_SEVER_CLOSE,
+    WS_MSG_HARDWARE_FNS,
+    WS_MSG_EMOTION,
+    WS_MSG_COUNT,
+} ws_msg_t;
+
+static inline uint32_t ws_msg_hash(const char *s, size_t len, uint32_t seed = WS_MSG_HASH_SEED)
+{
+    uint32_t h = seed;
+    for (size_t i = 0; i < len; i++)
+    {
+        h = (h ^ (uint8_t)s[i]) * 0x01000193u;
+    }
+    return h >> (32 - WS_MSG_HASH_BITS);
+}
+
+ws_msg_t ws_msg_type(const char *s, size_t len);
+const char *ws_msg_name(ws_msg_t type);
@@ -71,6 +71,9 @@ void ESP_AI::connect_ws()
                        "&ext5=" + loc_ext5 +
                        "&ext6=" + loc_ext6 +
                        "&ext7=" + loc_ext7 +
+                       "&mic_codecs=" + MicUplink::supportedCodecs() +
+                       "&flow=credit" +
+                       "&audio_cache=sha256" +
                        "&" + server_config.params;
 
     // ws 服务
@@ -84,6 +87,18 @@ void ESP_AI::connect_ws()
     }
 
     esp_ai_webSocket.onEvent(std::bind(&ESP_AI::webSocketEvent, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+    // TTS 音频按到达的分片直接写入播放队列，不为整帧申请内存；文本消息仍整条交给 webSocketEvent
+    esp_ai_webSocket.onFrameChunk([this](WSopcode_t opcode, size_t offset, uint8_t *payload, size_t length, bool isFinal) -> size_t
+                                  {
+                                      // 还有排队的整帧时先不收，保持顺序
+                                      if (!binBacklogDrain())
+                                      {
+                                          return (size_t)0;
+                                      }
+                                      size_t n = webSocketBinChunk(opcode, offset, payload, length, isFinal);
+                                      esp_ai_play_credit.received(n);
+                                      return n; },
+                                  true);
     esp_ai_webSocket.setReconnectInterval(3000);
     esp_ai_webSocket.enableHeartbeat(5000, 10000, 0);
 }
\ No newline at end of file
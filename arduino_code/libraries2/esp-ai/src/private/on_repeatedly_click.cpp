@@ -64,14 +64,14 @@ void ESP_AI::on_repeatedly_click()
                         click_count++;
                         if (click_count == 2)
                         {
-                            play_builtin_audio(san_ci, san_ci_len);
+                            PLAY_PROMPT(san_ci);
                         }
                         if (click_count == 5)
                         {
                             click_count = 0;
                             last_btn_time = 0;
 
-                            play_builtin_audio(hui_fu_chu_chang, hui_fu_chu_chang_len);
+                            PLAY_PROMPT(hui_fu_chu_chang);
                             wait_mp3_player_done();
 
                             // 结束对话音频
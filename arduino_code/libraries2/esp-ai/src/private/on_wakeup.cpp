@@ -61,6 +61,17 @@ void ESP_AI::on_wakeup()
 
     while (true)
     {
+        // 回声消除检测到播放中用户在说话：打断播放，直接开始聆听
+        if (esp_ai_barge_in)
+        {
+            esp_ai_barge_in = false;
+            if (!asr_ing && spk_ing)
+            {
+                DEBUG_PRINTLN(debug, ("[Info] -> 播放被打断"));
+                wakeUp("barge_in");
+            }
+        }
+
         if ((wake_up_scheme == "pin_high" || wake_up_scheme == "pin_low"))
         {
             int reading = digitalRead(wake_up_config.pin);
@@ -109,6 +120,14 @@ void ESP_AI::on_wakeup()
                 }
             }
         }
+        else if (wake_up_scheme == "kws")
+        {
+            // 唤醒词任务只记录结果，唤醒流程（提示音等）在这里执行
+            if (esp_ai_wake_word.take() >= 0 && !asr_ing)
+            {
+                wakeUp("wakeup");
+            }
+        }
         else if (esp_ai_is_listen_model)
         {
             int reading = digitalRead(wake_up_config.pin);
@@ -203,7 +203,7 @@ void ESP_AI::ble_connect_wifi()
         esp_ai_net_status = "0";
         ap_connect_err = "1";
         DEBUG_PRINTLN(debug, F("配网页面设置 WIFI 连接失败"));
-        play_builtin_audio(lian_jie_shi_bai, lian_jie_shi_bai_len);
+        PLAY_PROMPT(lian_jie_shi_bai);
         vTaskDelay(pdMS_TO_TICKS(100));
         wait_mp3_player_done();
         vTaskDelay(pdMS_TO_TICKS(1000));
@@ -235,7 +235,7 @@ void ESP_AI::ble_connect_wifi()
     if (is_bind_ok)
     {
         set_local_data("_ble_temp_", "0"); // 清除临时标识
-        play_builtin_audio(pei_wang_cheng_gong, pei_wang_cheng_gong_len);
+        PLAY_PROMPT(pei_wang_cheng_gong);
         vTaskDelay(pdMS_TO_TICKS(100));
         // 重启板子
         wait_mp3_player_done();
@@ -281,7 +281,7 @@ void ESP_AI::open_ble_server()
     esp_ai_ble_advertising->setMinPreferred(0x12);
     BLEDevice::startAdvertising();
     DEBUG_PRINTLN(debug, "[Info] 蓝牙服务器启动成功");
-    play_builtin_audio(qing_pei_wang, qing_pei_wang_len);
+    PLAY_PROMPT(qing_pei_wang);
 
     // 发送特征值
     // esp_ai_ble_characteristic->setValue("hello");
@@ -33,9 +33,29 @@ void ESP_AI::play_audio_wrapper(void *arg)
     instance->play_audio();
 }
 
+// 播放缓冲为空时最多阻塞这么久，然后处理一次上报
+#define PLAY_AUDIO_WAIT_MS 100
+
+static bool play_credit_send(const uint8_t *msg, size_t len)
+{
+    if (!esp_ai_ws_connected || xSemaphoreTake(esp_ai_ws_mutex, pdMS_TO_TICKS(100)) != pdTRUE)
+    {
+        return false;
+    }
+    bool ok = esp_ai_webSocket.sendBIN(msg, len);
+    xSemaphoreGive(esp_ai_ws_mutex);
+    return ok;
+}
+
 void ESP_AI::play_audio()
 {
-    // 发送正在可用音频流的频率
+    // 没有数据时阻塞在播放缓冲上，有数据写入立即唤醒，不再每 10ms 轮询
+    esp_ai_audio_buffer.setReadMaxWait(pdMS_TO_TICKS(PLAY_AUDIO_WAIT_MS));
+    esp_ai_copier.setCheckAvailable(false);
+    esp_ai_copier.setDelayOnNoData(0);
+    esp_ai_play_credit.begin(AUDIO_BUFFER_SIZE, play_credit_send);
+
+    // 发送正在可用音频流的频率（服务端未启用额度流控时）
     int frequency = 1000;
     long prev_time = millis();
     // 是否已经发送过可用为 0 的数据
@@ -43,14 +63,22 @@ void ESP_AI::play_audio()
 
     while (true)
     {
+        if (!esp_ai_spk_queue)
+        {
+            // 扬声器未初始化，读取不会阻塞
+            vTaskDelay(pdMS_TO_TICKS(PLAY_AUDIO_WAIT_MS));
+            continue;
+        }
+        if (esp_ai_copier.copy() > 0 && send0_ed)
+        {
+            send0_ed = false;
+        }
         int available = esp_ai_spk_queue.available();
-        if (available > 0)
+
+        if (esp_ai_play_credit.isEnabled())
         {
-            if (send0_ed)
-            {
-                send0_ed = false;
-            }
-            esp_ai_copier.copy();
+            esp_ai_play_credit.update(available);
+            continue;
         }
         if (esp_ai_ws_connected && ((millis() - prev_time) > frequency) && !send0_ed)
         {
@@ -66,7 +94,6 @@ void ESP_AI::play_audio()
                 xSemaphoreGive(esp_ai_ws_mutex);
             }
         }
-        vTaskDelay(10 / portTICK_RATE_MS);
     }
     vTaskDelete(NULL);
 }
@@ -27,6 +27,101 @@
  * @websit https://espai.fun
  */
 #include "send_audio.h"
+
+static void uplink_send(const uint8_t *data, size_t len)
+{
+    if (!esp_ai_webSocket.isConnected())
+    {
+        return;
+    }
+    if (xSemaphoreTake(esp_ai_ws_mutex, pdMS_TO_TICKS(100)) == pdTRUE)
+    {
+        esp_ai_webSocket.sendBIN(data, len);
+        xSemaphoreGive(esp_ai_ws_mutex);
+    }
+}
+
+// 本地 VAD 检测到语音开始/结束时通知服务端，服务端可以提前结束识别
+static void uplink_vad(bool speech)
+{
+    if (xSemaphoreTake(esp_ai_ws_mutex, pdMS_TO_TICKS(100)) == pdTRUE)
+    {
+        esp_ai_webSocket.sendTXT(speech ? "{\"type\":\"mic_vad\",\"speech\":true}" : "{\"type\":\"mic_vad\",\"speech\":false}");
+        xSemaphoreGive(esp_ai_ws_mutex);
+    }
+}
+
+// 从 I2S 读一块麦克风数据（一个 DMA 缓冲，512 帧），转成 16 位，返回采样数；readBytes 会等待 I2S 数据，
+// 每次读满一个 DMA 缓冲，返回的时刻就是这块采集完的时刻（回声消除按它对齐参考信号）
+static size_t read_mic(int16_t **pcm)
+{
+    static int32_t raw[512];
+    int bits = esp_ai_i2s_input.audioInfo().bits_per_sample;
+    size_t len = esp_ai_i2s_input.readBytes((uint8_t *)raw, bits == 16 ? sizeof(raw) / 2 : sizeof(raw));
+    *pcm = (int16_t *)raw;
+    if (bits == 16)
+    {
+        return len / sizeof(int16_t);
+    }
+    // 24/32 位数据在 32 位容器里取高 16 位；非常见位数和原来的 ws_stream 一样按有效位截取
+    bool unusual = mic_bits_per_sample != 16 && mic_bits_per_sample != 24 && mic_bits_per_sample != 32;
+    int shift = unusual ? 32 - mic_bits_per_sample : 16;
+    size_t samples = len / sizeof(int32_t);
+    for (size_t i = 0; i < samples; i++)
+    {
+        (*pcm)[i] = (int16_t)(raw[i] >> shift);
+    }
+    return samples;
+}
+
+// 不读麦克风时 DMA 里积压着旧数据，读到需要等待新数据为止，之后读到的数据和读取时刻对应
+static void drain_mic()
+{
+    int16_t *pcm;
+    for (int i = 0; i < 16; i++)
+    {
+        uint32_t t0 = micros();
+        read_mic(&pcm);
+        if (micros() - t0 > 4000)
+        {
+            break;
+        }
+    }
+}
+
+// 回声消除按 AEC_BLOCK 处理；一次读到的数据不是整块时，余下的采样和对齐的参考信号留到下一次，和新数据拼成整块
+static int16_t aec_mic[512 + AEC_BLOCK];
+static int16_t aec_ref[512 + AEC_BLOCK];
+static size_t aec_held = 0;
+
+// 回声消除：按读取时刻取对齐的参考信号，减去回声，*pcm 指向处理后的数据，返回采样数（比读到的多或少不到一块）；
+// 检测到打断时通知唤醒任务
+static size_t cancel_echo(int16_t **pcm, size_t samples)
+{
+    esp_ai_echo_ref.read(aec_ref + aec_held, samples, micros());
+    memcpy(aec_mic + aec_held, *pcm, samples * sizeof(int16_t));
+    size_t total = aec_held + samples;
+    size_t done = total - total % AEC_BLOCK;
+    for (size_t i = 0; i < done; i += AEC_BLOCK)
+    {
+        esp_ai_aec.process(aec_mic + i, aec_ref + i, aec_mic + i);
+    }
+    if (esp_ai_aec.bargeIn())
+    {
+        esp_ai_aec.clearBargeIn();
+        esp_ai_barge_in = true;
+    }
+
+    // 处理完的交给调用者，余下的移到开头
+    static int16_t out[512 + AEC_BLOCK];
+    memcpy(out, aec_mic, done * sizeof(int16_t));
+    aec_held = total - done;
+    memmove(aec_mic, aec_mic + done, aec_held * sizeof(int16_t));
+    memmove(aec_ref, aec_ref + done, aec_held * sizeof(int16_t));
+    *pcm = out;
+    return done;
+}
+
 void ESP_AI::send_audio_wrapper(void *arg)
 {
     ESP_AI *instance = static_cast<ESP_AI *>(arg);
@@ -36,17 +131,101 @@ void ESP_AI::send_audio_wrapper(void *arg)
 void ESP_AI::send_audio()
 {
     bool is_use_edge_impulse = wake_up_scheme == "edge_impulse";
+    bool is_use_kws = wake_up_scheme == "kws";
+    bool uplink_sending = false;
+    bool aec_running = false;
     while (true)
-    { 
+    {
+        // 回声消除：播放中（以及播放结束后回声还没消失）麦克风数据先减去回声
+        bool aec_on = esp_ai_aec.isReady() && (spk_ing || esp_ai_aec.farEnd());
+        if (aec_on != aec_running)
+        {
+            aec_running = aec_on;
+            if (aec_on)
+            {
+                drain_mic();
+                aec_held = 0;
+            }
+            else if (debug)
+            {
+                const aec_stats_t &st = esp_ai_aec.stats();
+                Serial.printf("[Info] -> 回声消除：%lu 块中播放 %lu 块，双讲 %lu 块，回声衰减 %.1f dB，平均 %lu us/块，最长 %lu us\n",
+                              (unsigned long)st.blocks, (unsigned long)st.far_blocks, (unsigned long)st.double_talk, st.erle_db,
+                              (unsigned long)(st.blocks ? st.process_us / st.blocks : 0), (unsigned long)st.process_us_max);
+                esp_ai_aec.clearStats();
+            }
+        }
+
+        // 服务端选定的上行编码变了，在本任务里切换，不和 write() 并发
+        uplink_codec_t codec = (uplink_codec_t)esp_ai_uplink_codec;
+        if (codec != esp_ai_mic_uplink.codec())
+        {
+            if (codec == UPLINK_UNKNOWN)
+            {
+                esp_ai_mic_uplink.end();
+            }
+            else if (!esp_ai_mic_uplink.begin(16000, codec, uplink_send, uplink_vad))
+            {
+                Serial.println("[Error] -> 麦克风上行编码初始化失败，上传原始 PCM");
+                esp_ai_uplink_codec = UPLINK_UNKNOWN;
+            }
+        }
+
         if (esp_ai_ws_connected && esp_ai_start_send_audio && esp_ai_session_id != "" && !is_use_edge_impulse)
         {
-            mic_to_ws_copier.copyBytes(1024);  
-            vTaskDelay(10);
+            if (esp_ai_mic_uplink.isActive())
+            {
+                // readBytes 会等待 I2S 数据，不需要再延时
+                int16_t *pcm;
+                size_t samples = read_mic(&pcm);
+                if (aec_on)
+                {
+                    samples = cancel_echo(&pcm, samples);
+                }
+                esp_ai_mic_uplink.write(pcm, samples);
+                uplink_sending = true;
+            }
+            else
+            {
+                mic_to_ws_copier.copyBytes(1024);
+                vTaskDelay(10);
+            }
         }
         else
         {
-            vTaskDelay(10);
+            if (uplink_sending)
+            {
+                uplink_sending = false;
+                esp_ai_mic_uplink.flush();
+                if (debug)
+                {
+                    uint32_t in = esp_ai_mic_uplink.frames_in;
+                    Serial.printf("[Info] -> 麦克风上行(%s)：%lu 帧中上传 %lu 帧，%lu 字节（原始 PCM %lu 字节），AGC 增益 %.1f 倍\n",
+                                  MicUplink::codecName(esp_ai_mic_uplink.codec()), (unsigned long)in, (unsigned long)esp_ai_mic_uplink.frames_sent,
+                                  (unsigned long)esp_ai_mic_uplink.bytes_sent, (unsigned long)(in * 640), esp_ai_mic_uplink.gain() / 256.0f);
+                }
+                esp_ai_mic_uplink.frames_in = esp_ai_mic_uplink.frames_sent = esp_ai_mic_uplink.bytes_sent = 0;
+                esp_ai_mic_uplink.reset();
+            }
+            if (is_use_kws && esp_ai_wake_word.isActive() && !asr_ing && !spk_ing && esp_ai_start_ed == "0")
+            {
+                // 空闲时麦克风数据交给语音唤醒，推理在唤醒词任务里做
+                int16_t *pcm;
+                size_t samples = read_mic(&pcm);
+                esp_ai_wake_word.feed(pcm, samples);
+            }
+            else if (aec_on && !asr_ing)
+            {
+                // 播放中麦克风数据只用来检测打断
+                int16_t *pcm;
+                size_t samples = read_mic(&pcm);
+                cancel_echo(&pcm, samples);
+            }
+            else
+            {
+                vTaskDelay(10);
+            }
         }
     }
     vTaskDelete(NULL);
-}
\ No newline at end of file
+}
@@ -29,6 +29,11 @@
 
 #include "begin.h"
 
+static uint32_t aec_now_us()
+{
+    return micros();
+}
+
 void ESP_AI::begin(ESP_AI_CONFIG config)
 {
     // xiao 需要延迟一定的时间
@@ -116,6 +121,9 @@ void ESP_AI::begin(ESP_AI_CONFIG config)
         pinMode(reset_btn_config.pin, INPUT_PULLUP);
     }
 
+    // 回声消除配置
+    aec_config = config.aec_config;
+
     // 唤醒配置
     if (strcmp(config.wake_up_config.wake_up_scheme, "") != 0)
     {
@@ -154,6 +162,24 @@ void ESP_AI::begin(ESP_AI_CONFIG config)
     // 灯光任务比较重要，靠前执行
     xTaskCreate(ESP_AI::lights_wrapper, "lights", 1024 * 3, this, 1, NULL);
 
+    // 提示音资源包，没有烧录时使用固件里的提示音
+    if (esp_ai_prompt_pack.begin())
+    {
+        DEBUG_PRINTLN(debug, "[Info] -> 提示音资源包：" + String(esp_ai_prompt_pack.lang()) + "，" + esp_ai_prompt_pack.count() + " 条，" + esp_ai_prompt_pack.size() + " 字节");
+    }
+
+    // 服务端下发的提示音、问候语缓存在文件系统里，重连和重启后按 hash 命中
+    if (!CachedAudio::mount())
+    {
+        DEBUG_PRINTLN(debug, F("[Info] -> 没有可用的文件系统，音频缓存只保存在内存中"));
+    }
+    else
+    {
+        // 读回上次保存的提示音、问候语，首次唤醒不用等服务端下发
+        esp_ai_cache_audio_du.preload();
+        esp_ai_cache_audio_greetings.preload();
+    }
+
     // 初始化扬声器
     speaker_i2s_setup();
     xTaskCreate(ESP_AI::play_audio_wrapper, "play_audio", 1024 * 4, this, 1, NULL);
@@ -279,7 +305,7 @@ void ESP_AI::begin(ESP_AI_CONFIG config)
         return;
     }
 
-    play_builtin_audio(lian_jie_zhong, lian_jie_zhong_len);
+    PLAY_PROMPT(lian_jie_zhong);
 
     WiFi.disconnect(true);
     delay(100);
@@ -331,12 +357,12 @@ void ESP_AI::begin(ESP_AI_CONFIG config)
 
     if (WiFi.status() != WL_CONNECTED)
     {
-        play_builtin_audio(lian_jie_shi_bai, lian_jie_shi_bai_len);
+        PLAY_PROMPT(lian_jie_shi_bai);
         return;
     }
 
-    play_builtin_audio(lian_jie_cheng_gong, lian_jie_cheng_gong_len);
-    play_builtin_audio(fu_wu_lian_jie_zhong, fu_wu_lian_jie_zhong_len);
+    PLAY_PROMPT(lian_jie_cheng_gong);
+    PLAY_PROMPT(fu_wu_lian_jie_zhong);
 
     esp_ai_played_connected = false;
     // 内置状态处理
@@ -363,6 +389,25 @@ void ESP_AI::begin(ESP_AI_CONFIG config)
         DEBUG_PRINTLN(debug, F("[Error] Failed to start MIC I2S!"));
     }
 
+    if (aec_config.enable)
+    {
+        // 参考信号和麦克风数据逐个采样对齐，两边都要是 16 kHz
+        if (esp_ai_i2s_input.audioInfo().sample_rate != 16000)
+        {
+            Serial.println(F("[Error] 回声消除需要麦克风采样率为 16000，已关闭。"));
+        }
+        else if (i2s_config_speaker.sample_rate && i2s_config_speaker.sample_rate != 16000)
+        {
+            Serial.println(F("[Error] 回声消除需要扬声器采样率为 16000，已关闭。"));
+        }
+        // 扬声器 DMA 深度（speaker_i2s_setup：8 x 1024 帧）加上配置的额外延时
+        else if (!esp_ai_echo_ref.begin(16000, 8 * 1024 + aec_config.delay_ms * 16) || !esp_ai_aec.begin(aec_now_us))
+        {
+            esp_ai_echo_ref.end();
+            Serial.println(F("[Error] 回声消除内存不足，已关闭。"));
+        }
+    }
+
     if (wake_up_scheme == "edge_impulse")
     {
         Serial.println(F("[Error] edge_impulseh唤醒方案已经废弃，请尝试其他唤醒方案。"));
@@ -422,5 +467,17 @@ void ESP_AI::begin(ESP_AI_CONFIG config)
             1,
             &volume_listener_task_handle);
     }
+
+    if (wake_up_scheme == "kws")
+    {
+        if (kws_model == nullptr)
+        {
+            Serial.println(F("[Error] kws 唤醒方案需要先调用 esp_ai.setWakeUpModel() 设置模型。"));
+        }
+        else if (!esp_ai_wake_word.begin(kws_model, wake_up_config.threshold, debug))
+        {
+            Serial.println(F("[Error] 语音唤醒模型初始化失败。"));
+        }
+    }
     connect_ws();
 }
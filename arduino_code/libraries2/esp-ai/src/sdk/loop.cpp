@@ -35,7 +35,7 @@ void handle_ble_data()
         if (JSON.typeof(data) == "undefined")
         {
             DEBUG_PRINTLN(true, ("传入数据解析失败或者传入了空数据。"));
-            play_builtin_audio(lian_jie_shi_bai, lian_jie_shi_bai_len);
+            PLAY_PROMPT(lian_jie_shi_bai);
             wait_mp3_player_done(); 
 
             String json_response = "{\"success\":false,\"message\":\"传入数据解析失败或者传入了空数据。\"}";
@@ -46,7 +46,7 @@ void handle_ble_data()
         }
  
         // 将数据都全部存入本地
-        play_builtin_audio(lian_jie_zhong, lian_jie_zhong_len);
+        PLAY_PROMPT(lian_jie_zhong);
         vTaskDelay(pdMS_TO_TICKS(100));
         wait_mp3_player_done(); 
         JSONVar keys = data.keys();
@@ -74,6 +74,8 @@ void ESP_AI::loop()
     }
 
     esp_ai_server.handleClient();
+    // 整帧交付时播放队列放不下的数据，腾出空间后继续写入
+    binBacklogDrain();
     esp_ai_webSocket.loop(); 
 
     handle_ble_data();
@@ -33,14 +33,8 @@ void ESP_AI::reCache()
 
     if (xSemaphoreTake(esp_ai_ws_mutex, pdMS_TO_TICKS(100)) == pdTRUE)
     {
-        if (!esp_ai_cache_audio_du.empty())
-        {
-            esp_ai_cache_audio_du.clear();
-        }
-        if (!esp_ai_cache_audio_greetings.empty())
-        {
-            esp_ai_cache_audio_greetings.clear();
-        } 
+        esp_ai_cache_audio_du.clear();
+        esp_ai_cache_audio_greetings.clear();
 
         esp_ai_webSocket.sendTXT("{ \"type\":\"re_cache\" }");
         xSemaphoreGive(esp_ai_ws_mutex);
@@ -37,6 +37,12 @@ void ESP_AI::delAllTask()
         wakeup_task_handle = NULL; // 防止悬空指针
         DEBUG_PRINTLN(debug, F("[TASK] -> wakeup_task_handle 已删除。"));
     }
+    // 语音唤醒任务的句柄由 WakeWord 持有
+    if (esp_ai_wake_word.isActive())
+    {
+        esp_ai_wake_word.end();
+        DEBUG_PRINTLN(debug, F("[TASK] -> wake_word 已删除。"));
+    }
     if (sensor_task_handle != NULL)
     {
         vTaskDelete(sensor_task_handle);
@@ -77,6 +83,11 @@ void ESP_AI::suspendAllTask()
         vTaskSuspend(wakeup_task_handle);
         DEBUG_PRINTLN(debug, F("[TASK] -> wakeup_task_handle 已挂起。"));
     }
+    if (esp_ai_wake_word.isActive())
+    {
+        esp_ai_wake_word.suspend();
+        DEBUG_PRINTLN(debug, F("[TASK] -> wake_word 已挂起。"));
+    }
     if (sensor_task_handle != NULL)
     {
         vTaskSuspend(sensor_task_handle);
@@ -111,6 +122,11 @@ void ESP_AI::resumeAllTask()
         vTaskResume(wakeup_task_handle);
         DEBUG_PRINTLN(debug, F("[TASK] -> wakeup_task_handle 已恢复"));
     }
+    if (esp_ai_wake_word.isActive())
+    {
+        esp_ai_wake_word.resume();
+        DEBUG_PRINTLN(debug, F("[TASK] -> wake_word 已恢复"));
+    }
     if (sensor_task_handle != NULL)
     {
         vTaskResume(sensor_task_handle);
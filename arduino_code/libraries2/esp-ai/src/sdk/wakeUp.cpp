@@ -53,16 +53,21 @@ void ESP_AI::wakeUp(String scene)
         mp3_player_stop();
 
         // 播放问候语
-        if (scene == "wakeup" && !esp_ai_cache_audio_greetings.empty() && !esp_ai_is_listen_model)
+        // 缓存 pin 住再播放，播放期间 WS 任务换上新数据也不会释放正在读的这块
+        CachedAudioBlob *greetings = (scene == "wakeup" && !esp_ai_is_listen_model) ? esp_ai_cache_audio_greetings.pin() : nullptr;
+        if (greetings != nullptr)
         {
-            play_builtin_audio(esp_ai_cache_audio_greetings.data(), esp_ai_cache_audio_greetings.size());
+            play_builtin_audio(greetings->data, greetings->len);
+            esp_ai_cache_audio_greetings.unpin(greetings);
             wait_mp3_player_done();
         }
 
-        // 播放提示音
-        if (!esp_ai_cache_audio_du.empty())
+        // 播放提示音，打断时用户已经在说话，不播放
+        CachedAudioBlob *tone = scene != "barge_in" ? esp_ai_cache_audio_du.pin() : nullptr;
+        if (tone != nullptr)
         {
-            play_builtin_audio(esp_ai_cache_audio_du.data(), esp_ai_cache_audio_du.size());
+            play_builtin_audio(tone->data, tone->len);
+            esp_ai_cache_audio_du.unpin(tone);
             wait_mp3_player_done();
         }
 
@@ -70,7 +75,7 @@ void ESP_AI::wakeUp(String scene)
         memset(esp_ai_asr_sample_buffer, 0, sizeof(esp_ai_asr_sample_buffer));
 
         // 内置状态处理
-        if (scene == "wakeup")
+        if (scene == "wakeup" || scene == "barge_in")
         {
             status_change("wakeup");
             if (onSessionStatusCb != nullptr)
@@ -0,0 +1,521 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025-至今 小明IO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @author 小明IO
+ * @email  1746809408@qq.com
+ * @github https://github.com/wangzongming/esp-ai
+ * @websit https://espai.fun
+ */
+#include "mic_uplink.h"
+
+#if ESP_AI_UPLINK_OPUS
+#include "AudioTools.h"
+#include "AudioTools/AudioCodecs/CodecOpus.h"
+
+// OpusAudioEncoder 每编码一帧调用一次 write()，把这一帧交给批次
+class UplinkPacketPrint : public Print
+{
+public:
+    std::function<void(const uint8_t *, size_t)> cb;
+    size_t write(uint8_t b) override { return write(&b, 1); }
+    size_t write(const uint8_t *data, size_t len) override
+    {
+        if (cb)
+        {
+            cb(data, len);
+        }
+        return len;
+    }
+};
+static UplinkPacketPrint uplink_packet_print;
+static audio_tools::OpusAudioEncoder uplink_opus;
+#endif
+
+// VAD：帧能量高于噪声 9dB，或者高于噪声 5dB 且过零率像清辅音
+#define VAD_SPEECH_RATIO 8
+#define VAD_FRICATIVE_RATIO 3
+#define VAD_MIN_ENERGY 400 // 均方值，约 -38dBFS 以下的声音不算语音
+#define VAD_NOISE_MIN 16
+
+// AGC：语音段 RMS 调到约 -21dBFS，增益 1~32 倍，压得快、放得慢
+#define AGC_TARGET_RMS 3000
+#define AGC_GAIN_MIN (1 * 256)
+#define AGC_GAIN_MAX (32 * 256)
+#define AGC_PEAK_LIMIT 30000
+
+static const int16_t ima_step_table[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767};
+
+static const int8_t ima_index_table[16] = {-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8};
+
+static uint32_t isqrt32(uint32_t v)
+{
+    uint32_t r = 0, bit = 1UL << 30;
+    while (bit > v)
+    {
+        bit >>= 2;
+    }
+    while (bit)
+    {
+        if (v >= r + bit)
+        {
+            v -= r + bit;
+            r = (r >> 1) + bit;
+        }
+        else
+        {
+            r >>= 1;
+        }
+        bit >>= 2;
+    }
+    return r;
+}
+
+const char *MicUplink::codecName(uplink_codec_t codec)
+{
+    switch (codec)
+    {
+    case UPLINK_PCM:
+        return "pcm";
+    case UPLINK_OPUS:
+        return "opus";
+    case UPLINK_ADPCM:
+        return "adpcm";
+    default:
+        return "";
+    }
+}
+
+uplink_codec_t MicUplink::codecFromName(const String &name)
+{
+    if (name == "pcm")
+        return UPLINK_PCM;
+    if (name == "adpcm")
+        return UPLINK_ADPCM;
+#if ESP_AI_UPLINK_OPUS
+    if (name == "opus")
+        return UPLINK_OPUS;
+#endif
+    return UPLINK_UNKNOWN;
+}
+
+const char *MicUplink::supportedCodecs()
+{
+#if ESP_AI_UPLINK_OPUS
+    return "opus,adpcm,pcm";
+#else
+    return "adpcm,pcm";
+#endif
+}
+
+bool MicUplink::begin(uint32_t sample_rate, uplink_codec_t codec, sink_t sink, vad_cb_t on_vad)
+{
+    end();
+    if (codec == UPLINK_UNKNOWN)
+    {
+        return false;
+    }
+    frame_samples = sample_rate * UPLINK_FRAME_MS / 1000;
+    if (frame_samples == 0 || frame_samples > UPLINK_MAX_FRAME_SAMPLES)
+    {
+        return false;
+    }
+
+#if ESP_AI_UPLINK_OPUS
+    if (codec == UPLINK_OPUS)
+    {
+        uplink_packet_print.cb = [this](const uint8_t *data, size_t len)
+        { appendPacket(data, len); };
+        auto &cfg = uplink_opus.config();
+        cfg.sample_rate = sample_rate;
+        cfg.channels = 1;
+        cfg.bits_per_sample = 16;
+        cfg.application = OPUS_APPLICATION_VOIP;
+        cfg.bitrate = 16000;
+        cfg.complexity = 3;
+        cfg.singal = OPUS_SIGNAL_VOICE;
+        cfg.frame_sizes_ms_x2 = OPUS_FRAMESIZE_20_MS;
+        uplink_opus.setOutput(uplink_packet_print);
+        if (!uplink_opus.begin())
+        {
+            return false;
+        }
+    }
+#endif
+
+    this->sink = sink;
+    this->on_vad = on_vad;
+    cur_codec = codec;
+    noise_floor = 0;
+    gain_q8 = 10 * 256;
+    frames_in = frames_sent = bytes_sent = 0;
+    reset();
+    active = true;
+    return true;
+}
+
+void MicUplink::end()
+{
+    if (!active)
+    {
+        return;
+    }
+    active = false;
+#if ESP_AI_UPLINK_OPUS
+    if (cur_codec == UPLINK_OPUS)
+    {
+        uplink_opus.end();
+    }
+#endif
+    cur_codec = UPLINK_UNKNOWN;
+}
+
+void MicUplink::reset()
+{
+    frame_fill = 0;
+    preroll_pos = 0;
+    preroll_cnt = 0;
+    onset = 0;
+    hangover = 0;
+    speech = false;
+    batch_count = 0;
+    batch_fill = 0;
+    adpcm_pred = 0;
+    adpcm_index = 0;
+}
+
+void MicUplink::write(const int16_t *pcm, size_t samples)
+{
+    if (!active)
+    {
+        return;
+    }
+    while (samples > 0)
+    {
+        size_t n = frame_samples - frame_fill;
+        if (n > samples)
+        {
+            n = samples;
+        }
+        memcpy(frame + frame_fill, pcm, n * sizeof(int16_t));
+        frame_fill += n;
+        pcm += n;
+        samples -= n;
+        if (frame_fill < frame_samples)
+        {
+            break;
+        }
+        frame_fill = 0;
+        frames_in++;
+
+        bool was_speech = speech;
+        bool is_speech = vad(frame);
+
+        if (is_speech && !was_speech)
+        {
+            // 语音开始：先补发起点前的帧
+            if (on_vad)
+            {
+                on_vad(true);
+            }
+            uint8_t idx = (preroll_pos + UPLINK_PREROLL_FRAMES - preroll_cnt) % UPLINK_PREROLL_FRAMES;
+            for (uint8_t i = 0; i < preroll_cnt; i++)
+            {
+                agc(preroll[idx], false);
+                encode(preroll[idx]);
+                idx = (idx + 1) % UPLINK_PREROLL_FRAMES;
+            }
+            preroll_cnt = 0;
+        }
+
+        if (is_speech)
+        {
+            agc(frame, frame_voice);
+            encode(frame);
+        }
+        else
+        {
+            if (was_speech)
+            {
+                flush();
+                if (on_vad)
+                {
+                    on_vad(false);
+                }
+            }
+            memcpy(preroll[preroll_pos], frame, frame_samples * sizeof(int16_t));
+            preroll_pos = (preroll_pos + 1) % UPLINK_PREROLL_FRAMES;
+            if (preroll_cnt < UPLINK_PREROLL_FRAMES)
+            {
+                preroll_cnt++;
+            }
+        }
+    }
+}
+
+/**
+ * 返回这一帧是否要上传（语音或语音后的延续段），同时更新噪声估计
+ */
+bool MicUplink::vad(const int16_t *in)
+{
+    uint64_t sum = 0;
+    uint16_t peak = 0;
+    uint16_t zc = 0;
+    int16_t prev = in[0];
+    for (size_t i = 0; i < frame_samples; i++)
+    {
+        int32_t s = in[i];
+        sum += (uint32_t)(s * s);
+        uint16_t a = s < 0 ? -s : s;
+        if (a > peak)
+        {
+            peak = a;
+        }
+        zc += ((s ^ prev) < 0);
+        prev = s;
+    }
+    uint32_t e = sum / frame_samples;
+    frame_energy = e;
+    frame_peak = peak;
+
+    if (noise_floor == 0)
+    {
+        noise_floor = e > VAD_NOISE_MIN ? e : VAD_NOISE_MIN;
+    }
+
+    bool loud = e > VAD_MIN_ENERGY && e / VAD_SPEECH_RATIO > noise_floor;
+    // 16kHz 下清辅音的过零率大约在 0.25 ~ 0.6 之间
+    bool fricative = e > VAD_MIN_ENERGY && e / VAD_FRICATIVE_RATIO > noise_floor &&
+                     zc * 4 > frame_samples && zc * 5 < frame_samples * 3;
+    bool voice = loud || fricative;
+    frame_voice = voice;
+
+    if (!voice)
+    {
+        // 噪声估计：下降快，上升慢
+        if (e < noise_floor)
+        {
+            noise_floor = (noise_floor * 3 + e) / 4;
+        }
+        else
+        {
+            noise_floor += (e - noise_floor) / 16;
+        }
+        if (noise_floor < VAD_NOISE_MIN)
+        {
+            noise_floor = VAD_NOISE_MIN;
+        }
+    }
+
+    if (voice)
+    {
+        if (onset < UPLINK_ONSET_FRAMES)
+        {
+            onset++;
+        }
+        if (onset >= UPLINK_ONSET_FRAMES || speech)
+        {
+            speech = true;
+            hangover = UPLINK_HANGOVER_FRAMES;
+        }
+    }
+    else
+    {
+        onset = 0;
+        if (hangover > 0)
+        {
+            hangover--;
+        }
+        else
+        {
+            speech = false;
+        }
+    }
+    return speech;
+}
+
+/**
+ * 定点 AGC，增益在一帧内线性过渡，避免拉链噪声；adapt 为 true 时（当前帧是语音）才按这一帧调整增益
+ */
+void MicUplink::agc(int16_t *in, bool adapt)
+{
+    int32_t g0 = gain_q8;
+    int32_t g1 = g0;
+    if (adapt)
+    {
+        uint32_t rms = isqrt32(frame_energy);
+        int32_t want = rms ? (int32_t)((AGC_TARGET_RMS * 256UL) / rms) : AGC_GAIN_MAX;
+        if (want < g1)
+        {
+            g1 -= (g1 - want) / 4 + 1; // 约 -2.5dB/帧
+        }
+        else if (want > g1)
+        {
+            g1 += g1 / 64 + 1; // 约 +0.13dB/帧
+        }
+        // 峰值不能削顶
+        if ((int32_t)frame_peak * g1 > AGC_PEAK_LIMIT * 256)
+        {
+            g1 = frame_peak ? (AGC_PEAK_LIMIT * 256) / frame_peak : g1;
+        }
+        g1 = constrain(g1, AGC_GAIN_MIN, AGC_GAIN_MAX);
+    }
+    gain_q8 = g1;
+
+    int32_t step = ((g1 - g0) << 8) / (int32_t)frame_samples; // Q16
+    int32_t g = g0 << 8;
+    for (size_t i = 0; i < frame_samples; i++, g += step)
+    {
+        int32_t s = (in[i] * (g >> 8)) >> 8;
+        in[i] = s > 32767 ? 32767 : (s < -32768 ? -32768 : s);
+    }
+}
+
+size_t MicUplink::adpcmEncode(const int16_t *in, size_t n, uint8_t *out)
+{
+    int32_t pred = adpcm_pred;
+    int32_t index = adpcm_index;
+    out[0] = pred & 0xFF;
+    out[1] = (pred >> 8) & 0xFF;
+    out[2] = index;
+    out[3] = 0;
+    uint8_t *p = out + 4;
+    for (size_t i = 0; i < n; i++)
+    {
+        int32_t step = ima_step_table[index];
+        int32_t diff = in[i] - pred;
+        uint8_t code = 0;
+        if (diff < 0)
+        {
+            code = 8;
+            diff = -diff;
+        }
+        int32_t delta = step >> 3;
+        if (diff >= step)
+        {
+            code |= 4;
+            diff -= step;
+            delta += step;
+        }
+        step >>= 1;
+        if (diff >= step)
+        {
+            code |= 2;
+            diff -= step;
+            delta += step;
+        }
+        step >>= 1;
+        if (diff >= step)
+        {
+            code |= 1;
+            delta += step;
+        }
+        pred += (code & 8) ? -delta : delta;
+        pred = pred > 32767 ? 32767 : (pred < -32768 ? -32768 : pred);
+        index += ima_index_table[code];
+        index = index < 0 ? 0 : (index > 88 ? 88 : index);
+        if (i & 1)
+        {
+            *p++ |= code << 4;
+        }
+        else
+        {
+            *p = code;
+        }
+    }
+    adpcm_pred = pred;
+    adpcm_index = index;
+    return 4 + (n + 1) / 2;
+}
+
+void MicUplink::encode(int16_t *in)
+{
+    switch (cur_codec)
+    {
+    case UPLINK_PCM:
+        appendPacket((const uint8_t *)in, frame_samples * sizeof(int16_t));
+        break;
+    case UPLINK_ADPCM:
+    {
+        uint8_t out[4 + UPLINK_MAX_FRAME_SAMPLES / 2];
+        appendPacket(out, adpcmEncode(in, frame_samples, out));
+        break;
+    }
+#if ESP_AI_UPLINK_OPUS
+    case UPLINK_OPUS:
+        // 正好一帧，编码器立即输出一个包（经 uplink_packet_print 回到 appendPacket）
+        uplink_opus.write((const uint8_t *)in, frame_samples * sizeof(int16_t));
+        break;
+#endif
+    default:
+        break;
+    }
+}
+
+void MicUplink::appendPacket(const uint8_t *data, size_t len)
+{
+    if (len == 0 || UPLINK_BATCH_HEAD + len > UPLINK_BATCH_MAX_BYTES)
+    {
+        return;
+    }
+    if (batch_count == UPLINK_BATCH_FRAMES || UPLINK_BATCH_HEAD + batch_fill + len > UPLINK_BATCH_MAX_BYTES)
+    {
+        flush();
+    }
+    memcpy(batch + UPLINK_BATCH_HEAD + batch_fill, data, len);
+    batch_len[batch_count++] = len;
+    batch_fill += len;
+    if (batch_count == UPLINK_BATCH_FRAMES)
+    {
+        flush();
+    }
+}
+
+void MicUplink::flush()
+{
+    if (batch_count == 0)
+    {
+        return;
+    }
+    size_t head = 2 + 2 * batch_count;
+    uint8_t *p = batch + UPLINK_BATCH_HEAD - head;
+    p[0] = cur_codec;
+    p[1] = batch_count;
+    for (uint8_t i = 0; i < batch_count; i++)
+    {
+        p[2 + 2 * i] = batch_len[i] & 0xFF;
+        p[3 + 2 * i] = batch_len[i] >> 8;
+    }
+    if (sink)
+    {
+        sink(p, head + batch_fill);
+    }
+    frames_sent += batch_count;
+    bytes_sent += head + batch_fill;
+    batch_count = 0;
+    batch_fill = 0;
+}
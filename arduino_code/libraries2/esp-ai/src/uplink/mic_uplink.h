@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2024 小明IO
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Commercial use of this software requires prior written authorization from the Licensor.
+ * 请注意：将 ESP-AI 代码用于商业用途需要事先获得许可方的授权。
+ * 删除与修改版权属于侵权行为，请尊重作者版权，避免产生不必要的纠纷。
+ * 
+ * @author 小明IO   
+ * @email  1746809408@qq.com
+ * @github https://github.com/wangzongming/esp-ai
+ * @websit https://espai.fun
+ */
+#pragma once
+#include <Arduino.h>
+#include <functional>
+
+/**
+ * 麦克风上行：定点 AGC + 能量/过零率 VAD + 20ms 编码帧 + 批量打包
+ *
+ * 只有服务端回复 {"type":"mic_format","codec":"..."} 后才启用，否则仍按原来的方式上传原始 PCM。
+ * 静音帧不上传（语音起点前补发 UPLINK_PREROLL_FRAMES 帧，结束后延续 UPLINK_HANGOVER_FRAMES 帧），
+ * 语音开始/结束时通过 vad 回调通知。
+ *
+ * 二进制帧格式（小端）：
+ *   [0]      编码：0 = pcm，1 = opus，2 = adpcm
+ *   [1]      帧数 n
+ *   [2..]    n 个 uint16 帧长度
+ *   [...]    n 个编码帧
+ *
+ * adpcm 帧（IMA ADPCM，每帧可独立解码）：int16 预测值 + uint8 步长索引 + 1 字节保留 + 每样本 4 bit（低半字节在前）
+ * 16kHz 时：pcm 640 字节/帧，adpcm 164 字节/帧，opus 约 40 字节/帧（16kbps）。
+ */
+
+#if __has_include(<opus.h>)
+#define ESP_AI_UPLINK_OPUS 1
+#else
+#define ESP_AI_UPLINK_OPUS 0
+#endif
+
+#define UPLINK_FRAME_MS 20
+#define UPLINK_MAX_FRAME_SAMPLES 320 // 16kHz * 20ms
+#define UPLINK_PREROLL_FRAMES 5      // 语音起点前补发 100ms
+#define UPLINK_HANGOVER_FRAMES 15    // 语音结束后继续发送 300ms
+#define UPLINK_ONSET_FRAMES 2        // 连续 2 帧语音才算开始，滤掉咔哒声
+#define UPLINK_BATCH_FRAMES 5        // 每个 WebSocket 帧最多打包 100ms
+#define UPLINK_BATCH_MAX_BYTES 2048
+#define UPLINK_BATCH_HEAD (2 + 2 * UPLINK_BATCH_FRAMES)
+
+typedef enum
+{
+    UPLINK_PCM = 0,
+    UPLINK_OPUS = 1,
+    UPLINK_ADPCM = 2,
+    UPLINK_UNKNOWN = 0xFF,
+} uplink_codec_t;
+
+class MicUplink
+{
+public:
+    typedef std::function<void(const uint8_t *data, size_t len)> sink_t;
+    typedef std::function<void(bool speech)> vad_cb_t;
+
+    bool begin(uint32_t sample_rate, uplink_codec_t codec, sink_t sink, vad_cb_t on_vad = nullptr);
+    void end();
+    // 任意长度的 16 位单声道 PCM，内部按 20ms 切帧
+    void write(const int16_t *pcm, size_t samples);
+    // 发送未满的批次
+    void flush();
+    // 新的会话：清空帧缓存，VAD 回到静音，AGC 增益保留
+    void reset();
+
+    bool isActive() { return active; }
+    bool isSpeech() { return speech; }
+    uplink_codec_t codec() { return cur_codec; }
+    // AGC 增益，Q8（256 = 1 倍）
+    int32_t gain() { return gain_q8; }
+
+    uint32_t frames_in = 0;   // 输入的帧数
+    uint32_t frames_sent = 0; // 上传的帧数
+    uint32_t bytes_sent = 0;  // 上传的字节数（含批次头）
+
+    static const char *codecName(uplink_codec_t codec);
+    static uplink_codec_t codecFromName(const String &name);
+    // 本机支持的编码，逗号分隔，写入连接参数 mic_codecs
+    static const char *supportedCodecs();
+
+private:
+    bool vad(const int16_t *frame);
+    void agc(int16_t *frame, bool adapt);
+    void encode(int16_t *frame);
+    size_t adpcmEncode(const int16_t *in, size_t n, uint8_t *out);
+    void appendPacket(const uint8_t *data, size_t len);
+
+    sink_t sink;
+    vad_cb_t on_vad;
+    uplink_codec_t cur_codec = UPLINK_UNKNOWN;
+    bool active = false;
+    size_t frame_samples = UPLINK_MAX_FRAME_SAMPLES;
+
+    // 切帧
+    int16_t frame[UPLINK_MAX_FRAME_SAMPLES];
+    size_t frame_fill = 0;
+
+    // 语音起点前的帧（原始数据）
+    int16_t preroll[UPLINK_PREROLL_FRAMES][UPLINK_MAX_FRAME_SAMPLES];
+    uint8_t preroll_pos = 0;
+    uint8_t preroll_cnt = 0;
+
+    // VAD
+    uint32_t noise_floor = 0; // 噪声均方值
+    uint32_t frame_energy = 0;
+    uint16_t frame_peak = 0;
+    bool frame_voice = false;
+    uint8_t onset = 0;
+    uint8_t hangover = 0;
+    bool speech = false;
+
+    // AGC
+    int32_t gain_q8 = 10 * 256;
+
+    // ADPCM 状态
+    int16_t adpcm_pred = 0;
+    int8_t adpcm_index = 0;
+
+    // 批次：编码帧从 UPLINK_BATCH_HEAD 处开始存放，发送时把批次头写在它们前面
+    uint8_t batch[UPLINK_BATCH_MAX_BYTES];
+    uint8_t batch_count = 0;
+    size_t batch_fill = 0;
+    uint16_t batch_len[UPLINK_BATCH_FRAMES];
+};
@@ -40,7 +40,7 @@ void ESP_AI::set_config()
     if (JSON.typeof(data) == "undefined")
     {
         DEBUG_PRINTLN(debug, ("传入数据解析失败或者传入了空数据。"));
-        play_builtin_audio(lian_jie_shi_bai, lian_jie_shi_bai_len);
+        PLAY_PROMPT(lian_jie_shi_bai);
         web_server_setCrossOrigin();
         String json_response = "{\"success\":false,\"message\":\"传入数据解析失败或者传入了空数据。\"}";
         esp_ai_server.send(200, "application/json", json_response);
@@ -71,7 +71,7 @@ void ESP_AI::set_config()
         DEBUG_PRINT(debug, F("wifi信息并未发生变化，不重新连接wifi。仅进行重新绑定设备。"));
     }
 
-    play_builtin_audio(lian_jie_zhong, lian_jie_zhong_len);
+    PLAY_PROMPT(lian_jie_zhong);
     ap_connect_err = "0";
     int connect_count = 0;
     // 10s 连不上Wifi的话就判定失败
@@ -106,7 +106,7 @@ void ESP_AI::set_config()
         esp_ai_net_status = "0";
         ap_connect_err = "1";
         DEBUG_PRINTLN(debug, ("配网页面设置 WIFI 连接失败"));
-        play_builtin_audio(lian_jie_shi_bai, lian_jie_shi_bai_len);
+        PLAY_PROMPT(lian_jie_shi_bai);
         web_server_setCrossOrigin();
         String json_response = "{\"success\":false,\"message\":\"wifi连接失败，请检查账号密码，将会自动重启设备。\"}";
         esp_ai_server.send(200, "application/json", json_response);
@@ -141,7 +141,7 @@ void ESP_AI::set_config()
         web_server_setCrossOrigin();
         String json_response = "{\"success\":true,\"message\":\"wifi 连接成功，设备激活成功, 即将重启设备。\"}";
         esp_ai_server.send(200, "application/json", json_response);
-        play_builtin_audio(pei_wang_cheng_gong, pei_wang_cheng_gong_len);
+        PLAY_PROMPT(pei_wang_cheng_gong);
     }
 
     if (is_bind_ok)
@@ -28,6 +28,161 @@
  */
 #include "main.h"
 
+/**
+ * 二进制帧格式：4 字节会话ID + 2 字节会话状态（ASCII）+ 音频数据
+ * 帧由 WebSocketsClient::onFrameChunk 按 TCP 到达的分片交付，帧头按定宽整数比较，
+ * 音频数据直接写入播放队列，每帧不再申请堆内存，也不再构造 String。
+ * 播放队列满时只收下放得下的部分，其余数据留在 TCP 窗口里，由服务端降速（背压）。
+ */
+static inline uint32_t sid_key(const uint8_t *p)
+{
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+// 会话ID（String）转整数，长度不为 4 时返回 0（帧头不会是 4 个 '\0'）
+static inline uint32_t sid_key(const String &sid)
+{
+    return sid.length() == 4 ? sid_key((const uint8_t *)sid.c_str()) : 0;
+}
+
+static inline uint16_t status_key(const uint8_t *p)
+{
+    return (uint16_t)p[0] | (uint16_t)p[1] << 8;
+}
+
+static inline uint16_t status_key(const String &status)
+{
+    return status.length() == 2 ? status_key((const uint8_t *)status.c_str()) : 0;
+}
+
+enum
+{
+    BIN_ROUTE_DROP = 0,
+    BIN_ROUTE_PLAY,
+    BIN_ROUTE_CACHE_TONE,
+    BIN_ROUTE_CACHE_GREETINGS,
+};
+
+// 当前二进制帧的状态（帧头可能被 TCP 拆成两片）
+static struct
+{
+    uint8_t head[6];
+    uint8_t head_len;
+    uint8_t route;
+    uint32_t sid;
+    uint16_t status;
+} bin_frame;
+
+// 整帧交付（没有分片回调，或异步网络栈）时播放队列放不下的帧按顺序排在这里，由 loop() 继续写入，WS 任务不等待。
+// 排队的字节不计入额度，服务端收不到新额度就停发；每帧为 4 字节长度 + 数据
+#define BIN_BACKLOG_MAX (32 * 1024)
+static uint8_t *bin_backlog = nullptr;
+static size_t bin_backlog_len = 0;
+static size_t bin_backlog_cap = 0;
+static size_t bin_backlog_pos = 0; // 队首帧里已经写入的字节数
+
+static bool bin_backlog_push(const uint8_t *data, size_t len)
+{
+    size_t need = bin_backlog_len + 4 + len;
+    if (need > BIN_BACKLOG_MAX)
+    {
+        return false;
+    }
+    if (need > bin_backlog_cap)
+    {
+        size_t cap = bin_backlog_cap ? bin_backlog_cap * 2 : 4096;
+        while (cap < need)
+        {
+            cap *= 2;
+        }
+        if (cap > BIN_BACKLOG_MAX)
+        {
+            cap = BIN_BACKLOG_MAX;
+        }
+        uint8_t *p = (uint8_t *)realloc(bin_backlog, cap);
+        if (p == nullptr)
+        {
+            return false;
+        }
+        bin_backlog = p;
+        bin_backlog_cap = cap;
+    }
+    uint32_t n = len;
+    memcpy(bin_backlog + bin_backlog_len, &n, 4);
+    memcpy(bin_backlog + bin_backlog_len + 4, data, len);
+    bin_backlog_len = need;
+    return true;
+}
+
+static void bin_backlog_clear()
+{
+    free(bin_backlog);
+    bin_backlog = nullptr;
+    bin_backlog_len = bin_backlog_cap = bin_backlog_pos = 0;
+}
+
+// TTS 接收统计：首包延时、帧数、字节数、接收路径上的堆分配次数
+static struct
+{
+    uint32_t request_ms; // iat_end 的时间，0 表示没有等待中的回复
+    uint32_t first_ms;   // 第一包音频写入播放队列的时间
+    uint32_t frames;
+    uint32_t bytes;
+    uint32_t allocs;     // 开始时的 getRxAllocCount()
+} tts_stats;
+
+static void tts_stats_begin()
+{
+    tts_stats.request_ms = millis();
+    tts_stats.first_ms = 0;
+    tts_stats.frames = 0;
+    tts_stats.bytes = 0;
+    tts_stats.allocs = esp_ai_webSocket.getRxAllocCount();
+}
+
+static void tts_stats_print(bool debug)
+{
+    if (!debug || !tts_stats.request_ms || !tts_stats.first_ms)
+    {
+        return;
+    }
+    uint32_t now = millis();
+    uint32_t allocs = esp_ai_webSocket.getRxAllocCount() - tts_stats.allocs;
+    float seconds = (now - tts_stats.request_ms) / 1000.0f;
+    Serial.printf("[TTS] -> 首包延时: %lu ms, 帧数: %lu, 字节: %lu, 接收堆分配: %lu 次 (%.1f 次/秒)\n",
+                  (unsigned long)(tts_stats.first_ms - tts_stats.request_ms), (unsigned long)tts_stats.frames,
+                  (unsigned long)tts_stats.bytes, (unsigned long)allocs, seconds > 0 ? allocs / seconds : 0.0f);
+    tts_stats.request_ms = 0;
+}
+
+/**
+ * 文本消息：JsonScan 直接在 payload 上解析（不建 DOM，不申请堆内存），type 经完美哈希转成 ws_msg_t 后 switch 分发，
+ * 字段展开到栈上的定长缓冲区，只有交给 String 接口（回调、全局状态）时才构造 String。
+ */
+#define WS_FIELD_SHORT 48 // 会话ID、任务ID、状态、编码等
+#define WS_FIELD_LONG 192 // 错误信息，更长时截断
+
+// 长度不定的字段（回调参数），短的在栈上展开
+static String json_string(const JsonScan &msg, const char *key)
+{
+    JsonView v = msg.raw(key);
+    char stack_buf[128];
+    if (v.len < sizeof(stack_buf))
+    {
+        JsonScan::unescape(v, stack_buf, sizeof(stack_buf));
+        return String(stack_buf);
+    }
+    char *buf = (char *)malloc(v.len + 1);
+    if (buf == nullptr)
+    {
+        return String();
+    }
+    JsonScan::unescape(v, buf, v.len + 1);
+    String res(buf);
+    free(buf);
+    return res;
+}
+
 void ESP_AI::webSocketEvent(WStype_t type, uint8_t *payload, size_t length)
 {
     switch (type)
@@ -37,13 +192,17 @@ void ESP_AI::webSocketEvent(WStype_t type, uint8_t *payload, size_t length)
         if (esp_ai_ws_connected)
         {
             esp_ai_ws_connected = false;
+            esp_ai_uplink_codec = UPLINK_UNKNOWN;
+            esp_ai_play_credit.setEnabled(false);
             esp_ai_start_ed = "0";
             esp_ai_session_id = "";
             asr_ing = false;
             Serial.print("[Info] -> ESP-AI 服务已断开：");
             Serial.println(length);
-            esp_ai_cache_audio_du.clear();
-            esp_ai_cache_audio_greetings.clear();
+            // 带 hash 的缓存保留，重连后服务端 cache_offer 直接命中
+            bin_backlog_clear();
+            esp_ai_cache_audio_du.disconnected();
+            esp_ai_cache_audio_greetings.disconnected();
             // esp_ai_cache_audio_sleep_reply.clear();
 
             // 内置状态处理
@@ -60,6 +219,8 @@ void ESP_AI::webSocketEvent(WStype_t type, uint8_t *payload, size_t length)
     {
         Serial.println("[Info] -> ESP-AI 服务连接成功");
         esp_ai_ws_connected = true;
+        esp_ai_uplink_codec = UPLINK_UNKNOWN;
+        esp_ai_play_credit.setEnabled(false);
         esp_ai_start_ed = "0";
         esp_ai_session_id = "";
         asr_ing = false;
@@ -96,8 +257,8 @@ void ESP_AI::webSocketEvent(WStype_t type, uint8_t *payload, size_t length)
         }
         else
         {
-            JSONVar parseRes = JSON.parse((char *)payload);
-            if (JSON.typeof(parseRes) == "undefined")
+            JsonScan msg;
+            if (!msg.parse((const char *)payload, length))
             {
                 return;
             }
@@ -107,425 +268,590 @@ void ESP_AI::webSocketEvent(WStype_t type, uint8_t *payload, size_t length)
                 Serial.println((char *)payload);
             }
 
-            if (parseRes.hasOwnProperty("type"))
+            const JsonField *type_field = msg.find("type");
+            if (type_field == nullptr)
+            {
+                return;
+            }
+            ws_msg_t msg_type = type_field->kind == JSON_STRING ? ws_msg_type(type_field->val.p, type_field->val.len) : WS_MSG_UNKNOWN;
+
+            switch (msg_type)
+            {
+            case WS_MSG_STC_TIME:
             {
-                String type = (const char *)parseRes["type"];
-                String command_id = "";
-                String data = "";
-                if (parseRes.hasOwnProperty("command_id"))
+                // 原样回传（转义后的原文，仍是合法的 JSON 字符串）
+                JsonView stc_time = msg.raw("stc_time");
+                char reply[128];
+                int n = snprintf(reply, sizeof(reply), "{\"type\":\"cts_time\",\"stc_time\":\"%.*s\"}", (int)stc_time.len, stc_time.p);
+                if (n > 0 && n < (int)sizeof(reply) && xSemaphoreTake(esp_ai_ws_mutex, pdMS_TO_TICKS(100)) == pdTRUE)
                 {
-                    command_id = (const char *)parseRes["command_id"];
+                    esp_ai_webSocket.sendTXT(reply, n);
+                    xSemaphoreGive(esp_ai_ws_mutex);
                 }
-                if (parseRes.hasOwnProperty("data"))
+                break;
+            }
+
+            case WS_MSG_NET_DELAY:
+            {
+                long net_delay = msg.num("net_delay");
+                DEBUG_PRINTLN(debug, "[Info] -> 网络延时：" + String(net_delay) + "ms");
+                break;
+            }
+
+            // user command
+            case WS_MSG_INSTRUCT:
+                if (onEventCb != nullptr)
                 {
-                    data = (const char *)parseRes["data"];
+                    onEventCb(json_string(msg, "command_id"), json_string(msg, "data"));
                 }
+                break;
 
-                if (type == "stc_time")
+            // tts task log
+            case WS_MSG_PLAY_AUDIO:
+            {
+                // 上报音频时
+                if (esp_ai_start_send_audio)
                 {
-                    if (xSemaphoreTake(esp_ai_ws_mutex, pdMS_TO_TICKS(100)) == pdTRUE)
-                    {
-                        String stc_time = parseRes["stc_time"];
-                        JSONVar data_delayed;
-                        data_delayed["type"] = "cts_time";
-                        data_delayed["stc_time"] = stc_time;
-                        String sendData = JSON.stringify(data_delayed);
-                        esp_ai_webSocket.sendTXT(sendData);
-                        xSemaphoreGive(esp_ai_ws_mutex);
-                    }
+                    esp_ai_tts_task_id = "";
+                    return;
+                }
+                spk_ing = true;
+                char tts_task_id[WS_FIELD_SHORT];
+                msg.str("tts_task_id", tts_task_id, sizeof(tts_task_id));
+                esp_ai_tts_task_id = tts_task_id;
+                if (debug)
+                {
+                    char now_session_id[WS_FIELD_SHORT];
+                    msg.str("session_id", now_session_id, sizeof(now_session_id));
+                    Serial.printf("[TTS] -> TTS 任务：%s 所属会话：%s\n", tts_task_id, now_session_id);
                 }
+                break;
+            }
+
+            case WS_MSG_MIC_FORMAT:
+            {
+                // 服务端选定的麦克风上行编码，由 send_audio 任务切换
+                char codec[WS_FIELD_SHORT];
+                msg.str("codec", codec, sizeof(codec));
+                esp_ai_uplink_codec = MicUplink::codecFromName(codec);
+                DEBUG_PRINTLN(debug, "[Info] -> 麦克风上行编码：" + String(codec) + (esp_ai_uplink_codec == UPLINK_UNKNOWN ? "（不支持，上传原始 PCM）" : ""));
+                break;
+            }
 
-                else if (type == "net_delay")
+            case WS_MSG_FLOW_CONTROL:
+            {
+                // 服务端按额度发送 TTS，不再需要每秒上报 client_available_audio
+                char mode[WS_FIELD_SHORT];
+                msg.str("mode", mode, sizeof(mode));
+                esp_ai_play_credit.setEnabled(strcmp(mode, "credit") == 0);
+                DEBUG_PRINTLN(debug, "[Info] -> TTS 流控：" + String(mode));
+                break;
+            }
+
+            case WS_MSG_SESSION_START:
+            {
+                char session_id[WS_FIELD_SHORT];
+                msg.str("session_id", session_id, sizeof(session_id));
+                esp_ai_session_id = session_id;
+                spk_ing = true;
+                break;
+            }
+
+            case WS_MSG_SESSION_STOP:
+                // 上报音频时
+                if (esp_ai_start_send_audio)
                 {
-                    long net_delay = parseRes["net_delay"];
-                    DEBUG_PRINTLN(debug, "[Info] -> 网络延时：" + String(net_delay) + "ms");
+                    esp_ai_tts_task_id = "";
+                    return;
                 }
 
-                // user command
-                else if (type == "instruct")
+                // 这里仅仅是停止，并不能结束录音
+                esp_ai_session_id = "";
+                break;
+
+            case WS_MSG_AUTH_FAIL:
+            {
+                char message[WS_FIELD_LONG];
+                char code[WS_FIELD_SHORT];
+                msg.str("message", message, sizeof(message));
+                msg.str("code", code, sizeof(code));
+                Serial.printf("[Error] -> 连接服务失败，鉴权失败：code: %s, message: %s\n", code, message);
+                Serial.println(F("[Error] -> 请检测服务器配置中是否配置了鉴权参数。"));
+                Serial.println(F("[Error] -> 如果你想用开放平台服务请到配网页面配置秘钥！"));
+                Serial.println(F("[Error] -> 如果你想用开放平台服务请到配网页面配置秘钥！"));
+                Serial.println(F("[Error] -> 如果你想用开放平台服务请到配网页面配置秘钥！"));
+                if (onErrorCb != nullptr)
                 {
-                    if (onEventCb != nullptr)
-                    {
-                        onEventCb(command_id, data);
-                    }
+                    onErrorCb("002", "auth", message);
                 }
+                break;
+            }
 
-                // tts task log
-                else if (type == "play_audio")
+            case WS_MSG_ERROR:
+            {
+                char at_pos[WS_FIELD_SHORT];
+                char message[WS_FIELD_LONG];
+                char code[WS_FIELD_SHORT];
+                msg.str("at", at_pos, sizeof(at_pos));
+                msg.str("message", message, sizeof(message));
+                msg.str("code", code, sizeof(code));
+                Serial.printf("[Error] -> 服务错误：%s %s %s\n", at_pos, code, message);
+
+                if (strcmp(code, "4002") == 0)
                 {
-                    // 上报音频时
-                    if (esp_ai_start_send_audio)
-                    {
-                        esp_ai_tts_task_id = "";
-                        return;
-                    }
-                    spk_ing = true;
-                    esp_ai_tts_task_id = (const char *)parseRes["tts_task_id"];
-                    String now_session_id = (const char *)parseRes["session_id"];
-                    DEBUG_PRINTLN(debug, "[TTS] -> TTS 任务：" + esp_ai_tts_task_id + " 所属会话：" + now_session_id);
+                    PLAY_PROMPT(yu_e_bu_zuo);
                 }
-                else if (type == "session_start")
+                else if (strcmp(code, "4001") == 0)
                 {
-                    esp_ai_session_id = (const char *)parseRes["session_id"];
-                    spk_ing = true;
+                    PLAY_PROMPT(e_du_ka_bu_cun_zai);
                 }
-
-                else if (type == "session_stop")
+                else if (strcmp(code, "4000") == 0)
                 {
-                    // 上报音频时
-                    if (esp_ai_start_send_audio)
-                    {
-                        esp_ai_tts_task_id = "";
-                        return;
-                    }
+                    PLAY_PROMPT(chao_ti_wei_qi_yong);
+                }
 
-                    // 这里仅仅是停止，并不能结束录音
-                    esp_ai_session_id = "";
+                if (onErrorCb != nullptr)
+                {
+                    onErrorCb(code, at_pos, message);
                 }
+                break;
+            }
 
-                else if (type == "auth_fail")
+            case WS_MSG_SESSION_STATUS:
+            {
+                char status[WS_FIELD_SHORT];
+                msg.str("status", status, sizeof(status));
+
+                if (strcmp(status, "iat_end") == 0)
                 {
-                    String message = (const char *)parseRes["message"];
-                    String code = (const char *)parseRes["code"];
-                    Serial.println("[Error] -> 连接服务失败，鉴权失败：code: " + code + ", message: "+ message);
-                    Serial.println(F("[Error] -> 请检测服务器配置中是否配置了鉴权参数。"));
-                    Serial.println(F("[Error] -> 如果你想用开放平台服务请到配网页面配置秘钥！"));
-                    Serial.println(F("[Error] -> 如果你想用开放平台服务请到配网页面配置秘钥！"));
-                    Serial.println(F("[Error] -> 如果你想用开放平台服务请到配网页面配置秘钥！"));
-                    if (onErrorCb != nullptr)
-                    {
-                        onErrorCb("002", "auth", message);
-                    }
+                    tts_stats_begin();
+                    esp_ai_start_ed = "0";
+                    esp_ai_start_send_audio = false;
+                    asr_ing = false;
+                    spk_ing = true;
                 }
-                else if (type == "error")
+                else if (strcmp(status, "iat_start") == 0)
                 {
-                    String at_pos = (const char *)parseRes["at"];
-                    String message = (const char *)parseRes["message"];
-                    String code = (const char *)parseRes["code"];
-                    Serial.println("[Error] -> 服务错误：" + at_pos + " " + code + " " + message);
+                    // 开始发送音频时，先等话说完
+                    wait_mp3_player_done();
+                    // 正在说话时就不要继续推理了，否则会误唤醒
+                    esp_ai_start_ed = "1";
+                    // 开始发送音频时，将缓冲区中的数据发送出去
+                    esp_ai_start_send_audio = true;
+                    // 记录时间戳
+                    last_silence_time = millis();
+                }
 
-                    if (code == "4002")
-                    {
-                        play_builtin_audio(yu_e_bu_zuo, yu_e_bu_zuo_len);
-                    }
-                    else if (code == "4001")
-                    {
-                        play_builtin_audio(e_du_ka_bu_cun_zai, e_du_ka_bu_cun_zai_len);
-                    }
-                    else if (code == "4000")
-                    {
-                        play_builtin_audio(chao_ti_wei_qi_yong, chao_ti_wei_qi_yong_len);
-                    }
+                // 内置状态处理
+                status_change(status);
+                if (onSessionStatusCb != nullptr)
+                {
+                    onSessionStatusCb(status);
+                }
+                break;
+            }
 
-                    if (onErrorCb != nullptr)
+            case WS_MSG_SET_WIFI_CONFIG:
+                if (xSemaphoreTake(esp_ai_ws_mutex, pdMS_TO_TICKS(100)) == pdTRUE)
+                {
+                    // setWifiConfig 的参数是 JSONVar，只把 configs 这一段交给 JSON.parse（很少收到的消息）
+                    JSONVar JSON_data;
+                    const JsonField *configs = msg.find("configs");
+                    if (configs != nullptr && configs->kind == JSON_OBJECT)
                     {
-                        onErrorCb(code, at_pos, message);
+                        char *end = (char *)configs->val.p + configs->val.len;
+                        char saved = *end;
+                        *end = '\0';
+                        JSON_data = JSON.parse(configs->val.p);
+                        *end = saved;
                     }
+                    bool is_ok = setWifiConfig(JSON_data);
+
+                    JSONVar set_wifi_config_res;
+                    set_wifi_config_res["type"] = "set_wifi_config_res";
+                    set_wifi_config_res["success"] = is_ok;
+                    String sendData = JSON.stringify(set_wifi_config_res);
+                    DEBUG_PRINTLN(debug, F("[TTS] -> 发送设置WiFi参数结果到服务端"));
+                    esp_ai_webSocket.sendTXT(sendData);
+                    xSemaphoreGive(esp_ai_ws_mutex);
                 }
+                break;
 
-                else if (type == "session_status")
-                {
-                    String status = (const char *)parseRes["status"];
+            case WS_MSG_RESTART:
+                ESP.restart();
+                break;
 
-                    if (status == "iat_end")
-                    {
-                        esp_ai_start_ed = "0";
-                        esp_ai_start_send_audio = false;
-                        asr_ing = false;
-                        spk_ing = true;
-                    }
-                    else if (status == "iat_start")
-                    {
-                        // 开始发送音频时，先等话说完
-                        wait_mp3_player_done();
-                        // 正在说话时就不要继续推理了，否则会误唤醒
-                        esp_ai_start_ed = "1";
-                        // 开始发送音频时，将缓冲区中的数据发送出去
-                        esp_ai_start_send_audio = true;
-                        // 记录时间戳
-                        last_silence_time = millis();
-                    }
+            case WS_MSG_CLEAR_CACHE:
+                esp_ai_cache_audio_du.clear();
+                esp_ai_cache_audio_greetings.clear();
+                break;
 
-                    // 内置状态处理
-                    status_change(status);
-                    if (onSessionStatusCb != nullptr)
-                    {
-                        onSessionStatusCb(status);
-                    }
-                }
-                else if (type == "set_wifi_config")
+            case WS_MSG_CACHE_OFFER:
+            {
+                // 服务端准备下发缓存音频，先比对 hash
+                char key[WS_FIELD_SHORT];
+                char hash[WS_FIELD_SHORT + 32];
+                msg.str("key", key, sizeof(key));
+                msg.str("hash", hash, sizeof(hash));
+                long size = msg.num("size");
+                CachedAudio *cache = strcmp(key, esp_ai_cache_audio_du.name()) == 0          ? &esp_ai_cache_audio_du
+                                     : strcmp(key, esp_ai_cache_audio_greetings.name()) == 0 ? &esp_ai_cache_audio_greetings
+                                                                                             : nullptr;
+                bool hit = cache != nullptr && cache->offer(hash, size > 0 ? size : 0);
+                DEBUG_PRINTLN(debug, "[Info] -> 音频缓存 " + String(key) + (hit ? " 命中" : " 未命中"));
+                char reply[WS_FIELD_SHORT + 64];
+                int n = snprintf(reply, sizeof(reply), "{ \"type\":\"cache_reply\", \"key\": \"%s\", \"hit\": %s }", key, hit ? "true" : "false");
+                if (n > 0 && n < (int)sizeof(reply) && xSemaphoreTake(esp_ai_ws_mutex, pdMS_TO_TICKS(100)) == pdTRUE)
                 {
+                    esp_ai_webSocket.sendTXT(reply, n);
+                    xSemaphoreGive(esp_ai_ws_mutex);
+                }
+                break;
+            }
 
-                    if (xSemaphoreTake(esp_ai_ws_mutex, pdMS_TO_TICKS(100)) == pdTRUE)
-                    {
+            case WS_MSG_SET_LOCAL_DATA:
+            {
+                char field[WS_FIELD_SHORT];
+                msg.str("field", field, sizeof(field));
+                set_local_data(field, json_string(msg, "value"));
+                break;
+            }
 
-                        JSONVar JSON_data = parseRes["configs"];
-                        bool is_ok = setWifiConfig(JSON_data);
+            case WS_MSG_LOG:
+                // 服务端日志，开启 debug 时已经打印了整条消息
+                break;
 
-                        JSONVar set_wifi_config_res;
-                        set_wifi_config_res["type"] = "set_wifi_config_res";
-                        set_wifi_config_res["success"] = is_ok;
-                        String sendData = JSON.stringify(data);
-                        DEBUG_PRINTLN(debug, F("[TTS] -> 发送设置WiFi参数结果到服务端"));
-                        esp_ai_webSocket.sendTXT(sendData);
-                        xSemaphoreGive(esp_ai_ws_mutex);
-                    }
-                }
+            case WS_MSG_SEVER_CLOSE:
+                DEBUG_PRINT(debug, F("[Error] 服务端主动断开，尝试重新连接。"));
+                ESP.restart();
+                break;
 
-                else if (type == "restart")
-                {
-                    ESP.restart();
-                }
-                else if (type == "clear_cache")
+            case WS_MSG_HARDWARE_FNS:
+            {
+                int pin = (int)msg.num("pin");
+                char fn_name[WS_FIELD_SHORT];
+                char str_val[WS_FIELD_SHORT];
+                msg.str("fn_name", fn_name, sizeof(fn_name));
+                msg.str("str_val", str_val, sizeof(str_val));
+                int num_val = (int)msg.num("num_val");
+
+                // 设置引脚模式
+                if (strcmp(fn_name, "pinMode") == 0)
                 {
-                    if (!esp_ai_cache_audio_du.empty())
-                    {
-                        esp_ai_cache_audio_du.clear();
-                    }
-                    if (!esp_ai_cache_audio_greetings.empty())
+                    strcmp(str_val, "OUTPUT") == 0 && (pinMode(pin, OUTPUT), true);
+                    strcmp(str_val, "INPUT") == 0 && (pinMode(pin, INPUT), true);
+                    strcmp(str_val, "INPUT_PULLUP") == 0 && (pinMode(pin, INPUT_PULLUP), true);
+                    strcmp(str_val, "INPUT_PULLDOWN") == 0 && (pinMode(pin, INPUT_PULLDOWN), true);
+
+                    // LEDC
+                    if (strcmp(str_val, "LEDC") == 0)
                     {
-                        esp_ai_cache_audio_greetings.clear();
+                        // LEDC 通道, 取值 0 ~ 15
+                        int channel = (int)msg.num("channel", 0);
+                        // 定义 PWM 频率，舵机通常使用 50Hz
+                        int freq = (int)msg.num("freq", 50);
+                        // 定义 PWM 分辨率
+                        int resolution = (int)msg.num("resolution", 10);
+
+                        // 初始化 LEDC 通道
+                        ledcSetup(channel, freq, resolution);
+                        // 将 LEDC 通道绑定到指定引脚
+                        ledcAttachPin(pin, channel);
                     }
                 }
-                else if (type == "set_local_data")
+                else if (strcmp(fn_name, "digitalWrite") == 0)
                 {
-                    String field = (const char *)parseRes["field"];
-                    String value = (const char *)parseRes["value"];
-                    set_local_data(field, value);
+                    strcmp(str_val, "HIGH") == 0 && (digitalWrite(pin, HIGH), true);
+                    strcmp(str_val, "LOW") == 0 && (digitalWrite(pin, LOW), true);
                 }
-                else if (type == "log")
+                else if (strcmp(fn_name, "digitalRead") == 0)
                 {
-                    String data = (const char *)parseRes["data"];
+                    digital_read_pins.push_back(pin);
                 }
-                else if (type == "sever-close")
+                else if (strcmp(fn_name, "analogWrite") == 0)
                 {
-                    DEBUG_PRINT(debug, F("[Error] 服务端主动断开，尝试重新连接。"));
-                    ESP.restart();
+                    analogWrite(pin, num_val);
                 }
-
-                else if (type == "hardware-fns")
+                else if (strcmp(fn_name, "analogRead") == 0)
                 {
-                    int pin = (int)parseRes["pin"];
-                    String fn_name = (const char *)parseRes["fn_name"];
-                    String str_val = (const char *)parseRes["str_val"];
-                    int num_val = (int)parseRes["num_val"];
-
-                    // 设置引脚模式
-                    if (fn_name == "pinMode")
-                    {
-                        str_val == "OUTPUT" && (pinMode(pin, OUTPUT), true);
-                        str_val == "INPUT" && (pinMode(pin, INPUT), true);
-                        str_val == "INPUT_PULLUP" && (pinMode(pin, INPUT_PULLUP), true);
-                        str_val == "INPUT_PULLDOWN" && (pinMode(pin, INPUT_PULLDOWN), true);
-
-                        // LEDC
-                        if (str_val == "LEDC")
-                        {
-                            // LEDC 通道, 取值 0 ~ 15
-                            int channel = 0;
-                            if (parseRes.hasOwnProperty("channel"))
-                            {
-                                channel = (int)parseRes["channel"];
-                            }
-                            // 定义 PWM 频率，舵机通常使用 50Hz
-                            int freq = 50;
-                            if (parseRes.hasOwnProperty("freq"))
-                            {
-                                freq = (int)parseRes["freq"];
-                            }
-                            // 定义 PWM 分辨率
-                            int resolution = 10;
-                            if (parseRes.hasOwnProperty("resolution"))
-                            {
-                                resolution = (int)parseRes["resolution"];
-                            }
-
-                            // 初始化 LEDC 通道
-                            ledcSetup(channel, freq, resolution);
-                            // 将 LEDC 通道绑定到指定引脚
-                            ledcAttachPin(pin, channel);
-                        }
-                    }
-                    else if (fn_name == "digitalWrite")
-                    {
-                        str_val == "HIGH" && (digitalWrite(pin, HIGH), true);
-                        str_val == "LOW" && (digitalWrite(pin, LOW), true);
-                    }
-                    else if (fn_name == "digitalRead")
-                    {
-                        digital_read_pins.push_back(pin);
-                    }
-                    else if (fn_name == "analogWrite")
-                    {
-                        analogWrite(pin, num_val);
-                    }
-                    else if (fn_name == "analogRead")
-                    {
-                        analog_read_pins.push_back(pin);
-                    }
-                    // 舵机驱动
-                    else if (fn_name == "ledcWrite")
-                    {
-                        int channel = 0;
-                        if (parseRes.hasOwnProperty("channel"))
-                        {
-                            channel = (int)parseRes["channel"];
-                        }
-                        int deg = (int)parseRes["deg"];
-                        ledcWrite(channel, angleToDutyCycle(deg));
-                    }
+                    analog_read_pins.push_back(pin);
                 }
-                // 情绪监听
-                else if (type == "emotion")
+                // 舵机驱动
+                else if (strcmp(fn_name, "ledcWrite") == 0)
                 {
-                    if (onEmotionCb != nullptr)
-                    {
-                        onEmotionCb(data);
-                    }
+                    int channel = (int)msg.num("channel", 0);
+                    int deg = (int)msg.num("deg");
+                    ledcWrite(channel, angleToDutyCycle(deg));
                 }
+                break;
+            }
+
+            // 情绪监听
+            case WS_MSG_EMOTION:
+                if (onEmotionCb != nullptr)
+                {
+                    onEmotionCb(json_string(msg, "data"));
+                }
+                break;
+
+            default:
+                break;
             }
         }
 
         break;
     case WStype_BIN:
     {
-
-        if (length < 6)
+        // 未注册流式回调时（或异步网络栈）整帧到达，走同一条处理路径；队列满时余下的排队，不在这里等待
+        bool idle = binBacklogDrain();
+        size_t done = 0;
+        if (idle)
         {
-            Serial.print("[Error] -> 数据帧长度小于6字节: ");
-            Serial.println(length);
-            return;
+            done = webSocketBinChunk(WSop_binary, 0, payload, length, true);
+            esp_ai_play_credit.received(done);
         }
-
-        // 会话ID
-        char session_id_string[5];
-        memcpy(session_id_string, payload, 4);
-        session_id_string[4] = '\0';
-        String sid = String(session_id_string);
-
-        // 会话状态
-        char session_status_string[3];
-        memcpy(session_status_string, payload + 4, 2);
-        session_status_string[2] = '\0';
-        esp_ai_session_status = String(session_status_string);
-
-        // Serial.print("内容长度：");
-        // Serial.print(length);
-        // Serial.print("  会话ID：");
-        // Serial.print(sid);
-        // Serial.print("  会话状态：");
-        // Serial.print(esp_ai_session_status);
-
-        // 提取音频数据
-        uint8_t *audioData = payload + 6;
-        size_t audioLength = length - 6;
-
-        if (sid == SID_TONE_CACHE)
+        if (done < length)
         {
-            esp_ai_cache_audio_du.insert(esp_ai_cache_audio_du.end(), audioData, audioData + audioLength);
+            if (bin_backlog_push(payload, length))
+            {
+                if (idle)
+                {
+                    bin_backlog_pos = done;
+                }
+            }
+            else
+            {
+                Serial.printf("[Warn] -> 播放队列已满，排队超过 %u 字节，丢弃 %u 字节（服务端没有按额度发送）\n", BIN_BACKLOG_MAX, (unsigned)(length - done));
+            }
         }
-        else if (sid == SID_WAKEUP_REP_CACHE)
+        break;
+    }
+    // case WStype_PING:
+    //     Serial.println("Ping");
+    //     break;
+    // case WStype_PONG:
+    //     Serial.println("Pong");
+    //     break;
+    case WStype_ERROR:
+        Serial.println("[Error] 服务 WebSocket 连接错误");
+        break;
+    }
+}
+
+/**
+ * 把排队的整帧写入播放队列，写不下时停下，返回队列是否已空；只在 loop()（webSocket.loop() 的回调也在这里）里调用，不用加锁
+ */
+bool ESP_AI::binBacklogDrain()
+{
+    size_t head = 0;
+    while (head < bin_backlog_len)
+    {
+        uint32_t len;
+        memcpy(&len, bin_backlog + head, 4);
+        uint8_t *frame = bin_backlog + head + 4;
+        size_t n = webSocketBinChunk(WSop_binary, bin_backlog_pos, frame + bin_backlog_pos, len - bin_backlog_pos, true);
+        esp_ai_play_credit.received(n);
+        bin_backlog_pos += n;
+        if (bin_backlog_pos < len)
         {
-            esp_ai_cache_audio_greetings.insert(esp_ai_cache_audio_greetings.end(), audioData, audioData + audioLength);
+            break;
         }
-        else
-        {
-            // 会话ID 不正确的分组数据直接抛弃  SID_WAKEUP_REP_CACHE
-            if (session_id_string && sid != SID_TONE && sid != SID_CONNECTED_SERVER && sid != SID_TTS_FN && sid != esp_ai_session_id)
-                return;
-            if (sid == SID_CONNECTED_SERVER && esp_ai_played_connected)
-                return;
+        head += 4 + len;
+        bin_backlog_pos = 0;
+    }
+    if (head > 0)
+    {
+        memmove(bin_backlog, bin_backlog + head, bin_backlog_len - head);
+        bin_backlog_len -= head;
+    }
+    return bin_backlog_len == 0;
+}
 
-            // Serial.print("  写入长度：");
-            // Serial.print(audioLength);
-            // Serial.print("    正在播放长度：");
-            // Serial.println(esp_ai_spk_queue.available());
-            mp3_player_write(audioData, audioLength);
-        }
+/**
+ * 二进制帧的一个分片，返回收下的字节数；少于 length 时剩余部分会在下次 loop() 重新交付
+ */
+size_t ESP_AI::webSocketBinChunk(WSopcode_t opcode, size_t offset, uint8_t *payload, size_t length, bool isFinal)
+{
+    size_t taken = 0;
 
-        if (esp_ai_session_status == SID_TTS_END_RESTART)
+    // 帧头：会话ID + 会话状态
+    if (offset == 0)
+    {
+        bin_frame.head_len = 0;
+    }
+    if (bin_frame.head_len < 6)
+    {
+        size_t n = 6 - bin_frame.head_len;
+        if (n > length)
         {
-            esp_ai_tts_task_id = "";
-            // 内置状态处理
-            status_change("tts_real_end");
-            if (esp_ai_session_id != "")
+            n = length;
+        }
+        memcpy(bin_frame.head + bin_frame.head_len, payload, n);
+        bin_frame.head_len += n;
+        payload += n;
+        length -= n;
+        taken += n;
+        if (bin_frame.head_len < 6)
+        {
+            if (isFinal)
             {
-                wait_mp3_player_done();
+                Serial.print("[Error] -> 数据帧长度小于6字节: ");
+                Serial.println(bin_frame.head_len);
+            }
+            return taken;
+        }
 
-                if (xSemaphoreTake(esp_ai_ws_mutex, pdMS_TO_TICKS(100)) == pdTRUE)
-                {
-                    esp_ai_webSocket.sendTXT("{ \"type\":\"client_out_audio_over\", \"session_id\": \"" + sid + "\",  \"session_status\": \"" + esp_ai_session_status + "\", \"tts_task_id\": \"" + esp_ai_tts_task_id + "\" }");
-                    xSemaphoreGive(esp_ai_ws_mutex);
-                }
+        bin_frame.sid = sid_key(bin_frame.head);
+        bin_frame.status = status_key(bin_frame.head + 4);
 
-                if (onSessionStatusCb != nullptr)
-                {
-                    onSessionStatusCb("tts_real_end");
-                }
+        // 会话状态，只在变化时才重新赋值
+        if (status_key(esp_ai_session_status) != bin_frame.status)
+        {
+            char session_status_string[3] = {(char)bin_frame.head[4], (char)bin_frame.head[5], '\0'};
+            esp_ai_session_status = String(session_status_string);
+        }
 
-                if (!esp_ai_is_listen_model)
-                {
-                    // tts发送完毕，需要重新开启录音
-                    DEBUG_PRINTLN(debug, F("[TTS] -> TTS 数据全部接收完毕，需继续对话。"));
-                    // 等待音频播放完毕
-                    // wait_mp3_player_done();
-                    asr_ing = false;
-                    spk_ing = false;
-                    wakeUp("continue");
-                }
-            }
+        if (bin_frame.sid == sid_key(SID_TONE_CACHE))
+        {
+            bin_frame.route = BIN_ROUTE_CACHE_TONE;
+        }
+        else if (bin_frame.sid == sid_key(SID_WAKEUP_REP_CACHE))
+        {
+            bin_frame.route = BIN_ROUTE_CACHE_GREETINGS;
+        }
+        // 会话ID 不正确的分组数据直接抛弃
+        else if (bin_frame.sid != sid_key(SID_TONE) && bin_frame.sid != sid_key(SID_CONNECTED_SERVER) &&
+                 bin_frame.sid != sid_key(SID_TTS_FN) && bin_frame.sid != sid_key(esp_ai_session_id))
+        {
+            bin_frame.route = BIN_ROUTE_DROP;
         }
-        else if (esp_ai_session_status == SID_TTS_END)
+        else if (bin_frame.sid == sid_key(SID_CONNECTED_SERVER) && esp_ai_played_connected)
         {
+            bin_frame.route = BIN_ROUTE_DROP;
+        }
+        else
+        {
+            bin_frame.route = BIN_ROUTE_PLAY;
+            tts_stats.frames++;
+        }
+    }
 
-            // 服务连接成功播放完毕
-            bool is_first_connect = esp_ai_played_connected == false && sid == SID_CONNECTED_SERVER && esp_ai_session_status == SID_TTS_END;
-            if (is_first_connect)
+    // 音频数据
+    if (length > 0)
+    {
+        switch (bin_frame.route)
+        {
+        case BIN_ROUTE_CACHE_TONE:
+            esp_ai_cache_audio_du.append(payload, length);
+            break;
+        case BIN_ROUTE_CACHE_GREETINGS:
+            esp_ai_cache_audio_greetings.append(payload, length);
+            break;
+        case BIN_ROUTE_PLAY:
+        {
+            size_t n = mp3_player_try_write(payload, length);
+            if (n > 0 && tts_stats.request_ms && !tts_stats.first_ms)
             {
-                esp_ai_played_connected = true;
+                tts_stats.first_ms = millis();
             }
+            tts_stats.bytes += n;
+            taken += n;
+            if (n < length)
+            {
+                // 播放队列已满
+                return taken;
+            }
+            break;
+        }
+        default:
+            break;
+        }
+        if (bin_frame.route != BIN_ROUTE_PLAY)
+        {
+            taken += length;
+        }
+    }
 
+    if (!isFinal || bin_frame.route == BIN_ROUTE_DROP)
+    {
+        return taken;
+    }
+
+    // 整帧接收完毕，处理会话状态
+    if (bin_frame.status == status_key(SID_TTS_END_RESTART))
+    {
+        char sid[5] = {(char)bin_frame.head[0], (char)bin_frame.head[1], (char)bin_frame.head[2], (char)bin_frame.head[3], '\0'};
+        tts_stats_print(debug);
+        esp_ai_tts_task_id = "";
+        // 内置状态处理
+        status_change("tts_real_end");
+        if (esp_ai_session_id != "")
+        {
             wait_mp3_player_done();
+
             if (xSemaphoreTake(esp_ai_ws_mutex, pdMS_TO_TICKS(100)) == pdTRUE)
             {
-                esp_ai_webSocket.sendTXT("{ \"type\":\"client_out_audio_over\", \"session_id\": \"" + sid + "\", \"session_status\": \"" + esp_ai_session_status + "\", \"tts_task_id\": \"" + esp_ai_tts_task_id + "\"}");
+                esp_ai_webSocket.sendTXT("{ \"type\":\"client_out_audio_over\", \"session_id\": \"" + String(sid) + "\",  \"session_status\": \"" + esp_ai_session_status + "\", \"tts_task_id\": \"" + esp_ai_tts_task_id + "\" }");
                 xSemaphoreGive(esp_ai_ws_mutex);
             }
 
-            esp_ai_tts_task_id = "";
-            // 内置状态处理
-            status_change("tts_real_end");
-
             if (onSessionStatusCb != nullptr)
             {
                 onSessionStatusCb("tts_real_end");
             }
-            DEBUG_PRINT(debug, F("[TTS] -> TTS 数据全部接收完毕，无需继续对话"));
-            esp_ai_start_ed = "0";
 
-            // 服务连接成功播放完毕
-            if (is_first_connect && onReadyCb != nullptr)
+            if (!esp_ai_is_listen_model)
             {
-                wait_mp3_player_done();
-                vTaskDelay(2000 / portTICK_PERIOD_MS);
-                onReadyCb();
+                // tts发送完毕，需要重新开启录音
+                DEBUG_PRINTLN(debug, F("[TTS] -> TTS 数据全部接收完毕，需继续对话。"));
+                asr_ing = false;
+                spk_ing = false;
+                wakeUp("continue");
             }
-            return;
         }
-        else if (esp_ai_session_status == SID_TTS_CHUNK_END)
+    }
+    else if (bin_frame.status == status_key(SID_TTS_END))
+    {
+        char sid[5] = {(char)bin_frame.head[0], (char)bin_frame.head[1], (char)bin_frame.head[2], (char)bin_frame.head[3], '\0'};
+        tts_stats_print(debug);
+
+        // 服务连接成功播放完毕
+        bool is_first_connect = esp_ai_played_connected == false && bin_frame.sid == sid_key(SID_CONNECTED_SERVER);
+        if (is_first_connect)
         {
-            esp_ai_tts_task_id = "";
+            esp_ai_played_connected = true;
+        }
+
+        wait_mp3_player_done();
+        if (xSemaphoreTake(esp_ai_ws_mutex, pdMS_TO_TICKS(100)) == pdTRUE)
+        {
+            esp_ai_webSocket.sendTXT("{ \"type\":\"client_out_audio_over\", \"session_id\": \"" + String(sid) + "\", \"session_status\": \"" + esp_ai_session_status + "\", \"tts_task_id\": \"" + esp_ai_tts_task_id + "\"}");
+            xSemaphoreGive(esp_ai_ws_mutex);
+        }
+
+        esp_ai_tts_task_id = "";
+        // 内置状态处理
+        status_change("tts_real_end");
+
+        if (onSessionStatusCb != nullptr)
+        {
+            onSessionStatusCb("tts_real_end");
+        }
+        DEBUG_PRINT(debug, F("[TTS] -> TTS 数据全部接收完毕，无需继续对话"));
+        esp_ai_start_ed = "0";
+
+        // 服务连接成功播放完毕
+        if (is_first_connect && onReadyCb != nullptr)
+        {
+            wait_mp3_player_done();
+            vTaskDelay(2000 / portTICK_PERIOD_MS);
+            onReadyCb();
         }
-        break;
     }
-    // case WStype_PING:
-    //     Serial.println("Ping");
-    //     break;
-    // case WStype_PONG:
-    //     Serial.println("Pong");
-    //     break;
-    case WStype_ERROR:
-        Serial.println("[Error] 服务 WebSocket 连接错误");
-        break;
+    else if (bin_frame.status == status_key(SID_TTS_CHUNK_END))
+    {
+        esp_ai_tts_task_id = "";
     }
+
+    return taken;
 }
@@ -0,0 +1,355 @@
+/*
+ * aec_test.cpp
+ *
+ * Created on: Oct 18,2026
+ *
+ *  Checks the echo canceller (src/aec/echo_canceller.h) and the reference alignment (src/aec/echo_reference.h):
+ *    - alignment: a speaker task writing into a DMA queue and a mic task reading blocks, both with scheduling jitter,
+ *      the reference must come out at a constant offset and resync only when playback restarts
+ *    - echo paths: the far-end speech goes through the alignment and an echo path (room impulse responses measured
+ *      on the device, or the built-in synthetic ones: small box, room with a long tail, misaligned by 20 ms, overdriven
+ *      speaker), plus mic noise; ERLE after convergence, no barge-in while only the device talks
+ *    - double talk: the near-end talker starts while the device talks; barge-in within the latency budget, the
+ *      near-end speech passes, the filter does not diverge (ERLE after the double talk)
+ *
+ *      aec_test speech.wav [ir.wav ...]          exit code 0 if everything passed; ir.wav: 16 bit mono impulse responses
+ *      aec_test --run mic.wav ref.wav out.wav    cancels a recording (ref already aligned), prints the statistics
+ *
+ */
+#include "aec/echo_canceller.h"
+#include "aec/echo_reference.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+static int s_failed = 0;
+#define CHECK(cond, ...) do{ if(!(cond)) {printf("    FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); s_failed++;} }while(0)
+
+#define RATE 16000
+
+//----------------------------------------------------------------------------------------------------------------------
+//  WAV files
+//----------------------------------------------------------------------------------------------------------------------
+// first channel of a 16 bit PCM WAV file, resampled to 16 kHz (linear) if needed
+static bool readWav(const char* path, std::vector<int16_t>& out) {
+    FILE* f = fopen(path, "rb");
+    if(!f) return false;
+    std::vector<uint8_t> d;
+    uint8_t buf[4096];
+    size_t n;
+    while((n = fread(buf, 1, sizeof(buf), f)) > 0) d.insert(d.end(), buf, buf + n);
+    fclose(f);
+    if(d.size() < 12 || memcmp(d.data(), "RIFF", 4) || memcmp(d.data() + 8, "WAVE", 4)) return false;
+    uint16_t channels = 0, bits = 0;
+    uint32_t rate = 0;
+    for(size_t p = 12; p + 8 <= d.size();) {
+        uint32_t len = d[p + 4] | d[p + 5] << 8 | d[p + 6] << 16 | (uint32_t)d[p + 7] << 24;
+        const uint8_t* c = d.data() + p + 8;
+        if(!memcmp(d.data() + p, "fmt ", 4) && len >= 16) {
+            channels = c[2] | c[3] << 8;
+            rate = c[4] | c[5] << 8 | c[6] << 16 | (uint32_t)c[7] << 24;
+            bits = c[14] | c[15] << 8;
+        }
+        else if(!memcmp(d.data() + p, "data", 4)) {
+            if(bits != 16 || !channels || !rate) return false;
+            if(len > d.size() - p - 8) len = d.size() - p - 8;
+            size_t frames = len / (2 * channels);
+            std::vector<int16_t> pcm(frames);
+            for(size_t i = 0; i < frames; i++) pcm[i] = (int16_t)(c[i * 2 * channels] | c[i * 2 * channels + 1] << 8);
+            if(rate == RATE) { out.swap(pcm); return true; }
+            size_t m = (size_t)((double)frames * RATE / rate);
+            out.resize(m);
+            for(size_t i = 0; i < m; i++) {
+                double t = (double)i * rate / RATE;
+                size_t k = (size_t)t;
+                double fr = t - k;
+                out[i] = (int16_t)lrint(pcm[k] * (1 - fr) + (k + 1 < frames ? pcm[k + 1] : 0) * fr);
+            }
+            return true;
+        }
+        p += 8 + len + (len & 1);
+    }
+    return false;
+}
+
+static bool writeWav(const char* path, const std::vector<int16_t>& pcm) {
+    FILE* f = fopen(path, "wb");
+    if(!f) return false;
+    uint32_t data = pcm.size() * 2, rate = RATE, byteRate = rate * 2;
+    uint32_t riff = 36 + data, fmtLen = 16;
+    uint16_t fmt = 1, ch = 1, align = 2, bits = 16;
+    fwrite("RIFF", 1, 4, f); fwrite(&riff, 4, 1, f); fwrite("WAVEfmt ", 1, 8, f); fwrite(&fmtLen, 4, 1, f);
+    fwrite(&fmt, 2, 1, f); fwrite(&ch, 2, 1, f); fwrite(&rate, 4, 1, f); fwrite(&byteRate, 4, 1, f);
+    fwrite(&align, 2, 1, f); fwrite(&bits, 2, 1, f); fwrite("data", 1, 4, f); fwrite(&data, 4, 1, f);
+    fwrite(pcm.data(), 2, pcm.size(), f);
+    fclose(f);
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  signals and echo paths
+//----------------------------------------------------------------------------------------------------------------------
+static std::mt19937 s_rng(42);
+
+static std::vector<int16_t> loop(const std::vector<int16_t>& v, size_t n, size_t offset = 0, bool reverse = false) {
+    std::vector<int16_t> out(n);
+    for(size_t i = 0; i < n; i++) {
+        size_t k = (i + offset) % v.size();
+        out[i] = v[reverse ? v.size() - 1 - k : k];
+    }
+    return out;
+}
+
+static double power(const std::vector<double>& v, size_t from, size_t to) {
+    double s = 0;
+    for(size_t i = from; i < to && i < v.size(); i++) s += v[i] * v[i];
+    return s / std::max<size_t>(1, std::min(to, v.size()) - from);
+}
+
+struct EchoPath {
+    std::string name;
+    std::vector<double> ir;
+    bool overdrive;
+    double minErle; // dB; the filter covers 64 ms, a longer tail or a non-linear speaker limits what it can cancel
+};
+
+// direct sound after `delay` ms, then reflections decaying with rt60 (seconds); tail cut at 250 ms
+static std::vector<double> syntheticIr(double delayMs, double gain, double rt60, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::normal_distribution<double> g(0.0, 1.0);
+    size_t d = (size_t)(delayMs * RATE / 1000), n = d + RATE / 4;
+    std::vector<double> ir(n, 0.0);
+    ir[d] = gain;
+    double decay = -6.9 / (rt60 * RATE); // 60 dB in rt60
+    for(size_t i = d + 16; i < n; i++) ir[i] += gain * 0.25 * g(rng) * exp(decay * (i - d));
+    return ir;
+}
+
+// mic = echo(far) + near + noise, all in double
+static std::vector<double> simulateMic(const std::vector<int16_t>& far, const std::vector<int16_t>& near, const EchoPath& path,
+                                       std::vector<double>* echoOnly) {
+    std::vector<double> x(far.size());
+    for(size_t i = 0; i < far.size(); i++) {
+        double v = far[i] / 32768.0;
+        x[i] = path.overdrive ? 32768.0 * tanh(2.0 * v) / tanh(2.0) : far[i];
+    }
+    std::vector<double> echo(far.size(), 0.0);
+    for(size_t i = 0; i < far.size(); i++) {
+        if(x[i] == 0) continue;
+        size_t m = std::min(path.ir.size(), far.size() - i);
+        for(size_t k = 0; k < m; k++) echo[i + k] += x[i] * path.ir[k];
+    }
+    std::normal_distribution<double> noise(0.0, 32768.0 * pow(10.0, -65 / 20.0));
+    std::vector<double> mic(far.size());
+    for(size_t i = 0; i < far.size(); i++) mic[i] = echo[i] + (i < near.size() ? near[i] : 0) + noise(s_rng);
+    if(echoOnly) echoOnly->swap(echo);
+    return mic;
+}
+
+static int16_t pcm16(double v) { return (int16_t)std::max(-32768.0, std::min(32767.0, v)); }
+
+//----------------------------------------------------------------------------------------------------------------------
+//  device timing: the speaker task writes 512 samples whenever the DMA queue (8 x 1024 frames) has room, the mic task
+//  reads 256 samples; both wake up late by 0..3 ms. Returns the reference EchoReference hands to each mic block.
+//----------------------------------------------------------------------------------------------------------------------
+#define DMA_DEPTH 8192
+#define SPK_CHUNK 512
+#define MIC_CHUNK 256
+
+// play[] holds what the speaker outputs at each sample (0 before start and in the gap), gapAt/gapLen pause playback
+static std::vector<int16_t> alignedReference(const std::vector<int16_t>& far, size_t gapAt, size_t gapLen, EchoReference& ref,
+                                             std::vector<int16_t>& played) {
+    std::uniform_int_distribution<int> jitter(0, 3000);
+    CHECK(ref.begin(RATE, DMA_DEPTH), "EchoReference::begin");
+    played.assign(far.size(), 0);
+    std::vector<int16_t> out(far.size(), 0);
+
+    // speaker events: write k (far samples [k*512, k*512+512)) returns at the time the DMA had room for it
+    struct Write { double t; size_t from, n; };
+    std::vector<Write> writes;
+    double dmaFree = 0;   // time the DMA plays its last queued sample
+    size_t pos = 0;
+    double startAt = 0.1; // playback starts at 100 ms
+    while(pos < far.size()) {
+        if(pos == gapAt) startAt = dmaFree + gapLen / (double)RATE;
+        size_t n = std::min((size_t)SPK_CHUNK, far.size() - pos);
+        // the write returns once the DMA has room for all n samples
+        double ready = std::max(startAt, dmaFree - (double)(DMA_DEPTH - n) / RATE) + jitter(s_rng) * 1e-6;
+        if(dmaFree < ready) dmaFree = ready; // queue ran dry, playback restarts when this chunk arrives
+        // the chunk plays from dmaFree on
+        size_t at = (size_t)lrint(dmaFree * RATE);
+        for(size_t i = 0; i < n && at + i < played.size(); i++) played[at + i] = far[pos + i];
+        writes.push_back({ready, pos, n});
+        dmaFree += (double)n / RATE;
+        pos += n;
+    }
+    // mic events: block [m, m+256) is complete at (m+256)/RATE, read returns a bit later
+    size_t w = 0;
+    for(size_t m = 0; m + MIC_CHUNK <= out.size(); m += MIC_CHUNK) {
+        double t = (m + MIC_CHUNK) / (double)RATE + jitter(s_rng) * 1e-6;
+        while(w < writes.size() && writes[w].t <= t) {
+            ref.write(far.data() + writes[w].from, writes[w].n, (uint32_t)lrint(writes[w].t * 1e6));
+            w++;
+        }
+        ref.read(out.data() + m, MIC_CHUNK, (uint32_t)lrint(t * 1e6));
+    }
+    return out;
+}
+
+// offset (samples) at which ref best matches played within ±64, and the share of blocks matching it exactly
+static int bestOffset(const std::vector<int16_t>& ref, const std::vector<int16_t>& played, size_t from, size_t to) {
+    int best = 0;
+    double bestCorr = -1;
+    for(int o = -64; o <= 64; o++) {
+        double c = 0, a = 0, b = 0;
+        for(size_t i = from; i < to; i++) {
+            long j = (long)i + o;
+            if(j < 0 || j >= (long)played.size()) continue;
+            c += (double)ref[i] * played[j];
+            a += (double)ref[i] * ref[i];
+            b += (double)played[j] * played[j];
+        }
+        double r = a > 0 && b > 0 ? c / sqrt(a * b) : 0;
+        if(r > bestCorr) { bestCorr = r; best = o; }
+    }
+    return best;
+}
+
+static void testAlignment(const std::vector<int16_t>& speech) {
+    std::vector<int16_t> far = loop(speech, RATE * 8);
+    EchoReference ref;
+    std::vector<int16_t> played;
+    std::vector<int16_t> r = alignedReference(far, RATE * 4, RATE / 2, ref, played);
+    int before = bestOffset(r, played, RATE, RATE * 3);
+    int after = bestOffset(r, played, RATE * 5, RATE * 7);
+    printf("  alignment             offset %d samples before, %d after a 0.5 s pause, %u resyncs (jitter 0..3 ms)\n", before, after, ref.resyncs);
+    // both tasks wake up 0..3 ms late, EchoReference hands out the reference 3 ms early: it may be early by up to
+    // 6 ms (the echo path gets longer, the filter covers it), never late (the echo path would not be causal)
+    CHECK(before >= 0 && before <= 2 * ECHO_REF_TOLERANCE && after >= 0 && after <= 2 * ECHO_REF_TOLERANCE, "offset %d / %d", before, after);
+    CHECK(ref.resyncs <= 2, "%u resyncs", ref.resyncs);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static uint32_t nowUs() {
+    static auto t0 = std::chrono::steady_clock::now();
+    return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - t0).count();
+}
+
+struct RunResult {
+    std::vector<double> out;       // aligned with the input (the canceller delay removed)
+    std::vector<size_t> bargeIns;  // sample positions
+    aec_stats_t stats;
+};
+
+static RunResult run(const std::vector<double>& mic, const std::vector<int16_t>& ref) {
+    EchoCanceller aec;
+    RunResult r;
+    if(!aec.begin(nowUs)) { CHECK(false, "begin"); return r; }
+    r.out.assign(mic.size(), 0.0);
+    int16_t m[AEC_BLOCK], o[AEC_BLOCK];
+    for(size_t p = 0; p + AEC_BLOCK <= mic.size(); p += AEC_BLOCK) {
+        for(int i = 0; i < AEC_BLOCK; i++) m[i] = pcm16(mic[p + i]);
+        aec.process(m, ref.data() + p, o);
+        // the output is one block late
+        if(p >= AEC_BLOCK) for(int i = 0; i < AEC_BLOCK; i++) r.out[p - AEC_BLOCK + i] = o[i];
+        if(aec.bargeIn()) { r.bargeIns.push_back(p + AEC_BLOCK); aec.clearBargeIn(); }
+    }
+    r.stats = aec.stats();
+    aec.end();
+    return r;
+}
+
+static void testEchoPath(const EchoPath& path, const std::vector<int16_t>& speech, const std::vector<int16_t>& nearSpeech) {
+    const size_t n = RATE * 14;
+    std::vector<int16_t> far = loop(speech, n);
+    EchoReference er;
+    std::vector<int16_t> played;
+    std::vector<int16_t> ref = alignedReference(far, n, 0, er, played);
+
+    // device only: the mic hears the played samples through the echo path
+    std::vector<double> echo;
+    std::vector<double> mic = simulateMic(played, {}, path, &echo);
+    RunResult a = run(mic, ref);
+    double pe = power(echo, RATE * 6, n - RATE), po = power(a.out, RATE * 6, n - RATE);
+    double erle = 10 * log10(pe / po);
+    double echoDb = 10 * log10(power(echo, RATE, n) / (32768.0 * 32768.0));
+
+    // double talk: the near-end talker (about as loud as the echo) speaks from 6 s to 9 s
+    std::vector<int16_t> near(n, 0);
+    double nearGain = sqrt(power(echo, RATE, n)) / std::max(1.0, sqrt(power(std::vector<double>(nearSpeech.begin(), nearSpeech.end()), 0, nearSpeech.size())));
+    for(size_t i = RATE * 6; i < RATE * 9; i++) near[i] = pcm16(nearSpeech[i - RATE * 6] * nearGain);
+    std::vector<double> micDt = simulateMic(played, near, path, nullptr);
+    RunResult b = run(micDt, ref);
+
+    // the near-end speech in the output: project the output on the near-end signal during the double talk
+    double c = 0, nn = 0;
+    for(size_t i = RATE * 6; i < RATE * 9; i++) { c += b.out[i] * near[i]; nn += (double)near[i] * near[i]; }
+    double nearKeptDb = 20 * log10(std::max(1e-6, c / nn));
+    double erleAfter = 10 * log10(power(echo, RATE * 11, n - RATE) / power(b.out, RATE * 11, n - RATE));
+    double bargeAt = -1;
+    for(size_t p : b.bargeIns) if(p >= RATE * 6) { bargeAt = (p - RATE * 6.0) / RATE; break; }
+    size_t falseBarge = 0;
+    for(size_t p : b.bargeIns) falseBarge += p < RATE * 6 || p > RATE * 9.5;
+
+    printf("  %-12s echo %5.1f dBFS  ERLE %5.1f dB  barge-in %s%.2f s  near-end %+5.1f dB  ERLE after double talk %5.1f dB  %.1f us/block\n",
+           path.name.c_str(), echoDb, erle, bargeAt < 0 ? "none " : "", bargeAt < 0 ? 0.0 : bargeAt, nearKeptDb, erleAfter,
+           (double)a.stats.process_us / std::max(1u, a.stats.blocks));
+    double minErle = path.minErle;
+    CHECK(erle > minErle, "%s: ERLE %.1f dB", path.name.c_str(), erle);
+    CHECK(a.bargeIns.empty(), "%s: %zu barge-ins while only the device talks", path.name.c_str(), a.bargeIns.size());
+    CHECK(bargeAt >= 0 && bargeAt <= 0.6, "%s: barge-in %.2f s after the near-end talker started", path.name.c_str(), bargeAt);
+    CHECK(falseBarge == 0, "%s: %zu barge-ins outside the double talk", path.name.c_str(), falseBarge);
+    CHECK(nearKeptDb > -6, "%s: near-end speech at %.1f dB", path.name.c_str(), nearKeptDb);
+    CHECK(erleAfter > minErle - 5, "%s: ERLE %.1f dB after the double talk", path.name.c_str(), erleAfter);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static int runFiles(const char* micPath, const char* refPath, const char* outPath) {
+    std::vector<int16_t> mic, ref;
+    if(!readWav(micPath, mic) || !readWav(refPath, ref)) { printf("cannot read the input files\n"); return 2; }
+    size_t n = std::min(mic.size(), ref.size());
+    RunResult r = run(std::vector<double>(mic.begin(), mic.begin() + n), ref);
+    std::vector<int16_t> out(n);
+    for(size_t i = 0; i < n; i++) out[i] = pcm16(r.out[i]);
+    writeWav(outPath, out);
+    printf("%u blocks, %u with far-end, %u double talk, ERLE %.1f dB, %zu barge-ins, %.1f us/block -> %s\n", r.stats.blocks,
+           r.stats.far_blocks, r.stats.double_talk, r.stats.erle_db, r.bargeIns.size(), (double)r.stats.process_us / std::max(1u, r.stats.blocks), outPath);
+    return 0;
+}
+//----------------------------------------------------------------------------------------------------------------------
+int main(int argc, char** argv) {
+    if(argc == 5 && !strcmp(argv[1], "--run")) return runFiles(argv[2], argv[3], argv[4]);
+    if(argc < 2) { printf("usage: aec_test speech.wav [ir.wav ...]\n"); return 2; }
+    printf("AEC\n");
+    std::vector<int16_t> speech;
+    if(!readWav(argv[1], speech)) { printf("cannot read %s\n", argv[1]); return 2; }
+    // the near-end talker: the same recording reversed, different words at the same level and spectrum
+    std::vector<int16_t> nearSpeech = loop(speech, RATE * 3, RATE, true);
+
+    testAlignment(speech);
+
+    std::vector<EchoPath> paths;
+    for(int i = 2; i < argc; i++) {
+        std::vector<int16_t> ir;
+        CHECK(readWav(argv[i], ir), "cannot read %s", argv[i]);
+        const char* name = strrchr(argv[i], '/') ? strrchr(argv[i], '/') + 1 : argv[i];
+        paths.push_back({name, std::vector<double>(ir.begin(), ir.end()), false, 15});
+        for(auto& v : paths.back().ir) v /= 32768.0;
+    }
+    if(paths.empty()) {
+        paths.push_back({"box", syntheticIr(1.0, 0.8, 0.05, 1), false, 20});
+        // reverberation past 64 ms is 15 dB down
+        paths.push_back({"room", syntheticIr(4.0, 0.3, 0.25, 2), false, 15});
+        paths.push_back({"late 20 ms", syntheticIr(21.0, 0.5, 0.08, 3), false, 20});
+        paths.push_back({"overdriven", syntheticIr(1.0, 0.8, 0.05, 4), true, 12});
+    }
+    for(auto& p : paths) testEchoPath(p, speech, nearSpeech);
+
+    printf("%s\n", s_failed ? "FAILED" : "all passed");
+    return s_failed ? 1 : 0;
+}
@@ -0,0 +1,123 @@
+/*
+ * asset_pack_test.cpp
+ *
+ * Created on: Oct 18,2026
+ *
+ *  Checks AssetPack (src/assets/asset_pack.h) against a pack built by src/audio/make_pack.py from
+ *  src/audio/zh/pack.txt: every prompt the firmware plays must come out of the pack byte for byte equal to the
+ *  array compiled into the app, lookups point into the pack (no copy), and damaged or truncated packs are refused.
+ *
+ *      asset_pack_test prompts_zh.bin      exit code 0 if everything passed
+ *
+ */
+#include "assets/asset_pack.h"
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "audio/zh/chao_ti_wei_qi_yong.h"
+#include "audio/zh/e_du_ka_bu_cun_zai.h"
+#include "audio/zh/fu_wu_lian_jie_zhong.h"
+#include "audio/zh/hui_fu_chu_chang.h"
+#include "audio/zh/jian_quan_shi_bai.h"
+#include "audio/zh/lian_jie_cheng_gong.h"
+#include "audio/zh/lian_jie_shi_bai.h"
+#include "audio/zh/lian_jie_zhong.h"
+#include "audio/zh/mei_dian_le.h"
+#include "audio/zh/pei_wang_cheng_gong.h"
+#include "audio/zh/pei_wang_xin_xi_yi_qing_chu.h"
+#include "audio/zh/qing_lian_jie_fu_wu.h"
+#include "audio/zh/qing_pei_wang.h"
+#include "audio/zh/san_ci.h"
+#include "audio/zh/yu_e_bu_zuo.h"
+
+static int s_failed = 0;
+#define CHECK(cond, ...) do{ if(!(cond)) {printf("    FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); s_failed++;} }while(0)
+
+struct prompt_t { const char* name; const unsigned char* data; unsigned int len; };
+#define PROMPT(n) { #n, n, n##_len }
+static const prompt_t s_prompts[] = {
+    PROMPT(chao_ti_wei_qi_yong), PROMPT(e_du_ka_bu_cun_zai), PROMPT(fu_wu_lian_jie_zhong), PROMPT(hui_fu_chu_chang),
+    PROMPT(jian_quan_shi_bai), PROMPT(lian_jie_cheng_gong), PROMPT(lian_jie_shi_bai), PROMPT(lian_jie_zhong),
+    PROMPT(mei_dian_le), PROMPT(pei_wang_cheng_gong), PROMPT(pei_wang_xin_xi_yi_qing_chu), PROMPT(qing_lian_jie_fu_wu),
+    PROMPT(qing_pei_wang), PROMPT(san_ci), PROMPT(yu_e_bu_zuo),
+};
+static const size_t s_count = sizeof(s_prompts) / sizeof(s_prompts[0]);
+
+//----------------------------------------------------------------------------------------------------------------------
+static void testContents(const std::vector<uint8_t>& pack) {
+    AssetPack ap;
+    CHECK(ap.open(pack.data(), pack.size()), "pack refused");
+    CHECK(ap.count() == s_count && strcmp(ap.lang(), "zh") == 0, "%u prompts, lang '%s'", ap.count(), ap.lang());
+    CHECK(ap.verify(), "data CRC");
+    size_t total = 0;
+    for(const prompt_t& p : s_prompts) {
+        const uint8_t* data = nullptr;
+        size_t len = 0;
+        asset_codec_t codec = ASSET_CODEC_OPUS;
+        bool found = ap.find(p.name, &data, &len, &codec);
+        CHECK(found, "%s missing", p.name);
+        if(!found) continue;
+        CHECK(len == p.len && memcmp(data, p.data, len) == 0, "%s differs from the array in the app", p.name);
+        CHECK(data >= pack.data() && data + len <= pack.data() + pack.size(), "%s not inside the pack", p.name);
+        CHECK(((data - pack.data()) & 3) == 0 && codec == ASSET_CODEC_MP3, "%s: alignment or codec", p.name);
+        total += len;
+    }
+    const uint8_t* d;
+    size_t l;
+    CHECK(!ap.find("san", &d, &l) && !ap.find("san_ci_", &d, &l) && !ap.find("", &d, &l) && !ap.find("zzz", &d, &l), "found a missing name");
+    for(uint16_t i = 1; i < ap.count(); i++) CHECK(strcmp(ap.name(i - 1), ap.name(i)) < 0, "index not sorted at %u", i);
+    CHECK(ap.name(ap.count()) == nullptr, "name() past the end");
+    printf("  contents              %u prompts, %zu bytes of MP3 in a %zu byte pack, equal to the app arrays\n", ap.count(), total, pack.size());
+}
+//----------------------------------------------------------------------------------------------------------------------
+static void testDamage(const std::vector<uint8_t>& pack) {
+    AssetPack ap;
+    std::vector<uint8_t> p = pack;
+    p[ASSET_PACK_HEAD_SIZE + 5] ^= 0x20;                                   // a name in the index
+    CHECK(!ap.open(p.data(), p.size()) && !ap.isOpen(), "damaged index accepted");
+
+    p = pack;
+    p[p.size() - 100] ^= 0x01;                                              // audio data: open is cheap, verify finds it
+    CHECK(ap.open(p.data(), p.size()) && !ap.verify(), "damaged data not detected");
+
+    CHECK(!ap.open(pack.data(), pack.size() - 4), "truncated pack accepted");
+    CHECK(!ap.open(pack.data(), 16), "short pack accepted");
+    p = pack;
+    p[4] = ASSET_PACK_VERSION + 1;
+    CHECK(!ap.open(p.data(), p.size()), "unknown version accepted");
+    p = pack;
+    memcpy(p.data(), "EAPX", 4);
+    CHECK(!ap.open(p.data(), p.size()), "bad magic accepted");
+    const uint8_t* d;
+    size_t l;
+    CHECK(!ap.find("san_ci", &d, &l), "find on a refused pack");
+    printf("  damage                index, data, size, version and magic checks ok\n");
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+int main(int argc, char** argv) {
+    printf("AssetPack\n");
+    if(argc < 2) {
+        printf("usage: asset_pack_test <pack>\n");
+        return 2;
+    }
+    FILE* f = fopen(argv[1], "rb");
+    if(!f) {
+        printf("cannot open %s\n", argv[1]);
+        return 2;
+    }
+    std::vector<uint8_t> pack;
+    uint8_t buf[4096];
+    size_t n;
+    while((n = fread(buf, 1, sizeof(buf), f)) > 0) pack.insert(pack.end(), buf, buf + n);
+    fclose(f);
+
+    uint8_t check[] = "123456789";
+    CHECK(AssetPack::crc32(0, check, 9) == 0xCBF43926, "crc32 differs from zlib");
+    testContents(pack);
+    testDamage(pack);
+
+    printf("%s\n", s_failed ? "FAILED" : "all passed");
+    return s_failed ? 1 : 0;
+}
@@ -0,0 +1,284 @@
+/*
+ * cache_test.cpp
+ *
+ * Created on: Oct 18,2026
+ *
+ *  Checks CachedAudio (src/cache/audio_cache.h, the tone / greetings cache the server offers by SHA-256) on a
+ *  temporary directory standing in for LittleFS:
+ *      offer / append / commit     miss, receive in frames, hash check, file written by the save task
+ *      preload                     a fresh object (next boot) reads the file back, the next offer hits in memory
+ *      corrupt files               wrong content or a name that does not match the hash are dropped at boot
+ *      pin                         commit, clear and legacy appends while a player holds the data leave it intact,
+ *                                  a reader task against a writer task replacing the data thousands of times
+ *      offer timing                commit does not wait for the file write
+ *
+ *      cache_test                  exit code 0 if everything passed
+ *
+ */
+#include "cache/audio_cache.h"
+#include <LittleFS.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+static int s_failed = 0;
+#define CHECK(cond, ...) do{ if(!(cond)) {printf("    FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); s_failed++;} }while(0)
+
+static std::string s_root;
+
+static std::string sha256Hex(const std::vector<uint8_t>& data) {
+    mbedtls_sha256_context ctx;
+    uint8_t d[32];
+    mbedtls_sha256_init(&ctx);
+    mbedtls_sha256_starts(&ctx, 0);
+    mbedtls_sha256_update(&ctx, data.data(), data.size());
+    mbedtls_sha256_finish(&ctx, d);
+    char hex[65];
+    for(int i = 0; i < 32; i++) sprintf(hex + 2 * i, "%02x", d[i]);
+    return hex;
+}
+
+static std::vector<uint8_t> makeAudio(size_t size, uint32_t seed) {
+    std::vector<uint8_t> v(size);
+    for(size_t i = 0; i < size; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        v[i] = seed >> 24;
+    }
+    return v;
+}
+
+static std::string cacheFile(const char* key, const std::string& hash) {
+    return s_root + CACHE_AUDIO_DIR "/" + key + "-" + hash.substr(0, 16) + ".mp3";
+}
+
+static bool fileExists(const std::string& p) {
+    FILE* f = fopen(p.c_str(), "rb");
+    if(f) fclose(f);
+    return f != nullptr;
+}
+
+static int countFiles(const char* key) {
+    int n = 0;
+    for(auto& e : std::filesystem::directory_iterator(s_root + CACHE_AUDIO_DIR))
+        if(e.path().filename().string().rfind(std::string(key) + "-", 0) == 0) n++;
+    return n;
+}
+
+// the save task writes in the background, wait until the file has its full size
+static bool waitFile(const std::string& p, size_t size) {
+    for(int i = 0; i < 2000; i++) {
+        struct stat st;
+        if(stat(p.c_str(), &st) == 0 && (size_t)st.st_size == size) return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+static bool same(CachedAudioBlob* b, const std::vector<uint8_t>& v) {
+    return b != nullptr && b->len == v.size() && memcmp(b->data, v.data(), v.size()) == 0;
+}
+
+// the server side of one cache_offer: offer, and on a miss the audio in 1024 byte frames
+static bool serve(CachedAudio& c, const std::vector<uint8_t>& audio) {
+    bool hit = c.offer(sha256Hex(audio).c_str(), audio.size());
+    if(!hit)
+        for(size_t off = 0; off < audio.size(); off += 1024) c.append(audio.data() + off, std::min<size_t>(1024, audio.size() - off));
+    return hit;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static void testSha() {
+    std::vector<uint8_t> abc = {'a', 'b', 'c'};
+    CHECK(sha256Hex(abc) == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", "sha256(abc)");
+}
+
+static void testOfferAndPreload() {
+    printf("offer, save and preload\n");
+    std::vector<uint8_t> tone = makeAudio(37 * 1024 + 123, 1);
+    std::string h = sha256Hex(tone);
+    {
+        CachedAudio c("tone");
+        CHECK(!c.preload(), "nothing stored yet");
+        CHECK(!serve(c, tone), "first offer is a miss");
+        CHECK(c.size() == tone.size(), "size %zu", c.size());
+        CachedAudioBlob* b = c.pin();
+        CHECK(same(b, tone), "committed data");
+        c.unpin(b);
+        CHECK(waitFile(cacheFile("tone", h), tone.size()), "file written");
+        CHECK(serve(c, tone), "second offer hits in memory");
+    }
+    {
+        // next boot
+        CachedAudio c("tone");
+        CHECK(c.preload(), "preload");
+        CachedAudioBlob* b = c.pin();
+        CHECK(same(b, tone), "preloaded data");
+        c.unpin(b);
+        CHECK(serve(c, tone), "offer after preload hits");
+
+        // a new version replaces the old file
+        std::vector<uint8_t> tone2 = makeAudio(20000, 2);
+        CHECK(!serve(c, tone2), "new version is a miss");
+        CHECK(waitFile(cacheFile("tone", sha256Hex(tone2)), tone2.size()), "new file written");
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        CHECK(countFiles("tone") == 1, "%d files for tone", countFiles("tone"));
+
+        // a bad hash keeps nothing
+        std::vector<uint8_t> bad = tone2;
+        CHECK(!c.offer(sha256Hex(tone).c_str(), bad.size()), "offer");
+        for(size_t off = 0; off < bad.size(); off += 1024) c.append(bad.data() + off, std::min<size_t>(1024, bad.size() - off));
+        b = c.pin();
+        CHECK(same(b, tone2), "failed hash check keeps the previous data");
+        c.unpin(b);
+
+        c.clear();
+        CHECK(c.empty(), "clear");
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        CHECK(countFiles("tone") == 0, "clear removes the file");
+    }
+    {
+        CachedAudio c("tone");
+        CHECK(!c.preload(), "nothing to preload after clear");
+    }
+}
+
+static void testCorruptFiles() {
+    printf("corrupt files\n");
+    std::vector<uint8_t> g = makeAudio(5000, 3);
+    std::string h = sha256Hex(g);
+    {
+        CachedAudio c("greetings");
+        serve(c, g);
+        CHECK(waitFile(cacheFile("greetings", h), g.size()), "file written");
+    }
+
+    // flipped byte: the content no longer matches the name
+    std::string p = cacheFile("greetings", h);
+    FILE* f = fopen(p.c_str(), "r+b");
+    fseek(f, 100, SEEK_SET);
+    fputc(g[100] ^ 1, f);
+    fclose(f);
+    {
+        CachedAudio c("greetings");
+        CHECK(!c.preload(), "corrupt content rejected");
+        CHECK(c.empty(), "nothing loaded");
+        CHECK(!fileExists(p), "corrupt file removed");
+    }
+
+    // truncated file, and a stray file with a name that is not a hash
+    f = fopen(p.c_str(), "wb");
+    fwrite(g.data(), 1, g.size() / 2, f);
+    fclose(f);
+    std::string stray = s_root + CACHE_AUDIO_DIR "/greetings-zz.mp3";
+    f = fopen(stray.c_str(), "wb");
+    fwrite(g.data(), 1, g.size(), f);
+    fclose(f);
+    {
+        CachedAudio c("greetings");
+        CHECK(!c.preload(), "truncated and stray files rejected");
+        CHECK(countFiles("greetings") == 0, "%d files left", countFiles("greetings"));
+        CHECK(!serve(c, g), "offer after a truncated file is a miss");
+        c.clear();
+    }
+}
+
+static void testPin() {
+    printf("pin\n");
+    CachedAudio c("tone");
+    std::vector<uint8_t> a = makeAudio(30000, 4), b = makeAudio(31000, 5);
+    serve(c, a);
+
+    // the player holds a, the server replaces it, then it is cleared
+    CachedAudioBlob* held = c.pin();
+    serve(c, b);
+    CHECK(same(held, a), "pinned data survives a commit");
+    CachedAudioBlob* nb = c.pin();
+    CHECK(same(nb, b), "new data is current");
+    c.unpin(nb);
+    c.clear();
+    CHECK(same(held, a), "pinned data survives clear");
+    CHECK(c.pin() == nullptr, "nothing current after clear");
+    c.unpin(held);
+
+    // an old server appends while the player holds the data: copy on write
+    std::vector<uint8_t> part = makeAudio(3000, 6);
+    c.append(part.data(), part.size());
+    held = c.pin();
+    std::vector<uint8_t> more = makeAudio(40000, 7);
+    c.append(more.data(), more.size());
+    CHECK(same(held, part), "pinned legacy data unchanged by append");
+    std::vector<uint8_t> all = part;
+    all.insert(all.end(), more.begin(), more.end());
+    nb = c.pin();
+    CHECK(same(nb, all), "appended data is current");
+    c.unpin(nb);
+    c.unpin(held);
+    c.disconnected();
+    CHECK(c.empty(), "legacy data dropped on disconnect");
+
+    // a player task against the WS task replacing the data
+    std::vector<std::vector<uint8_t>> versions;
+    for(int i = 0; i < 8; i++) versions.push_back(makeAudio(8000 + 1000 * i, 10 + i));
+    std::atomic<bool> stop(false);
+    std::atomic<int> plays(0), bad(0);
+    std::thread player([&]() {
+        while(!stop) {
+            CachedAudioBlob* p = c.pin();
+            if(p == nullptr) continue;
+            // the content must stay one of the versions while pinned
+            size_t v = (p->len - 8000) / 1000;
+            bool ok = v < versions.size() && p->len == versions[v].size();
+            for(int pass = 0; ok && pass < 3; pass++) ok = memcmp(p->data, versions[v].data(), p->len) == 0;
+            if(!ok) bad++;
+            plays++;
+            c.unpin(p);
+        }
+    });
+    for(int i = 0; i < 3000; i++) {
+        if(i % 97 == 0) c.clear();
+        else            serve(c, versions[i % versions.size()]);
+    }
+    stop = true;
+    player.join();
+    printf("    %d plays during 3000 replacements\n", plays.load());
+    CHECK(bad == 0, "%d plays saw changing data", bad.load());
+    CHECK(plays > 0, "no plays");
+    c.clear();
+}
+
+static void testCommitTiming() {
+    printf("commit timing\n");
+    CachedAudio c("greetings");
+    std::vector<uint8_t> big = makeAudio(CACHE_AUDIO_MAX_SIZE, 20);
+    auto t0 = std::chrono::steady_clock::now();
+    serve(c, big);
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    printf("    512 KB offer + frames + commit: %.2f ms\n", ms);
+    CHECK(waitFile(cacheFile("greetings", sha256Hex(big)), big.size()), "file written");
+    CHECK(!c.offer(sha256Hex(big).c_str(), CACHE_AUDIO_MAX_SIZE + 1), "oversize offer refused");
+    c.clear();
+}
+
+int main() {
+    char tmpl[] = "/tmp/esp_ai_cache_XXXXXX";
+    if(!mkdtemp(tmpl)) { printf("mkdtemp failed\n"); return 1; }
+    s_root = tmpl;
+    LittleFS.setRoot(s_root);
+    CHECK(CachedAudio::mount(), "mount");
+
+    testSha();
+    testOfferAndPreload();
+    testCorruptFiles();
+    testPin();
+    testCommitTiming();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    std::filesystem::remove_all(s_root);
+    printf("%s\n", s_failed ? "FAILED" : "all passed");
+    return s_failed ? 1 : 0;
+}
@@ -0,0 +1,429 @@
+/*
+ * kws_test.cpp
+ *
+ * Created on: Oct 18,2026
+ *
+ *  Checks the wake word pipeline (src/kws/kws_mfcc.h, src/kws/kws_engine.h) with WAV files:
+ *    - the fixed-point MFCC front-end against a double precision reference of the same definition, on speech
+ *      (the WAV files given on the command line) and on tones and noise from -60 to 0 dBFS
+ *    - incremental computation: any chunking of the input gives bit-identical features, the 1 s window equals the
+ *      last 49 frames computed one by one
+ *    - the engine with a template matching model whose keyword is a chirp: chirps.wav (noise with chirps at known
+ *      times and levels) must give one detection per chirp within the latency budget, noise.wav and the speech
+ *      files none
+ *  Prints the front-end and model time per frame.
+ *
+ *      kws_test [speech.wav ...]                 exit code 0 if everything passed
+ *      kws_test --dump features.csv input.wav    writes the features of a 16 kHz WAV file (one frame per line)
+ *
+ */
+#include "kws/kws_mfcc.h"
+#include "kws/kws_engine.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+static int s_failed = 0;
+#define CHECK(cond, ...) do{ if(!(cond)) {printf("    FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); s_failed++;} }while(0)
+
+//----------------------------------------------------------------------------------------------------------------------
+//  WAV files
+//----------------------------------------------------------------------------------------------------------------------
+// first channel of a 16 bit PCM WAV file, resampled to 16 kHz (linear) if needed
+static bool readWav(const char* path, std::vector<int16_t>& out) {
+    FILE* f = fopen(path, "rb");
+    if(!f) return false;
+    std::vector<uint8_t> d;
+    uint8_t buf[4096];
+    size_t n;
+    while((n = fread(buf, 1, sizeof(buf), f)) > 0) d.insert(d.end(), buf, buf + n);
+    fclose(f);
+    if(d.size() < 12 || memcmp(d.data(), "RIFF", 4) || memcmp(d.data() + 8, "WAVE", 4)) return false;
+    uint16_t channels = 0, bits = 0;
+    uint32_t rate = 0;
+    for(size_t p = 12; p + 8 <= d.size();) {
+        uint32_t len = d[p + 4] | d[p + 5] << 8 | d[p + 6] << 16 | (uint32_t)d[p + 7] << 24;
+        const uint8_t* c = d.data() + p + 8;
+        if(!memcmp(d.data() + p, "fmt ", 4) && len >= 16) {
+            channels = c[2] | c[3] << 8;
+            rate = c[4] | c[5] << 8 | c[6] << 16 | (uint32_t)c[7] << 24;
+            bits = c[14] | c[15] << 8;
+        }
+        else if(!memcmp(d.data() + p, "data", 4)) {
+            if(bits != 16 || !channels || !rate) return false;
+            if(len > d.size() - p - 8) len = d.size() - p - 8;
+            size_t frames = len / (2 * channels);
+            std::vector<int16_t> pcm(frames);
+            for(size_t i = 0; i < frames; i++) pcm[i] = (int16_t)(c[i * 2 * channels] | c[i * 2 * channels + 1] << 8);
+            if(rate == KWS_SAMPLE_RATE) { out.swap(pcm); return true; }
+            size_t m = (size_t)((double)frames * KWS_SAMPLE_RATE / rate);
+            out.resize(m);
+            for(size_t i = 0; i < m; i++) {
+                double t = (double)i * rate / KWS_SAMPLE_RATE;
+                size_t k = (size_t)t;
+                double fr = t - k;
+                out[i] = (int16_t)lrint(pcm[k] * (1 - fr) + (k + 1 < frames ? pcm[k + 1] : 0) * fr);
+            }
+            return true;
+        }
+        p += 8 + len + (len & 1);
+    }
+    return false;
+}
+
+static bool writeWav(const std::string& path, const std::vector<int16_t>& pcm) {
+    FILE* f = fopen(path.c_str(), "wb");
+    if(!f) return false;
+    uint32_t data = pcm.size() * 2, rate = KWS_SAMPLE_RATE, byteRate = rate * 2;
+    uint32_t riff = 36 + data, fmtLen = 16;
+    uint16_t fmt = 1, ch = 1, align = 2, bits = 16;
+    fwrite("RIFF", 1, 4, f); fwrite(&riff, 4, 1, f); fwrite("WAVEfmt ", 1, 8, f); fwrite(&fmtLen, 4, 1, f);
+    fwrite(&fmt, 2, 1, f); fwrite(&ch, 2, 1, f); fwrite(&rate, 4, 1, f); fwrite(&byteRate, 4, 1, f);
+    fwrite(&align, 2, 1, f); fwrite(&bits, 2, 1, f); fwrite("data", 1, 4, f); fwrite(&data, 4, 1, f);
+    fwrite(pcm.data(), 2, pcm.size(), f);
+    fclose(f);
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  signals
+//----------------------------------------------------------------------------------------------------------------------
+static std::mt19937 s_rng(1234);
+
+static void addNoise(std::vector<int16_t>& v, double dBFS) {
+    std::normal_distribution<double> g(0.0, 32767.0 * pow(10.0, dBFS / 20.0));
+    for(auto& s : v) s = (int16_t)std::max(-32768.0, std::min(32767.0, s + g(s_rng)));
+}
+
+static void addTone(std::vector<int16_t>& v, double hz, double dBFS) {
+    double a = 32767.0 * pow(10.0, dBFS / 20.0);
+    for(size_t i = 0; i < v.size(); i++) v[i] = (int16_t)std::max(-32768.0, std::min(32767.0, v[i] + a * sin(2 * M_PI * hz * i / KWS_SAMPLE_RATE)));
+}
+
+// the keyword of the template model: 0.5 s, 400 -> 2500 Hz, with 20 ms fades
+static std::vector<int16_t> chirp(double dBFS) {
+    const size_t n = KWS_SAMPLE_RATE / 2;
+    std::vector<int16_t> v(n);
+    double a = 32767.0 * pow(10.0, dBFS / 20.0), phase = 0;
+    for(size_t i = 0; i < n; i++) {
+        double hz = 400 + 2100.0 * i / n;
+        phase += 2 * M_PI * hz / KWS_SAMPLE_RATE;
+        double fade = std::min(1.0, std::min(i, n - i) / 320.0);
+        v[i] = (int16_t)lrint(a * fade * sin(phase));
+    }
+    return v;
+}
+
+static void mix(std::vector<int16_t>& v, const std::vector<int16_t>& s, double at) {
+    size_t p = (size_t)(at * KWS_SAMPLE_RATE);
+    for(size_t i = 0; i < s.size() && p + i < v.size(); i++) v[p + i] = (int16_t)std::max(-32768, std::min(32767, v[p + i] + s[i]));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  double precision reference of the front-end
+//----------------------------------------------------------------------------------------------------------------------
+static double melOf(double f) { return 2595.0 * log10(1.0 + f / 700.0); }
+
+static void referenceFrame(const int16_t* frame, double* logMel, double* mfcc) {
+    static std::vector<std::vector<double>> fb; // [band][bin]
+    const int bins = KWS_FFT_LEN / 2 + 1;
+    if(fb.empty()) {
+        fb.assign(KWS_MEL_BANDS, std::vector<double>(bins, 0.0));
+        double lo = melOf(KWS_MEL_LOW_HZ), hi = melOf(KWS_MEL_HIGH_HZ);
+        std::vector<double> e(KWS_MEL_BANDS + 2);
+        for(int i = 0; i < KWS_MEL_BANDS + 2; i++) e[i] = lo + (hi - lo) * i / (KWS_MEL_BANDS + 1);
+        for(int k = 0; k < bins; k++) {
+            double m = melOf((double)k * KWS_SAMPLE_RATE / KWS_FFT_LEN);
+            for(int b = 0; b < KWS_MEL_BANDS; b++) {
+                if(m >= e[b] && m < e[b + 1]) fb[b][k] = (m - e[b]) / (e[b + 1] - e[b]);
+                else if(m >= e[b + 1] && m < e[b + 2]) fb[b][k] = 1.0 - (m - e[b + 1]) / (e[b + 2] - e[b + 1]);
+            }
+        }
+    }
+    std::vector<double> x(KWS_FRAME_LEN), p(bins);
+    for(int i = 0; i < KWS_FRAME_LEN; i++) x[i] = frame[i] * (0.5 - 0.5 * cos(2 * M_PI * i / KWS_FRAME_LEN));
+    for(int k = 0; k < bins; k++) {
+        double re = 0, im = 0;
+        for(int i = 0; i < KWS_FRAME_LEN; i++) {
+            double w = 2 * M_PI * k * i / KWS_FFT_LEN;
+            re += x[i] * cos(w);
+            im -= x[i] * sin(w);
+        }
+        p[k] = re * re + im * im;
+    }
+    for(int b = 0; b < KWS_MEL_BANDS; b++) {
+        double s = 0;
+        for(int k = 0; k < bins; k++) s += fb[b][k] * p[k];
+        logMel[b] = s > 0 ? std::max((double)KWS_LOG_FLOOR, log2(s)) : KWS_LOG_FLOOR;
+    }
+    for(int k = 0; k < KWS_MFCC_COEFFS; k++) {
+        double s = 0, norm = sqrt((k ? 2.0 : 1.0) / KWS_MEL_BANDS);
+        for(int b = 0; b < KWS_MEL_BANDS; b++) s += logMel[b] * norm * cos(M_PI * k * (b + 0.5) / KWS_MEL_BANDS);
+        mfcc[k] = s;
+    }
+}
+
+// pre-emphasis as in KwsMfcc::write(), frames as the front-end cuts them
+static std::vector<std::vector<int16_t>> frames(const std::vector<int16_t>& pcm) {
+    std::vector<int16_t> y(pcm.size());
+    int32_t prev = 0;
+    for(size_t i = 0; i < pcm.size(); i++) {
+        int32_t v = pcm[i] - ((prev * 31785 + (1 << 14)) >> 15);
+        y[i] = (int16_t)std::max(-32768, std::min(32767, v));
+        prev = pcm[i];
+    }
+    std::vector<std::vector<int16_t>> out;
+    for(size_t p = 0; p + KWS_FRAME_LEN <= y.size(); p += KWS_HOP) out.emplace_back(y.begin() + p, y.begin() + p + KWS_FRAME_LEN);
+    return out;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static void testAccuracy(const char* name, const std::vector<int16_t>& pcm) {
+    auto fr = frames(pcm);
+    double worstMel = 0, sumSq = 0, worstFrame = 0;
+    size_t n = 0, melCount = 0;
+    for(auto& f : fr) {
+        int16_t q[KWS_MFCC_COEFFS];
+        int32_t lm[KWS_MEL_BANDS];
+        double rl[KWS_MEL_BANDS], rm[KWS_MFCC_COEFFS];
+        KwsMfcc::compute(f.data(), q, lm);
+        referenceFrame(f.data(), rl, rm);
+        // log mel: bands within 50 dB (16.6 log2 units) of the loudest band of the frame
+        double top = *std::max_element(rl, rl + KWS_MEL_BANDS);
+        for(int b = 0; b < KWS_MEL_BANDS; b++) {
+            if(rl[b] < top - 16.6 || rl[b] <= KWS_LOG_FLOOR + 1) continue;
+            worstMel = std::max(worstMel, fabs(lm[b] / 65536.0 - rl[b]));
+            melCount++;
+        }
+        double fs = 0;
+        for(int k = 0; k < KWS_MFCC_COEFFS; k++) {
+            double e = q[k] / (double)(1 << KWS_MFCC_FRAC_BITS) - rm[k];
+            fs += e * e;
+        }
+        sumSq += fs;
+        worstFrame = std::max(worstFrame, sqrt(fs / KWS_MFCC_COEFFS));
+        n++;
+    }
+    double rms = sqrt(sumSq / (n * KWS_MFCC_COEFFS));
+    printf("  accuracy %-18s %4zu frames: mfcc rms error %.4f, worst frame %.4f, log mel worst %.4f (log2 units, 1 = 3 dB)\n",
+           name, n, rms, worstFrame, worstMel);
+    CHECK(n > 0, "no frames");
+    CHECK(rms < 0.05, "%s: mfcc rms error %.4f", name, rms);
+    CHECK(worstFrame < 0.1, "%s: worst frame %.4f", name, worstFrame);
+    CHECK(melCount == 0 || worstMel < 0.1, "%s: log mel error %.4f", name, worstMel);
+}
+//----------------------------------------------------------------------------------------------------------------------
+static void testIncremental(const std::vector<int16_t>& pcm) {
+    auto fr = frames(pcm);
+    KwsMfcc ref;
+    ref.write(pcm.data(), pcm.size());
+    CHECK(ref.frames() == fr.size(), "%u frames, expected %zu", ref.frames(), fr.size());
+
+    // the window is the last KWS_WINDOW_FRAMES frames, each computed on its own
+    std::vector<int16_t> win(KWS_WINDOW_FRAMES * KWS_MFCC_COEFFS);
+    ref.window(win.data());
+    bool same = true;
+    for(int i = 0; i < KWS_WINDOW_FRAMES; i++) {
+        int16_t q[KWS_MFCC_COEFFS];
+        KwsMfcc::compute(fr[fr.size() - KWS_WINDOW_FRAMES + i].data(), q);
+        same &= !memcmp(q, &win[i * KWS_MFCC_COEFFS], sizeof(q));
+    }
+    CHECK(same, "window differs from the frames computed one by one");
+
+    // any chunking gives the same result
+    const size_t chunks[] = {1, 7, KWS_HOP, 1000, 4096};
+    for(size_t c : chunks) {
+        KwsMfcc m;
+        for(size_t p = 0; p < pcm.size(); p += c) m.write(pcm.data() + p, std::min(c, pcm.size() - p));
+        std::vector<int16_t> w(win.size());
+        m.window(w.data());
+        CHECK(m.frames() == ref.frames() && w == win, "chunks of %zu differ", c);
+    }
+
+    // before the window is full it is padded with silence
+    KwsMfcc early;
+    early.write(pcm.data(), KWS_FRAME_LEN + 9 * KWS_HOP);
+    std::vector<int16_t> w(win.size());
+    early.window(w.data());
+    int16_t q[KWS_MFCC_COEFFS];
+    KwsMfcc::compute(fr[9].data(), q);
+    CHECK(early.frames() == 10 && !memcmp(&w[(KWS_WINDOW_FRAMES - 1) * KWS_MFCC_COEFFS], q, sizeof(q)), "newest frame of a partial window");
+    CHECK(w[0] == 0 && w[(KWS_WINDOW_FRAMES - 11) * KWS_MFCC_COEFFS] == 0, "padding is not silence");
+    printf("  incremental           %u frames, chunks of 1..4096 samples bit-identical, window == last %d frames\n",
+           ref.frames(), KWS_WINDOW_FRAMES);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  template matching model: keyword "chirp"
+//----------------------------------------------------------------------------------------------------------------------
+class ChirpModel : public KwsModel {
+public:
+    bool begin() override {
+        KwsMfcc m;
+        std::vector<int16_t> c = chirp(-12);
+        m.write(c.data(), c.size());
+        int16_t w[KWS_WINDOW_FRAMES * KWS_MFCC_COEFFS];
+        m.window(w);
+        m_len = m.frames();
+        m_tpl.assign(w + (KWS_WINDOW_FRAMES - m_len) * KWS_MFCC_COEFFS, w + KWS_WINDOW_FRAMES * KWS_MFCC_COEFFS);
+        normalize(m_tpl);
+        return m_len > 0 && m_len < KWS_WINDOW_FRAMES;
+    }
+    int labels() override { return 3; }
+    const char* label(int i) override { static const char* n[] = {"_silence_", "_unknown_", "chirp"}; return n[i]; }
+    float inputScale() override { return 0.25f; }
+    int inputZeroPoint() override { return -10; }
+    bool invoke(const int8_t* f, uint8_t* scores) override {
+        double best = 0;
+        for(int o = 0; o + m_len <= KWS_WINDOW_FRAMES; o++) {
+            std::vector<double> seg(m_len * KWS_MFCC_COEFFS);
+            for(size_t i = 0; i < seg.size(); i++) seg[i] = (f[o * KWS_MFCC_COEFFS + i] - inputZeroPoint()) * inputScale();
+            normalize(seg);
+            double dot = 0;
+            for(size_t i = 0; i < seg.size(); i++) dot += seg[i] * m_tpl[i];
+            best = std::max(best, dot);
+        }
+        scores[2] = (uint8_t)lrint(255 * best);
+        scores[0] = 255 - scores[2];
+        scores[1] = 0;
+        return true;
+    }
+    uint32_t m_len = 0;
+
+private:
+    // c0 (level) dropped, every coefficient track mean-removed, unit length
+    template<typename T> void normalize(std::vector<T>& v) {
+        size_t fr = v.size() / KWS_MFCC_COEFFS;
+        for(int k = 0; k < KWS_MFCC_COEFFS; k++) {
+            double mean = 0;
+            for(size_t i = 0; i < fr; i++) mean += v[i * KWS_MFCC_COEFFS + k];
+            mean /= fr;
+            for(size_t i = 0; i < fr; i++) v[i * KWS_MFCC_COEFFS + k] = k ? v[i * KWS_MFCC_COEFFS + k] - mean : 0;
+        }
+        double n = 0;
+        for(auto x : v) n += (double)x * x;
+        n = sqrt(n);
+        for(auto& x : v) x = n > 0 ? x / n : 0;
+    }
+    std::vector<double> m_tpl;
+};
+
+static uint32_t nowUs() {
+    static auto t0 = std::chrono::steady_clock::now();
+    return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - t0).count();
+}
+
+// detections as audio time in seconds (end of the frame that triggered), fed in 80 ms buffers like WakeWord
+static std::vector<double> detect(KwsEngine& e, const std::vector<int16_t>& pcm) {
+    std::vector<double> t;
+    e.reset();
+    const size_t buf = KWS_HOP * 4;
+    for(size_t p = 0; p < pcm.size(); p += buf) {
+        size_t n = std::min(buf, pcm.size() - p);
+        // one buffer may hold the end of several frames, find the one that triggered by feeding frame by frame
+        for(size_t q = 0; q < n;) {
+            size_t k = std::min(n - q, e.frontend().until_frame());
+            if(e.process(pcm.data() + p + q, k) >= 0) t.push_back((p + q + k) / (double)KWS_SAMPLE_RATE);
+            q += k;
+        }
+    }
+    return t;
+}
+
+static void testEngine(const std::string& dir, const std::vector<std::vector<int16_t>>& speech) {
+    ChirpModel model;
+    KwsEngine engine;
+    CHECK(engine.begin(&model, 0.85f, nowUs), "engine refused the model");
+
+    // chirps.wav: noise at -50 dBFS, a hum, chirps at several levels; the one at 8.3 s falls into the refractory time of the one before
+    std::vector<int16_t> pcm(KWS_SAMPLE_RATE * 12);
+    addNoise(pcm, -50);
+    addTone(pcm, 150, -40);
+    const double at[] = {2.0, 4.5, 7.5, 8.3};
+    const double level[] = {-12, -30, -6, -12};
+    for(int i = 0; i < 4; i++) mix(pcm, chirp(level[i]), at[i]);
+    std::vector<int16_t> noise(KWS_SAMPLE_RATE * 10);
+    addNoise(noise, -20);
+    CHECK(writeWav(dir + "/chirps.wav", pcm) && writeWav(dir + "/noise.wav", noise), "cannot write WAV files to %s", dir.c_str());
+
+    std::vector<int16_t> in;
+    CHECK(readWav((dir + "/chirps.wav").c_str(), in) && in == pcm, "chirps.wav round trip");
+    engine.clearStats();
+    std::vector<double> t = detect(engine, in);
+    printf("  engine chirps.wav     %zu detections:", t.size());
+    for(double x : t) printf(" %.2f s", x);
+    printf("\n");
+    CHECK(t.size() == 3, "%zu detections, expected 3 (the 4th chirp is inside the refractory time)", t.size());
+    for(size_t i = 0; i < t.size() && i < 3; i++) {
+        double lat = t[i] - (at[i] + 0.5);
+        CHECK(lat >= -0.3 && lat <= 0.4, "chirp %zu: detected %.2f s after its end", i, lat);
+    }
+    const kws_stats_t& st = engine.stats();
+    printf("  budget (host)         front-end %.1f us per 20 ms frame (max %u), model %.1f us per invoke, %u invokes\n",
+           (double)st.frontend_us / st.frames, st.frontend_us_max, (double)st.invoke_us / std::max(1u, st.invokes), st.invokes);
+    CHECK(st.invokes == st.frames / KWS_INVOKE_STRIDE - (KWS_WINDOW_FRAMES - 1) / KWS_INVOKE_STRIDE, "%u invokes for %u frames", st.invokes, st.frames);
+
+    CHECK(readWav((dir + "/noise.wav").c_str(), in), "noise.wav");
+    t = detect(engine, in);
+    CHECK(t.empty(), "%zu detections in noise.wav", t.size());
+    size_t falseSpeech = 0;
+    for(auto& s : speech) falseSpeech += detect(engine, s).size();
+    CHECK(falseSpeech == 0, "%zu detections in speech", falseSpeech);
+    printf("  engine negatives      noise.wav and %zu speech files: %zu detections\n", speech.size(), t.size() + falseSpeech);
+}
+//----------------------------------------------------------------------------------------------------------------------
+static int dump(const char* csv, const char* wav) {
+    std::vector<int16_t> pcm;
+    if(!readWav(wav, pcm)) { printf("cannot read %s\n", wav); return 2; }
+    FILE* f = fopen(csv, "w");
+    if(!f) { printf("cannot write %s\n", csv); return 2; }
+    KwsMfcc m;
+    for(size_t p = 0; p < pcm.size(); p += KWS_HOP) {
+        if(m.write(pcm.data() + p, std::min((size_t)KWS_HOP, pcm.size() - p)) == 0) continue;
+        const int16_t* c = m.last();
+        for(int k = 0; k < KWS_MFCC_COEFFS; k++) fprintf(f, k ? ",%.4f" : "%.4f", c[k] / (double)(1 << KWS_MFCC_FRAC_BITS));
+        fprintf(f, "\n");
+    }
+    fclose(f);
+    printf("%u frames -> %s\n", m.frames(), csv);
+    return 0;
+}
+//----------------------------------------------------------------------------------------------------------------------
+int main(int argc, char** argv) {
+    if(argc == 4 && !strcmp(argv[1], "--dump")) return dump(argv[2], argv[3]);
+    printf("KWS front-end / engine\n");
+
+    std::vector<std::vector<int16_t>> speech;
+    for(int i = 1; i < argc; i++) {
+        std::vector<int16_t> pcm;
+        CHECK(readWav(argv[i], pcm), "cannot read %s", argv[i]);
+        if(!pcm.empty()) speech.push_back(pcm);
+    }
+    for(size_t i = 0; i < speech.size(); i++) {
+        const char* name = strrchr(argv[i + 1], '/') ? strrchr(argv[i + 1], '/') + 1 : argv[i + 1];
+        testAccuracy(name, speech[i]);
+    }
+    for(double db : {0.0, -20.0, -40.0, -60.0}) {
+        std::vector<int16_t> v(KWS_SAMPLE_RATE);
+        addTone(v, 440, db - 1);
+        addTone(v, 1870, db - 10);
+        addNoise(v, db - 40);
+        char name[32];
+        snprintf(name, sizeof(name), "tones %.0f dBFS", db);
+        testAccuracy(name, v);
+    }
+    std::vector<int16_t> v(KWS_SAMPLE_RATE * 2);
+    addNoise(v, -30);
+    testAccuracy("noise -30 dBFS", v);
+
+    testIncremental(speech.empty() ? v : speech[0]);
+    testEngine(".", speech);
+
+    printf("%s\n", s_failed ? "FAILED" : "all passed");
+    return s_failed ? 1 : 0;
+}
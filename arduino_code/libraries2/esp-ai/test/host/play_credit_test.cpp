@@ -0,0 +1,361 @@
+/*
+ * play_credit_test.cpp
+ *
+ * Created on: Oct 18,2026
+ *
+ *  Checks PlayCredit (src/flow/play_credit.h, used by ESP_AI::play_audio()) and compares it with the old
+ *  1 Hz client_available_audio report.
+ *
+ *  A server stand-in speaks the server side of both protocols: it generates TTS audio faster than real time and
+ *  sends 6 byte header + 1024 byte frames, either within the credit it got from the device or within
+ *  "window - value" of the last JSON report. Device and server exchange the real message bytes over a simulated
+ *  TCP link (in order, latency + jitter). The device side models esp_ai_audio_buffer (20 KB, refuses what does not
+ *  fit, as mp3_player_try_write() does), the play task (1024 byte reads, blocks on the empty buffer until data
+ *  arrives or 100 ms passed) and the decoder draining at the bitrate. Time is simulated in 1 ms steps, so the runs
+ *  are deterministic and ten minutes take a few milliseconds.
+ *
+ *  Measured per run:
+ *      underruns       the decoder ran dry in the middle of an utterance
+ *      refusals        frames the device could not take completely (head of line blocking on the socket)
+ *      msgs/min        flow control messages from the device
+ *
+ *      play_credit_test            exit code 0 if everything passed
+ *
+ */
+#include "flow/play_credit.h"
+#include <stdio.h>
+#include <string.h>
+#include <deque>
+#include <string>
+#include <vector>
+
+static int s_failed = 0;
+#define CHECK(cond, ...) do{ if(!(cond)) {printf("    FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); s_failed++;} }while(0)
+
+#define WINDOW      (1024 * 20)     // AUDIO_BUFFER_SIZE
+#define FRAME_AUDIO 1024
+#define FRAME_HEAD  6               // session id + session status
+#define READ_SIZE   1024            // StreamCopy buffer
+#define WAIT_MS     100             // PLAY_AUDIO_WAIT_MS
+#define REPORT_MS   1000            // client_available_audio period
+
+enum mode_t_ { MODE_LEGACY, MODE_CREDIT };
+
+//----------------------------------------------------------------------------------------------------------------------
+//  link: TCP delivers in order, every message is delayed by latency + [0, jitter]
+//----------------------------------------------------------------------------------------------------------------------
+class Link {
+  public:
+    struct msg_t {
+        uint32_t             at;
+        bool                 text;
+        std::vector<uint8_t> data;
+        size_t               taken;     // bytes the receiver already took
+        bool                 refused;   // did not fit into the buffer at once
+    };
+
+    Link(uint32_t latency, uint32_t jitter, uint32_t seed) : m_latency(latency), m_jitter(jitter), m_rnd(seed | 1) {}
+
+    void push(uint32_t now, bool text, const uint8_t* data, size_t len) {
+        uint32_t at = now + m_latency + (m_jitter ? rnd() % (m_jitter + 1) : 0);
+        if(at < m_last) at = m_last;
+        m_last = at;
+        m_q.push_back({at, text, std::vector<uint8_t>(data, data + len), 0, false});
+    }
+    msg_t* front(uint32_t now) { return (!m_q.empty() && m_q.front().at <= now) ? &m_q.front() : nullptr; }
+    void   pop() { m_q.pop_front(); }
+
+  private:
+    uint32_t rnd() { m_rnd ^= m_rnd << 13; m_rnd ^= m_rnd >> 17; m_rnd ^= m_rnd << 5; return m_rnd; }
+
+    uint32_t            m_latency, m_jitter, m_rnd;
+    uint32_t            m_last = 0;
+    std::deque<msg_t>   m_q;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+struct scenario_t {
+    const char* name;
+    uint32_t    rate;           // audio bytes per second, a multiple of 1000
+    uint32_t    latency;        // one way, ms
+    uint32_t    jitter;         // ms
+    float       ttsSpeed;       // generation speed, times real time
+    uint32_t    firstByteMs;    // TTS latency
+    uint32_t    utterances;
+    uint32_t    utterMs;        // length of one utterance
+    uint32_t    gapMs;          // silence between two utterances
+    uint32_t    seed;
+    bool        clean;          // the network keeps up, credit must not underrun at all
+    float       maxMsgsPerMin;  // credit: about rate / step per second while playing
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+//  server stand-in
+//----------------------------------------------------------------------------------------------------------------------
+class ServerStandIn {
+  public:
+    ServerStandIn(mode_t_ mode, const scenario_t& sc) : m_mode(mode), m_sc(sc) {}
+
+    void onMessage(const Link::msg_t& m) {
+        if(m_mode == MODE_CREDIT) {
+            uint32_t consumed, window;
+            if(m.text || !PlayCredit::decode(m.data.data(), m.data.size(), &consumed, &window)) { m_badMsgs++; return; }
+            if(m_hasCredit && (int32_t)(consumed - m_consumed) < 0) m_badMsgs++; // must never go back
+            m_consumed = consumed;
+            m_window = window;
+            m_hasCredit = true;
+        }
+        else {
+            std::string s(m.data.begin(), m.data.end());
+            size_t p = s.find("\"value\": \"");
+            if(!m.text || p == std::string::npos) { m_badMsgs++; return; }
+            long value = atol(s.c_str() + p + 10);
+            m_allowance = (long)WINDOW - value;
+        }
+    }
+
+    void tick(uint32_t now, Link& down) {
+        // TTS generation: utterance k starts at utterStart(k), bytes appear at ttsSpeed * rate
+        while(m_started < m_sc.utterances && now >= utterStart(m_started)) m_started++;
+        uint64_t produced = 0;
+        for(uint32_t k = 0; k < m_started; k++) {
+            uint32_t start = utterStart(k) + m_sc.firstByteMs;
+            uint64_t total = utterBytes();
+            uint64_t n = now > start ? (uint64_t)((now - start) * (double)m_sc.rate * m_sc.ttsSpeed / 1000.0) : 0;
+            produced += n < total ? n : total;
+        }
+        uint64_t totalProduced = (uint64_t)m_started * utterBytes();
+
+        while(produced > m_sentAudio) {
+            uint64_t pending = produced - m_sentAudio;
+            uint64_t toEnd = utterBytes() - m_sentAudio % utterBytes(); // frames never cross an utterance boundary
+            uint32_t n = (uint32_t)std::min<uint64_t>(std::min<uint64_t>(pending, toEnd), FRAME_AUDIO);
+            if(n < FRAME_AUDIO && n < toEnd && produced < totalProduced) break; // wait for a full frame
+            uint32_t len = n + FRAME_HEAD;
+            if(m_mode == MODE_CREDIT) {
+                if(!m_hasCredit || (int32_t)(m_sentBytes + len - (m_consumed + m_window)) > 0) break;
+            }
+            else {
+                if(m_allowance < (long)len) break;
+                m_allowance -= len;
+            }
+            uint8_t frame[FRAME_HEAD + FRAME_AUDIO];
+            memcpy(frame, "ab1200", FRAME_HEAD);
+            memset(frame + FRAME_HEAD, 0x55, n);
+            down.push(now, false, frame, len);
+            m_sentBytes += len;
+            m_sentAudio += n;
+        }
+    }
+
+    uint32_t utterStart(uint32_t k) const { return 1000 + k * (m_sc.utterMs + m_sc.gapMs); }
+    uint64_t utterBytes() const { return (uint64_t)m_sc.utterMs * m_sc.rate / 1000; }
+    uint32_t badMsgs() const { return m_badMsgs; }
+
+  private:
+    mode_t_             m_mode;
+    const scenario_t&   m_sc;
+    uint32_t            m_started = 0;  // utterances the TTS has started
+    uint64_t            m_sentAudio = 0;
+    uint32_t            m_sentBytes = 0; // frame bytes, wraps like the device counter
+    bool                m_hasCredit = false;
+    uint32_t            m_consumed = 0;
+    uint32_t            m_window = 0;
+    long                m_allowance = WINDOW; // legacy: the buffer is empty after connecting
+    uint32_t            m_badMsgs = 0;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+//  device: esp_ai_audio_buffer + play task + decoder
+//----------------------------------------------------------------------------------------------------------------------
+struct result_t {
+    uint32_t underruns = 0;
+    uint32_t starvedMs = 0;
+    uint32_t refusals = 0;
+    uint32_t msgs = 0;
+    uint32_t maxBuffered = 0;
+    uint64_t played = 0;
+    float    msgsPerMin = 0;
+    uint32_t badMsgs = 0;
+};
+
+static result_t run(mode_t_ mode, const scenario_t& sc) {
+    Link down(sc.latency, sc.jitter, sc.seed), up(sc.latency, sc.jitter, sc.seed * 7919);
+    ServerStandIn server(mode, sc);
+    result_t r;
+
+    uint32_t now = 0;
+    PlayCredit credit;
+    credit.begin(WINDOW, [&](const uint8_t* msg, size_t len) { up.push(now, false, msg, len); r.msgs++; return true; });
+    if(mode == MODE_CREDIT) credit.setEnabled(true); // {"type":"flow_control","mode":"credit"}
+
+    uint32_t buffered = 0;          // esp_ai_audio_buffer
+    uint32_t dec = 0;               // taken by the play task, not yet played
+    bool     waiting = false;       // play task blocked on the empty buffer
+    uint32_t waitStart = 0;
+    uint32_t prevReport = 0;        // legacy loop state
+    bool     send0 = false;
+    bool     starved = false;
+    const uint32_t perMs = sc.rate / 1000;
+    const uint64_t utterBytes = server.utterBytes();
+    const uint32_t endMs = server.utterStart(sc.utterances) + 5000;
+
+    for(now = 0; now < endMs; now++) {
+        // server side
+        while(Link::msg_t* m = up.front(now)) { server.onMessage(*m); up.pop(); }
+        server.tick(now, down);
+
+        // WS task: webSocketBinChunk takes what fits into the buffer
+        while(Link::msg_t* m = down.front(now)) {
+            size_t taken = 0;
+            if(m->taken < FRAME_HEAD) taken = FRAME_HEAD - m->taken;
+            size_t room = WINDOW - buffered;
+            size_t audio = m->data.size() - (m->taken + taken);
+            size_t n = audio < room ? audio : room;
+            buffered += n;
+            taken += n;
+            m->taken += taken;
+            credit.received(taken);
+            if(m->taken < m->data.size()) {
+                if(!m->refused) r.refusals++;
+                m->refused = true;
+                break;
+            }
+            down.pop();
+        }
+        if(buffered > r.maxBuffered) r.maxBuffered = buffered;
+
+        // play task: one copy() per pass, the decoder/I2S takes the next chunk when the previous one is almost out
+        bool copied = false;
+        if(waiting) {
+            if(buffered || now - waitStart >= WAIT_MS) { waiting = false; copied = true; }
+        }
+        else if(dec < perMs * 8) {
+            if(buffered) copied = true;
+            else { waiting = true; waitStart = now; }
+        }
+        if(copied) {
+            uint32_t n = buffered < READ_SIZE ? buffered : READ_SIZE;
+            buffered -= n;
+            dec += n;
+            if(n && send0) send0 = false;
+            if(mode == MODE_CREDIT) credit.update(buffered);
+            else if(now - prevReport > REPORT_MS && !send0) {
+                prevReport = now;
+                if(buffered == 0) send0 = true;
+                char json[128];
+                int len = snprintf(json, sizeof(json), "{ \"type\":\"client_available_audio\", \"session_id\": \"ab12\", \"value\": \"%u\"}", buffered);
+                up.push(now, true, (const uint8_t*)json, len);
+                r.msgs++;
+            }
+        }
+
+        // decoder/I2S
+        uint32_t take = dec < perMs ? dec : perMs;
+        dec -= take;
+        r.played += take;
+        uint64_t inUtter = r.played % utterBytes;
+        bool midUtterance = inUtter != 0 && r.played < (uint64_t)sc.utterances * utterBytes;
+        if(take < perMs && midUtterance) {
+            if(!starved) r.underruns++;
+            starved = true;
+            r.starvedMs++;
+        }
+        else starved = false;
+    }
+    r.msgsPerMin = r.msgs * 60000.0f / endMs;
+    r.badMsgs = server.badMsgs();
+    return r;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static void testScenario(const scenario_t& sc) {
+    printf("  %s: %u B/s, %u+%u ms one way, TTS %.1fx, %u x %u s\n", sc.name, sc.rate, sc.latency, sc.jitter,
+           sc.ttsSpeed, sc.utterances, sc.utterMs / 1000);
+    result_t res[2];
+    for(int mode = 0; mode < 2; mode++) {
+        result_t& r = res[mode] = run((mode_t_)mode, sc);
+        printf("    %-7s underruns %3u (%5u ms), refusals %4u, max buffered %5u, %6.1f msgs/min\n",
+               mode == MODE_CREDIT ? "credit" : "legacy", r.underruns, r.starvedMs, r.refusals, r.maxBuffered, r.msgsPerMin);
+    }
+    const result_t& c = res[MODE_CREDIT];
+    const result_t& l = res[MODE_LEGACY];
+    uint64_t total = (uint64_t)sc.utterances * sc.utterMs * sc.rate / 1000;
+    CHECK(c.played == total, "%s: played %llu of %llu bytes", sc.name, (unsigned long long)c.played, (unsigned long long)total);
+    CHECK(c.refusals == 0 && c.maxBuffered <= WINDOW, "%s: the server sent beyond the credit", sc.name);
+    CHECK(c.badMsgs == 0 && l.badMsgs == 0, "%s: malformed or decreasing messages", sc.name);
+    CHECK(c.underruns <= l.underruns && (!sc.clean || c.underruns == 0), "%s: %u underruns with credit", sc.name, c.underruns);
+    CHECK(c.msgsPerMin <= sc.maxMsgsPerMin, "%s: %.1f msgs/min with credit", sc.name, c.msgsPerMin);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static void testCodec() {
+    uint8_t msg[PLAY_CREDIT_MSG_LEN];
+    uint32_t c = 0, w = 0;
+    CHECK(PlayCredit::encode(msg, 0xA1B2C3D4, WINDOW) == PLAY_CREDIT_MSG_LEN, "length");
+    CHECK(msg[0] == 'C' && msg[1] == 'R' && msg[2] == 0xD4 && msg[5] == 0xA1, "layout");
+    CHECK(PlayCredit::decode(msg, sizeof(msg), &c, &w) && c == 0xA1B2C3D4 && w == WINDOW, "round trip");
+    CHECK(!PlayCredit::decode(msg, sizeof(msg) - 1, &c, &w), "short message accepted");
+    msg[1] = 'X';
+    CHECK(!PlayCredit::decode(msg, sizeof(msg), &c, &w), "bad magic accepted");
+    printf("  codec                 10 byte frame ok\n");
+}
+//----------------------------------------------------------------------------------------------------------------------
+static void testRules() {
+    std::vector<uint32_t> sent;
+    bool sinkOk = true;
+    PlayCredit pc;
+    pc.begin(WINDOW, [&](const uint8_t* msg, size_t len) {
+        uint32_t c, w;
+        if(!sinkOk) return false;
+        if(PlayCredit::decode(msg, len, &c, &w)) sent.push_back(c);
+        return true;
+    });
+
+    CHECK(!pc.update(0) && sent.empty(), "sent while disabled");
+    pc.received(0xFFFFF000);                    // counter close to wrapping, only bytes after enabling count
+    pc.setEnabled(true);
+    CHECK(pc.update(3000) && sent.size() == 1 && sent[0] == 0, "initial credit");     // 3000 bytes builtin audio
+    CHECK(!pc.update(3000) && !pc.update(0), "idle without consumption sends");
+    pc.received(WINDOW);                        // wraps
+    CHECK(!pc.update(WINDOW - 100), "sent below the step");
+    CHECK(pc.consumed() == 100, "consumed %u", pc.consumed());
+    CHECK(pc.update(WINDOW / 2 - 100) && sent.back() == WINDOW / 2 + 100, "step not reported");
+    CHECK(!pc.update(WINDOW / 2 - 200), "repeated without a new step");
+    CHECK(pc.update(WINDOW / 4 - 1) && sent.back() == WINDOW - WINDOW / 4 + 1, "low watermark not reported");
+    CHECK(!pc.update(WINDOW / 4 - 2), "low watermark fired twice");
+    sinkOk = false;
+    CHECK(!pc.update(0) && sent.size() == 3, "failed send counted");
+    sinkOk = true;
+    CHECK(pc.update(0) && sent.back() == WINDOW, "retry after a failed send");
+    CHECK(!pc.update(0), "empty buffer reported twice");
+    pc.setEnabled(false);
+    pc.received(5000);
+    CHECK(!pc.update(0) && sent.size() == 4, "sent after disabling");
+    pc.setEnabled(true);
+    CHECK(pc.update(0) && sent.back() == 0, "counters not restarted");
+    CHECK(pc.credits_sent == 5, "credits_sent %u", pc.credits_sent);
+    printf("  rules                 step, watermarks, wrap, retry and restart ok\n");
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+int main() {
+    printf("PlayCredit\n");
+    testCodec();
+    testRules();
+
+    // speech is what the TTS sends (16 or 24 kHz mono MP3), there credit also has to beat the 1 Hz report.
+    // Underruns that remain with credit happen right after the first frame of an utterance: TTS and jitter,
+    // not flow control, the legacy run has them too.
+    //                    name              rate  lat  jit speed first   n  length   gap seed  clean  msgs/min
+    const scenario_t sc[] = {
+        {"speech, LAN    ",  4000,  10,  10, 3.0f,  300, 12, 20000, 5000,   1,  true,  30},
+        {"speech, Wi-Fi  ",  6000,  40,  80, 2.0f,  600, 12, 20000, 5000,   2,  true,  40},
+        {"speech, LTE    ",  4000, 100, 250, 1.5f,  800, 12, 20000, 5000,   3, false,  30},
+        {"music,  Wi-Fi  ", 16000,  60, 150, 2.0f,  500,  6, 60000, 5000,   4, false, 120},
+    };
+    for(const scenario_t& s : sc) testScenario(s);
+
+    printf("%s\n", s_failed ? "FAILED" : "all passed");
+    return s_failed ? 1 : 0;
+}
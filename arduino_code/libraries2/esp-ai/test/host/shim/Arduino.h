@@ -0,0 +1,92 @@
+/*
+ * Arduino.h
+ *
+ * Created on: Oct 18,2026
+ *
+ *  Minimal Arduino-ESP32 replacement for the host build of src/cache (test/host): String, Serial.printf and a
+ *  FreeRTOS task/mutex subset on std::thread. FS.h, LittleFS.h and FFat.h stand in for the file systems,
+ *  esp_heap_caps.h and mbedtls/ for the IDF parts. Never include this file in a firmware build.
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <cctype>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <chrono>
+
+//----------------------------------------------------------------------------------------------------------------------
+class String {
+  public:
+    String() {}
+    String(const char* s) : m_s(s ? s : "") {}
+    String(const std::string& s) : m_s(s) {}
+
+    const char* c_str() const                         { return m_s.c_str(); }
+    unsigned    length() const                        { return m_s.size(); }
+    String      substring(unsigned from, unsigned to) const {
+        if(from > m_s.size()) return String();
+        return String(m_s.substr(from, to > from ? to - from : 0));
+    }
+    bool startsWith(const String& s) const            { return m_s.compare(0, s.m_s.size(), s.m_s) == 0; }
+    String& operator+=(const String& s)               { m_s += s.m_s; return *this; }
+    friend String operator+(const String& a, const String& b) { return String(a.m_s + b.m_s); }
+    friend String operator+(const String& a, const char* b)   { return String(a.m_s + b); }
+    bool operator==(const String& s) const            { return m_s == s.m_s; }
+    bool operator!=(const String& s) const            { return m_s != s.m_s; }
+    bool operator==(const char* s) const              { return m_s == s; }
+    bool operator!=(const char* s) const              { return m_s != s; }
+
+  private:
+    std::string m_s;
+};
+
+struct HostSerial {
+    void printf(const char* fmt, ...) {
+        va_list ap;
+        va_start(ap, fmt);
+        vfprintf(stderr, fmt, ap);
+        va_end(ap);
+    }
+};
+inline HostSerial Serial;
+
+inline unsigned long millis() {
+    return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  FreeRTOS subset, a task is a detached std::thread, one tick is one ms
+typedef int                 BaseType_t;
+typedef uint32_t            TickType_t;
+typedef void*               TaskHandle_t;
+typedef std::timed_mutex*   SemaphoreHandle_t;
+#define pdPASS              1
+#define pdTRUE              1
+#define pdFALSE             0
+#define portMAX_DELAY       0xFFFFFFFFu
+#define pdMS_TO_TICKS(ms)   ((TickType_t)(ms))
+
+inline void vTaskDelay(TickType_t ticks) { std::this_thread::sleep_for(std::chrono::milliseconds(ticks)); }
+inline void vTaskDelete(TaskHandle_t)    {}    // the thread ends when the task function returns
+inline BaseType_t xTaskCreate(void (*fn)(void*), const char*, uint32_t, void* param, int, TaskHandle_t* handle) {
+    std::thread t(fn, param);
+    if(handle) *handle = (TaskHandle_t)1;
+    t.detach();
+    return pdPASS;
+}
+inline SemaphoreHandle_t xSemaphoreCreateMutex()               { return new std::timed_mutex; }
+inline void              vSemaphoreDelete(SemaphoreHandle_t m) { delete m; }
+inline BaseType_t        xSemaphoreGive(SemaphoreHandle_t m)   { m->unlock(); return pdTRUE; }
+inline BaseType_t        xSemaphoreTake(SemaphoreHandle_t m, TickType_t ticks) {
+    if(ticks == portMAX_DELAY) {m->lock(); return pdTRUE;}
+    return m->try_lock_for(std::chrono::milliseconds(ticks)) ? pdTRUE : pdFALSE;
+}
@@ -0,0 +1,18 @@
+/*
+ * FFat.h
+ *
+ * Created on: Oct 18,2026
+ *
+ *  Host stand-in for the FFat object, never mounts (the tests use LittleFS.h).
+ *  Never include this file in a firmware build.
+ *
+ */
+#pragma once
+
+#include "FS.h"
+
+class HostFFat : public fs::FS {
+  public:
+    bool begin(bool) { return false; }
+};
+inline HostFFat FFat;
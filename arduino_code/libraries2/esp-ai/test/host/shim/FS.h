@@ -0,0 +1,93 @@
+/*
+ * FS.h
+ *
+ * Created on: Oct 18,2026
+ *
+ *  Minimal fs::FS / fs::File replacement for the host build (test/host). The file system is a directory on the host,
+ *  paths are relative to it like on LittleFS. Only what src/cache uses is provided.
+ *  Never include this file in a firmware build.
+ *
+ */
+#pragma once
+
+#include "Arduino.h"
+#include <algorithm>
+#include <filesystem>
+#include <vector>
+#include <sys/stat.h>
+
+#define FILE_READ   "r"
+#define FILE_WRITE  "w"
+
+namespace fs {
+
+class File {
+  public:
+    File() {}
+    File(const std::string& root, const std::string& path, const char* mode) : m_root(root), m_path(path) {
+        std::string host = root + path;
+        struct stat st;
+        if(mode[0] == 'r' && stat(host.c_str(), &st) == 0 && S_ISDIR(st.st_mode)) {
+            m_dir = true;
+            for(auto& e : std::filesystem::directory_iterator(host)) m_entries.push_back(e.path().filename().string());
+            std::sort(m_entries.begin(), m_entries.end());
+            m_ok = true;
+            return;
+        }
+        m_fp = fopen(host.c_str(), mode[0] == 'w' ? "wb" : "rb");
+        m_ok = m_fp != nullptr;
+    }
+    File(File&& o) noexcept { *this = std::move(o); }
+    File& operator=(File&& o) noexcept {
+        close();
+        m_root = std::move(o.m_root); m_path = std::move(o.m_path); m_entries = std::move(o.m_entries);
+        m_fp = o.m_fp; m_dir = o.m_dir; m_ok = o.m_ok; m_next = o.m_next;
+        o.m_fp = nullptr; o.m_ok = false;
+        return *this;
+    }
+    ~File() { close(); }
+
+    operator bool() const     { return m_ok; }
+    bool        isDirectory() { return m_dir; }
+    const char* path()        { return m_path.c_str(); }
+    const char* name()        { size_t p = m_path.rfind('/'); return m_path.c_str() + (p == std::string::npos ? 0 : p + 1); }
+    size_t      read(uint8_t* buf, size_t len)        { return m_fp ? fread(buf, 1, len, m_fp) : 0; }
+    size_t      write(const uint8_t* buf, size_t len) { return m_fp ? fwrite(buf, 1, len, m_fp) : 0; }
+    size_t size() {
+        struct stat st;
+        return stat((m_root + m_path).c_str(), &st) == 0 ? st.st_size : 0;
+    }
+    File openNextFile() {
+        if(!m_dir || m_next >= m_entries.size()) return File();
+        return File(m_root, m_path + "/" + m_entries[m_next++], FILE_READ);
+    }
+    void close() {
+        if(m_fp) fclose(m_fp);
+        m_fp = nullptr;
+        m_ok = false;
+    }
+
+  private:
+    std::string              m_root, m_path;
+    std::vector<std::string> m_entries;
+    FILE*                    m_fp = nullptr;
+    bool                     m_dir = false, m_ok = false;
+    size_t                   m_next = 0;
+};
+
+class FS {
+  public:
+    void setRoot(const std::string& root) { m_root = root; }
+    File open(const String& path, const char* mode = FILE_READ) { return File(m_root, path.c_str(), mode); }
+    bool exists(const String& path) { struct stat st; return stat((m_root + path.c_str()).c_str(), &st) == 0; }
+    bool remove(const String& path) { return ::remove((m_root + path.c_str()).c_str()) == 0; }
+    bool mkdir(const String& path)  { return ::mkdir((m_root + path.c_str()).c_str(), 0755) == 0; }
+
+  protected:
+    std::string m_root;
+};
+
+} // namespace fs
+
+using fs::FS;
+using fs::File;
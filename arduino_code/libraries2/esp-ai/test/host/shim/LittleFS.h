@@ -0,0 +1,18 @@
+/*
+ * LittleFS.h
+ *
+ * Created on: Oct 18,2026
+ *
+ *  Host stand-in for the LittleFS object: mounted when the test set a root directory with LittleFS.setRoot().
+ *  Never include this file in a firmware build.
+ *
+ */
+#pragma once
+
+#include "FS.h"
+
+class HostLittleFS : public fs::FS {
+  public:
+    bool begin(bool) { return !m_root.empty(); }
+};
+inline HostLittleFS LittleFS;
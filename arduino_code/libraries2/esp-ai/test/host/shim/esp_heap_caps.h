@@ -0,0 +1,18 @@
+/*
+ * esp_heap_caps.h
+ *
+ * Created on: Oct 18,2026
+ *
+ *  Host stand-in for the IDF capability allocators, there is no PSRAM on the host, everything ends up in malloc.
+ *  Never include this file in a firmware build.
+ *
+ */
+#pragma once
+
+#include <stdlib.h>
+
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+#define MALLOC_CAP_DEFAULT  (1 << 12)
+
+inline void* heap_caps_malloc_prefer(size_t size, size_t, ...)             { return malloc(size); }
+inline void* heap_caps_realloc_prefer(void* ptr, size_t size, size_t, ...) { return realloc(ptr, size); }
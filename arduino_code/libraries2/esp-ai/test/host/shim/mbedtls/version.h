@@ -0,0 +1,11 @@
+/*
+ * mbedtls/version.h
+ *
+ * Created on: Oct 18,2026
+ *
+ *  Host stand-in, the SHA-256 in sha256.h has the mbedtls 3 names.
+ *
+ */
+#pragma once
+
+#define MBEDTLS_VERSION_NUMBER 0x03000000
@@ -0,0 +1,317 @@
+/*
+ * ws_msg_test.cpp
+ *
+ * Created on: Oct 18,2026
+ *
+ *  Checks JsonTokenizer / JsonScan (src/msg/json_scan.h) and the perfect hash of the message types
+ *  (src/msg/ws_msg.h): token stream, rejection of broken JSON, escapes and UTF-8 truncation, number limits, and
+ *  every top-level field of ws_text_trace.txt (one text message per line, the shapes a session produces) against
+ *  cJSON from Arduino_JSON. Then replays the trace through both paths the way webSocketEvent() uses them and prints
+ *  time and heap allocations per message:
+ *      cJSON   JSON.parse DOM, String copies of type / command_id / data, if-chain of String compares
+ *      scan    JsonScan over the payload, ws_msg_type(), fields into fixed buffers
+ *
+ *      ws_msg_test <trace>         exit code 0 if everything passed
+ *
+ */
+#include "msg/json_scan.h"
+#include "msg/ws_msg.h"
+#include "cjson/cJSON.h"
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+static int s_failed = 0;
+#define CHECK(cond, ...) do{ if(!(cond)) {printf("    FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); s_failed++;} }while(0)
+
+static bool parse(JsonScan& scan, const char* s) { return scan.parse(s, strlen(s)); }
+
+//----------------------------------------------------------------------------------------------------------------------
+static void testTokens() {
+    const char* json = " {\"a\" : [1, -2.5e3, \"x\\ty\"], \"b\":{}, \"c\":true,\"d\":false, \"e\":null} ";
+    const json_tok_t expect[] = {JSON_TOK_OBJ_BEGIN, JSON_TOK_KEY, JSON_TOK_ARR_BEGIN, JSON_TOK_NUMBER, JSON_TOK_NUMBER,
+                                 JSON_TOK_STRING, JSON_TOK_ARR_END, JSON_TOK_KEY, JSON_TOK_OBJ_BEGIN, JSON_TOK_OBJ_END,
+                                 JSON_TOK_KEY, JSON_TOK_TRUE, JSON_TOK_KEY, JSON_TOK_FALSE, JSON_TOK_KEY, JSON_TOK_NULL,
+                                 JSON_TOK_OBJ_END, JSON_TOK_END};
+    JsonTokenizer tz;
+    tz.begin(json, strlen(json));
+    bool ok = true;
+    for(json_tok_t t : expect) {
+        JsonToken tok = tz.next();
+        if(tok.type != t) { ok = false; break; }
+        if(t == JSON_TOK_NUMBER && tok.view.len == 7) CHECK(memcmp(tok.view.p, "-2.5e3", 6) == 0, "number view");
+        if(t == JSON_TOK_STRING) CHECK(tok.view.len == 4 && tok.view.esc, "string view %zu", tok.view.len);
+    }
+    CHECK(ok, "token sequence differs");
+    CHECK(tz.next().type == JSON_TOK_END, "END is sticky");
+
+    static const char* bad[] = {
+        "", " ", "{", "}", "{\"a\":1,}", "{\"a\" 1}", "{\"a\":}", "{a:1}", "{\"a\":01}", "{\"a\":1.}", "{\"a\":-}",
+        "{\"a\":1e}", "{\"a\":.5}", "{\"a\":tru}", "{\"a\":nul}", "{\"a\":\"x}", "{\"a\":\"\\x\"}", "{\"a\":\"\\u12g4\"}",
+        "{\"a\":\"tab\there\"}", "{\"a\":[1,2}", "{\"a\":{]}", "{\"a\":1}}", "{\"a\":1} x", "{\"a\":1}{}", "[1,]",
+        "{\"a\":[1 2]}", "{,}", "{\"a\":1,,\"b\":2}", "{\"a\":\"\\u12\"}", "{\"a\":+1}",
+    };
+    int rejected = 0;
+    for(const char* s : bad) {
+        JsonTokenizer t;
+        t.begin(s, strlen(s));
+        json_tok_t last;
+        int guard = 0;
+        do { last = t.next().type; } while(last != JSON_TOK_ERROR && last != JSON_TOK_END && ++guard < 100);
+        if(last == JSON_TOK_ERROR) rejected++;
+        else CHECK(false, "accepted broken JSON: %s", s);
+    }
+    // nesting limit
+    std::string deep = "{\"a\":";
+    for(int i = 0; i < JSON_SCAN_MAX_DEPTH; i++) deep += "[";
+    for(int i = 0; i < JSON_SCAN_MAX_DEPTH; i++) deep += "]";
+    deep += "}";
+    JsonScan scan;
+    CHECK(!scan.parse(deep.data(), deep.size()), "nesting deeper than JSON_SCAN_MAX_DEPTH accepted");
+    deep.erase(5, 1);
+    deep.erase(deep.size() - 2, 1);
+    CHECK(scan.parse(deep.data(), deep.size()) && scan.kind("a") == JSON_ARRAY, "nesting at JSON_SCAN_MAX_DEPTH refused");
+    CHECK(!parse(scan, "[1,2]") && scan.count() == 0, "top level must be an object");
+    printf("  tokenizer             token stream ok, %d broken messages rejected\n", rejected);
+}
+//----------------------------------------------------------------------------------------------------------------------
+static void testValues() {
+    JsonScan scan;
+    char buf[64];
+    CHECK(parse(scan, "{\"s\":\"\\u4f60\\u597d\\n\\\"\\/\\\\\",\"e\":\"\\ud83d\\ude00\",\"l\":\"\\ud83d!\",\"raw\":\"你好世界\"}"),
+          "escapes refused");
+    CHECK(scan.str("s", buf, sizeof(buf)) == 10 && strcmp(buf, "你好\n\"/\\") == 0, "escapes: %s", buf);
+    CHECK(scan.str("e", buf, sizeof(buf)) == 4 && strcmp(buf, "\xF0\x9F\x98\x80") == 0, "surrogate pair");
+    CHECK(scan.str("l", buf, sizeof(buf)) == 4 && strcmp(buf, "\xEF\xBF\xBD!") == 0, "lone surrogate");
+    CHECK(scan.is("s", "你好\n\"/\\") && !scan.is("s", "你好"), "is() with escapes");
+    CHECK(scan.is("raw", "你好世界") && scan.raw("raw").len == 12, "is() without escapes");
+    // truncation never splits a UTF-8 character
+    CHECK(scan.str("raw", buf, 8) == 6 && strcmp(buf, "你好") == 0, "truncated raw: %s", buf);
+    CHECK(scan.str("s", buf, 5) == 3 && strcmp(buf, "你") == 0, "truncated escaped: %s", buf);
+    CHECK(scan.str("missing", buf, sizeof(buf)) == 0 && buf[0] == 0, "missing string");
+
+    CHECK(parse(scan, "{\"a\":123,\"b\":-45,\"c\":1.9,\"d\":-2.5e1,\"e\":99999999999999999999999,\"f\":-99999999999999999999999,"
+                      "\"g\":\"7\",\"h\":true,\"i\":false,\"j\":null,\"k\":0}"), "numbers refused");
+    CHECK(scan.num("a") == 123 && scan.num("b") == -45 && scan.num("k", 9) == 0, "integers");
+    CHECK(scan.num("c") == 1 && scan.num("d") == -25, "fractions %ld %ld", scan.num("c"), scan.num("d"));
+    CHECK(scan.num("e") == LONG_MAX && scan.num("f") == LONG_MIN, "saturation");
+    CHECK(scan.num("g", -1) == -1 && scan.num("zz", 5) == 5, "not a number");
+    CHECK(scan.boolean("h") && !scan.boolean("i", true) && scan.boolean("j", true), "booleans");
+    CHECK(scan.kind("j") == JSON_NULL && scan.kind("zz") == JSON_NONE, "kinds");
+
+    CHECK(parse(scan, "{\"a\":1,\"a\":2,\"o\":{\"x\":[1,{\"y\":\"}\"}]},\"t\":\"z\"}"), "nested refused");
+    CHECK(scan.num("a") == 1, "first duplicate wins, like cJSON");
+    const JsonField* o = scan.find("o");
+    CHECK(o && o->kind == JSON_OBJECT && o->val.len == 19 && o->val.p[0] == '{' && o->val.p[18] == '}', "nested span");
+    CHECK(scan.is("t", "z") && scan.count() == 4, "field after nested value");
+
+    std::string many = "{";
+    for(int i = 0; i < JSON_SCAN_MAX_FIELDS + 8; i++) many += (i ? ",\"f" : "\"f") + std::to_string(i) + "\":" + std::to_string(i);
+    many += "}";
+    CHECK(scan.parse(many.data(), many.size()) && scan.count() == JSON_SCAN_MAX_FIELDS, "field limit");
+    CHECK(scan.num("f0") == 0 && !scan.has(("f" + std::to_string(JSON_SCAN_MAX_FIELDS)).c_str()), "fields beyond the limit");
+    printf("  values                escapes, truncation, numbers, nesting ok\n");
+}
+//----------------------------------------------------------------------------------------------------------------------
+static void testTypes() {
+    int found = 0;
+    for(int t = 1; t < WS_MSG_COUNT; t++) {
+        const char* name = ws_msg_name((ws_msg_t)t);
+        if(ws_msg_type(name, strlen(name)) == t) found++;
+        else CHECK(false, "%s does not map to itself", name);
+    }
+    if(found != WS_MSG_COUNT - 1) {
+        // the table is out of date: look for a seed that puts every name into its own slot
+        for(uint32_t seed = 1; seed < (1u << 24); seed++) {
+            uint32_t used = 0;
+            bool ok = true;
+            for(int t = 1; t < WS_MSG_COUNT && ok; t++) {
+                const char* name = ws_msg_name((ws_msg_t)t);
+                uint32_t bit = 1u << ws_msg_hash(name, strlen(name), seed);
+                ok = !(used & bit);
+                used |= bit;
+            }
+            if(ok) { printf("    WS_MSG_HASH_SEED 0x%xu would work, rebuild the slot table with it\n", seed); break; }
+        }
+    }
+    static const char* unknown[] = {"", "errors", "erro", "ERROR", "session", "session_statu", "future_type", "sever_close"};
+    for(const char* s : unknown) CHECK(ws_msg_type(s, strlen(s)) == WS_MSG_UNKNOWN, "'%s' is not a message type", s);
+    printf("  types                 %d names hash to their own slot\n", found);
+}
+//----------------------------------------------------------------------------------------------------------------------
+// every top-level field compared with cJSON
+static void testTrace(const std::vector<std::string>& trace) {
+    int fields = 0;
+    for(const std::string& line : trace) {
+        JsonScan scan;
+        cJSON* root = cJSON_ParseWithLength(line.data(), line.size());
+        bool ok = scan.parse(line.data(), line.size());
+        CHECK(root && ok, "parse: %s", line.c_str());
+        if(!root || !ok) { cJSON_Delete(root); continue; }
+        int n = 0;
+        for(cJSON* it = root->child; it; it = it->next, n++) {
+            const JsonField* f = scan.find(it->string);
+            CHECK(f != nullptr, "missing field %s", it->string);
+            if(!f) continue;
+            fields++;
+            if(cJSON_IsString(it)) {
+                char buf[256];
+                scan.str(it->string, buf, sizeof(buf));
+                CHECK(f->kind == JSON_STRING && strcmp(buf, it->valuestring) == 0, "%s: '%s' != '%s'", it->string, buf, it->valuestring);
+            }
+            else if(cJSON_IsNumber(it)) {
+                CHECK(f->kind == JSON_NUMBER && scan.num(it->string) == it->valueint, "%s: %ld != %d", it->string, scan.num(it->string), it->valueint);
+            }
+            else if(cJSON_IsObject(it) || cJSON_IsArray(it)) {
+                std::string sub(f->val.p, f->val.len);
+                cJSON* inner = cJSON_Parse(sub.c_str());
+                char* a = cJSON_PrintUnformatted(inner);
+                char* b = cJSON_PrintUnformatted(it);
+                CHECK(a && b && strcmp(a, b) == 0, "%s: nested span differs", it->string);
+                free(a);
+                free(b);
+                cJSON_Delete(inner);
+            }
+            else {
+                json_kind_t k = cJSON_IsTrue(it) ? JSON_TRUE : cJSON_IsFalse(it) ? JSON_FALSE : JSON_NULL;
+                CHECK(f->kind == k, "%s: literal kind", it->string);
+            }
+        }
+        CHECK(n == scan.count(), "field count %d != %u: %s", n, scan.count(), line.c_str());
+        cJSON_Delete(root);
+
+        // every prefix of a message is broken JSON and must be refused without reading past its end
+        for(size_t cut = 0; cut < line.size(); cut++) {
+            std::vector<char> part(line.begin(), line.begin() + cut); // exact size, no terminator
+            CHECK(!scan.parse(part.data(), cut), "prefix of %zu bytes accepted: %s", cut, line.c_str());
+        }
+    }
+    printf("  trace                 %zu messages, %d fields equal to cJSON, all prefixes refused\n", trace.size(), fields);
+}
+//----------------------------------------------------------------------------------------------------------------------
+//  benchmark: the fields each handler of webSocketEvent() reads
+//----------------------------------------------------------------------------------------------------------------------
+struct handler_t { ws_msg_t type; const char* strs[4]; const char* nums[8]; };
+static const handler_t s_handlers[] = {
+    {WS_MSG_STC_TIME,        {"stc_time"}, {}},
+    {WS_MSG_NET_DELAY,       {}, {"net_delay"}},
+    {WS_MSG_INSTRUCT,        {"command_id", "data"}, {}},
+    {WS_MSG_PLAY_AUDIO,      {"tts_task_id", "session_id"}, {}},
+    {WS_MSG_MIC_FORMAT,      {"codec"}, {}},
+    {WS_MSG_FLOW_CONTROL,    {"mode"}, {}},
+    {WS_MSG_SESSION_START,   {"session_id"}, {}},
+    {WS_MSG_SESSION_STOP,    {}, {}},
+    {WS_MSG_AUTH_FAIL,       {"message", "code"}, {}},
+    {WS_MSG_ERROR,           {"at", "message", "code"}, {}},
+    {WS_MSG_SESSION_STATUS,  {"status"}, {}},
+    {WS_MSG_SET_WIFI_CONFIG, {}, {}},
+    {WS_MSG_RESTART,         {}, {}},
+    {WS_MSG_CLEAR_CACHE,     {}, {}},
+    {WS_MSG_CACHE_OFFER,     {"key", "hash"}, {"size"}},
+    {WS_MSG_SET_LOCAL_DATA,  {"field", "value"}, {}},
+    {WS_MSG_LOG,             {"data"}, {}},
+    {WS_MSG_SEVER_CLOSE,     {}, {}},
+    {WS_MSG_HARDWARE_FNS,    {"fn_name", "str_val"}, {"pin", "num_val", "channel", "freq", "resolution", "deg"}},
+    {WS_MSG_EMOTION,         {"data"}, {}},
+};
+
+static uint32_t s_allocs = 0;
+static void* countedMalloc(size_t n) { s_allocs++; return malloc(n); }
+
+// an Arduino String copy: one heap block per non-empty value
+static volatile uint32_t s_sink = 0;
+static void stringCopy(const char* s) {
+    if(!s || !*s) return;
+    size_t n = strlen(s);
+    char* p = (char*)countedMalloc(n + 1);
+    memcpy(p, s, n + 1);
+    s_sink += (uint8_t)p[n / 2];
+    free(p);
+}
+
+static void oldPath(const std::string& line) {
+    cJSON* root = cJSON_Parse(line.c_str());
+    if(!root) return;
+    cJSON* type = cJSON_GetObjectItemCaseSensitive(root, "type");
+    if(type) {
+        const char* t = cJSON_IsString(type) ? type->valuestring : "";
+        stringCopy(t);
+        stringCopy(cJSON_GetStringValue(cJSON_GetObjectItemCaseSensitive(root, "command_id")));
+        stringCopy(cJSON_GetStringValue(cJSON_GetObjectItemCaseSensitive(root, "data")));
+        for(const handler_t& h : s_handlers) { // the if-chain, in source order
+            if(strcmp(t, ws_msg_name(h.type)) != 0) continue;
+            for(const char* k : h.strs) if(k) stringCopy(cJSON_GetStringValue(cJSON_GetObjectItemCaseSensitive(root, k)));
+            for(const char* k : h.nums) if(k) { cJSON* v = cJSON_GetObjectItemCaseSensitive(root, k); s_sink += v ? v->valueint : 0; }
+            break;
+        }
+    }
+    cJSON_Delete(root);
+}
+
+static void newPath(const std::string& line) {
+    JsonScan msg;
+    if(!msg.parse(line.data(), line.size())) return;
+    const JsonField* type = msg.find("type");
+    if(!type) return;
+    ws_msg_t t = type->kind == JSON_STRING && !type->val.esc ? ws_msg_type(type->val.p, type->val.len) : WS_MSG_UNKNOWN;
+    for(const handler_t& h : s_handlers) {
+        if(h.type != t) continue;
+        char buf[256];
+        for(const char* k : h.strs) if(k) s_sink += msg.str(k, buf, sizeof(buf));
+        for(const char* k : h.nums) if(k) s_sink += msg.num(k);
+        break;
+    }
+}
+
+static void bench(const std::vector<std::string>& trace) {
+    const int rounds = 2000;
+    double ns[2];
+    uint32_t allocs[2];
+    for(int k = 0; k < 2; k++) {
+        s_allocs = 0;
+        auto t0 = std::chrono::steady_clock::now();
+        for(int r = 0; r < rounds; r++)
+            for(const std::string& line : trace) k ? newPath(line) : oldPath(line);
+        ns[k] = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / ((double)rounds * trace.size());
+        allocs[k] = s_allocs;
+    }
+    double per = 1.0 / ((double)rounds * trace.size());
+    printf("  bench cJSON           %7.1f ns per message, %5.1f heap allocations per message\n", ns[0], allocs[0] * per);
+    printf("  bench scan            %7.1f ns per message, %5.1f heap allocations per message (%.1fx)\n", ns[1], allocs[1] * per, ns[0] / ns[1]);
+    CHECK(allocs[0] > 0 && allocs[1] == 0, "the scan path allocated %u times", allocs[1]);
+}
+//----------------------------------------------------------------------------------------------------------------------
+int main(int argc, char** argv) {
+    printf("JsonScan / ws_msg_type\n");
+    if(argc < 2) {
+        printf("usage: ws_msg_test <trace>\n");
+        return 2;
+    }
+    FILE* f = fopen(argv[1], "r");
+    if(!f) {
+        printf("cannot open %s\n", argv[1]);
+        return 2;
+    }
+    std::vector<std::string> trace;
+    char line[4096];
+    while(fgets(line, sizeof(line), f)) {
+        size_t n = strcspn(line, "\r\n");
+        if(n) trace.push_back(std::string(line, n));
+    }
+    fclose(f);
+
+    cJSON_Hooks hooks = {countedMalloc, free};
+    cJSON_InitHooks(&hooks);
+
+    testTokens();
+    testValues();
+    testTypes();
+    testTrace(trace);
+    bench(trace);
+
+    printf("%s\n", s_failed ? "FAILED" : "all passed");
+    return s_failed ? 1 : 0;
+}
@@ -0,0 +1,109 @@
+/***************************************************
+Copyright (c) 2020 Luis Llamas
+(www.luisllamas.es)
+
+This program is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License as published by
+the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License along with this program.  If not, see <http://www.gnu.org/licenses
+****************************************************/
+
+#include "DirtyRegion.h"
+
+bool DirtyRect::Intersects(const DirtyRect &other) const
+{
+	if (Empty() || other.Empty())
+		return false;
+	return x < other.x + other.w && other.x < x + w && y < other.y + other.h && other.y < y + h;
+}
+
+DirtyRect DirtyRect::United(const DirtyRect &other) const
+{
+	if (Empty())
+		return other;
+	if (other.Empty())
+		return *this;
+	int32_t left = min(x, other.x);
+	int32_t top = min(y, other.y);
+	int32_t right = max(x + w, other.x + other.w);
+	int32_t bottom = max(y + h, other.y + other.h);
+	return DirtyRect(left, top, right - left, bottom - top);
+}
+
+DirtyRect DirtyRect::Clipped(int16_t width, int16_t height) const
+{
+	int32_t left = max((int32_t)x, (int32_t)0);
+	int32_t top = max((int32_t)y, (int32_t)0);
+	int32_t right = min((int32_t)x + w, (int32_t)width);
+	int32_t bottom = min((int32_t)y + h, (int32_t)height);
+	if (right <= left || bottom <= top)
+		return DirtyRect();
+	return DirtyRect(left, top, right - left, bottom - top);
+}
+
+void DirtyRegion::Remove(int index)
+{
+	for (int i = index; i < count_ - 1; i++)
+	{
+		rects_[i] = rects_[i + 1];
+	}
+	count_--;
+}
+
+void DirtyRegion::Add(DirtyRect rect)
+{
+	if (rect.Empty())
+		return;
+
+	// 先把相交的、或合并后面积不超过两者之和的矩形吸收进来；
+	// 合并后的矩形变大了，可能又碰到别的矩形，所以从头再扫一遍
+	bool merged = true;
+	while (merged)
+	{
+		merged = false;
+		for (int i = 0; i < count_; i++)
+		{
+			DirtyRect united = rects_[i].United(rect);
+			if (rects_[i].Intersects(rect) || united.Area() <= rects_[i].Area() + rect.Area())
+			{
+				rect = united;
+				Remove(i);
+				merged = true;
+				break;
+			}
+		}
+
+		if (!merged && count_ == DIRTY_REGION_MAX_RECTS)
+		{
+			// 放不下了，和多发像素最少的那个合并
+			int best = 0;
+			int32_t best_cost = INT32_MAX;
+			for (int i = 0; i < count_; i++)
+			{
+				int32_t cost = rects_[i].United(rect).Area() - rects_[i].Area();
+				if (cost < best_cost)
+				{
+					best_cost = cost;
+					best = i;
+				}
+			}
+			rect = rects_[best].United(rect);
+			Remove(best);
+			merged = true;
+		}
+	}
+
+	rects_[count_++] = rect;
+}
+
+int32_t DirtyRegion::Area() const
+{
+	int32_t area = 0;
+	for (int i = 0; i < count_; i++)
+	{
+		area += rects_[i].Area();
+	}
+	return area;
+}
@@ -0,0 +1,63 @@
+/***************************************************
+Copyright (c) 2020 Luis Llamas
+(www.luisllamas.es)
+
+This program is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License as published by
+the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License along with this program.  If not, see <http://www.gnu.org/licenses
+****************************************************/
+
+#ifndef _DIRTYREGION_h
+#define _DIRTYREGION_h
+
+#include <Arduino.h>
+
+// 屏幕上的一个矩形，w 或 h 不大于 0 时表示空
+struct DirtyRect
+{
+	int16_t x = 0;
+	int16_t y = 0;
+	int16_t w = 0;
+	int16_t h = 0;
+
+	DirtyRect() {}
+	DirtyRect(int32_t x_, int32_t y_, int32_t w_, int32_t h_) : x(x_), y(y_), w(w_), h(h_) {}
+
+	bool Empty() const { return w <= 0 || h <= 0; }
+	int32_t Area() const { return Empty() ? 0 : (int32_t)w * h; }
+	bool Intersects(const DirtyRect &other) const;
+	// 同时包含两个矩形的最小矩形
+	DirtyRect United(const DirtyRect &other) const;
+	// 裁剪到 (0, 0, width, height) 之内
+	DirtyRect Clipped(int16_t width, int16_t height) const;
+
+	bool operator==(const DirtyRect &other) const { return x == other.x && y == other.y && w == other.w && h == other.h; }
+	bool operator!=(const DirtyRect &other) const { return !(*this == other); }
+};
+
+#define DIRTY_REGION_MAX_RECTS 6
+
+// 一帧内需要重绘并发送到屏幕的区域。
+// 由若干互不重叠的矩形组成，相交或合并后不会多发像素的矩形会被合并，
+// 超出容量时挑合并代价最小的一对合并，所以最坏情况退化为整屏一个矩形。
+class DirtyRegion
+{
+public:
+	void Clear() { count_ = 0; }
+	void Add(DirtyRect rect);
+
+	int Count() const { return count_; }
+	const DirtyRect &Rect(int index) const { return rects_[index]; }
+	int32_t Area() const;
+
+private:
+	void Remove(int index);
+
+	DirtyRect rects_[DIRTY_REGION_MAX_RECTS];
+	int count_ = 0;
+};
+
+#endif
@@ -49,9 +49,18 @@ void Eye::Update() {
 	BlinkTransformation.Update();
 }
 
+void Eye::Render() {
+	EyeDrawer::Rasterize(CenterX, CenterY, FinalConfig, &Spans);
+	EyeDrawer::Fill(&Spans, Color, AntiAlias, Background);
+}
+
+DirtyRect Eye::Bounds() {
+	return EyeDrawer::Bounds(CenterX, CenterY, FinalConfig);
+}
+
 void Eye::Draw() {
 	Update();
-	EyeDrawer::Draw(CenterX, CenterY, FinalConfig, Color);
+	Render();
 }
 
 void Eye::ApplyPreset(EyeConfig config) {
@@ -18,6 +18,7 @@ You should have received a copy of the GNU Affero General Public License along w
 #include "Animations.h"
 #include "EyeConfig.h"
 #include "EyeDrawer.h"
+#include "DirtyRegion.h"
 #include "EyeTransition.h"
 #include "EyeTransformation.h"
 #include "EyeVariation.h"
@@ -30,7 +31,6 @@ class Eye {
   protected:
     Face& _face;
 
-    void Update();
     void ChainOperators();
 
   public:
@@ -40,6 +40,9 @@ class Eye {
     uint16_t CenterY;
     uint16_t Color = 0xFFFF;
     bool IsMirrored = false;
+    // Blend the edges towards Background (colour screens only)
+    bool AntiAlias = false;
+    uint16_t Background = 0x0000;
 
     EyeConfig Config;
     EyeConfig* FinalConfig;
@@ -50,8 +53,17 @@ class Eye {
     EyeVariation Variation2;
     EyeBlink BlinkTransformation;
 
+    // Rows of the last rasterized frame, reused while the eye does not change
+    EyeSpans Spans;
+
     void ApplyPreset(EyeConfig preset);
     void TransitionTo(EyeConfig preset);
+    // Advance the animation chain by one frame
+    void Update();
+    // Draw the current frame without advancing the animation (may be called once per dirty region)
+    void Render();
+    // Screen area covered by Render()
+    DirtyRect Bounds();
     void Draw();
 };
 
@@ -0,0 +1,269 @@
+/***************************************************
+Copyright (c) 2023 Alastair Aitchison, Playful Technology, (c) 2020 Luis Llamas
+(www.luisllamas.es)
+
+This program is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License as published by
+the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License along with this program.  If not, see <http://www.gnu.org/licenses
+****************************************************/
+
+#include "EyeDrawer.h"
+
+namespace {
+
+struct EllipseTableEntry {
+  int16_t radius = 0;   // 0: unused
+  uint8_t age = 0;
+  uint16_t width[EYE_SPAN_MAX_RADIUS];
+};
+
+EllipseTableEntry ellipse_tables[EYE_SPAN_TABLES];
+
+// Spans for EyeDrawer::Draw(), which has no per-eye buffer to keep them in
+EyeSpans scratch_spans;
+
+// Blend two RGB565 colours, alpha is 0 (background) to EYE_SPAN_ONE (foreground)
+uint16_t Blend565(uint16_t fg, uint16_t bg, uint16_t alpha) {
+  uint16_t inv = EYE_SPAN_ONE - alpha;
+  uint16_t r = (((fg >> 11) & 0x1F) * alpha + ((bg >> 11) & 0x1F) * inv) >> EYE_SPAN_FRAC_BITS;
+  uint16_t g = (((fg >> 5) & 0x3F) * alpha + ((bg >> 5) & 0x3F) * inv) >> EYE_SPAN_FRAC_BITS;
+  uint16_t b = ((fg & 0x1F) * alpha + (bg & 0x1F) * inv) >> EYE_SPAN_FRAC_BITS;
+  return (r << 11) | (g << 5) | b;
+}
+
+}
+
+void EyeDrawer::Draw(int16_t centerX, int16_t centerY, EyeConfig *config, int16_t color) {
+  scratch_spans.Valid = false;
+  Rasterize(centerX, centerY, config, &scratch_spans);
+  Fill(&scratch_spans, color);
+}
+
+bool EyeDrawer::Rasterize(int16_t centerX, int16_t centerY, EyeConfig *config, EyeSpans *spans) {
+  // Amount by which corners will be shifted up/down based on requested "slope"
+  int32_t delta_y_top = config->Height * config->Slope_Top / 2.0;
+  int32_t delta_y_bottom = config->Height * config->Slope_Bottom / 2.0;
+  // Full extent of the eye, after accounting for slope added at top and bottom
+  auto totalHeight = config->Height + delta_y_top - delta_y_bottom;
+  // If the requested top/bottom radius would exceed the height of the eye, adjust them downwards
+  if (config->Radius_Bottom > 0 && config->Radius_Top > 0 && totalHeight - 1 < config->Radius_Bottom + config->Radius_Top) {
+    int32_t corrected_radius_top = (float)config->Radius_Top * (totalHeight - 1) / (config->Radius_Bottom + config->Radius_Top);
+    int32_t corrected_radius_bottom = (float)config->Radius_Bottom * (totalHeight - 1) / (config->Radius_Bottom + config->Radius_Top);
+    config->Radius_Top = corrected_radius_top;
+    config->Radius_Bottom = corrected_radius_bottom;
+  }
+
+  if (spans->Valid && spans->CenterX == centerX && spans->CenterY == centerY
+      && memcmp(&spans->Config, config, sizeof(EyeConfig)) == 0) {
+    return false;
+  }
+  spans->Valid = true;
+  spans->CenterX = centerX;
+  spans->CenterY = centerY;
+  spans->Config = *config;
+
+  int32_t radius_top = max((int32_t)config->Radius_Top, (int32_t)0);
+  int32_t radius_bottom = max((int32_t)config->Radius_Bottom, (int32_t)0);
+
+  // Calculate _inside_ corners of eye (TL, TR, BL, and BR) before any slope or rounded corners are applied
+  int32_t TLc_y = centerY + config->OffsetY - config->Height/2 + radius_top - delta_y_top;
+  int32_t TLc_x = centerX + config->OffsetX - config->Width/2 + radius_top;
+  int32_t TRc_y = centerY + config->OffsetY - config->Height/2 + radius_top + delta_y_top;
+  int32_t TRc_x = centerX + config->OffsetX + config->Width/2 - radius_top;
+  int32_t BLc_y = centerY + config->OffsetY + config->Height/2 - radius_bottom - delta_y_bottom;
+  int32_t BLc_x = centerX + config->OffsetX - config->Width/2 + radius_bottom;
+  int32_t BRc_y = centerY + config->OffsetY + config->Height/2 - radius_bottom + delta_y_bottom;
+  int32_t BRc_x = centerX + config->OffsetX + config->Width/2 - radius_bottom;
+
+  // Calculate interior extents
+  int32_t min_c_x = min(TLc_x, BLc_x);
+  int32_t max_c_x = max(TRc_x, BRc_x);
+  int32_t min_c_y = min(TLc_y, TRc_y);
+  int32_t max_c_y = max(BLc_y, BRc_y);
+
+  // Rows covered by any of the shapes below, the corners reach one row past their centre
+  int32_t top = min(min_c_y - radius_top, min(BLc_y, BRc_y) - 1);
+  int32_t bottom = max(max_c_y + radius_bottom, max(TLc_y, TRc_y) + 1);
+  spans->Top = top;
+  spans->Rows = constrain(bottom - top, (int32_t)0, (int32_t)EYE_SPAN_MAX_ROWS);
+  for (uint16_t i = 0; i < spans->Rows; i++) {
+    spans->Left[i] = INT16_MAX;
+    spans->Right[i] = INT16_MIN;
+  }
+
+  // Fill eye centre
+  SpanRectangle(spans, min_c_x, min_c_y, max_c_x, max_c_y);
+
+  // Fill eye outwards to meet edges of rounded corners
+  SpanRectangle(spans, TRc_x, TRc_y, BRc_x + radius_bottom, BRc_y); // Right
+  SpanRectangle(spans, TLc_x - radius_top, TLc_y, BLc_x, BLc_y); // Left
+  SpanRectangle(spans, TLc_x, TLc_y - radius_top, TRc_x, TRc_y); // Top
+  SpanRectangle(spans, BLc_x, BLc_y, BRc_x, BRc_y + radius_bottom); // Bottom
+
+  // Slanted edges at top of bottom of eyes: the first triangle cuts the corner
+  // of the rectangles above, the second fills the other half of the slope
+  // +ve Slope_Top means eyes slope downwards towards middle of face
+  if (config->Slope_Top > 0) {
+    SpanRectangularTriangle(spans, TLc_x, TLc_y-radius_top, TRc_x, TRc_y-radius_top, true);
+    SpanRectangularTriangle(spans, TRc_x, TRc_y-radius_top, TLc_x, TLc_y-radius_top, false);
+  }
+  else if (config->Slope_Top < 0) {
+    SpanRectangularTriangle(spans, TRc_x, TRc_y-radius_top, TLc_x, TLc_y-radius_top, true);
+    SpanRectangularTriangle(spans, TLc_x, TLc_y-radius_top, TRc_x, TRc_y-radius_top, false);
+  }
+  // Slanted edges at bottom of eyes
+  if (config->Slope_Bottom > 0) {
+    SpanRectangularTriangle(spans, BRc_x+radius_bottom, BRc_y+radius_bottom, BLc_x-radius_bottom, BLc_y+radius_bottom, true);
+    SpanRectangularTriangle(spans, BLc_x-radius_bottom, BLc_y+radius_bottom, BRc_x+radius_bottom, BRc_y+radius_bottom, false);
+  }
+  else if (config->Slope_Bottom < 0) {
+    SpanRectangularTriangle(spans, BLc_x-radius_bottom, BLc_y+radius_bottom, BRc_x+radius_bottom, BRc_y+radius_bottom, true);
+    SpanRectangularTriangle(spans, BRc_x+radius_bottom, BRc_y+radius_bottom, BLc_x-radius_bottom, BLc_y+radius_bottom, false);
+  }
+
+  // Corners (which extend "outwards" towards corner of screen from supplied coordinate values)
+  if (radius_top >= 2) {
+    SpanEllipseCorner(spans, T_L, TLc_x, TLc_y, radius_top);
+    SpanEllipseCorner(spans, T_R, TRc_x, TRc_y, radius_top);
+  }
+  if (radius_bottom >= 2) {
+    SpanEllipseCorner(spans, B_L, BLc_x, BLc_y, radius_bottom);
+    SpanEllipseCorner(spans, B_R, BRc_x, BRc_y, radius_bottom);
+  }
+  return true;
+}
+
+void EyeDrawer::Fill(const EyeSpans *spans, uint16_t color, bool antiAlias, uint16_t background) {
+#if SCREEN_TYPE == 1
+  antiAlias = false;  // monochrome, a pixel is either on or off
+#endif
+  uint16_t old_color = u8g2->getDrawColor();
+  u8g2->setDrawColor(color);
+
+  for (uint16_t i = 0; i < spans->Rows; i++) {
+    int32_t left = spans->Left[i];
+    int32_t right = spans->Right[i];
+    if (right <= left) continue;
+    int16_t y = spans->Top + i;
+
+    if (!antiAlias) {
+      // Pixels whose centre is inside the span
+      int32_t x0 = (left + EYE_SPAN_ONE / 2) >> EYE_SPAN_FRAC_BITS;
+      int32_t x1 = (right + EYE_SPAN_ONE / 2) >> EYE_SPAN_FRAC_BITS;
+      if (x1 > x0) u8g2->drawHLine(x0, y, x1 - x0);
+      continue;
+    }
+
+    // Fully covered pixels get the colour, the pixel at each end is blended by its coverage
+    int32_t x0 = left >> EYE_SPAN_FRAC_BITS;
+    int32_t x1 = right >> EYE_SPAN_FRAC_BITS;
+    if (x0 == x1) {
+      u8g2->setDrawColor(Blend565(color, background, right - left));
+      u8g2->drawHLine(x0, y, 1);
+      u8g2->setDrawColor(color);
+      continue;
+    }
+    uint16_t cover_left = EYE_SPAN_ONE - (left & (EYE_SPAN_ONE - 1));
+    uint16_t cover_right = right & (EYE_SPAN_ONE - 1);
+    if (cover_left < EYE_SPAN_ONE) {
+      u8g2->setDrawColor(Blend565(color, background, cover_left));
+      u8g2->drawHLine(x0, y, 1);
+      u8g2->setDrawColor(color);
+      x0++;
+    }
+    if (x1 > x0) u8g2->drawHLine(x0, y, x1 - x0);
+    if (cover_right > 0) {
+      u8g2->setDrawColor(Blend565(color, background, cover_right));
+      u8g2->drawHLine(x1, y, 1);
+      u8g2->setDrawColor(color);
+    }
+  }
+
+  // Restore old color
+  u8g2->setDrawColor(old_color);
+}
+
+void EyeDrawer::AddSpan(EyeSpans *spans, int32_t y, int32_t left, int32_t right) {
+  int32_t i = y - spans->Top;
+  if (i < 0 || i >= spans->Rows) return;
+  spans->Left[i] = min((int32_t)spans->Left[i], constrain(left, (int32_t)INT16_MIN, (int32_t)INT16_MAX));
+  spans->Right[i] = max((int32_t)spans->Right[i], constrain(right, (int32_t)INT16_MIN, (int32_t)INT16_MAX));
+}
+
+void EyeDrawer::SpanRectangle(EyeSpans *spans, int32_t x0, int32_t y0, int32_t x1, int32_t y1) {
+  // Always from TL->BR
+  int32_t l = min(x0, x1) << EYE_SPAN_FRAC_BITS;
+  int32_t r = max(x0, x1) << EYE_SPAN_FRAC_BITS;
+  int32_t t = min(y0, y1);
+  int32_t b = max(y0, y1);
+  for (int32_t y = t; y < b; y++) {
+    AddSpan(spans, y, l, r);
+  }
+}
+
+void EyeDrawer::SpanRectangularTriangle(EyeSpans *spans, int32_t x0, int32_t y0, int32_t x1, int32_t y1, bool erase) {
+  if (y0 == y1) return;
+  int32_t t = min(y0, y1);
+  int32_t b = max(y0, y1);
+  int32_t edge = x1 << EYE_SPAN_FRAC_BITS;
+  for (int32_t y = t; y < b; y++) {
+    // Hypotenuse at the centre of the row
+    int32_t num = (x1 - x0) * ((2 * (y - y0) + 1) << EYE_SPAN_FRAC_BITS);
+    int32_t hyp = (x0 << EYE_SPAN_FRAC_BITS) + num / (2 * (y1 - y0));
+    if (!erase) {
+      AddSpan(spans, y, min(hyp, edge), max(hyp, edge));
+      continue;
+    }
+    int32_t i = y - spans->Top;
+    if (i < 0 || i >= spans->Rows) continue;
+    // The triangle lies on the side of its vertical edge x1, cut that end of the row back
+    if (x1 > x0) spans->Right[i] = min((int32_t)spans->Right[i], hyp);
+    else spans->Left[i] = max((int32_t)spans->Left[i], hyp);
+  }
+}
+
+void EyeDrawer::SpanEllipseCorner(EyeSpans *spans, CornerType corner, int32_t x0, int32_t y0, int32_t r) {
+  r = min(r, (int32_t)EYE_SPAN_MAX_RADIUS);
+  const uint16_t *width = EllipseTable(r);
+  int32_t x = x0 << EYE_SPAN_FRAC_BITS;
+  bool right = corner == T_R || corner == B_R;
+
+  // Row k away from the centre line uses the half-width at its middle; the
+  // row next to the inside corner is filled to the full radius
+  for (int32_t k = 0; k <= r; k++) {
+    int32_t w = k == 0 ? r << EYE_SPAN_FRAC_BITS : width[k - 1];
+    int32_t y = (corner == T_R || corner == T_L) ? y0 - k : y0 + k - 1;
+    if (right) AddSpan(spans, y, x, x + w);
+    else AddSpan(spans, y, x - w, x);
+  }
+}
+
+const uint16_t *EyeDrawer::EllipseTable(int32_t r) {
+  EllipseTableEntry *oldest = &ellipse_tables[0];
+  EllipseTableEntry *found = nullptr;
+  for (uint8_t i = 0; i < EYE_SPAN_TABLES; i++) {
+    EllipseTableEntry *entry = &ellipse_tables[i];
+    if (entry->radius == r) {
+      found = entry;
+    } else if (entry->age < UINT8_MAX) {
+      entry->age++;
+    }
+    if (entry->age > oldest->age) oldest = entry;
+  }
+  if (found != nullptr) {
+    found->age = 0;
+    return found->width;
+  }
+
+  // Half-width at the middle of row j below the centre: r * sqrt(1 - ((j + 0.5) / r)^2)
+  oldest->radius = r;
+  oldest->age = 0;
+  for (int32_t j = 0; j < r; j++) {
+    float d = (j + 0.5f) / r;
+    oldest->width[j] = r * sqrtf(1.0f - d * d) * EYE_SPAN_ONE + 0.5f;
+  }
+  return oldest->width;
+}
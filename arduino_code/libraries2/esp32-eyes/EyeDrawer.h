@@ -16,195 +16,77 @@ You should have received a copy of the GNU Affero General Public License along w
 #include <Arduino.h>
 #include "Common.h"
 #include "EyeConfig.h"
+#include "DirtyRegion.h"
 
 enum CornerType {T_R, T_L, B_L, B_R};
 
+#define EYE_SPAN_MAX_ROWS 256     // taller eyes are cut off at the bottom
+#define EYE_SPAN_MAX_RADIUS 128   // larger corner radii are drawn with this radius
+#define EYE_SPAN_TABLES 4         // ellipse span tables kept between frames
+#define EYE_SPAN_FRAC_BITS 4      // spans are stored in 12.4 fixed point
+#define EYE_SPAN_ONE (1 << EYE_SPAN_FRAC_BITS)
+
+/**
+ * Horizontal extent of an eye on every row it covers, in 12.4 fixed point.
+ * Kept between frames together with the input it was built from, so an eye that
+ * did not change (or is drawn again for the next band) is not rasterized again.
+ */
+struct EyeSpans {
+  bool Valid = false;
+  int16_t CenterX = 0;
+  int16_t CenterY = 0;
+  EyeConfig Config = {};
+
+  int16_t Top = 0;                  // screen row of Left[0] / Right[0]
+  uint16_t Rows = 0;
+  int16_t Left[EYE_SPAN_MAX_ROWS];  // first covered position
+  int16_t Right[EYE_SPAN_MAX_ROWS]; // end of the covered range, empty row if Right <= Left
+};
+
 /**
  * Contains all functions to draw eye based on supplied (expression-based) config
+ *
+ * The eye is built as one span per row from rectangles, sloped edges and elliptic
+ * corners, then filled with one horizontal line per row. Optionally the partially
+ * covered pixel at each end of a span is blended towards the background colour.
  */
 class EyeDrawer {
   public:
-    static void Draw(int16_t centerX, int16_t centerY, EyeConfig *config, int16_t color) {
-      // Amount by which corners will be shifted up/down based on requested "slope"
-      int32_t delta_y_top = config->Height * config->Slope_Top / 2.0;
-      int32_t delta_y_bottom = config->Height * config->Slope_Bottom / 2.0;
-      // Full extent of the eye, after accounting for slope added at top and bottom
-      auto totalHeight = config->Height + delta_y_top - delta_y_bottom;
-      // If the requested top/bottom radius would exceed the height of the eye, adjust them downwards 
-      if (config->Radius_Bottom > 0 && config->Radius_Top > 0 && totalHeight - 1 < config->Radius_Bottom + config->Radius_Top) {
-        int32_t corrected_radius_top = (float)config->Radius_Top * (totalHeight - 1) / (config->Radius_Bottom + config->Radius_Top);
-        int32_t corrected_radius_bottom = (float)config->Radius_Bottom * (totalHeight - 1) / (config->Radius_Bottom + config->Radius_Top);
-        config->Radius_Top = corrected_radius_top;
-        config->Radius_Bottom = corrected_radius_bottom;
-      }
-
-      // Calculate _inside_ corners of eye (TL, TR, BL, and BR) before any slope or rounded corners are applied
-      int32_t TLc_y = centerY + config->OffsetY - config->Height/2 + config->Radius_Top - delta_y_top;
-      int32_t TLc_x = centerX + config->OffsetX - config->Width/2 + config->Radius_Top;
-      int32_t TRc_y = centerY + config->OffsetY - config->Height/2 + config->Radius_Top + delta_y_top;
-      int32_t TRc_x = centerX + config->OffsetX + config->Width/2 - config->Radius_Top;
-      int32_t BLc_y = centerY + config->OffsetY + config->Height/2 - config->Radius_Bottom - delta_y_bottom;
-      int32_t BLc_x = centerX + config->OffsetX - config->Width/2 + config->Radius_Bottom;
-      int32_t BRc_y = centerY + config->OffsetY + config->Height/2 - config->Radius_Bottom + delta_y_bottom;
-      int32_t BRc_x = centerX + config->OffsetX + config->Width/2 - config->Radius_Bottom;
-        
-      // Calculate interior extents
-      int32_t min_c_x = min(TLc_x, BLc_x);
-      int32_t max_c_x = max(TRc_x, BRc_x);
-      int32_t min_c_y = min(TLc_y, TRc_y);
-      int32_t max_c_y = max(BLc_y, BRc_y);
-
-      uint16_t old_color = u8g2->getDrawColor();
-      u8g2->setDrawColor(color);
-      // Fill eye centre
-      EyeDrawer::FillRectangle(min_c_x, min_c_y, max_c_x, max_c_y);
-
-      // Fill eye outwards to meet edges of rounded corners 
-      EyeDrawer::FillRectangle(TRc_x, TRc_y, BRc_x + config->Radius_Bottom, BRc_y); // Right 
-		  EyeDrawer::FillRectangle(TLc_x - config->Radius_Top, TLc_y, BLc_x, BLc_y); // Left
-		  EyeDrawer::FillRectangle(TLc_x, TLc_y - config->Radius_Top, TRc_x, TRc_y); // Top
-		  EyeDrawer::FillRectangle(BLc_x, BLc_y, BRc_x, BRc_y + config->Radius_Bottom); // Bottom
-        
-      // Draw slanted edges at top of bottom of eyes 
-      // +ve Slope_Top means eyes slope downwards towards middle of face
-      if(config->Slope_Top > 0) {
-        EyeDrawer::FillRectangularTriangle(TLc_x, TLc_y-config->Radius_Top, TRc_x, TRc_y-config->Radius_Top);
-        EyeDrawer::FillRectangularTriangle(TRc_x, TRc_y-config->Radius_Top, TLc_x, TLc_y-config->Radius_Top);
-      } 
-      else if(config->Slope_Top < 0) {
-        EyeDrawer::FillRectangularTriangle(TRc_x, TRc_y-config->Radius_Top, TLc_x, TLc_y-config->Radius_Top);
-        EyeDrawer::FillRectangularTriangle(TLc_x, TLc_y-config->Radius_Top, TRc_x, TRc_y-config->Radius_Top);
-      }
-      // Draw slanted edges at bottom of eyes
-      if(config->Slope_Bottom > 0) {
-        EyeDrawer::FillRectangularTriangle(BRc_x+config->Radius_Bottom, BRc_y+config->Radius_Bottom, BLc_x-config->Radius_Bottom, BLc_y+config->Radius_Bottom);
-        EyeDrawer::FillRectangularTriangle(BLc_x-config->Radius_Bottom, BLc_y+config->Radius_Bottom, BRc_x+config->Radius_Bottom, BRc_y+config->Radius_Bottom);
-      }
-      else if (config->Slope_Bottom < 0) {
-        EyeDrawer::FillRectangularTriangle(BLc_x-config->Radius_Bottom, BLc_y+config->Radius_Bottom, BRc_x+config->Radius_Bottom, BRc_y+config->Radius_Bottom);
-        EyeDrawer::FillRectangularTriangle(BRc_x+config->Radius_Bottom, BRc_y+config->Radius_Bottom, BLc_x-config->Radius_Bottom, BLc_y+config->Radius_Bottom);
-      }
-
-      // Draw corners (which extend "outwards" towards corner of screen from supplied coordinate values)
-      if(config->Radius_Top > 0) {
-        EyeDrawer::FillEllipseCorner(T_L, TLc_x, TLc_y, config->Radius_Top, config->Radius_Top);
-        EyeDrawer::FillEllipseCorner(T_R, TRc_x, TRc_y, config->Radius_Top, config->Radius_Top);
-      }
-      if(config->Radius_Bottom > 0) {
-        EyeDrawer::FillEllipseCorner(B_L, BLc_x, BLc_y, config->Radius_Bottom, config->Radius_Bottom);
-        EyeDrawer::FillEllipseCorner(B_R, BRc_x, BRc_y, config->Radius_Bottom, config->Radius_Bottom);
-      }
-      // Restore old color
-      u8g2->setDrawColor(old_color);
+    // Rasterize into a shared buffer and fill, for callers that do not keep spans
+    static void Draw(int16_t centerX, int16_t centerY, EyeConfig *config, int16_t color);
+
+    // Build the spans of an eye, returns false if they are unchanged from the last call
+    static bool Rasterize(int16_t centerX, int16_t centerY, EyeConfig *config, EyeSpans *spans);
+
+    // Fill the spans; antiAlias only has an effect on colour (TFT) screens
+    static void Fill(const EyeSpans *spans, uint16_t color, bool antiAlias = false, uint16_t background = 0);
+
+    // Bounding box of everything Draw() paints for the same config, with a small margin for rounding
+    static DirtyRect Bounds(int16_t centerX, int16_t centerY, const EyeConfig *config) {
+      int32_t delta_y_top = abs((int32_t)(config->Height * config->Slope_Top / 2.0));
+      int32_t delta_y_bottom = abs((int32_t)(config->Height * config->Slope_Bottom / 2.0));
+      int32_t left = centerX + config->OffsetX - config->Width/2 - 2;
+      int32_t right = centerX + config->OffsetX + config->Width/2 + 2;
+      int32_t top = centerY + config->OffsetY - config->Height/2 - delta_y_top - 2;
+      int32_t bottom = centerY + config->OffsetY + config->Height/2 + delta_y_bottom + 2;
+      return DirtyRect(left, top, right - left, bottom - top);
     }
 
-    // Draw rounded corners
-    static void FillEllipseCorner(CornerType corner, int16_t x0, int16_t y0, int32_t rx, int32_t ry) {
-      if (rx < 2) return;
-      if (ry < 2) return;
-      int32_t x, y;
-      int32_t rx2 = rx * rx;
-      int32_t ry2 = ry * ry;
-      int32_t fx2 = 4 * rx2;
-      int32_t fy2 = 4 * ry2;
-      int32_t s;
-
-      if (corner == T_R) {
-        for(x = 0, y = ry, s = 2 * ry2 + rx2 * (1 - 2 * ry); ry2 * x <= rx2 * y; x++) {
-          u8g2->drawHLine(x0, y0 - y, x);
-          if(s >= 0) {
-            s += fx2 * (1 - y);
-            y--;
-          }
-          s += ry2 * ((4 * x) + 6);
-        }         
-        for(x = rx, y = 0, s = 2 * rx2 + ry2 * (1 - 2 * rx); rx2 * y <= ry2 * x; y++) {
-          u8g2->drawHLine(x0, y0 - y, x);
-          if (s >= 0) {
-            s += fy2 * (1 - x);
-            x--;
-          }
-          s += rx2 * ((4 * y) + 6);
-        }
-      }
-
-      else if (corner == B_R) {
-        for (x = 0, y = ry, s = 2 * ry2 + rx2 * (1 - 2 * ry); ry2 * x <= rx2 * y; x++) {
-          u8g2->drawHLine(x0, y0 + y -1, x);
-          if (s >= 0) {
-            s += fx2 * (1 - y);
-            y--;
-          }
-          s += ry2 * ((4 * x) + 6);
-        }
-        for (x = rx, y = 0, s = 2 * rx2 + ry2 * (1 - 2 * rx); rx2 * y <= ry2 * x; y++) {
-          u8g2->drawHLine(x0, y0 + y -1, x);
-          if (s >= 0) {
-            s += fy2 * (1 - x);
-            x--;
-          }
-          s += rx2 * ((4 * y) + 6);
-        }
-      }
-
-      else if (corner == T_L) {
-        for (x = 0, y = ry, s = 2 * ry2 + rx2 * (1 - 2 * ry); ry2 * x <= rx2 * y; x++) {
-          u8g2->drawHLine(x0-x, y0 - y, x);
-          if (s >= 0) {
-            s += fx2 * (1 - y);
-            y--;
-          }
-          s += ry2 * ((4 * x) + 6);
-        }
-        for (x = rx, y = 0, s = 2 * rx2 + ry2 * (1 - 2 * rx); rx2 * y <= ry2 * x; y++) {
-          u8g2->drawHLine(x0-x, y0 - y, x);
-          if (s >= 0) {
-            s += fy2 * (1 - x);
-            x--;
-          }
-          s += rx2 * ((4 * y) + 6);
-        }
-      }
-
-      else if (corner == B_L) {
-        for (x = 0, y = ry, s = 2 * ry2 + rx2 * (1 - 2 * ry); ry2 * x <= rx2 * y; x++) {
-          u8g2->drawHLine(x0-x, y0 + y - 1, x);
-          if (s >= 0) {
-            s += fx2 * (1 - y);
-            y--;
-          }
-          s += ry2 * ((4 * x) + 6);
-        }
-        for (x = rx, y = 0, s = 2 * rx2 + ry2 * (1 - 2 * rx); rx2 * y <= ry2 * x; y++) {
-          u8g2->drawHLine(x0-x, y0 + y , x);
-          if (s >= 0) {
-            s += fy2 * (1 - x);
-            x--;
-          }
-          s += rx2 * ((4 * y) + 6);
-        }
-      }
-    }
+  private:
+    // Widen the span of row y to include [left, right), positions in 12.4 fixed point
+    static void AddSpan(EyeSpans *spans, int32_t y, int32_t left, int32_t right);
 
-    // Fill a solid rectangle between specified coordinates
-    static void FillRectangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1) {
-      // Always draw from TL->BR
-      int32_t l = min(x0, x1);
-      int32_t r = max(x0, x1);
-      int32_t t = min(y0, y1);
-      int32_t b = max(y0, y1);
-      int32_t w = r-l;
-      int32_t h = b-t; 
-      u8g2->drawBox(l, t, w, h);
-    }
+    // Solid rectangle between specified coordinates
+    static void SpanRectangle(EyeSpans *spans, int32_t x0, int32_t y0, int32_t x1, int32_t y1);
 
-    static void FillRectangularTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1) {
-      u8g2->drawTriangle(x0, y0, x1, y1, x1, y0);
-    }
+    // Right-angled triangle (x0,y0), (x1,y1), (x1,y0); erase cuts the rows back to its hypotenuse instead
+    static void SpanRectangularTriangle(EyeSpans *spans, int32_t x0, int32_t y0, int32_t x1, int32_t y1, bool erase);
 
-    static void FillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2) {
-        u8g2->drawTriangle(x0, y0, x1, y1, x2, y2);
-    }
+    // Rounded corner, extending "outwards" from the inside corner (x0,y0)
+    static void SpanEllipseCorner(EyeSpans *spans, CornerType corner, int32_t x0, int32_t y0, int32_t r);
+
+    // Half-widths of a circle of radius r at the centre of each row, cached per radius
+    static const uint16_t *EllipseTable(int32_t r);
 };
 
 #endif
\ No newline at end of file
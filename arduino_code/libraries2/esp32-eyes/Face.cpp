@@ -17,12 +17,22 @@ You should have received a copy of the GNU Affero General Public License along w
 // OLED基类指针
 U8G2 *u8g2;
 
+// 字形绘制的放大倍数，图标位置和文字区域都按它缩放
+#define FACE_GLYPH_SCALE 1
+// 底部消息每帧左移的像素
+#define FACE_CHAT_STEP 4
+
 #else /******************else******************/
 
-TFT_eSPI tft = TFT_eSPI();				// tft instance
-TFT_eSprite sprite = TFT_eSprite(&tft); // 创建双缓冲区
+TFT_eSPI tft = TFT_eSPI();			 // tft instance
+TFT_eStrip strip = TFT_eStrip(&tft); // 两个行带缓冲区轮流绘制和 DMA 发送，代替整屏精灵
 // TFT基类指针
 U8g2_for_TFT_eSPI *u8g2;
+
+#define FACE_GLYPH_SCALE 2 // U8g2_for_TFT_eSPI::drawGlyph 按 2 倍绘制
+#define FACE_CHAT_STEP 10
+// 每个行带的行数，240 宽时两个行带共 19.2 KB，整屏精灵要 115 KB
+#define FACE_STRIP_LINES 20
 #endif
 
 /* eye_size:眼睛大小 *** screenType:屏幕类型 *** clock:时钟引脚 *** data:数据引脚 *** rotation:旋转角度 *** txt_color:文字颜色 *** bg_color:背景颜色 *** eye_color:眼睛颜色 ***/
@@ -49,11 +59,22 @@ Face::Face(uint8_t eye_size, const String &screenType, uint8_t clock, uint8_t da
 	width_ = tft.width();
 	height_ = tft.height();
 
-	sprite.createSprite(width_, height_); // 创建双缓冲区
-	u8g2 = new U8g2_for_TFT_eSPI();		  // create u8g2 procedures
-	u8g2->begin(sprite);				  // connect u8g2 procedures to TFT_eSPI
+	// 一个行带发送时 CPU 绘制下一个行带；DMA 不可用时行带改为阻塞发送
+	tft.initDMA();
+	if (!strip.createStrip(width_, FACE_STRIP_LINES))
+	{
+		Serial.println("[Face] 行带缓冲区申请失败，屏幕不会刷新");
+	}
+	u8g2 = new U8g2_for_TFT_eSPI(); // create u8g2 procedures
+	u8g2->begin(strip);				// connect u8g2 procedures to TFT_eSPI
 	u8g2->setBackgroundColor(bg_color);
+	// 中文字形解码后缓存，每帧重绘聊天文字时不再重复解码
+	if (!u8g2->enableGlyphCache())
+	{
+		Serial.println("[Face] 字形缓存申请失败，文字逐帧解码");
+	}
 #endif
+	chat_x_ = width_ / 4; // 文字初始位置在屏幕中间靠左一点
 	u8g2->setFontMode(0);		   // use u8g2 transparent mode
 	u8g2->setFontDirection(0);	   // left to right (this is default)
 	u8g2->setDrawColor(txt_color); // apply color to u8g2 procedures
@@ -91,6 +112,9 @@ Face::~Face()
 {
 	delete u8g2;
 	u8g2 = NULL;
+#if SCREEN_TYPE != 1
+	strip.deleteStrip();
+#endif
 	chat_message_ = "";
 	notification_message_ = "";
 }
@@ -247,47 +271,35 @@ void Face::SetVolume(uint8_t volume)
 	volume_ = volume;
 }
 
-// 显示底部消息，从右至左滚动显示
-static void ShowNotificationAtBottom(String &message, uint16_t txt_color, int width, int height)
+void Face::SetAntiAlias(bool anti_alias)
 {
-	static int text_x_position = width / 4; // 文字初始位置在屏幕中间靠左一点
-	static int text_length = 0;
+#if SCREEN_TYPE == 0
+	// 边缘像素按覆盖率与背景色混合，单色 OLED 无效
+	LeftEye.AntiAlias = anti_alias;
+	LeftEye.Background = bg_color_;
+	RightEye.AntiAlias = anti_alias;
+	RightEye.Background = bg_color_;
+#endif
+}
 
+// 显示底部消息，从右至左滚动显示；滚动位置由 Face::Update 推进
+static void DrawChatMessage(const String &message, int x, uint16_t txt_color, int height)
+{
 	u8g2->setFont(u8g2_font_wqy12_t_gb2312); // select u8g2 font from here: https://github.com/olikraus/u8g2/wiki/fntlistall
-	// 计算文字的总长度，区分字符和中文
-	text_length = calculateTextWidth(message); // 获取文字宽度
-
-	// 如果文字已经完全滚出屏幕，则重置位置
-	if (text_x_position <= -text_length)
-	{
-		text_x_position = width / 4;
-		text_length = 0; // 重置长度，以便下次计算
-		message.clear();
-	}
-
-	// 绘制文字
-	u8g2->setDrawColor(txt_color);				  // 应用颜色到u8g2过程
-	u8g2->setCursor(text_x_position, height - 1); // start writing at this position
+	u8g2->setDrawColor(txt_color);			 // 应用颜色到u8g2过程
+	u8g2->setCursor(x, height - 1);			 // start writing at this position
 	u8g2->print(message.c_str());
-
-	// 每次调用该函数时，更新文字的位置
-#if SCREEN_TYPE == 1
-	text_x_position -= 4; // 每次调用函数时，文字向左移动4个像素
-#else					  /******************else******************/
-	text_x_position -= 10; // 每次调用函数时，文字向左移动12个像素
-#endif
 }
 
-// 绘制左上角wifi状态图标
-static void ShowWifiStatus(int width)
+// 右上角状态图标的横坐标，距右边缘的距离按屏幕放大
+static int IconX(int width, int slot)
 {
-#if SCREEN_TYPE == 1
-	uint8_t proportion = 1;
-#else /******************else******************/
-	int8_t proportion = 2;
-#endif
+	return width - slot * FACE_GLYPH_SCALE;
+}
 
-	u8g2->setFont(u8g2_font_siji_t_6x10);
+// wifi状态图标
+static uint16_t WifiGlyph()
+{
 	if (WIFI_MODE_STA == WiFi.getMode())
 	{
 		if (WiFi.isConnected())
@@ -295,131 +307,287 @@ static void ShowWifiStatus(int width)
 			int rssi = WiFi.RSSI();
 			if (rssi > -50) // 强信号
 			{
-				u8g2->drawGlyph(width - 28 * proportion, 10 * proportion, 57872 + 10); // 强信号的图标
+				return 57872 + 10;
 			}
 			else if (rssi > -80) // 中等信号
 			{
-				u8g2->drawGlyph(width - 28 * proportion, 10 * proportion, 57872 + 9); // 中等信号的图标
+				return 57872 + 9;
 			}
 			else // 弱信号
 			{
-				u8g2->drawGlyph(width - 28 * proportion, 10 * proportion, 57872 + 8); // 弱信号的图标
+				return 57872 + 8;
 			}
 		}
-		else
-		{
-			u8g2->drawGlyph(width - 28 * proportion, 10 * proportion, 57872 + 11);
-		}
+		return 57872 + 11;
 	}
 	else if (WIFI_MODE_APSTA == WiFi.getMode())
 	{
 		// 热点
-		u8g2->drawGlyph(width - 28 * proportion, 10 * proportion, 57520 + 3);
+		return 57520 + 3;
 	}
-	else
+	// 无状态
+	return 57872 + 15;
+}
+
+static uint16_t BatGlyph(uint8_t bat_level)
+{
+	if (0xFF == bat_level)
 	{
-		// 无状态
-		u8g2->drawGlyph(width - 28 * proportion, 10 * proportion, 57872 + 15);
+		return 57904 + 9;
 	}
+	return 57922 + map(bat_level, 0, 100, 0, 9);
 }
 
-static void ShowBatStatus(int width, uint8_t bat_level)
+static uint16_t VolumeGlyph(uint8_t volume)
+{
+	if (5 > volume) // 静音图标
+	{
+		return 57424 + 2;
+	}
+	return 57568 + map(volume, 5, 100, 3, 0);
+}
+
+static void DrawIcon(int x, uint16_t glyph, uint16_t txt_color)
 {
-#if SCREEN_TYPE == 1
-	uint8_t proportion = 1;
-#else /******************else******************/
-	int8_t proportion = 2;
-#endif
 	u8g2->setFont(u8g2_font_siji_t_6x10);
+	u8g2->setDrawColor(txt_color);
+	u8g2->drawGlyph(x, 10 * FACE_GLYPH_SCALE, glyph);
+}
 
-	if (0xFF == bat_level)
+// 以 baseline 为基线、从 x 开始的一行字形占用的区域，需先设置好字体。
+// 字形按 FACE_GLYPH_SCALE 放大后向基线上方延伸，基线下方只有字体的下沉部分，各留一点余量
+static DirtyRect GlyphBounds(int x, int baseline, int glyph_width)
+{
+	int char_height = u8g2->getMaxCharHeight();
+	int top = baseline - char_height * FACE_GLYPH_SCALE - 2;
+	int bottom = baseline + char_height / 2 + 2;
+	return DirtyRect(x - 2, top, glyph_width * FACE_GLYPH_SCALE + 4, bottom - top);
+}
+
+// 宽度取 u8g2 实测和 calculateTextWidth 估算中较大的一个
+static DirtyRect TextBounds(int x, int baseline, const String &text)
+{
+	if (text.length() == 0)
 	{
-		u8g2->drawGlyph(width - 12 * proportion, 10 * proportion, 57904 + 9);
+		return DirtyRect();
 	}
-	else
+	return GlyphBounds(x, baseline, max((int)u8g2->getUTF8Width(text.c_str()), calculateTextWidth(text)));
+}
+
+static DirtyRect IconBounds(int x)
+{
+	return GlyphBounds(x, 10 * FACE_GLYPH_SCALE, u8g2->getMaxCharWidth());
+}
+
+// FNV-1a，用作部件内容的签名
+static uint32_t Signature(const void *data, size_t len, uint32_t hash = 2166136261u)
+{
+	const uint8_t *p = (const uint8_t *)data;
+	for (size_t i = 0; i < len; i++)
 	{
-		u8g2->drawGlyph(width - 12 * proportion, 10 * proportion, 57922 + map(bat_level, 0, 100, 0, 9));
+		hash = (hash ^ p[i]) * 16777619u;
 	}
+	return hash;
 }
 
-static void ShowVolume(int width, uint8_t volume)
+static uint32_t EyeSignature(Eye &eye)
 {
-#if SCREEN_TYPE == 1
-	uint8_t proportion = 1;
-#else /******************else******************/
-	int8_t proportion = 2;
-#endif
-	u8g2->setFont(u8g2_font_siji_t_6x10);
-	if (5 > volume) // 绘制静音图标
+	uint32_t hash = Signature(eye.FinalConfig, sizeof(EyeConfig));
+	hash = Signature(&eye.CenterX, sizeof(eye.CenterX), hash);
+	hash = Signature(&eye.CenterY, sizeof(eye.CenterY), hash);
+	hash = Signature(&eye.AntiAlias, sizeof(eye.AntiAlias), hash);
+	return Signature(&eye.Color, sizeof(eye.Color), hash);
+}
+
+static uint32_t TextSignature(const String &text, int x)
+{
+	return Signature(text.c_str(), text.length(), Signature(&x, sizeof(x)));
+}
+
+// 推进一帧动画：表情行为、眨眼、眼睛过渡，以及滚动消息到头后的重置
+void Face::Advance()
+{
+	if (only_show_notification_)
+	{
+		return;
+	}
+
+	if (height_ > 32)
 	{
-		u8g2->drawGlyph(width - 40 * proportion, 10 * proportion, 57424 + 2);
+		// Update behavior
+		Behavior.Update();
+		Blink.Update();
+		LeftEye.Update();
+		if (screenType_ != "096_2")
+		{
+			RightEye.Update();
+		}
 	}
-	else
+
+	if (screenType_ != "096_2" && chat_message_.length())
 	{
-		u8g2->drawGlyph(width - 40 * proportion, 10 * proportion, 57568 + map(volume, 5, 100, 3, 0));
+		u8g2->setFont(u8g2_font_wqy12_t_gb2312);
+		// 如果文字已经完全滚出屏幕，则重置位置
+		if (chat_x_ <= -calculateTextWidth(chat_message_))
+		{
+			chat_x_ = width_ / 4;
+			chat_message_.clear();
+		}
 	}
 }
 
-static void ShowEmotion(FaceBehavior &Behavior, Eye &LeftEye, Eye &RightEye, BlinkAssistant &Blink, String &screenType)
+// 计算本帧每个部件的位置和内容签名，不显示的部件区域为空
+void Face::Measure(WidgetState *state)
 {
-	// Update behavior
-	Behavior.Update();
-	Blink.Update();
-	// Draw left eye
-	LeftEye.Draw();
-	// Draw right eye
-	if (screenType != "096_2")
+	for (int i = 0; i < WIDGET_COUNT; i++)
+	{
+		state[i] = WidgetState();
+	}
+
+	u8g2->setFont(u8g2_font_wqy12_t_gb2312);
+	if (only_show_notification_)
+	{
+		int x = (width_ - calculateTextWidth(notification_message_)) / 2;
+		state[WIDGET_NOTIFICATION].bounds = TextBounds(x, height_ / 2, notification_message_).Clipped(width_, height_);
+		state[WIDGET_NOTIFICATION].key = TextSignature(notification_message_, x);
+		return;
+	}
+
+	if (height_ > 32)
+	{
+		state[WIDGET_LEFT_EYE].bounds = LeftEye.Bounds().Clipped(width_, height_);
+		state[WIDGET_LEFT_EYE].key = EyeSignature(LeftEye);
+		if (screenType_ != "096_2")
+		{
+			state[WIDGET_RIGHT_EYE].bounds = RightEye.Bounds().Clipped(width_, height_);
+			state[WIDGET_RIGHT_EYE].key = EyeSignature(RightEye);
+		}
+	}
+
+	if (screenType_ == "096_2")
 	{
-		RightEye.Draw();
+		return;
+	}
+
+	state[WIDGET_NOTIFICATION].bounds = TextBounds(0, u8g2->getMaxCharHeight() - 1, notification_message_).Clipped(width_, height_);
+	state[WIDGET_NOTIFICATION].key = TextSignature(notification_message_, 0);
+	state[WIDGET_CHAT].bounds = TextBounds(chat_x_, height_ - 1, chat_message_).Clipped(width_, height_);
+	state[WIDGET_CHAT].key = TextSignature(chat_message_, chat_x_);
+
+	u8g2->setFont(u8g2_font_siji_t_6x10);
+	state[WIDGET_WIFI].bounds = IconBounds(IconX(width_, 28)).Clipped(width_, height_);
+	state[WIDGET_WIFI].key = WifiGlyph();
+	state[WIDGET_BATTERY].bounds = IconBounds(IconX(width_, 12)).Clipped(width_, height_);
+	state[WIDGET_BATTERY].key = BatGlyph(bat_level_);
+	state[WIDGET_VOLUME].bounds = IconBounds(IconX(width_, 40)).Clipped(width_, height_);
+	state[WIDGET_VOLUME].key = VolumeGlyph(volume_);
+}
+
+void Face::DrawWidget(int widget)
+{
+	switch (widget)
+	{
+	case WIDGET_LEFT_EYE:
+		LeftEye.Render();
+		break;
+	case WIDGET_RIGHT_EYE:
+		RightEye.Render();
+		break;
+	case WIDGET_NOTIFICATION:
+		DrawNotification(notification_message_, txt_color_, width_, height_, only_show_notification_);
+		break;
+	case WIDGET_CHAT:
+		DrawChatMessage(chat_message_, chat_x_, txt_color_, height_);
+		break;
+	case WIDGET_WIFI:
+		DrawIcon(IconX(width_, 28), widgets_[widget].key, txt_color_);
+		break;
+	case WIDGET_BATTERY:
+		DrawIcon(IconX(width_, 12), widgets_[widget].key, txt_color_);
+		break;
+	case WIDGET_VOLUME:
+		DrawIcon(IconX(width_, 40), widgets_[widget].key, txt_color_);
+		break;
 	}
 }
 
 void Face::Update()
 {
+	uint32_t start = micros();
+	// 滚动消息在绘制完成后才左移，和原来每次绘制后移动的节奏一致
+	bool chat_scrolling = !only_show_notification_ && screenType_ != "096_2" && chat_message_.length();
+
+	Advance();
+	WidgetState next[WIDGET_COUNT];
+	Measure(next);
 
 #if SCREEN_TYPE == 1
+	// OLED 整屏缓冲区很小，每帧整屏重绘
+	for (int i = 0; i < WIDGET_COUNT; i++)
+	{
+		widgets_[i] = next[i];
+	}
 	u8g2->clearBuffer();
+	for (int i = 0; i < WIDGET_COUNT; i++)
+	{
+		if (!widgets_[i].bounds.Empty())
+		{
+			DrawWidget(i);
+		}
+	}
+	// 将缓冲区内容显示到屏幕上
+	u8g2->sendBuffer();
+	last_frame_.bytes = width_ * height_ / 8;
+	last_frame_.rects = 1;
 #else /******************else******************/
-	sprite.fillSprite(bg_color_);
-#endif
-	if (only_show_notification_)
+	// 位置或内容变了的部件，旧区域和新区域都要重绘
+	dirty_.Clear();
+	if (full_redraw_)
 	{
-		// 绘制通知消息
-		DrawNotification(notification_message_, txt_color_, width_, height_, only_show_notification_);
+		dirty_.Add(DirtyRect(0, 0, width_, height_));
+		full_redraw_ = false;
 	}
-	else
-	{ 
-		if (height_ > 32)
+	for (int i = 0; i < WIDGET_COUNT; i++)
+	{
+		if (next[i].bounds != widgets_[i].bounds || next[i].key != widgets_[i].key)
 		{
-			// 绘制表情
-			ShowEmotion(Behavior, LeftEye, RightEye, Blink, screenType_);
+			dirty_.Add(widgets_[i].bounds);
+			dirty_.Add(next[i].bounds);
 		}
+		widgets_[i] = next[i];
+	}
 
-		if (screenType_ != "096_2")
+	// 每个脏区域按行带绘制：先清背景，再按原来的顺序重放和行带相交的部件，
+	// 行带负责裁剪；一个行带 DMA 发送的同时绘制下一个，没有变化时什么都不发
+	for (int i = 0; i < dirty_.Count(); i++)
+	{
+		const DirtyRect &rect = dirty_.Rect(i);
+		if (!strip.startStrip(rect.x, rect.y, rect.w, rect.h))
+		{
+			continue;
+		}
+		do
 		{
-			// 绘制通知消息
-			DrawNotification(notification_message_, txt_color_, width_, height_, only_show_notification_);
-			// 绘制底部消息
-			if (chat_message_.length())
+			int32_t x, y, w, h;
+			strip.getBand(&x, &y, &w, &h);
+			DirtyRect band(x, y, w, h);
+			strip.fillSprite(bg_color_);
+			for (int widget = 0; widget < WIDGET_COUNT; widget++)
 			{
-				ShowNotificationAtBottom(chat_message_, txt_color_, width_, height_);
+				if (widgets_[widget].bounds.Intersects(band))
+				{
+					DrawWidget(widget);
+				}
 			}
-
-			// 绘制右上角wifi状态图标
-			ShowWifiStatus(width_);
-
-			// 绘制右上角电量图标
-			ShowBatStatus(width_, bat_level_);
-
-			// 绘制右上角音量图标
-			ShowVolume(width_, volume_);
-		}
+		} while (strip.nextBand());
 	}
-
-	// 将缓冲区内容显示到屏幕上
-#if SCREEN_TYPE == 1
-	u8g2->sendBuffer();
-#else /******************else******************/
-	sprite.pushSprite(0, 0);
+	last_frame_.bytes = dirty_.Area() * sizeof(uint16_t);
+	last_frame_.rects = dirty_.Count();
 #endif
+
+	if (chat_scrolling)
+	{
+		chat_x_ -= FACE_CHAT_STEP;
+	}
+	last_frame_.frame_us = micros() - start;
 }
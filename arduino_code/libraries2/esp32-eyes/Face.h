@@ -22,6 +22,7 @@ You should have received a copy of the GNU Affero General Public License along w
 #include "FaceBehavior.h"
 #include "LookAssistant.h"
 #include "BlinkAssistant.h"
+#include "DirtyRegion.h"
 
 class Face
 {
@@ -47,12 +48,25 @@ public:
     void SetBatLevel(uint8_t level);
     // 设置音量
     void SetVolume(uint8_t volume);
+    // 眼睛边缘抗锯齿，仅 TFT 彩屏有效
+    void SetAntiAlias(bool anti_alias);
     // 设置是否只显示一行文字，其他的都不渲染，仅仅显示 notification_message_ 文字。并且居中显示
     void OnlyShowNotification(bool only_show_notification);
 
     int width() const { return width_; }
     int height() const { return height_; }
 
+    // 帧统计：绘制加发送的耗时、发送到屏幕的字节数、刷新的矩形个数
+    struct FrameStats
+    {
+        uint32_t frame_us = 0;
+        uint32_t bytes = 0;
+        uint8_t rects = 0;
+    };
+    const FrameStats &LastFrame() const { return last_frame_; }
+    // 下一帧整屏重绘，屏幕被其他代码画过之后调用
+    void Invalidate() { full_redraw_ = true; }
+
     void Update();
 
 private:
@@ -68,6 +82,33 @@ private:
     bool only_show_notification_ = false; 
     String chat_message_;
     String notification_message_;
+    int chat_x_ = 0; // 底部滚动消息当前的横坐标
+
+    // 一帧画面由这些部件按顺序叠加绘制
+    enum Widget
+    {
+        WIDGET_LEFT_EYE,
+        WIDGET_RIGHT_EYE,
+        WIDGET_NOTIFICATION,
+        WIDGET_CHAT,
+        WIDGET_WIFI,
+        WIDGET_BATTERY,
+        WIDGET_VOLUME,
+        WIDGET_COUNT
+    };
+    struct WidgetState
+    {
+        DirtyRect bounds; // 屏幕上占用的区域，为空表示本帧不显示
+        uint32_t key = 0; // 内容签名，图标部件直接存字形编码
+    };
+    WidgetState widgets_[WIDGET_COUNT]; // 当前帧（绘制后即为上一帧）
+    DirtyRegion dirty_;
+    bool full_redraw_ = true;
+    FrameStats last_frame_;
+
+    void Advance();
+    void Measure(WidgetState *state);
+    void DrawWidget(int widget);
 };
 
 #endif
\ No newline at end of file